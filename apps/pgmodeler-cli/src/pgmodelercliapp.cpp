@@ -19,6 +19,12 @@
 #include "pgmodelercliapp.h"
 #include "utilsns.h"
 #include "settings/appearanceconfigwidget.h"
+#include <QElapsedTimer>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QLocalServer>
+#include <QLocalSocket>
 
 QTextStream PgModelerCliApp::out(stdout);
 
@@ -37,6 +43,8 @@ const QString PgModelerCliApp::ExportToDict("--export-to-dict");
 const QString PgModelerCliApp::ImportDb("--import-db");
 const QString PgModelerCliApp::NoIndex("--no-index");
 const QString PgModelerCliApp::Split("--split");
+const QString PgModelerCliApp::Incremental("--incremental");
+const QString PgModelerCliApp::Threads("--threads");
 const QString PgModelerCliApp::DependenciesSql("--dependencies");
 const QString PgModelerCliApp::ChildrenSql("--children");
 const QString PgModelerCliApp::Diff("--diff");
@@ -93,6 +101,11 @@ const QString PgModelerCliApp::ForceRecreateObjs("--force-recreate-objs");
 const QString PgModelerCliApp::OnlyUnmodifiable("--only-unmodifiable");
 const QString PgModelerCliApp::CreateConfigs("--create-configs");
 const QString PgModelerCliApp::MissingOnly("--missing-only");
+const QString PgModelerCliApp::Batch("--batch");
+const QString PgModelerCliApp::Server("--server");
+
+const QString PgModelerCliApp::BatchCmdQuit("quit");
+const QString PgModelerCliApp::BatchCmdUnload("unload");
 
 const QString PgModelerCliApp::TagExpr("<%1");
 const QString PgModelerCliApp::EndTagExpr("</%1");
@@ -123,7 +136,9 @@ attribs_map PgModelerCliApp::short_opts = {
 	{ NoSequenceReuse, "-ns" },	{ NoCascadeDrop, "-nd" },	{ ForceRecreateObjs, "-nf" },
 	{ OnlyUnmodifiable, "-nu" },	{ NoIndex, "-ni" },	{ Split, "-sp" },
 	{ SystemWide, "-sw" },	{ CreateConfigs, "-cc" }, { Force, "-ff" },
-	{ MissingOnly, "-mo" }, { DependenciesSql, "-ds" }, { ChildrenSql, "-cs" }
+	{ MissingOnly, "-mo" }, { DependenciesSql, "-ds" }, { ChildrenSql, "-cs" },
+	{ Incremental, "-in" }, { Threads, "-th" },
+	{ Batch, "-bt" }, { Server, "-sv" }
 };
 
 std::map<QString, bool> PgModelerCliApp::long_opts = {
@@ -148,15 +163,17 @@ std::map<QString, bool> PgModelerCliApp::long_opts = {
 	{ ForceRecreateObjs, false },	{ OnlyUnmodifiable, false },	{ ExportToDict, false },
 	{ NoIndex, false },	{ Split, false },	{ SystemWide, false },
 	{ CreateConfigs, false }, { Force, false }, { MissingOnly, false },
-	{ DependenciesSql, false }, { ChildrenSql, false }
+	{ DependenciesSql, false }, { ChildrenSql, false },
+	{ Incremental, false }, { Threads, true },
+	{ Batch, true }, { Server, true }
 };
 
 std::map<QString, QStringList> PgModelerCliApp::accepted_opts = {
 	{{ Attributes::Connection }, { ConnAlias, Host, Port, User, Passwd, InitialDb }},
-	{{ ExportToFile }, { Input, Output, PgSqlVer, Split, DependenciesSql, ChildrenSql }},
+	{{ ExportToFile }, { Input, Output, PgSqlVer, Split, DependenciesSql, ChildrenSql, Incremental }},
 	{{ ExportToPng },  { Input, Output, ShowGrid, ShowDelimiters, PageByPage, ZoomFactor }},
 	{{ ExportToSvg },  { Input, Output, ShowGrid, ShowDelimiters }},
-	{{ ExportToDict }, { Input, Output, Split, NoIndex }},
+	{{ ExportToDict }, { Input, Output, Split, NoIndex, Threads }},
 
 	{{ ExportToDbms }, { Input, PgSqlVer, IgnoreDuplicates, IgnoreErrorCodes,
 											 DropDatabase, DropObjects, Simulate, UseTmpNames }},
@@ -173,15 +190,15 @@ std::map<QString, QStringList> PgModelerCliApp::accepted_opts = {
 	{{ DbmMimeType }, { SystemWide, Force }},
 	{{ FixModel },	{ Input, Output, FixTries }},
 	{{ ListConns }, {}},
-	{{ CreateConfigs }, {MissingOnly, Force}}
+	{{ CreateConfigs }, {MissingOnly, Force}},
+	{{ Batch }, {}},
+	{{ Server }, {}}
 };
 
 PgModelerCliApp::PgModelerCliApp(int argc, char **argv) : Application(argc, argv)
 {
 	try
 	{
-		QString op, value, orig_op;
-		bool accepts_val=false;
 		attribs_map opts;
 		QStringList args = arguments();
 
@@ -189,6 +206,9 @@ PgModelerCliApp::PgModelerCliApp(int argc, char **argv) : Application(argc, argv
 		scene=nullptr;
 		xmlparser=nullptr;
 		zoom=1;
+		batch_mode=false;
+		reuse_model=false;
+		model_load_time=0;
 
 		export_hlp = nullptr;
 		import_hlp = nullptr;
@@ -199,85 +219,57 @@ PgModelerCliApp::PgModelerCliApp(int argc, char **argv) : Application(argc, argv
 
 		// We extract the options values only if the help option is not present
 		if(args.size() > 1 && !args.contains(Help) && !args.contains(short_opts[Help]))
-		{	
-			for(int i=1; i < argc; i++)
-			{
-				op = orig_op = argv[i];
-
-				//If the retrieved option starts with - it will be treated as a command option
-				if(op[0]=='-')
-				{
-					value.clear();
-
-					if(i < argc-1 && argv[i+1][0]!='-')
-					{
-						//If the next option does not starts with '-', is considered a value
-						value=argv[++i];
-					}
-
-					//Raises an error if the option is not recognized
-					if(!isOptionRecognized(op, accepts_val))
-						throw Exception(tr("Unrecognized option `%1'.").arg(orig_op), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-
-					//Raises an error if the value is empty and the option accepts a value
-					if(accepts_val && value.isEmpty())
-						throw Exception(tr("Value not specified for option `%1'.").arg(orig_op), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-					else if(!accepts_val && !value.isEmpty())
-						throw Exception(tr("Option `%1' does not accept values.").arg(orig_op), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-
-					/* If we find a filter object parameter we append its parameter index so
-					 * its value is not replaced by the next filter parameter found */
-					if(op == FilterObjects)
-						opts[QString("%1%2").arg(op).arg(i)] = value;
-
-					opts[op] = value;
-				}
-			}
-		}
+			extractOptions(args.mid(1), opts);
 
 		//Validates and executes the options
 		parseOptions(opts);
 
 		if(!parsed_opts.empty())
 		{
-			model=new DatabaseModel;
-			xmlparser=model->getXMLParser();
-			silent_mode=(parsed_opts.count(Silent));
+			batch_mode = (parsed_opts.count(Batch) || parsed_opts.count(Server));
 
-			//If the export is to png or svg loads additional configurations
-			if(parsed_opts.count(ExportToPng) || parsed_opts.count(ExportToSvg) || parsed_opts.count(ImportDb))
+			/* Enabling the binary snapshots of the loaded models so reopening an unchanged model file
+			 * skips the XML parsing. In case of failure the models are just loaded without snapshots */
+			try
 			{
-				connect(model, &DatabaseModel::s_objectAdded, this, &PgModelerCliApp::handleObjectAddition);
-				connect(model, &DatabaseModel::s_objectRemoved, this, &PgModelerCliApp::handleObjectRemoval);
-
-				//Load the appearance settings including grid and delimiter options
-				AppearanceConfigWidget appearance_wgt;
-				appearance_wgt.loadConfiguration();
-
-				scene=new ObjectsScene;
-				scene->setParent(this);
-				scene->setSceneRect(QRectF(0,0,2000,2000));
+				DatabaseModel::setSnapshotsDirectory(GlobalAttributes::getConfigurationsPath() +
+																						 GlobalAttributes::DirSeparator + GlobalAttributes::SnapshotsDir);
 			}
+			catch(Exception &)
+			{}
 
-			if(parsed_opts.count(ExportToDbms) || parsed_opts.count(ImportDb) || parsed_opts.count(Diff))
-			{
-				configureConnection(false);
+			/* In batch/server mode the standard output is reserved to the commands' results
+			 * so the progress messages are suppressed */
+			silent_mode=(parsed_opts.count(Silent) || batch_mode);
 
-				//Replacing the initial db parameter for the input database when reverse engineering
-				if((parsed_opts.count(ImportDb) || parsed_opts.count(Diff)) && !parsed_opts[InputDb].isEmpty())
-					connection.setConnectionParam(Connection::ParamDbName, parsed_opts[InputDb]);
+			/* In batch/server mode the models (and their scenes) are created per command
+			 * and kept in memory (see runBatchCommand()) */
+			if(!batch_mode)
+			{
+				model=new DatabaseModel;
+				xmlparser=model->getXMLParser();
 			}
 
-			if(parsed_opts.count(Diff))
+			//If the export is to png or svg loads additional configurations
+			if(parsed_opts.count(ExportToPng) || parsed_opts.count(ExportToSvg) || parsed_opts.count(ImportDb) || batch_mode)
 			{
-				configureConnection(true);
+				//Load the appearance settings including grid and delimiter options
+				AppearanceConfigWidget appearance_wgt;
+				appearance_wgt.loadConfiguration();
 
-				if(!extra_connection.isConfigured())
-					extra_connection = connection;
+				if(!batch_mode)
+				{
+					connect(model, &DatabaseModel::s_objectAdded, this, &PgModelerCliApp::handleObjectAddition);
+					connect(model, &DatabaseModel::s_objectRemoved, this, &PgModelerCliApp::handleObjectRemoval);
 
-				extra_connection.setConnectionParam(Connection::ParamDbName, parsed_opts[CompareTo]);
+					scene=new ObjectsScene;
+					scene->setParent(this);
+					scene->setSceneRect(QRectF(0,0,2000,2000));
+				}
 			}
 
+			setupConnections();
+
 			if(!silent_mode && export_hlp && import_hlp && diff_hlp)
 			{
 				connect(export_hlp, &ModelExportHelper::s_progressUpdated, this, &PgModelerCliApp::updateProgress);
@@ -295,6 +287,8 @@ PgModelerCliApp::PgModelerCliApp(int argc, char **argv) : Application(argc, argv
 
 PgModelerCliApp::~PgModelerCliApp()
 {
+	clearCachedModels();
+
 	if(scene)
 		delete scene;
 
@@ -330,6 +324,68 @@ void PgModelerCliApp::printMessage(const QString &txt)
 		printText(txt);
 }
 
+void PgModelerCliApp::extractOptions(const QStringList &args, attribs_map &opts)
+{
+	QString op, value, orig_op;
+	bool accepts_val=false;
+
+	for(int i=0; i < args.size(); i++)
+	{
+		op = orig_op = args[i];
+
+		//If the retrieved option starts with - it will be treated as a command option
+		if(op.startsWith('-'))
+		{
+			value.clear();
+
+			if(i < args.size()-1 && !args[i+1].startsWith('-'))
+			{
+				//If the next option does not starts with '-', is considered a value
+				value=args[++i];
+			}
+
+			//Raises an error if the option is not recognized
+			if(!isOptionRecognized(op, accepts_val))
+				throw Exception(tr("Unrecognized option `%1'.").arg(orig_op), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			//Raises an error if the value is empty and the option accepts a value
+			if(accepts_val && value.isEmpty())
+				throw Exception(tr("Value not specified for option `%1'.").arg(orig_op), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			else if(!accepts_val && !value.isEmpty())
+				throw Exception(tr("Option `%1' does not accept values.").arg(orig_op), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			/* If we find a filter object parameter we append its parameter index so
+			 * its value is not replaced by the next filter parameter found */
+			if(op == FilterObjects)
+				opts[QString("%1%2").arg(op).arg(i)] = value;
+
+			opts[op] = value;
+		}
+	}
+}
+
+void PgModelerCliApp::setupConnections()
+{
+	if(parsed_opts.count(ExportToDbms) || parsed_opts.count(ImportDb) || parsed_opts.count(Diff))
+	{
+		configureConnection(false);
+
+		//Replacing the initial db parameter for the input database when reverse engineering
+		if((parsed_opts.count(ImportDb) || parsed_opts.count(Diff)) && !parsed_opts[InputDb].isEmpty())
+			connection.setConnectionParam(Connection::ParamDbName, parsed_opts[InputDb]);
+	}
+
+	if(parsed_opts.count(Diff))
+	{
+		configureConnection(true);
+
+		if(!extra_connection.isConfigured())
+			extra_connection = connection;
+
+		extra_connection.setConnectionParam(Connection::ParamDbName, parsed_opts[CompareTo]);
+	}
+}
+
 void PgModelerCliApp::configureConnection(bool extra_conn)
 {
 	QString chr = (extra_conn ? "1" : "");
@@ -410,6 +466,8 @@ void PgModelerCliApp::showMenu()
 	printText(tr("  %1, %2\t\t\t    Compares a model and a database or two databases generating the SQL script to sync the latter in relation to the first.").arg(short_opts[Diff]).arg(Diff));
 	printText(tr("  %1, %2\t\t    Tries to fix the structure of the input model file to make it loadable again.").arg(short_opts[FixModel]).arg(FixModel));
 	printText(tr("  %1, %2\t\t    Creates the pgModeler's configuration folder and files in the user's local storage.").arg(short_opts[CreateConfigs]).arg(CreateConfigs));
+	printText(tr("  %1, %2 [FILE]\t\t    Runs the commands in the batch file keeping the loaded models in memory between them.").arg(short_opts[Batch]).arg(Batch));
+	printText(tr("  %1, %2 [NAME]\t\t    Runs the commands received through the local socket NAME keeping the loaded models in memory between them.").arg(short_opts[Server]).arg(Server));
 #ifndef Q_OS_MAC
 	printText(tr("  %1, %2 [ACTION]\t    Handles the DBM file association to pgModeler binaries. The ACTION can be [%3 | %4].").arg(short_opts[DbmMimeType]).arg(DbmMimeType).arg(Install).arg(Uninstall));
 #endif
@@ -428,6 +486,7 @@ void PgModelerCliApp::showMenu()
 	printText(tr("  %1, %2\t\t\t    The SQL file is generated per object. The files will be named in such a way to reflect the correct creation order of the objects.").arg(short_opts[Split]).arg(Split));
 	printText(tr("  %1, %2\t\t    Includes the object's dependencies SQL code in the generated file. (Only for split mode)").arg(short_opts[DependenciesSql]).arg(DependenciesSql));
 	printText(tr("  %1, %2\t\t    Includes the object's children SQL code in the generated file. (Only for split mode)").arg(short_opts[ChildrenSql]).arg(ChildrenSql));
+	printText(tr("  %1, %2\t\t    Writes only the files whose contents changed since the previous export and removes the ones not generated anymore. A manifest of the generated files is kept in the output directory. (Only for split mode)").arg(short_opts[Incremental]).arg(Incremental));
 	printText();
 
 	printText(tr("PNG and SVG export options: "));
@@ -440,6 +499,7 @@ void PgModelerCliApp::showMenu()
 	printText(tr("Data dictionary export options: "));
 	printText(tr("  %1, %2\t\t\t    The data dictionaries are generated in separated files inside the specified output directory.").arg(short_opts[Split]).arg(Split));
 	printText(tr("  %1, %2\t\t    Avoids the generation of the index that is used to help navigate through the data dictionary.").arg(short_opts[NoIndex]).arg(NoIndex));
+	printText(tr("  %1, %2 [COUNT]\t    Amount of threads used to generate the tables dictionaries. Defaults to the number of processor cores.").arg(short_opts[Threads]).arg(Threads));
 	printText();
 
 	printText(tr("DBMS export options: "));
@@ -567,6 +627,13 @@ void PgModelerCliApp::showMenu()
 	printText(tr("   A second connection can be specified by appending a 1 to any connection configuration parameter listed above."));
 	printText(tr("   This causes the connection to be associated to %1 exclusively.").arg(CompareTo));
 	printText();
+	printText(tr("** In batch (%1) and server (%2) modes each command is a JSON object in a single line having one of the forms:").arg(Batch).arg(Server));
+	printText(tr("   * {\"%1\": \"ID\", \"%2\": [\"OPTION\", \"VALUE\", ...]} runs an export, import or diff operation using the options described above.").arg(Attributes::Id, Attributes::Arguments));
+	printText(tr("   * {\"%1\": \"%2\"} releases all the models kept in memory.").arg(Attributes::Command, BatchCmdUnload));
+	printText(tr("   * {\"%1\": \"%2\"} finishes the batch or stops the server.").arg(Attributes::Command, BatchCmdQuit));
+	printText(tr("   The result of each command is written as a JSON object in a single line containing its id, status, error message and timings (in ms)."));
+	printText(tr("   The models are reloaded only when their files change. The option %1 must be used together with %2 in these modes.").arg(ApplyDiff).arg(NoDiffPreview));
+	printText();
 }
 
 void PgModelerCliApp::listConnections()
@@ -594,15 +661,22 @@ void PgModelerCliApp::listConnections()
 
 void PgModelerCliApp::parseOptions(attribs_map &opts)
 {
+	bool run_batch = (opts.count(Batch) || opts.count(Server));
+
+	/* The settings and helpers are created only once since in batch/server mode
+	 * this method is called again for each command received */
+
 	//Loading connections
-	if(opts.count(ListConns) || opts.count(ExportToDbms) || opts.count(ImportDb) || opts.count(Diff))
+	if(!conn_conf &&
+		 (opts.count(ListConns) || opts.count(ExportToDbms) || opts.count(ImportDb) || opts.count(Diff) || run_batch))
 	{
 		conn_conf = new ConnectionsConfigWidget;
 		conn_conf->loadConfiguration();
 		conn_conf->getConnections(connections, false);
 	}
+
 	//Loading general and relationship settings when exporting to image formats
-	else if(opts.count(ExportToPng) || opts.count(ExportToSvg))
+	if(!general_conf && (opts.count(ExportToPng) || opts.count(ExportToSvg) || run_batch))
 	{
 		general_conf = new GeneralConfigWidget;
 		rel_conf = new RelationshipConfigWidget;
@@ -612,10 +686,11 @@ void PgModelerCliApp::parseOptions(attribs_map &opts)
 	}
 
 	//Creating the export/import/diff helpers when one of the operations are specified
-	if(opts.count(ExportToDbms) || opts.count(ExportToFile) ||
-		 opts.count(ExportToPng) || opts.count(ExportToSvg) ||
-		 opts.count(ExportToDict) || opts.count(ImportDb) ||
-		 opts.count(Diff))
+	if(!export_hlp &&
+		 (opts.count(ExportToDbms) || opts.count(ExportToFile) ||
+			opts.count(ExportToPng) || opts.count(ExportToSvg) ||
+			opts.count(ExportToDict) || opts.count(ImportDb) ||
+			opts.count(Diff) || run_batch))
 	{
 		export_hlp = new ModelExportHelper;
 		import_hlp = new DatabaseImportHelper;
@@ -666,13 +741,13 @@ void PgModelerCliApp::parseOptions(attribs_map &opts)
 		if(!fix_model && !upd_mime && exp_mode_cnt > 1)
 			throw Exception(tr("Multiple export modes were specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		
-		if(!list_conns && !upd_mime && !import_db && !diff && !create_configs && !opts.count(Input))
+		if(!list_conns && !upd_mime && !import_db && !diff && !create_configs && !run_batch && !opts.count(Input))
 			throw Exception(tr("No input file was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 		if(import_db && !opts.count(InputDb))
 			throw Exception(tr("No input database was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-		if(!opts.count(ExportToDbms) && !upd_mime && !list_conns && !diff && !create_configs && !opts.count(Output))
+		if(!opts.count(ExportToDbms) && !upd_mime && !list_conns && !diff && !create_configs && !run_batch && !opts.count(Output))
 			throw Exception(tr("No output file was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		
 		if(!opts.count(ExportToDbms) && !upd_mime && !import_db && !list_conns && !create_configs &&
@@ -701,6 +776,12 @@ void PgModelerCliApp::parseOptions(attribs_map &opts)
 				throw Exception(tr("The options `%1' and `%2' can't be used at the same time!").arg(DependenciesSql, ChildrenSql), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		}
 
+		if(opts.count(Threads) && opts[Threads].toUInt() == 0)
+			throw Exception(tr("Invalid amount of threads specified for the option `%1'!").arg(Threads), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		if(opts.count(Incremental) && (!opts.count(ExportToFile) || !opts.count(Split)))
+			throw Exception(tr("The option `%1' must be used together with the split mode option `%2'!").arg(Incremental, Split), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
 		if(diff)
 		{
 			if(!opts.count(Input) && !opts.count(InputDb))
@@ -823,20 +904,12 @@ int PgModelerCliApp::exec()
 		{
 			showVersionInfo();
 
-			if(parsed_opts.count(ListConns))
-				 listConnections();
-			else if(parsed_opts.count(FixModel))
-				fixModel();
-			else if(parsed_opts.count(DbmMimeType))
-				updateMimeType();
-			else if(parsed_opts.count(CreateConfigs))
-				createConfigurations();
-			else if(parsed_opts.count(ImportDb))
-				importDatabase();
-			else if(parsed_opts.count(Diff))
-				diffModelDatabase();
+			if(parsed_opts.count(Batch))
+				return runBatch();
+			else if(parsed_opts.count(Server))
+				runServer();
 			else
-				exportModel();
+				runOperation();
 		}
 
 		return 0;
@@ -847,6 +920,344 @@ int PgModelerCliApp::exec()
 	}
 }
 
+void PgModelerCliApp::runOperation()
+{
+	if(parsed_opts.count(ListConns))
+		 listConnections();
+	else if(parsed_opts.count(FixModel))
+		fixModel();
+	else if(parsed_opts.count(DbmMimeType))
+		updateMimeType();
+	else if(parsed_opts.count(CreateConfigs))
+		createConfigurations();
+	else if(parsed_opts.count(ImportDb))
+		importDatabase();
+	else if(parsed_opts.count(Diff))
+		diffModelDatabase();
+	else
+		exportModel();
+}
+
+int PgModelerCliApp::runBatch()
+{
+	QFile input(parsed_opts[Batch]);
+	QElapsedTimer timer;
+	QByteArray line;
+	QJsonObject summary;
+	unsigned cmd_count = 0, fail_count = 0;
+	bool quit = false, success = false;
+
+	if(!input.open(QFile::ReadOnly | QFile::Text))
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(parsed_opts[Batch]),
+										ErrorCode::FileDirectoryNotAccessed,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	timer.start();
+
+	while(!quit && !input.atEnd())
+	{
+		line = input.readLine().trimmed();
+
+		// Empty lines and comments (lines starting with #) are ignored
+		if(line.isEmpty() || line.startsWith('#'))
+			continue;
+
+		out << runBatchCommand(line, quit, success) << Qt::endl;
+		cmd_count++;
+
+		if(!success)
+			fail_count++;
+	}
+
+	summary["commands"] = static_cast<qint64>(cmd_count);
+	summary["failed"] = static_cast<qint64>(fail_count);
+	summary["elapsed-ms"] = timer.elapsed();
+	out << QJsonDocument(summary).toJson(QJsonDocument::Compact) << Qt::endl;
+
+	return (fail_count > 0 ? -1 : 0);
+}
+
+void PgModelerCliApp::runServer()
+{
+	QLocalServer server;
+	QLocalSocket *socket = nullptr, check_socket;
+	QByteArray line;
+	bool quit = false, success = false, last_line = false;
+
+	/* Checking if the local socket is in use before listening on it. A socket file left by a server
+	 * that wasn't properly finished (nobody accepts connections on it) is removed, otherwise the
+	 * server is not started so the socket of another running server is never taken over */
+	check_socket.connectToServer(parsed_opts[Server]);
+
+	if(check_socket.waitForConnected(ServerCheckTimeout))
+	{
+		check_socket.disconnectFromServer();
+		throw Exception(tr("The local socket `%1' is already in use by another server!").arg(parsed_opts[Server]),
+										ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	if(check_socket.error() == QLocalSocket::ConnectionRefusedError)
+		QLocalServer::removeServer(parsed_opts[Server]);
+
+	// Only the user running the server is allowed to connect to it
+	server.setSocketOptions(QLocalServer::UserAccessOption);
+
+	if(!server.listen(parsed_opts[Server]))
+		throw Exception(tr("Failed to listen on the local socket `%1'! %2").arg(parsed_opts[Server], server.errorString()),
+										ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	printText(tr("Listening on local socket: %1").arg(server.fullServerName()));
+
+	/* The clients are served one at a time and their commands are executed in the order they are received
+	 * since all of them share the same helpers and loaded models */
+	while(!quit && server.waitForNewConnection(-1))
+	{
+		socket = server.nextPendingConnection();
+		last_line = false;
+
+		while(!quit && !last_line)
+		{
+			if(!socket->canReadLine() && !socket->waitForReadyRead(ClientTimeout))
+			{
+				// The client is idle for too long, so it's disconnected allowing the next one to be served
+				if(socket->state() == QLocalSocket::ConnectedState)
+				{
+					printText(tr("Disconnecting the client idle for more than %1 seconds.").arg(ClientTimeout / 1000));
+					break;
+				}
+
+				// The client disconnected, the remaining data (if any) is treated as the last command
+				last_line = true;
+
+				if(socket->bytesAvailable() == 0)
+					break;
+			}
+
+			if(!socket->canReadLine() && !last_line)
+				continue;
+
+			line = (last_line ? socket->readAll() : socket->readLine()).trimmed();
+
+			if(line.isEmpty())
+				continue;
+
+			socket->write(runBatchCommand(line, quit, success) + '\n');
+			socket->flush();
+
+			if(socket->state() == QLocalSocket::ConnectedState && !socket->waitForBytesWritten(ClientTimeout))
+			{
+				if(socket->bytesToWrite() > 0)
+				{
+					printText(tr("Disconnecting the client that didn't receive the result of the command in %1 seconds.").arg(ClientTimeout / 1000));
+					break;
+				}
+			}
+		}
+
+		socket->abort();
+		delete socket;
+	}
+
+	server.close();
+}
+
+QByteArray PgModelerCliApp::runBatchCommand(const QByteArray &cmd_line, bool &quit, bool &success)
+{
+	QJsonParseError parse_err;
+	QJsonDocument cmd_doc = QJsonDocument::fromJson(cmd_line, &parse_err);
+	QJsonObject cmd = cmd_doc.object(), result;
+	QElapsedTimer timer;
+
+	timer.start();
+	success = false;
+	reuse_model = false;
+	model_load_time = 0;
+
+	if(cmd.contains(Attributes::Id))
+		result[Attributes::Id] = cmd[Attributes::Id];
+
+	try
+	{
+		if(parse_err.error != QJsonParseError::NoError || !cmd_doc.isObject())
+			throw Exception(tr("Invalid batch command! Each command must be a JSON object in a single line. %1").arg(parse_err.errorString()),
+											ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		if(cmd.contains(Attributes::Command))
+		{
+			QString cmd_name = cmd[Attributes::Command].toString();
+
+			if(cmd_name == BatchCmdQuit)
+				quit = true;
+			else if(cmd_name == BatchCmdUnload)
+				clearCachedModels();
+			else
+				throw Exception(tr("Unknown batch command `%1'!").arg(cmd_name), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			result[Attributes::Command] = cmd_name;
+		}
+		else
+		{
+			QStringList args;
+			attribs_map opts;
+
+			for(auto arg : cmd[Attributes::Arguments].toArray())
+				args.append(arg.toVariant().toString());
+
+			extractOptions(args, opts);
+
+			if(opts.empty())
+				throw Exception(tr("No operation mode was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			for(auto &op : { Help, ListConns, FixModel, DbmMimeType, CreateConfigs, Batch, Server })
+			{
+				if(opts.count(op))
+					throw Exception(tr("The option `%1' is not accepted in batch mode!").arg(op), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			}
+
+			// Resetting the state left by the previous command
+			zoom = 1;
+			obj_filters.clear();
+			start_date = end_date = QDateTime();
+			connection = Connection();
+			extra_connection = Connection();
+			export_hlp->setIgnoredErrors({});
+			parsed_opts.clear();
+
+			parseOptions(opts);
+
+			// There's no terminal to show the diff preview and ask for the user's confirmation
+			if(parsed_opts.count(ApplyDiff) && !parsed_opts.count(NoDiffPreview))
+				throw Exception(tr("The option `%1' must be used together with `%2' in batch mode!").arg(ApplyDiff, NoDiffPreview),
+												ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			for(auto &itr : accepted_opts)
+			{
+				if(itr.first != Attributes::Connection && parsed_opts.count(itr.first))
+				{
+					result["operation"] = itr.first;
+					break;
+				}
+			}
+
+			setupConnections();
+			setupBatchModel();
+
+			try
+			{
+				runOperation();
+			}
+			catch(Exception &e)
+			{
+				releaseBatchModel(false);
+				throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+			}
+
+			result["reused-model"] = reuse_model;
+			result["load-ms"] = model_load_time;
+			releaseBatchModel(true);
+		}
+
+		success = true;
+		result["status"] = "ok";
+	}
+	catch(Exception &e)
+	{
+		result["status"] = "error";
+		result["error"] = e.getExceptionsText().trimmed();
+	}
+
+	result["elapsed-ms"] = timer.elapsed();
+	return QJsonDocument(result).toJson(QJsonDocument::Compact);
+}
+
+void PgModelerCliApp::setupBatchModel()
+{
+	QString input = parsed_opts[Input];
+
+	reuse_model = false;
+
+	if(!input.isEmpty() && cached_models.count(input))
+	{
+		CachedModel &cached = cached_models[input];
+		QFileInfo fi(input);
+
+		// The model is reused only if its file was not changed since the last loading
+		if(cached.last_modified == fi.lastModified() && cached.file_size == fi.size())
+		{
+			model = cached.model;
+			scene = cached.scene;
+			reuse_model = true;
+			return;
+		}
+
+		destroyCachedModel(cached);
+		cached_models.erase(input);
+	}
+
+	model = new DatabaseModel;
+	scene = nullptr;
+
+	/* The scene is created only for models loaded from files since they
+	 * can be cached and eventually used by a later export to PNG or SVG */
+	if(!input.isEmpty())
+	{
+		connect(model, &DatabaseModel::s_objectAdded, this, &PgModelerCliApp::handleObjectAddition);
+		connect(model, &DatabaseModel::s_objectRemoved, this, &PgModelerCliApp::handleObjectRemoval);
+
+		scene = new ObjectsScene;
+		scene->setSceneRect(QRectF(0,0,2000,2000));
+	}
+}
+
+void PgModelerCliApp::releaseBatchModel(bool cache_model)
+{
+	QString input = parsed_opts[Input];
+
+	if(!reuse_model)
+	{
+		CachedModel cached;
+
+		cached.model = model;
+		cached.scene = scene;
+
+		if(cache_model && !input.isEmpty())
+		{
+			QFileInfo fi(input);
+
+			cached.last_modified = fi.lastModified();
+			cached.file_size = fi.size();
+			cached_models[input] = cached;
+		}
+		else
+			destroyCachedModel(cached);
+	}
+
+	model = nullptr;
+	scene = nullptr;
+}
+
+void PgModelerCliApp::destroyCachedModel(CachedModel &cached)
+{
+	if(!cached.model)
+		return;
+
+	disconnect(cached.model, nullptr, this, nullptr);
+
+	if(cached.scene)
+		delete cached.scene;
+
+	delete cached.model;
+	cached.model = nullptr;
+	cached.scene = nullptr;
+}
+
+void PgModelerCliApp::clearCachedModels()
+{
+	for(auto &itr : cached_models)
+		destroyCachedModel(itr.second);
+
+	cached_models.clear();
+}
+
 void PgModelerCliApp::updateProgress(int progress, QString msg, ObjectType)
 {
 	if(progress > 0)
@@ -1720,12 +2131,25 @@ void PgModelerCliApp::fixModel()
 
 void PgModelerCliApp::loadModel()
 {
+	// In batch/server mode the model may be already loaded by a previous command
+	if(reuse_model)
+	{
+		printMessage(tr("Reusing the model loaded in memory."));
+		return;
+	}
+
+	QElapsedTimer timer;
+	timer.start();
+
 	//Create the systems objects on model before loading it
 	model->createSystemObjects(false);
 
 	//Load the model file
 	model->loadModel(parsed_opts[Input]);
 
+	for(auto &[phase, msecs] : model->getLoadingTimes())
+		printMessage(tr("%1: %2 ms").arg(phase).arg(msecs));
+
 	/* The scene object is created only when some options are used
 	 * so we need to check it if is not null to avoid segfaults */
 	if(scene)
@@ -1742,6 +2166,8 @@ void PgModelerCliApp::loadModel()
 
 		scene->blockSignals(false);
 	}
+
+	model_load_time = timer.elapsed();
 }
 
 void PgModelerCliApp::exportModel()
@@ -1786,7 +2212,8 @@ void PgModelerCliApp::exportModel()
 			printMessage(tr("Export to output directory: %1").arg(parsed_opts[Output]));
 
 		export_hlp->exportToSQL(model, parsed_opts[Output], parsed_opts[PgSqlVer],
-														parsed_opts.count(Split) > 0, code_gen_option);
+														parsed_opts.count(Split) > 0, code_gen_option,
+														parsed_opts.count(Incremental) > 0);
 	}
 	//Export data dictionary
 	else if(parsed_opts.count(ExportToDict))
@@ -1794,7 +2221,8 @@ void PgModelerCliApp::exportModel()
 		printMessage(tr("Export to data dictionary: %1").arg(parsed_opts[Output]));
 		export_hlp->exportToDataDict(model, parsed_opts[Output],
 																 parsed_opts.count(NoIndex) == 0,
-																 parsed_opts.count(Split) > 0);
+																 parsed_opts.count(Split) > 0,
+																 parsed_opts[Threads].toUInt());
 	}
 	//Export to DBMS
 	else
@@ -1896,7 +2324,7 @@ void PgModelerCliApp::importDatabase(DatabaseModel *model, Connection conn)
 
 void PgModelerCliApp::diffModelDatabase()
 {
-	DatabaseModel *model_aux = new DatabaseModel();
+	DatabaseModel model_aux;
 	QString dbname;
 	std::vector<BaseObject *> filtered_objs;
 
@@ -1960,9 +2388,9 @@ void PgModelerCliApp::diffModelDatabase()
 	}
 
 	printMessage(tr("Importing the database `%1'...").arg(dbname));
-	importDatabase(model_aux, extra_connection);
+	importDatabase(&model_aux, extra_connection);
 
-	diff_hlp->setModels(model, model_aux);
+	diff_hlp->setModels(model, &model_aux);
 	diff_hlp->setFilteredObjects(filtered_objs);
 	diff_hlp->setDiffOption(ModelsDiffHelper::OptKeepClusterObjs, !parsed_opts.count(DropClusterObjs));
 	diff_hlp->setDiffOption(ModelsDiffHelper::OptCascadeMode, !parsed_opts.count(NoCascadeDrop));
@@ -44,6 +44,23 @@ class PgModelerCliApp: public Application {
 	private:
 		Q_OBJECT
 
+		//! \brief Stores a model kept in memory by the batch/server mode together with the state of its file when loaded
+		struct CachedModel {
+			DatabaseModel *model;
+			ObjectsScene *scene;
+			QDateTime last_modified;
+			qint64 file_size;
+
+			CachedModel() : model(nullptr), scene(nullptr), file_size(0) {}
+		};
+
+		/*! \brief Time (in ms) the server mode waits for a client to send a command or to receive a result
+		 * before disconnecting it, so an idle client doesn't block the others indefinitely */
+		static constexpr int ClientTimeout = 60000;
+
+		//! \brief Time (in ms) the server mode waits to check if another server is listening on the same local socket
+		static constexpr int ServerCheckTimeout = 1000;
+
 		XmlParser *xmlparser;
 
 		//! \brief Holds the pgModeler version in which the model was construted (used by the fix operation)
@@ -121,6 +138,18 @@ class PgModelerCliApp: public Application {
 		//! \brief Stores the changelog of the model that is being fixed to reproduce it in the output model
 		QString changelog;
 
+		//! \brief Indicates if the cli is running commands from a batch file or a local socket
+		bool batch_mode,
+
+		//! \brief Indicates that the model of the current batch command is already loaded (see setupBatchModel())
+		reuse_model;
+
+		//! \brief Time (in ms) spent loading the input model of the current operation
+		qint64 model_load_time;
+
+		//! \brief The models loaded by the batch commands indexed by the absolute paths of their files
+		std::map<QString, CachedModel> cached_models;
+
 		static const QRegularExpression PasswordRegExp;
 		static const QString PasswordPlaceholder;
 
@@ -163,6 +192,8 @@ class PgModelerCliApp: public Application {
 		SystemWide,
 		NoIndex,
 		Split,
+		Incremental,
+		Threads,
 		OriginalSql,
 		DependenciesSql,
 		ChildrenSql,
@@ -198,6 +229,11 @@ class PgModelerCliApp: public Application {
 		CreateConfigs,
 		MissingOnly,
 
+		Batch,
+		Server,
+		BatchCmdQuit,
+		BatchCmdUnload,
+
 		TagExpr,
 		EndTagExpr,
 		AttributeExpr,
@@ -205,9 +241,42 @@ class PgModelerCliApp: public Application {
 		MsgFileAssociated,
 		MsgNoFileAssociation;
 
+		//! \brief Extracts the options and their values from the provided arguments list
+		void extractOptions(const QStringList &args, attribs_map &opts);
+
 		//! \brief Parsers the options and executes the action specified by them
 		void parseOptions(attribs_map &parsed_opts);
 
+		//! \brief Configures the connection(s) used by the current operation from the parsed options
+		void setupConnections();
+
+		//! \brief Executes the operation specified by the parsed options
+		void runOperation();
+
+		/*! \brief Runs the commands (one JSON object per line) from the batch file writing the result of each one
+		 * to the stdout. Returns a non-zero value if any command failed */
+		int runBatch();
+
+		/*! \brief Listens on a local socket (UNIX domain socket or named pipe on Windows) running the commands
+		 * sent by the clients and writing back their results until the command "quit" is received */
+		void runServer();
+
+		/*! \brief Runs a single batch command returning its result as a JSON object in a single line.
+		 * A command is either {"arguments": [...]} containing the same options accepted by the command line
+		 * or {"command": "quit|unload"}. An optional "id" attribute is copied to the result */
+		QByteArray runBatchCommand(const QByteArray &cmd_line, bool &quit, bool &success);
+
+		/*! \brief Configures the model (and scene) used by the current batch command reusing the one
+		 * in memory when the input file was already loaded and was not changed since then */
+		void setupBatchModel();
+
+		/*! \brief Stores the model loaded by the current batch command in memory when cache_model is true,
+		 * otherwise destroys it. Models reused from the memory are kept untouched */
+		void releaseBatchModel(bool cache_model);
+
+		void destroyCachedModel(CachedModel &cached);
+		void clearCachedModels();
+
 		//! \brief Shows the options menu
 		void showMenu();
 
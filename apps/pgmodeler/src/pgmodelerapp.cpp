@@ -19,6 +19,8 @@
 #include "globalattributes.h"
 #include "messagebox.h"
 #include "attributes.h"
+#include "databasemodel.h"
+#include "tools/databaseimportcache.h"
 #include <QScreen>
 
 PgModelerApp::PgModelerApp(int &argc, char **argv) : Application(argc,argv)
@@ -69,6 +71,26 @@ PgModelerApp::PgModelerApp(int &argc, char **argv) : Application(argc,argv)
 		}
 	}
 
+	/* Enabling the binary snapshots of the loaded models so reopening an unchanged model file
+	 * skips the XML parsing. In case of failure the models are just loaded without snapshots */
+	try
+	{
+		DatabaseModel::setSnapshotsDirectory(GlobalAttributes::getConfigurationsPath() +
+																				 GlobalAttributes::DirSeparator + GlobalAttributes::SnapshotsDir);
+	}
+	catch(Exception &)
+	{}
+
+	/* Enabling the cache of the models imported by the diff process (incremental import).
+	 * In case of failure the databases are always fully imported */
+	try
+	{
+		DatabaseImportCache::setCacheDirectory(GlobalAttributes::getConfigurationsPath() +
+																					 GlobalAttributes::DirSeparator + GlobalAttributes::ImportCachesDir);
+	}
+	catch(Exception &)
+	{}
+
 	//Trying to identify if the user defined a custom UI language in the pgmodeler.conf file
 	QString lang_id = GlobalAttributes::getConfigParamFromFile(Attributes::UiLanguage, GlobalAttributes::GeneralConf);
 
@@ -10,11 +10,17 @@ DEFINES += CONNECTOR_SYMBOLS
 HEADERS += src/connectorglobal.h \
 	   src/resultset.h \
 	   src/connection.h \
-	   src/catalog.h
+	   src/catalog.h \
+	   src/catalogcache.h \
+	   src/completionindex.h \
+	   src/completioncatalog.h
 
 SOURCES += src/resultset.cpp \
 	   src/connection.cpp \
-	   src/catalog.cpp
+	   src/catalog.cpp \
+	   src/catalogcache.cpp \
+	   src/completionindex.cpp \
+	   src/completioncatalog.cpp
 
 unix|windows: LIBS += $$PGSQL_LIB \
 		      $$LIBCORE_LIB \
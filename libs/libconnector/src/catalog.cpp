@@ -16,6 +16,7 @@
 # Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
 */
 #include "catalog.h"
+#include "catalogcache.h"
 #include "coreutilsns.h"
 #include "utilsns.h"
 
@@ -24,6 +25,7 @@ const QString Catalog::QueryAttribs("attribs");
 const QString Catalog::PgSqlTrue("t");
 const QString Catalog::PgSqlFalse("f");
 const QString Catalog::BoolField("_bool");
+const QString Catalog::ChangedNamesCacheId("-- changed names\n");
 const QString Catalog::ArrayPattern("((\\[)[0-9]+(\\:)[0-9]+(\\])=)?(\\{)((.)+(,)*)*(\\})$");
 const QString Catalog::PgModelerTempDbObj("__pgmodeler_tmp");
 const QString Catalog::InvFilterPattern("__invalid__pattern__");
@@ -82,6 +84,7 @@ std::map<ObjectType, QString> Catalog::name_fields=
 Catalog::Catalog()
 {
 	match_signature = true;
+	use_cache = true;
 	last_sys_oid=0;
 	setQueryFilter(ExclExtensionObjs | ExclSystemObjs);
 }
@@ -95,39 +98,37 @@ void Catalog::setConnection(Connection &conn)
 {
 	try
 	{
-		ResultSet res;
+		std::vector<attribs_map> tuples;
 		QStringList obj_oids;
 
 		connection.close();
 		connection.setConnectionParams(conn.getConnectionParams());
 		connection.connect();
 
+		/* Every time the connection is (re)configured the cached catalog results are validated
+		 * so the operations started after changes in the database don't read outdated data */
+		cache_key = CatalogCache::getConnectionKey(connection.getConnectionParams());
+		validateCache(true);
+
 		//Retrieving the last system oid
-		executeCatalogQuery(QueryList, ObjectType::Database, res, true,
-		{{Attributes::Name, conn.getConnectionParam(Connection::ParamDbName)}});
+		tuples = executeCatalogQuery(QueryList, ObjectType::Database, true,
+																 {{Attributes::Name, conn.getConnectionParam(Connection::ParamDbName)}}, true);
 
-		if(res.accessTuple(ResultSet::FirstTuple))
-		{
-			attribs_map attribs=changeAttributeNames(res.getTupleValues());
-			last_sys_oid=attribs[Attributes::LastSysOid].toUInt();
-		}
+		if(!tuples.empty())
+			last_sys_oid=tuples[0][Attributes::LastSysOid].toUInt();
 
 		//Retrieving the list of objects created by extensions
 		ext_objects.clear();
 		ext_objs_oids = "";
-		this->connection.executeDMLCommand(GetExtensionObjsSql, res);
+		tuples = executeQuery(GetExtensionObjsSql);
 
-		if(res.accessTuple(ResultSet::FirstTuple))
+		for(auto &tuple : tuples)
 		{
-			do
-			{
-				obj_oids.append(res.getColumnValue(Attributes::Oid));
-				ext_objects[res.getColumnValue(Attributes::Name)].append(res.getColumnValue(Attributes::Oid));
-			}
-			while(res.accessTuple(ResultSet::NextTuple));
-
-			ext_objs_oids = obj_oids.join(',');
+			obj_oids.append(tuple[Attributes::Oid]);
+			ext_objects[tuple[Attributes::Name]].append(tuple[Attributes::Oid]);
 		}
+
+		ext_objs_oids = obj_oids.join(',');
 	}
 	catch(Exception &e)
 	{
@@ -485,11 +486,114 @@ QString Catalog::getCatalogQuery(const QString &qry_type, ObjectType obj_type, b
 	return sql;
 }
 
-void Catalog::executeCatalogQuery(const QString &qry_type, ObjectType obj_type, ResultSet &result, bool single_result, attribs_map attribs)
+void Catalog::setCacheEnabled(bool value)
+{
+	use_cache = value;
+}
+
+bool Catalog::isCacheEnabled()
 {
+	return use_cache;
+}
+
+bool Catalog::validateCache(bool force)
+{
+	if(!use_cache || cache_key.isEmpty() || !CatalogCache::isCacheEnabled())
+		return false;
+
+	if(!CatalogCache::isProbeRequired(cache_key, force))
+		return true;
+
 	try
 	{
-		connection.executeDMLCommand(getCatalogQuery(qry_type, obj_type, single_result, attribs), result);
+		ResultSet res;
+		attribs_map attribs;
+
+		loadCatalogQuery(Attributes::CatalogProbe);
+		schparser.ignoreUnkownAttributes(true);
+		schparser.ignoreEmptyAttributes(true);
+		connection.executeDMLCommand(schparser.getSourceCode(attribs).simplified(), res);
+
+		if(!res.accessTuple(ResultSet::FirstTuple))
+			return false;
+
+		CatalogCache::updateProbeValue(cache_key, res.getColumnValue(Attributes::CatalogProbe));
+		return true;
+	}
+	catch(Exception &)
+	{
+		/* If the probe query can't be executed (e.g. lack of privileges) the catalog is
+		 * read directly from the database since we can't tell if the cached results are up to date */
+		CatalogCache::invalidate(cache_key);
+		return false;
+	}
+}
+
+std::vector<attribs_map> Catalog::executeQuery(const QString &sql, bool change_names)
+{
+	ResultSet res;
+	std::vector<attribs_map> tuples;
+	unsigned generation = 0;
+	bool cached = validateCache(false);
+
+	/* Results with changed attribute names are cached apart from the raw ones
+	 * since the same query may be executed both ways */
+	QString cache_qry = change_names ? ChangedNamesCacheId + sql : sql;
+
+	if(cached && CatalogCache::getResult(cache_key, cache_qry, tuples, generation))
+		return tuples;
+
+	connection.executeDMLCommand(sql, res);
+
+	if(res.accessTuple(ResultSet::FirstTuple))
+	{
+		/* The attribute names (and the ones that hold boolean values) are resolved once per result
+		 * so the tuples share the same name strings and no name lookup is made per tuple */
+		QStringList attr_names = res.getColumnNames();
+		std::vector<bool> bool_attrs(attr_names.size(), false);
+		int col_cnt = attr_names.size();
+
+		for(int col = 0; change_names && col < col_cnt; col++)
+		{
+			if(attr_names[col].endsWith(BoolField))
+			{
+				attr_names[col].remove(BoolField);
+				bool_attrs[col] = true;
+			}
+
+			attr_names[col].replace('_','-');
+		}
+
+		tuples.reserve(res.getTupleCount());
+
+		do
+		{
+			attribs_map tuple;
+
+			for(int col = 0; col < col_cnt; col++)
+			{
+				if(bool_attrs[col])
+					tuple[attr_names[col]] = res.getColumnLatin1(col) == PgSqlFalse ? "" : Attributes::True;
+				else
+					tuple[attr_names[col]] = res.getColumnString(col);
+			}
+
+			tuples.push_back(std::move(tuple));
+		}
+		while(res.accessTuple(ResultSet::NextTuple));
+	}
+
+	if(cached)
+		CatalogCache::storeResult(cache_key, cache_qry, tuples, generation);
+
+	return tuples;
+}
+
+std::vector<attribs_map> Catalog::executeCatalogQuery(const QString &qry_type, ObjectType obj_type, bool single_result, attribs_map attribs, bool change_names)
+{
+	try
+	{
+		return executeQuery(getCatalogQuery(qry_type, obj_type, single_result, attribs), change_names);
 	}
 	catch(Exception &e)
 	{
@@ -502,14 +606,7 @@ unsigned Catalog::getObjectCount(ObjectType obj_type, const QString &sch_name, c
 {
 	try
 	{
-		ResultSet res;
-
-		extra_attribs[Attributes::Schema]=sch_name;
-		extra_attribs[Attributes::Table]=tab_name;
-
-		executeCatalogQuery(QueryList, obj_type, res, false, extra_attribs);
-		res.accessTuple(ResultSet::FirstTuple);
-		return res.getTupleCount();
+		return getObjectsCount({ obj_type }, sch_name, tab_name, extra_attribs)[obj_type];
 	}
 	catch(Exception &e)
 	{
@@ -599,21 +696,13 @@ attribs_map Catalog::getObjectsNames(ObjectType obj_type, const QString &sch_nam
 {
 	try
 	{
-		ResultSet res;
 		attribs_map objects;
 
 		extra_attribs[Attributes::Schema]=sch_name;
 		extra_attribs[Attributes::Table]=tab_name;
-		executeCatalogQuery(QueryList, obj_type, res, false, extra_attribs);
 
-		if(res.accessTuple(ResultSet::FirstTuple))
-		{
-			do
-			{
-				objects[res.getColumnValue(Attributes::Oid)]=res.getColumnValue(Attributes::Name);
-			}
-			while(res.accessTuple(ResultSet::NextTuple));
-		}
+		for(auto &tuple : executeCatalogQuery(QueryList, obj_type, false, extra_attribs))
+			objects[tuple[Attributes::Oid]]=tuple[Attributes::Name];
 
 		return objects;
 	}
@@ -623,65 +712,162 @@ attribs_map Catalog::getObjectsNames(ObjectType obj_type, const QString &sch_nam
 	}
 }
 
+QString Catalog::getListQuery(ObjectType obj_type, attribs_map attribs)
+{
+	QString sql, select_kw=QString("SELECT");
+
+	//Build the catalog query for the specified object type
+	sql=getCatalogQuery(QueryList, obj_type, false, attribs);
+
+	/* For certain objects the catalog query will be empty due to the
+	absence of that kind of element in the version of the database.
+	E.g.: Event triggers does not exists in PgSQL < 9.3 */
+	if(!sql.isEmpty())
+	{
+		//Injecting the object type integer code in order to sort the final result
+		sql.replace(sql.indexOf(select_kw), select_kw.size(),
+								QString("%1 %2 AS object_type, ").arg(select_kw).arg(enum_t(obj_type)));
+
+		sql+=QChar('\n');
+	}
+
+	return sql;
+}
+
+std::vector<attribs_map> Catalog::getObjectsNames(const QStringList &queries, bool sort_results, unsigned limit)
+{
+	std::vector<attribs_map> objects;
+
+	if(queries.isEmpty())
+		return objects;
+
+	QString sql, obj_type_attr = QString(Attributes::ObjectType).replace('-', '_'),
+			parent_type_attr = QString(Attributes::ParentType).replace('-', '_');
+	attribs_map attribs;
+
+	//Joining the generated queries by using union in order to retrieve all results at once
+	sql = QChar('(') +  queries.join(QString(") UNION (")) + QChar(')');
+
+	if(sort_results)
+		sql += QString(" ORDER BY oid, object_type");
+
+	if(limit > 0)
+		sql += QString(" LIMIT %1").arg(limit);
+
+	for(auto &tuple : executeQuery(sql))
+	{
+		attribs[Attributes::Oid]=tuple[Attributes::Oid];
+		attribs[Attributes::Name]=tuple[Attributes::Name];
+		attribs[Attributes::ObjectType]=tuple[obj_type_attr];
+		attribs[Attributes::Parent]=tuple[Attributes::Parent];
+		attribs[Attributes::ParentType]=tuple[parent_type_attr];
+		objects.push_back(attribs);
+		attribs.clear();
+	}
+
+	return objects;
+}
+
 std::vector<attribs_map> Catalog::getObjectsNames(std::vector<ObjectType> obj_types, const QString &sch_name, const QString &tab_name, attribs_map extra_attribs, bool sort_results)
 {
 	try
 	{
-		ResultSet res;
-		std::vector<attribs_map> objects;
-		QString sql, select_kw=QString("SELECT");
+		QString sql;
 		QStringList queries;
-		attribs_map attribs;
 
 		extra_attribs[Attributes::Schema]=sch_name;
 		extra_attribs[Attributes::Table]=tab_name;
 
 		for(auto &obj_type : obj_types)
 		{	
-			//Build the catalog query for the specified object type
-			sql=getCatalogQuery(QueryList, obj_type, false, extra_attribs);
+			sql=getListQuery(obj_type, extra_attribs);
 
-			/* For certain objects the catalog query will be empty due to the
-			absence of that kind of element in the version of the database.
-			E.g.: Event triggers does not exists in PgSQL < 9.3 */
 			if(!sql.isEmpty())
-			{
-				//Injecting the object type integer code in order to sort the final result
-				sql.replace(sql.indexOf(select_kw), select_kw.size(),
-										QString("%1 %2 AS object_type, ").arg(select_kw).arg(enum_t(obj_type)));
-
-				sql+=QChar('\n');
 				queries.push_back(sql);
-			}
 		}
 
-		//Joining the generated queries by using union in order to retrieve all results at once
-		sql = QChar('(') +  queries.join(QString(") UNION (")) + QChar(')');
+		return getObjectsNames(queries, sort_results, 0);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
 
-		if(sort_results)
-			sql += QString(" ORDER BY oid, object_type");
+std::map<ObjectType, unsigned> Catalog::getObjectsCount(std::vector<ObjectType> obj_types, const QString &sch_name, const QString &tab_name, attribs_map extra_attribs)
+{
+	try
+	{
+		std::map<ObjectType, unsigned> counts;
+		QString sql;
+		QStringList queries;
 
-		connection.executeDMLCommand(sql, res);
+		extra_attribs[Attributes::Schema]=sch_name;
+		extra_attribs[Attributes::Table]=tab_name;
 
-		if(res.accessTuple(ResultSet::FirstTuple))
+		for(auto &obj_type : obj_types)
 		{
-			QString obj_type_attr = QString(Attributes::ObjectType).replace('-', '_'),
-					parent_type_attr = QString(Attributes::ParentType).replace('-', '_');
+			counts[obj_type] = 0;
+			sql=getCatalogQuery(QueryList, obj_type, false, extra_attribs);
 
-			do
-			{
-				attribs[Attributes::Oid]=res.getColumnValue(Attributes::Oid);
-				attribs[Attributes::Name]=res.getColumnValue(Attributes::Name);
-				attribs[Attributes::ObjectType]=res.getColumnValue(obj_type_attr);
-				attribs[Attributes::Parent]=res.getColumnValue(Attributes::Parent);
-				attribs[Attributes::ParentType]=res.getColumnValue(parent_type_attr);
-				objects.push_back(attribs);
-				attribs.clear();
-			}
-			while(res.accessTuple(ResultSet::NextTuple));
+			//Wrapping the listing query so only the amount of objects is returned by the server
+			if(!sql.isEmpty())
+				queries.push_back(QString("SELECT %1 AS object_type, count(*) AS %2 FROM (%3\n) AS list")
+													.arg(enum_t(obj_type)).arg(Attributes::ObjCount, sql));
 		}
 
-		return objects;
+		if(queries.isEmpty())
+			return counts;
+
+		QString obj_type_attr = QString(Attributes::ObjectType).replace('-', '_');
+
+		for(auto &tuple : executeQuery(queries.join(QString(" UNION ALL "))))
+			counts[static_cast<ObjectType>(tuple[obj_type_attr].toUInt())] = tuple[Attributes::ObjCount].toUInt();
+
+		return counts;
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+std::vector<attribs_map> Catalog::findObjects(std::vector<ObjectType> obj_types, const QString &pattern, bool by_oid, unsigned limit)
+{
+	try
+	{
+		QString sql, value = pattern;
+		QStringList queries;
+		attribs_map attribs;
+
+		if(pattern.isEmpty())
+			return std::vector<attribs_map>();
+
+		/* Escaping the LIKE wildcards so the pattern is matched literally and
+		 * then the backslashes and quotes in order to use the pattern in a E'' string */
+		value.replace(QChar('\\'), QString("\\\\"));
+		value.replace(QChar('%'), QString("\\%"));
+		value.replace(QChar('_'), QString("\\_"));
+		value.replace(QChar('\\'), QString("\\\\"));
+		value.replace(QChar('\''), QString("\\'"));
+
+		for(auto &obj_type : obj_types)
+		{
+			if(by_oid)
+				attribs[Attributes::CustomFilter] = QString("%1::text LIKE E'%2%'").arg(oid_fields[obj_type], value);
+			// Objects without a name field (casts, transforms) are not searched by name
+			else if(!name_fields[obj_type].isEmpty())
+				attribs[Attributes::CustomFilter] = QString("%1 ILIKE E'%%2%'").arg(name_fields[obj_type], value);
+			else
+				continue;
+
+			sql=getListQuery(obj_type, attribs);
+
+			if(!sql.isEmpty())
+				queries.push_back(sql);
+		}
+
+		return getObjectsNames(queries, false, limit);
 	}
 	catch(Exception &e)
 	{
@@ -693,15 +879,15 @@ attribs_map Catalog::getAttributes(const QString &obj_name, ObjectType obj_type,
 {
 	try
 	{
-		ResultSet res;
 		attribs_map obj_attribs;
+		std::vector<attribs_map> tuples;
 
 		//Add the name of the object as extra attrib in order to retrieve the data only for it
 		extra_attribs[Attributes::Name]=obj_name;
-		executeCatalogQuery(QueryAttribs, obj_type, res, true, extra_attribs);
+		tuples=executeCatalogQuery(QueryAttribs, obj_type, true, extra_attribs, true);
 
-		if(res.accessTuple(ResultSet::FirstTuple))
-			obj_attribs=changeAttributeNames(res.getTupleValues());
+		if(!tuples.empty())
+			obj_attribs=std::move(tuples[0]);
 
 		/* Insert the object type as an attribute of the query result to facilitate the
 		import process on the classes that uses the Catalog */
@@ -719,26 +905,15 @@ std::vector<attribs_map> Catalog::getMultipleAttributes(ObjectType obj_type, att
 {
 	try
 	{
-		ResultSet res;
-		attribs_map tuple;
 		std::vector<attribs_map> obj_attribs;
+		QString obj_type_id = QString("%1").arg(enum_t(obj_type));
 
-		executeCatalogQuery(QueryAttribs, obj_type, res, false, extra_attribs);
-		if(res.accessTuple(ResultSet::FirstTuple))
-		{
-			do
-			{
-				tuple=changeAttributeNames(res.getTupleValues());
-
-				/* Insert the object type as an attribute of the query result to facilitate the
-				import process on the classes that uses the Catalog */
-				tuple[Attributes::ObjectType]=QString("%1").arg(enum_t(obj_type));
+		obj_attribs=executeCatalogQuery(QueryAttribs, obj_type, false, extra_attribs, true);
 
-				obj_attribs.push_back(tuple);
-				tuple.clear();
-			}
-			while(res.accessTuple(ResultSet::NextTuple));
-		}
+		/* Insert the object type as an attribute of the query result to facilitate the
+		import process on the classes that uses the Catalog */
+		for(auto &tuple : obj_attribs)
+			tuple[Attributes::ObjectType]=obj_type_id;
 
 		return obj_attribs;
 	}
@@ -752,29 +927,13 @@ std::vector<attribs_map> Catalog::getMultipleAttributes(const QString &catalog_s
 {
 	try
 	{
-		ResultSet res;
-		attribs_map tuple;
-		std::vector<attribs_map> obj_attribs;
-
 		loadCatalogQuery(catalog_sch);
 		schparser.ignoreUnkownAttributes(true);
 		schparser.ignoreEmptyAttributes(true);
 
 		attribs[Attributes::PgSqlVersion]=schparser.getPgSQLVersion();
-		connection.executeDMLCommand(schparser.getSourceCode(attribs).simplified(), res);
-
-		if(res.accessTuple(ResultSet::FirstTuple))
-		{
-			do
-			{
-				tuple=changeAttributeNames(res.getTupleValues());
-				obj_attribs.push_back(tuple);
-				tuple.clear();
-			}
-			while(res.accessTuple(ResultSet::NextTuple));
-		}
 
-		return obj_attribs;
+		return executeQuery(schparser.getSourceCode(attribs).simplified(), true);
 	}
 	catch(Exception &e)
 	{
@@ -821,32 +980,6 @@ QString Catalog::getNotExtObjectQuery(const QString &oid_field)
 	}
 }
 
-attribs_map Catalog::changeAttributeNames(const attribs_map &attribs)
-{
-	attribs_map::const_iterator itr=attribs.begin();
-	attribs_map new_attribs;
-	QString attr_name, value;
-
-	while(itr!=attribs.end())
-	{
-		attr_name=itr->first;
-		value=itr->second;
-
-		if(attr_name.endsWith(BoolField))
-		{
-			attr_name.remove(BoolField);
-			if(value==PgSqlFalse) value.clear();
-			else value=Attributes::True;
-		}
-
-		attr_name.replace('_','-');
-		new_attribs[attr_name]=value;
-		itr++;
-	}
-
-	return new_attribs;
-}
-
 QString Catalog::createOidFilter(const std::vector<unsigned> &oids)
 {
 	QString filter;
@@ -892,7 +1025,7 @@ attribs_map Catalog::getObjectAttributes(ObjectType obj_type, unsigned oid, cons
 	try
 	{
 		std::vector<attribs_map> attribs_vect=getObjectsAttributes(obj_type, sch_name, tab_name, { oid }, extra_attribs);
-		return (attribs_vect.empty() ? attribs_map() : attribs_vect[0]);
+		return (attribs_vect.empty() ? attribs_map() : std::move(attribs_vect[0]));
 	}
 	catch(Exception &e)
 	{
@@ -906,24 +1039,21 @@ QString Catalog::getObjectOID(const QString &name, ObjectType obj_type, const QS
 	try
 	{
 		attribs_map attribs;
-		ResultSet res;
+		std::vector<attribs_map> tuples;
 
 		attribs[Attributes::CustomFilter] = QString("%1 = E'%2'").arg(name_fields[obj_type]).arg(name);
 		attribs[Attributes::Schema] = schema;
 		attribs[Attributes::Table] = table;
-		executeCatalogQuery(QueryList, obj_type, res, false, attribs);
+		tuples = executeCatalogQuery(QueryList, obj_type, false, attribs);
 
-		if(res.getTupleCount() > 1)
+		if(tuples.size() > 1)
 			throw Exception(QApplication::translate("Catalog","The catalog query returned more than one OID!","", -1),
 											ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-		else if(res.isEmpty())
+		else if(tuples.empty())
 			return "0";
 		else
-		{
-			res.accessTuple(ResultSet::FirstTuple);
-			return res.getColumnValue(Attributes::Oid);
-		}
+			return tuples[0][Attributes::Oid];
 	}
 	catch(Exception &e)
 	{
@@ -940,7 +1070,8 @@ attribs_map Catalog::getServerAttributes()
 	{
 		ResultSet res = ResultSet();
 		QString sql, attr_name;
-		attribs_map tuple, attribs_aux;
+		attribs_map attribs_aux;
+		std::vector<int> col_idxs;
 
 		loadCatalogQuery(QString("server"));
 		schparser.ignoreUnkownAttributes(true);
@@ -950,12 +1081,13 @@ attribs_map Catalog::getServerAttributes()
 
 		if(res.accessTuple(ResultSet::FirstTuple))
 		{
+			col_idxs = res.getColumnIndexes({ Attributes::Attribute, Attributes::Value });
+
 			do
 			{
-				tuple=res.getTupleValues();
-				attr_name = tuple[Attributes::Attribute];
+				attr_name = res.getColumnString(col_idxs[0]);
 				attr_name.replace('_','-');
-				attribs[attr_name]=tuple[Attributes::Value];
+				attribs[attr_name]=res.getColumnString(col_idxs[1]);
 			}
 			while(res.accessTuple(ResultSet::NextTuple));
 
@@ -973,6 +1105,53 @@ attribs_map Catalog::getServerAttributes()
 	return attribs;
 }
 
+void Catalog::getObjectsMarkers(std::map<unsigned, QString> &markers, std::map<unsigned, unsigned> &parents)
+{
+	try
+	{
+		ResultSet res;
+		attribs_map attribs;
+		unsigned oid = 0, parent_oid = 0;
+		std::vector<QByteArrayView> oids, parent_oids, obj_markers;
+		std::vector<int> col_idxs;
+
+		loadCatalogQuery(Attributes::ObjectsMarkers);
+		schparser.ignoreUnkownAttributes(true);
+		schparser.ignoreEmptyAttributes(true);
+
+		markers.clear();
+		parents.clear();
+
+		/* The markers are always read from the server (the cache is bypassed) since they are used
+		 * to detect changes. The result is read column-wise without building a map per tuple */
+		connection.executeDMLCommand(schparser.getSourceCode(attribs).simplified(), res);
+
+		if(!res.accessTuple(ResultSet::FirstTuple))
+			return;
+
+		col_idxs = res.getColumnIndexes({ Attributes::Oid, Attributes::Parent, Attributes::Marker });
+		oids = res.getColumnViews(col_idxs[0]);
+		parent_oids = res.getColumnViews(col_idxs[1]);
+		obj_markers = res.getColumnViews(col_idxs[2]);
+
+		// The values returned by libpq are null terminated so the oids can be converted in place
+		for(size_t tup = 0; tup < oids.size(); tup++)
+		{
+			oid = std::strtoul(oids[tup].data(), nullptr, 10);
+			parent_oid = std::strtoul(parent_oids[tup].data(), nullptr, 10);
+			markers[oid] = QLatin1String(obj_markers[tup].data(), obj_markers[tup].size());
+
+			if(parent_oid > 0)
+				parents[oid] = parent_oid;
+		}
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e,
+						QString("catalog: %1").arg(Attributes::ObjectsMarkers));
+	}
+}
+
 unsigned Catalog::getObjectCount(bool incl_sys_objs)
 {
 	unsigned count = 0;
@@ -980,8 +1159,8 @@ unsigned Catalog::getObjectCount(bool incl_sys_objs)
 	try
 	{
 		ResultSet res = ResultSet();
-		QString sql, attr_name;
-		attribs_map tuple, attribs;
+		QString sql;
+		attribs_map attribs;
 
 		if(!incl_sys_objs)
 			attribs[Attributes::LastSysOid]=QString::number(last_sys_oid);
@@ -993,10 +1172,7 @@ unsigned Catalog::getObjectCount(bool incl_sys_objs)
 		connection.executeDMLCommand(sql, res);
 
 		if(res.accessTuple(ResultSet::FirstTuple))
-		{
-			tuple = res.getTupleValues();
-			count = tuple[Attributes::ObjCount].toUInt();
-		}
+			count = std::strtoul(res.getColumnValue(res.getColumnIndex(Attributes::ObjCount)), nullptr, 10);
 	}
 	catch(Exception &e)
 	{
@@ -1245,6 +1421,8 @@ void Catalog::operator = (const Catalog &catalog)
 		this->ext_objs_oids=catalog.ext_objs_oids;
 		this->connection.setConnectionParams(catalog.connection.getConnectionParams());
 		this->last_sys_oid=catalog.last_sys_oid;
+		this->cache_key=catalog.cache_key;
+		this->use_cache=catalog.use_cache;
 		this->filter=catalog.filter;
 		this->exclude_ext_objs=catalog.exclude_ext_objs;
 		this->exclude_sys_objs=catalog.exclude_sys_objs;
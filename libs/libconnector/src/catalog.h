@@ -61,6 +61,9 @@ class __libconnector Catalog {
 		PgSqlFalse, //! \brief Replacement for false 'f' boolean value
 		BoolField,     //! \brief Suffix for boolean fields.
 
+		//! \brief Prefix of the cache keys of the results which had the attribute names changed (see executeQuery())
+		ChangedNamesCacheId,
+
 		//! \brief Query used to retrieve extension objects.
 		GetExtensionObjsSql,
 
@@ -113,6 +116,9 @@ class __libconnector Catalog {
 		//! \brief Connection used to query the pg_catalog
 		Connection connection;
 
+		//! \brief The key of the connection's cached results (see CatalogCache)
+		QString cache_key;
+
 		//! \brief Stores the last system object identifier. This is used to filter system objects
 		unsigned last_sys_oid;
 
@@ -131,27 +137,37 @@ class __libconnector Catalog {
 		list_only_sys_objs,
 
 		//! \brief Indicates that the name filtering should occur in the objects' signature instead of their names
-		match_signature;
+		match_signature,
+
+		//! \brief Indicates if this catalog reads/stores its results through the shared cache (see CatalogCache)
+		use_cache;
 
 		/*! \brief Load the schema parser buffer with the catalog query using identified by qry_id.
 		The method will cache the catalog query if it's not cached yet (only when use_cached_queries=true) */
 		void loadCatalogQuery(const QString &qry_id);
 
-		/*! \brief Executes a query on the catalog for the specified object type. If the parameter 'single_result' is true
-		the query will return only one tuple on the result set. Additional attributes can be passed so that SchemaParser will
+		/*! \brief Runs the catalog probe query (see CatalogCache) in order to discard the cached results of the
+		 * connection in case the database's catalog was changed. The query is executed only if the probe interval
+		 * has expired or when force is true. Returns false when the cache is disabled or couldn't be validated */
+		bool validateCache(bool force);
+
+		/*! \brief Executes the query returning the tuples of the result. When the catalog cache is enabled
+		 * the tuples are read from the cache of the connection when available, otherwise they are cached after
+		 * the execution of the query. When change_names is true the attribute names that have underscores have this
+		 * char replaced by dashes and the values of the fields which suffix is _bool are replaced by '1' when 't' and by
+		 * empty when 'f', since XMLParser/SchemaParser understand bool values as 1 (one) or '' (empty). The new names are
+		 * computed only once per result column */
+		std::vector<attribs_map> executeQuery(const QString &sql, bool change_names = false);
+
+		/*! \brief Executes a query on the catalog for the specified object type returning the resulting tuples. If the parameter 'single_result' is true
+		the query will return only one tuple. Additional attributes can be passed so that SchemaParser will
 		use them when parsing the schema file for the object. A special extra attribute is accepted but not passed to SchemaParser:
 		ParsersAttributes::CUSTOM_FILTER that will be appended to the current filter expression */
-		void executeCatalogQuery(const QString &qry_type, ObjectType obj_type, ResultSet &result, bool single_result=false, attribs_map attribs=attribs_map());
+		std::vector<attribs_map> executeCatalogQuery(const QString &qry_type, ObjectType obj_type, bool single_result=false, attribs_map attribs=attribs_map(), bool change_names=false);
 
 		//! \brief Returns the catalog query according to the type of the object type provided
 		QString getCatalogQuery(const QString &qry_type, ObjectType obj_type, bool single_result=false, attribs_map attribs=attribs_map());
 
-		/*! \brief Recreates the attribute map in such way that attribute names that have
-		underscores have this char replaced by dashes. Another special operation made is to replace
-		the values of fiels which suffix is _bool to '1' when 't' and to empty when 'f', this is because
-		the resultant attribs_map will be passed to XMLParser/SchemaParser which understands bool values as 1 (one) or '' (empty) */
-		attribs_map changeAttributeNames(const attribs_map &attribs);
-
 		//! \brief Returns a attribute set for the specified object type and name
 		attribs_map getAttributes(const QString &obj_name, ObjectType obj_type, attribs_map extra_attribs=attribs_map());
 
@@ -166,6 +182,14 @@ class __libconnector Catalog {
 		//! \brief Creates a comma separated string containing all the oids to be filtered
 		QString createOidFilter(const std::vector<unsigned> &oids);
 
+		/*! \brief Returns the listing query of the object type with the object type code injected as the
+		 * first column (object_type). An empty string is returned if the type is not supported by the server */
+		QString getListQuery(ObjectType obj_type, attribs_map attribs);
+
+		/*! \brief Executes the provided listing queries (see getListQuery()) at once returning the oids, names, types
+		 * and parents of the objects. When limit is greater than zero at most limit objects are returned */
+		std::vector<attribs_map> getObjectsNames(const QStringList &queries, bool sort_results, unsigned limit);
+
 	public:
 		Catalog();
 		Catalog(const Catalog &catalog);
@@ -184,6 +208,14 @@ class __libconnector Catalog {
 	catalog queries will fail */
 		void closeConnection();
 
+		/*! \brief Enables/disables the use of the shared cache (see CatalogCache) by this catalog. When disabled all the
+		 * queries are executed directly on the database. This is used by operations that must never read outdated data
+		 * (e.g. the reverse engineering and the diff). The cache is enabled by default */
+		void setCacheEnabled(bool value);
+
+		//! \brief Returns if this catalog uses the shared cache
+		bool isCacheEnabled();
+
 		//! \brief Configures the catalog query filter
 		void setQueryFilter(QueryFilter filter);
 
@@ -237,6 +269,20 @@ class __libconnector Catalog {
 		the specified list of types.	A schema name can be specified in order to filter only objects of the specifed schema */
 		std::vector<attribs_map> getObjectsNames(std::vector<ObjectType> obj_types, const QString &sch_name="", const QString &tab_name="", attribs_map extra_attribs=attribs_map(), bool sort_results=false);
 
+		/*! \brief Returns the amount of objects of each provided type (in the schema and/or table, when specified)
+		 * running a single query that retrieves only the counts from the server */
+		std::map<ObjectType, unsigned> getObjectsCount(std::vector<ObjectType> obj_types, const QString &sch_name="", const QString &tab_name="", attribs_map extra_attribs=attribs_map());
+
+		/*! \brief Returns the oids, names, types and parents of the objects of the provided types which names contain the
+		 * pattern (case insensitive) or, when by_oid is true, which OIDs start with the pattern. At most limit objects are
+		 * returned (zero means no limit). Table children objects can't be searched since their listing depends on the parent table */
+		std::vector<attribs_map> findObjects(std::vector<ObjectType> obj_types, const QString &pattern, bool by_oid, unsigned limit);
+
+		/*! \brief Fills the maps with the change markers of the database objects and the oids of the parent tables of the table children objects
+		 * (see objectsmarkers.sch). The marker of an object changes every time it is modified in the database, so comparing them with markers
+		 * retrieved previously reveals the objects created, changed or dropped since then */
+		void getObjectsMarkers(std::map<unsigned, QString> &markers, std::map<unsigned, unsigned> &parents);
+
 		//! \brief Returns a set of multiple attributes (several tuples) for the specified object type
 		std::vector<attribs_map> getMultipleAttributes(ObjectType obj_type, attribs_map extra_attribs=attribs_map());
 
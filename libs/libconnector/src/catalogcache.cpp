@@ -0,0 +1,148 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "catalogcache.h"
+#include "connection.h"
+#include <QCryptographicHash>
+
+QMutex CatalogCache::cache_mutex;
+bool CatalogCache::cache_enabled=true;
+std::map<QString, CatalogCache::ConnectionCache> CatalogCache::conn_caches;
+
+void CatalogCache::discardResults(ConnectionCache &cache)
+{
+	/* The cache entry itself is kept so the generation is never reused
+	 * by results of queries started before the discarding */
+	cache.results.clear();
+	cache.probe_value.clear();
+	cache.probe_timer.invalidate();
+	cache.generation++;
+}
+
+void CatalogCache::setCacheEnabled(bool value)
+{
+	QMutexLocker locker(&cache_mutex);
+
+	cache_enabled=value;
+
+	if(!cache_enabled)
+	{
+		for(auto &itr : conn_caches)
+			discardResults(itr.second);
+	}
+}
+
+bool CatalogCache::isCacheEnabled()
+{
+	QMutexLocker locker(&cache_mutex);
+	return cache_enabled;
+}
+
+QString CatalogCache::getConnectionKey(const attribs_map &conn_params)
+{
+	QStringList values;
+
+	/* Only the parameters that determine the server, the database and the session
+	 * in which the catalog is read are considered (alias, password, timeout are ignored) */
+	for(auto &param : { Connection::ParamServerFqdn, Connection::ParamServerIp, Connection::ParamPort,
+											Connection::ParamDbName, Connection::ParamUser, Connection::ParamOthers })
+	{
+		auto itr = conn_params.find(param);
+		values.append(itr != conn_params.end() ? itr->second : "");
+	}
+
+	return QString(QCryptographicHash::hash(values.join(QChar('\n')).toUtf8(), QCryptographicHash::Sha1).toHex());
+}
+
+bool CatalogCache::isProbeRequired(const QString &conn_key, bool force)
+{
+	QMutexLocker locker(&cache_mutex);
+
+	if(!cache_enabled)
+		return false;
+
+	auto itr = conn_caches.find(conn_key);
+
+	return (force || itr == conn_caches.end() ||
+					!itr->second.probe_timer.isValid() ||
+					itr->second.probe_timer.hasExpired(ProbeInterval));
+}
+
+bool CatalogCache::updateProbeValue(const QString &conn_key, const QString &probe_value)
+{
+	QMutexLocker locker(&cache_mutex);
+	ConnectionCache &cache = conn_caches[conn_key];
+	bool changed = (cache.probe_value != probe_value);
+
+	if(changed)
+	{
+		discardResults(cache);
+		cache.probe_value = probe_value;
+	}
+
+	cache.probe_timer.start();
+	return changed;
+}
+
+bool CatalogCache::getResult(const QString &conn_key, const QString &query, std::vector<attribs_map> &tuples, unsigned &generation)
+{
+	QMutexLocker locker(&cache_mutex);
+	auto itr = conn_caches.find(conn_key);
+
+	generation = 0;
+
+	if(!cache_enabled || itr == conn_caches.end())
+		return false;
+
+	generation = itr->second.generation;
+
+	auto res_itr = itr->second.results.find(query);
+
+	if(res_itr == itr->second.results.end())
+		return false;
+
+	tuples = res_itr->second;
+	return true;
+}
+
+void CatalogCache::storeResult(const QString &conn_key, const QString &query, const std::vector<attribs_map> &tuples, unsigned generation)
+{
+	QMutexLocker locker(&cache_mutex);
+	auto itr = conn_caches.find(conn_key);
+
+	/* The results are stored only for connections which have a probe value registered
+	 * and weren't invalidated while the query was being executed */
+	if(!cache_enabled || itr == conn_caches.end() || itr->second.generation != generation)
+		return;
+
+	if(itr->second.results.size() >= MaxCachedResults)
+		itr->second.results.clear();
+
+	itr->second.results[query] = tuples;
+}
+
+void CatalogCache::invalidate(const QString &conn_key)
+{
+	QMutexLocker locker(&cache_mutex);
+
+	for(auto &itr : conn_caches)
+	{
+		if(conn_key.isEmpty() || itr.first == conn_key)
+			discardResults(itr.second);
+	}
+}
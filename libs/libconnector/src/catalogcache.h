@@ -0,0 +1,106 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libconnector
+\class CatalogCache
+\brief Implements an in-memory cache of catalog query results shared by all the Catalog instances of the application.
+The results are stored per connection (server, database, user and options) and keyed by the catalog query itself, so the
+database explorer and the object properties/source code reuse the data already retrieved by each other. The reverse engineering
+(import and diff) doesn't use the cache (see Catalog::setCacheEnabled()) since it must always work on the current catalog state.
+The cache of a connection is discarded when the value returned by the change probe query (a digest of the row count and the
+transaction ids of the rows of the system catalogs) differs from the one stored with the cached results.
+*/
+
+#ifndef CATALOG_CACHE_H
+#define CATALOG_CACHE_H
+
+#include "connectorglobal.h"
+#include "attribsmap.h"
+#include <QMutex>
+#include <QElapsedTimer>
+#include <vector>
+#include <map>
+
+class __libconnector CatalogCache {
+	private:
+		struct ConnectionCache {
+			//! \brief The value returned by the catalog probe query when the cached results were retrieved
+			QString probe_value;
+
+			//! \brief Counts the time elapsed since the last probe query was executed
+			QElapsedTimer probe_timer;
+
+			/*! \brief Incremented every time the cached results are discarded. This is used to avoid storing
+			 * results of queries started before an invalidation */
+			unsigned generation;
+
+			//! \brief The cached tuples of each catalog query
+			std::map<QString, std::vector<attribs_map>> results;
+
+			ConnectionCache() : generation(0) {}
+		};
+
+		//! \brief Maximum amount of cached query results per connection. The cache of a connection is discarded when this limit is reached
+		static constexpr unsigned MaxCachedResults = 2000;
+
+		/*! \brief Interval (in ms) in which the cached results of a connection are used without running the probe query again.
+		 * Since the probe query scans the system catalogs it isn't executed on every cache access */
+		static constexpr qint64 ProbeInterval = 5000;
+
+		static QMutex cache_mutex;
+
+		static bool cache_enabled;
+
+		//! \brief Stores the cached results of each connection (see getConnectionKey())
+		static std::map<QString, ConnectionCache> conn_caches;
+
+		//! \brief Clears the results and the probe value of the connection cache forcing a new probe in the next access
+		static void discardResults(ConnectionCache &cache);
+
+	public:
+		//! \brief Enables/disables the cache. When disabling it all the cached results are discarded
+		static void setCacheEnabled(bool value);
+
+		static bool isCacheEnabled();
+
+		//! \brief Returns the key that identifies the cached results of the provided connection parameters
+		static QString getConnectionKey(const attribs_map &conn_params);
+
+		/*! \brief Returns if the probe query must be executed for the connection in order to validate
+		 * the cached results. When force is true the probe interval is ignored */
+		static bool isProbeRequired(const QString &conn_key, bool force);
+
+		/*! \brief Stores the probe value of the connection discarding the cached results in case it differs from
+		 * the one stored previously. Returns true when the cached results were discarded */
+		static bool updateProbeValue(const QString &conn_key, const QString &probe_value);
+
+		/*! \brief Copies the cached tuples of the query to the provided vector returning true when the query
+		 * is cached. The generation is set to the current generation of the connection cache and must be passed
+		 * to storeResult() when the results are retrieved from the database */
+		static bool getResult(const QString &conn_key, const QString &query, std::vector<attribs_map> &tuples, unsigned &generation);
+
+		/*! \brief Stores the tuples of a query. The tuples are ignored if the cache of the connection
+		 * was discarded after the provided generation was obtained from getResult() */
+		static void storeResult(const QString &conn_key, const QString &query, const std::vector<attribs_map> &tuples, unsigned generation);
+
+		//! \brief Discards the cached results of the connection or of all connections when the key is empty
+		static void invalidate(const QString &conn_key = "");
+};
+
+#endif
@@ -0,0 +1,182 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+#include "completioncatalog.h"
+#include "catalogcache.h"
+#include "connection.h"
+#include "schemaparser.h"
+#include "globalattributes.h"
+#include <QThreadPool>
+#include <QHash>
+
+QMutex CompletionCatalog::entries_mutex;
+std::map<QString, CompletionCatalog::CatalogEntry> CompletionCatalog::entries;
+unsigned CompletionCatalog::last_generation = 0;
+QString CompletionCatalog::completion_sql;
+
+QString CompletionCatalog::getCompletionQuery()
+{
+	QMutexLocker locker(&entries_mutex);
+
+	if(completion_sql.isEmpty())
+	{
+		SchemaParser schparser;
+		attribs_map attribs;
+
+		schparser.ignoreUnkownAttributes(true);
+		schparser.ignoreEmptyAttributes(true);
+		completion_sql = schparser.getSourceCode(GlobalAttributes::getSchemaFilePath(GlobalAttributes::CatalogSchemasDir, Attributes::Completion),
+																						 attribs).simplified();
+	}
+
+	return completion_sql;
+}
+
+void CompletionCatalog::refresh(const attribs_map &conn_params, bool force)
+{
+	QString conn_key = CatalogCache::getConnectionKey(conn_params), sql;
+	unsigned generation = 0;
+
+	try
+	{
+		/* The query is parsed in the calling thread since the schema parser
+		 * configuration isn't shared with the background tasks */
+		sql = getCompletionQuery();
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e,
+										QString("catalog: %1").arg(Attributes::Completion));
+	}
+
+	{
+		QMutexLocker locker(&entries_mutex);
+		CatalogEntry &entry = entries[conn_key];
+
+		if(entry.refreshing ||
+			 (!force && entry.index && entry.refresh_timer.isValid() && !entry.refresh_timer.hasExpired(RefreshInterval)))
+			return;
+
+		entry.refreshing = true;
+		entry.generation = generation = ++last_generation;
+		entry.refresh_timer.start();
+	}
+
+	QThreadPool::globalInstance()->start([conn_params, conn_key, sql, generation](){
+		std::shared_ptr<CompletionIndex> index;
+
+		try
+		{
+			Connection conn(conn_params);
+			ResultSet res;
+
+			conn.connect();
+			conn.executeDMLCommand(sql, res);
+			conn.close();
+
+			index = std::make_shared<CompletionIndex>();
+			loadIndex(res, *index);
+			index->finish();
+		}
+		catch(Exception &)
+		{
+			/* Errors aren't reported from the background task since the completion can still
+			 * use the previous index. The next refresh will try to retrieve the objects again */
+			index.reset();
+		}
+
+		QMutexLocker locker(&entries_mutex);
+		auto itr = entries.find(conn_key);
+
+		/* The entry may have been discarded by clear() while the index was being built, or even
+		 * recreated by a newer refresh, in both cases the result of this task is outdated */
+		if(itr == entries.end() || itr->second.generation != generation)
+			return;
+
+		if(index)
+			itr->second.index = index;
+
+		itr->second.refreshing = false;
+	});
+}
+
+std::shared_ptr<const CompletionIndex> CompletionCatalog::getIndex(const attribs_map &conn_params)
+{
+	QMutexLocker locker(&entries_mutex);
+	auto itr = entries.find(CatalogCache::getConnectionKey(conn_params));
+
+	if(itr == entries.end())
+		return nullptr;
+
+	return itr->second.index;
+}
+
+bool CompletionCatalog::isRefreshing(const attribs_map &conn_params)
+{
+	QMutexLocker locker(&entries_mutex);
+	auto itr = entries.find(CatalogCache::getConnectionKey(conn_params));
+
+	return itr != entries.end() && itr->second.refreshing;
+}
+
+void CompletionCatalog::clear(const attribs_map &conn_params)
+{
+	QMutexLocker locker(&entries_mutex);
+
+	if(conn_params.empty())
+		entries.clear();
+	else
+		entries.erase(CatalogCache::getConnectionKey(conn_params));
+}
+
+void CompletionCatalog::loadIndex(ResultSet &res, CompletionIndex &index)
+{
+	try
+	{
+		std::vector<int> col_idxs;
+		QHash<QByteArray, ObjectType> obj_types;
+		QByteArrayView type_val;
+
+		if(!res.accessTuple(ResultSet::FirstTuple))
+			return;
+
+		col_idxs = res.getColumnIndexes({ Attributes::Type, Attributes::Schema, Attributes::Parent,
+																			Attributes::Name, Attributes::Signature });
+
+		do
+		{
+			type_val = res.getColumnView(col_idxs[0]);
+
+			/* The few distinct type names are converted only once instead of once per object.
+			 * The lookup uses the value returned by libpq without copying it */
+			auto type_itr = obj_types.constFind(QByteArray::fromRawData(type_val.data(), type_val.size()));
+
+			if(type_itr == obj_types.constEnd())
+				type_itr = obj_types.insert(type_val.toByteArray(), BaseObject::getObjectType(QString::fromLatin1(type_val.data(), type_val.size())));
+
+			index.addItem(type_itr.value(), res.getColumnString(col_idxs[1]), res.getColumnString(col_idxs[2]),
+										res.getColumnString(col_idxs[3]), res.getColumnString(col_idxs[4]));
+		}
+		while(res.accessTuple(ResultSet::NextTuple));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
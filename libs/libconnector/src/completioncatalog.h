@@ -0,0 +1,97 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+/**
+\ingroup libconnector
+\class CompletionCatalog
+\brief Keeps the names of the objects of the databases in use by the code completion of live connections (e.g. SQL execution).
+Each connection has its own index (see CompletionIndex) retrieved by a single catalog query (see completion.sch) executed in
+background through a dedicated connection, so the user interface is never blocked while the catalog of a large database is read.
+The index of a connection is replaced only when the new one is completely built, meanwhile the previous one keeps being served.
+*/
+
+#ifndef COMPLETION_CATALOG_H
+#define COMPLETION_CATALOG_H
+
+#include "connectorglobal.h"
+#include "completionindex.h"
+#include "attribsmap.h"
+#include "resultset.h"
+#include <QMutex>
+#include <QElapsedTimer>
+#include <memory>
+
+class __libconnector CompletionCatalog {
+	private:
+		struct CatalogEntry {
+			//! \brief The last index completely built for the connection
+			std::shared_ptr<const CompletionIndex> index;
+
+			//! \brief Counts the time elapsed since the last refresh was started
+			QElapsedTimer refresh_timer;
+
+			//! \brief Indicates that a refresh is running in background for the connection
+			bool refreshing;
+
+			/*! \brief Identifies the last refresh started for the connection. A background task only installs its index
+			 * if the entry still has the generation of the task, so results of refreshes started before a clear() are dropped */
+			unsigned generation;
+
+			CatalogEntry() : refreshing(false), generation(0) {}
+		};
+
+		//! \brief Interval (in ms) in which the index of a connection is used without being refreshed
+		static constexpr qint64 RefreshInterval = 60000;
+
+		static QMutex entries_mutex;
+
+		//! \brief Stores the index of each connection (see CatalogCache::getConnectionKey())
+		static std::map<QString, CatalogEntry> entries;
+
+		//! \brief The generation assigned to the last refresh started (see CatalogEntry::generation)
+		static unsigned last_generation;
+
+		//! \brief The completion catalog query, parsed once in the thread that requests the first refresh
+		static QString completion_sql;
+
+		//! \brief Returns the completion catalog query parsing it in the first call
+		static QString getCompletionQuery();
+
+	public:
+		/*! \brief Starts a background refresh of the index of the connection in case it was never retrieved or the refresh
+		 * interval has elapsed. When force is true the interval is ignored. Nothing is done while a refresh is running for the
+		 * connection. In case of errors (e.g. lost connection) the previous index is kept */
+		static void refresh(const attribs_map &conn_params, bool force = false);
+
+		/*! \brief Returns the last index built for the connection. A null pointer is returned when the
+		 * index was never built. The returned index remains valid even if it is replaced by a refresh */
+		static std::shared_ptr<const CompletionIndex> getIndex(const attribs_map &conn_params);
+
+		//! \brief Returns if a background refresh is running for the connection
+		static bool isRefreshing(const attribs_map &conn_params);
+
+		//! \brief Discards the index of the connection or of all connections when the parameters are empty
+		static void clear(const attribs_map &conn_params = attribs_map());
+
+		/*! \brief Adds to the index the objects contained in the result of the completion catalog query.
+		 * This method doesn't finish the index (see CompletionIndex::finish()) */
+		static void loadIndex(ResultSet &res, CompletionIndex &index);
+};
+
+#endif
@@ -0,0 +1,177 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+#include "completionindex.h"
+#include <algorithm>
+
+CompletionIndex::CompletionIndex()
+{
+	finished = false;
+}
+
+QString CompletionIndex::getSharedName(const QString &name)
+{
+	if(name.isEmpty())
+		return name;
+
+	return *shared_names.insert(name);
+}
+
+QString CompletionIndex::getScopeKey(const QString &schema, const QString &parent)
+{
+	if(parent.isEmpty())
+		return foldName(schema);
+
+	return foldName(schema) + QChar('.') + foldName(parent);
+}
+
+QString CompletionIndex::foldName(const QString &name)
+{
+	/* Names that are already in lower case (the vast majority in PostgreSQL)
+	 * are returned without being copied by QString::toLower() */
+	return name.toLower();
+}
+
+bool CompletionIndex::isRelation(ObjectType obj_type)
+{
+	return obj_type == ObjectType::Table || obj_type == ObjectType::View ||
+				 obj_type == ObjectType::ForeignTable || obj_type == ObjectType::Sequence;
+}
+
+void CompletionIndex::addItem(ObjectType obj_type, const QString &schema, const QString &parent, const QString &name, const QString &signature)
+{
+	Item item;
+	unsigned idx = items.size();
+	QString fold_name = foldName(name);
+
+	if(name.isEmpty() ||
+		 (obj_type != ObjectType::Schema && obj_type != ObjectType::Column &&
+			obj_type != ObjectType::Function && !isRelation(obj_type)))
+		return;
+
+	item.obj_type = obj_type;
+	item.name = name;
+	item.signature = signature;
+
+	if(obj_type == ObjectType::Schema)
+		scopes[""].push_back({ fold_name, idx });
+	else if(obj_type == ObjectType::Column)
+	{
+		item.schema = getSharedName(schema);
+		item.parent = getSharedName(parent);
+		scopes[getScopeKey(schema, parent)].push_back({ fold_name, idx });
+	}
+	else
+	{
+		//Relations and functions can be referenced with or without the schema name
+		item.schema = getSharedName(schema);
+		scopes[""].push_back({ fold_name, idx });
+		scopes[getScopeKey(schema)].push_back({ fold_name, idx });
+	}
+
+	items.push_back(std::move(item));
+	finished = false;
+}
+
+void CompletionIndex::finish()
+{
+	for(auto &itr : scopes)
+	{
+		std::sort(itr.second.begin(), itr.second.end());
+		itr.second.shrink_to_fit();
+	}
+
+	items.shrink_to_fit();
+	shared_names.clear();
+	finished = true;
+}
+
+bool CompletionIndex::isFinished() const
+{
+	return finished;
+}
+
+unsigned CompletionIndex::getItemCount() const
+{
+	return items.size();
+}
+
+QString CompletionIndex::resolveScope(const QStringList &qualifiers) const
+{
+	if(qualifiers.isEmpty())
+		return "";
+
+	//Database names in fully qualified references (db.schema.table) are ignored
+	if(qualifiers.size() > 1)
+		return getScopeKey(qualifiers[qualifiers.size() - 2], qualifiers.last());
+
+	QString fold_name = foldName(qualifiers.last());
+	auto sch_itr = scopes.find(fold_name), root_itr = scopes.find("");
+	const Item *rel_item = nullptr;
+
+	if(sch_itr != scopes.end() || root_itr == scopes.end())
+		return fold_name;
+
+	//The qualifier isn't a schema so we try to find a relation with the same name in the root scope
+	auto &entries = root_itr->second;
+	auto itr = std::lower_bound(entries.begin(), entries.end(), ScopeEntry(fold_name, 0));
+
+	for(; itr != entries.end() && itr->first == fold_name; itr++)
+	{
+		const Item &item = items[itr->second];
+
+		if(!isRelation(item.obj_type))
+			continue;
+
+		if(!rel_item || item.schema == QString("public"))
+			rel_item = &item;
+
+		if(item.schema == QString("public"))
+			break;
+	}
+
+	if(!rel_item)
+		return fold_name;
+
+	return getScopeKey(rel_item->schema, rel_item->name);
+}
+
+std::vector<const CompletionIndex::Item *> CompletionIndex::find(const QStringList &qualifiers, const QString &prefix, unsigned limit) const
+{
+	std::vector<const Item *> found;
+
+	if(!finished || limit == 0)
+		return found;
+
+	auto scope_itr = scopes.find(resolveScope(qualifiers));
+
+	if(scope_itr == scopes.end())
+		return found;
+
+	QString fold_prefix = foldName(prefix);
+	auto &entries = scope_itr->second;
+	auto itr = std::lower_bound(entries.begin(), entries.end(), ScopeEntry(fold_prefix, 0));
+
+	/* Since the entries are sorted all the names starting with the prefix are
+	 * placed right after the position found by the binary search */
+	for(; itr != entries.end() && found.size() < limit && itr->first.startsWith(fold_prefix); itr++)
+		found.push_back(&items[itr->second]);
+
+	return found;
+}
@@ -0,0 +1,112 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+/**
+\ingroup libconnector
+\class CompletionIndex
+\brief Implements the prefix index of the database object names used by the code completion of live database connections
+(see CompletionCatalog). The names are grouped in scopes according to the qualifier typed before them: the root scope lists
+schemas, relations and functions, the scope of a schema lists its relations and functions and the scope of a relation lists
+its columns. Each scope stores its names case folded in a sorted vector so the names starting with a prefix are located by a
+binary search followed by a sequential read, keeping the lookups fast even on databases with hundreds of thousands of objects.
+The index must be finished (see finish()) before any lookup and is never changed after that, so a finished index can be read
+by several threads.
+*/
+
+#ifndef COMPLETION_INDEX_H
+#define COMPLETION_INDEX_H
+
+#include "connectorglobal.h"
+#include "baseobject.h"
+#include <QSet>
+#include <vector>
+#include <map>
+
+class __libconnector CompletionIndex {
+	public:
+		struct Item {
+			ObjectType obj_type;
+
+			//! \brief The schema in which the object is located (empty for schemas)
+			QString schema,
+
+			//! \brief The relation in which the object is located (columns only)
+			parent,
+
+			name,
+
+			//! \brief The data type of columns or the identity arguments of functions
+			signature;
+		};
+
+		//! \brief Default maximum amount of items returned by find()
+		static constexpr unsigned DefaultLimit = 500;
+
+	private:
+		//! \brief Stores the case folded name of an item and the item's position in the items vector
+		using ScopeEntry = std::pair<QString, unsigned>;
+
+		std::vector<Item> items;
+
+		//! \brief The entries of each scope (see getScopeKey()) sorted by the case folded names after finish()
+		std::map<QString, std::vector<ScopeEntry>> scopes;
+
+		/*! \brief Stores a single copy of the schema and relation names repeated by several items.
+		 * The set is used only while the index is being filled */
+		QSet<QString> shared_names;
+
+		bool finished;
+
+		//! \brief Returns the shared copy of the provided name (see shared_names)
+		QString getSharedName(const QString &name);
+
+		//! \brief Returns the key of the scope of the objects located in the provided schema and relation (both optional)
+		static QString getScopeKey(const QString &schema, const QString &parent = "");
+
+		//! \brief Returns the case insensitive form of the name used to compare it with the typed prefixes
+		static QString foldName(const QString &name);
+
+		//! \brief Returns if the provided type is one of the types of relations that have columns indexed
+		static bool isRelation(ObjectType obj_type);
+
+		/*! \brief Returns the key of the scope selected by the typed qualifiers. A single qualifier selects a schema or,
+		 * when no schema has the name, a relation (the one in public is preferred when several schemas contain it) */
+		QString resolveScope(const QStringList &qualifiers) const;
+
+	public:
+		CompletionIndex();
+
+		/*! \brief Adds an object to the index. Only schemas, relations (tables, views, foreign tables and sequences),
+		 * columns and functions are accepted, other types are ignored. Adding an item to a finished index requires finishing it again */
+		void addItem(ObjectType obj_type, const QString &schema, const QString &parent, const QString &name, const QString &signature = "");
+
+		//! \brief Sorts the scopes making the index available to lookups
+		void finish();
+
+		bool isFinished() const;
+
+		unsigned getItemCount() const;
+
+		/*! \brief Returns the items which names start with the prefix (case insensitive) in the scope selected by the qualifiers
+		 * typed before it, e.g. { "public", "customer" } lists the columns of public.customer. An empty prefix lists all the items
+		 * of the scope. At most limit items are returned, ordered by name. Nothing is returned while the index isn't finished */
+		std::vector<const Item *> find(const QStringList &qualifiers, const QString &prefix, unsigned limit = DefaultLimit) const;
+};
+
+#endif
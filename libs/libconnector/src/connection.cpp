@@ -503,6 +503,86 @@ void Connection::executeDDLCommand(const QString &sql)
 	PQclear(sql_res);
 }
 
+void Connection::startCopy(const QString &copy_cmd)
+{
+	PGresult *sql_res=nullptr;
+
+	if(!connection)
+		throw Exception(ErrorCode::OprNotAllocatedConnection, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	validateConnectionStatus();
+	notices.clear();
+	sql_res=PQexec(connection, copy_cmd.toStdString().c_str());
+
+	//Prints the SQL to stdout when the flag is active
+	if(print_sql)
+	{
+		QTextStream out(stdout);
+		out << QString("\n---\n") << copy_cmd << Qt::endl;
+	}
+
+	//Raise an error in case the command is not a COPY ... FROM STDIN
+	if(PQresultStatus(sql_res) != PGRES_COPY_IN)
+	{
+		QString field = QString(PQresultErrorField(sql_res, PG_DIAG_SQLSTATE));
+
+		PQclear(sql_res);
+
+		throw Exception(Exception::getErrorMessage(ErrorCode::SQLCommandNotExecuted)
+						.arg(PQerrorMessage(connection)),
+						ErrorCode::SQLCommandNotExecuted, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr,	field);
+	}
+
+	PQclear(sql_res);
+}
+
+void Connection::putCopyData(const QByteArray &data)
+{
+	if(!connection)
+		throw Exception(ErrorCode::OprNotAllocatedConnection, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	if(data.isEmpty())
+		return;
+
+	// The connection is blocking so the data is either queued/sent or an error is returned
+	if(PQputCopyData(connection, data.constData(), data.size()) != 1)
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::SQLCommandNotExecuted)
+						.arg(PQerrorMessage(connection)),
+						ErrorCode::SQLCommandNotExecuted, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+	}
+}
+
+void Connection::endCopy(const QString &error_msg)
+{
+	PGresult *sql_res=nullptr;
+	QString err_msg, field;
+
+	if(!connection)
+		throw Exception(ErrorCode::OprNotAllocatedConnection, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	if(PQputCopyEnd(connection, error_msg.isEmpty() ? nullptr : error_msg.toStdString().c_str()) != 1)
+		err_msg = PQerrorMessage(connection);
+
+	//Retrieving the final status of the COPY command consuming all the results so the connection can be reused
+	while((sql_res = PQgetResult(connection)))
+	{
+		if(err_msg.isEmpty() && PQresultStatus(sql_res) != PGRES_COMMAND_OK)
+		{
+			err_msg = PQresultErrorMessage(sql_res);
+			field = QString(PQresultErrorField(sql_res, PG_DIAG_SQLSTATE));
+		}
+
+		PQclear(sql_res);
+	}
+
+	if(!err_msg.isEmpty())
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::SQLCommandNotExecuted).arg(err_msg),
+						ErrorCode::SQLCommandNotExecuted, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr,	field);
+	}
+}
+
 void Connection::setDefaultForOperation(ConnOperation op_id, bool value)
 {
 	if(op_id > OpNone)
@@ -247,6 +247,18 @@ class __libconnector Connection {
 		 to be an data definition one  */
 		void executeDDLCommand(const QString &sql);
 
+		/*! \brief Starts a COPY ... FROM STDIN command so the rows can be sent in batches via putCopyData().
+		 * The command must be finished by endCopy() before executing any other command in the connection */
+		void startCopy(const QString &copy_cmd);
+
+		//! \brief Sends a chunk of data (in the format expected by the COPY command in progress) to the server
+		void putCopyData(const QByteArray &data);
+
+		/*! \brief Finishes the COPY command in progress. If an error message is provided the command is aborted
+		 * on server side with that message, otherwise, the data sent is committed. In both cases, this method raises
+		 * an error if the COPY command fails */
+		void endCopy(const QString &error_msg = "");
+
 		//! \brief Toggles the default status for the connect in the specified operation (OP_??? constants).
 		void setDefaultForOperation(ConnOperation op_id, bool value);
 
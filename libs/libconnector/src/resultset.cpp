@@ -205,16 +205,92 @@ int ResultSet::getColumnSize(int column_idx)
 attribs_map ResultSet::getTupleValues()
 {
 	attribs_map tup_vals;
+	int col_cnt = getColumnCount();
 
 	if(current_tuple < 0 || current_tuple >= getTupleCount())
 		throw Exception(ErrorCode::RefInvalidTuple, __PRETTY_FUNCTION__, __FILE__, __LINE__);
 
-	for(int col=0; col < getColumnCount(); col++)
-		tup_vals[getColumnName(col)]=getColumnValue(col);
+	for(int col = 0; col < col_cnt; col++)
+	{
+		tup_vals[QString(PQfname(sql_result, col))] =
+				QString::fromUtf8(PQgetvalue(sql_result, current_tuple, col), PQgetlength(sql_result, current_tuple, col));
+	}
 
 	return tup_vals;
 }
 
+QByteArrayView ResultSet::getColumnView(int column_idx)
+{
+	validateColumnIndex(column_idx);
+	return QByteArrayView(PQgetvalue(sql_result, current_tuple, column_idx),
+												PQgetlength(sql_result, current_tuple, column_idx));
+}
+
+QLatin1String ResultSet::getColumnLatin1(int column_idx)
+{
+	validateColumnIndex(column_idx);
+	return QLatin1String(PQgetvalue(sql_result, current_tuple, column_idx),
+											 PQgetlength(sql_result, current_tuple, column_idx));
+}
+
+QString ResultSet::getColumnString(int column_idx)
+{
+	validateColumnIndex(column_idx);
+	return QString::fromUtf8(PQgetvalue(sql_result, current_tuple, column_idx),
+													 PQgetlength(sql_result, current_tuple, column_idx));
+}
+
+std::vector<QByteArrayView> ResultSet::getColumnViews(int column_idx)
+{
+	std::vector<QByteArrayView> values;
+	int tup_cnt = 0;
+
+	//Raise an error in case the column index is invalid
+	if(column_idx < 0 || column_idx >= getColumnCount())
+		throw Exception(ErrorCode::RefTupleColumnInvalidIndex, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	if(empty_result)
+		throw Exception(ErrorCode::RefInvalidTuple, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	tup_cnt = getTupleCount();
+	values.reserve(tup_cnt);
+
+	for(int tup = 0; tup < tup_cnt; tup++)
+		values.emplace_back(PQgetvalue(sql_result, tup, column_idx), PQgetlength(sql_result, tup, column_idx));
+
+	return values;
+}
+
+QStringList ResultSet::getColumnNames()
+{
+	QStringList names;
+	int col_cnt = getColumnCount();
+
+	for(int col = 0; col < col_cnt; col++)
+		names.append(QString(PQfname(sql_result, col)));
+
+	return names;
+}
+
+std::vector<int> ResultSet::getColumnIndexes(const QStringList &column_names)
+{
+	std::vector<int> col_idxs;
+
+	try
+	{
+		col_idxs.reserve(column_names.size());
+
+		for(auto &name : column_names)
+			col_idxs.push_back(getColumnIndex(name));
+
+		return col_idxs;
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+	}
+}
+
 int ResultSet::getTupleCount()
 {
 	//In case the result has some tuples
@@ -33,6 +33,10 @@ It the resultset contains data the user must call ResultSet::accessTuple() to ac
 #include <libpq-fe.h>
 #include <cstdlib>
 #include <iostream>
+#include <vector>
+#include <QByteArrayView>
+#include <QLatin1String>
+#include <QStringList>
 
 //This constant is defined on PostgreSQL source code src/catalog/pg_type.h
 #define BYTEAOID 17
@@ -89,6 +93,29 @@ class __libconnector ResultSet {
 		//! \brief Returns all the column names / values for the current tuple.
 		attribs_map getTupleValues();
 
+		/*! \brief Returns a view to the value of a column in the current tuple without copying it. The view
+		 * is valid until the result set is cleared. The column index must be resolved prior to the iteration
+		 * over the tuples (see getColumnIndexes()) so no name lookup is made for each tuple */
+		QByteArrayView getColumnView(int column_idx);
+
+		/*! \brief Returns a view to the value of a column in the current tuple as a latin1 string without copying it.
+		 * This must be used only on columns that are known to contain ascii values, e.g., oids, xids and flags */
+		QLatin1String getColumnLatin1(int column_idx);
+
+		//! \brief Returns the value of a column in the current tuple converted from utf8 using the length known by the result
+		QString getColumnString(int column_idx);
+
+		/*! \brief Returns views to the values of a column in all the tuples of the result (columnar access).
+		 * Null values are returned as empty views. The views are valid until the result set is cleared */
+		std::vector<QByteArrayView> getColumnViews(int column_idx);
+
+		//! \brief Returns the names of all columns in the result
+		QStringList getColumnNames();
+
+		/*! \brief Returns the indexes of the provided columns, in the same order, so they can be resolved once per result
+		 * and used to access the values of all tuples. Raises an error if one of the columns doesn't exist */
+		std::vector<int> getColumnIndexes(const QStringList &column_names);
+
 		/*! \brief Returns the number of rows affected by the command that generated
 	 the result if it is an INSERT, DELETE, UPDATE or the number of
 	 tuples returned if the command was a SELECT */
@@ -91,7 +91,10 @@ HEADERS += src/coreglobal.h \
 	   src/foreignserver.h \
 	   src/physicaltable.h \
 	   src/foreigntable.h \
-    src/coreutilsns.h
+    src/coreutilsns.h \
+    src/objectsearchindex.h \
+    src/splitsqlmanifest.h \
+    src/objectclonehelper.h
 
 SOURCES +=  src/textbox.cpp \
 	    src/basefunction.cpp \
@@ -172,7 +175,10 @@ SOURCES +=  src/textbox.cpp \
 	    src/foreignserver.cpp \
 	    src/physicaltable.cpp \
 	    src/foreigntable.cpp \
-    src/coreutilsns.cpp
+    src/coreutilsns.cpp \
+    src/objectsearchindex.cpp \
+    src/splitsqlmanifest.cpp \
+    src/objectclonehelper.cpp
 
 unix|windows: LIBS += $$LIBPARSERS_LIB \
 		      $$LIBUTILS_LIB
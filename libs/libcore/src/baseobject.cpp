@@ -73,11 +73,12 @@ const QString BaseObject::objs_sql[BaseObject::ObjectTypeCount]={
 	 starts at 4k because the id ranges 0, 1k, 2k, 3k, 4k
 	 are respectively assigned to objects of classes Role, Tablespace
 	 DatabaseModel, Schema, Tag */
-unsigned BaseObject::global_id=5000;
+std::atomic<unsigned> BaseObject::global_id=5000;
 
 QString BaseObject::pgsql_ver=PgSqlVersions::DefaulVersion;
-bool BaseObject::use_cached_code=true;
-bool BaseObject::escape_comments=true;
+QMutex BaseObject::pgsql_ver_mtx;
+std::atomic<bool> BaseObject::use_cached_code(true);
+std::atomic<bool> BaseObject::escape_comments(true);
 
 BaseObject::BaseObject()
 {
@@ -758,7 +759,7 @@ QString BaseObject::getSourceCode(SchemaParser::CodeType def_type, bool reduced_
 	{
 		bool format=false;
 
-		schparser.setPgSQLVersion(BaseObject::pgsql_ver);
+		schparser.setPgSQLVersion(BaseObject::getPgSQLVersion());
 		attributes[Attributes::SqlDisabled]=(sql_disabled ? Attributes::True : "");
 
 		//Formats the object's name in case the SQL definition is being generated
@@ -984,6 +985,10 @@ void BaseObject::swapObjectsIds(BaseObject *obj1, BaseObject *obj2, bool enable_
 	unsigned id_bkp=obj1->object_id;
 	obj1->object_id=obj2->object_id;
 	obj2->object_id=id_bkp;
+
+	//The ids determine the creation order so the objects are flagged as modified
+	obj1->setCodeInvalidated(true);
+	obj2->setCodeInvalidated(true);
 }
 
 void BaseObject::updateObjectId(BaseObject *obj)
@@ -997,7 +1002,10 @@ void BaseObject::updateObjectId(BaseObject *obj)
 						.arg(obj->getTypeName()),
 						ErrorCode::OprReservedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	else
+	{
 		obj->object_id=++global_id;
+		obj->setCodeInvalidated(true);
+	}
 }
 
 std::vector<ObjectType> BaseObject::getObjectTypes(bool inc_table_objs, std::vector<ObjectType> exclude_types)
@@ -1067,7 +1075,9 @@ void BaseObject::setPgSQLVersion(const QString &version)
 {
 	try
 	{
-		pgsql_ver = PgSqlVersions::parseString(version, false);
+		QString ver = PgSqlVersions::parseString(version, false);
+		QMutexLocker locker(&pgsql_ver_mtx);
+		pgsql_ver = ver;
 	}
 	catch(Exception &e)
 	{
@@ -1077,6 +1087,7 @@ void BaseObject::setPgSQLVersion(const QString &version)
 
 QString BaseObject::getPgSQLVersion()
 {
+	QMutexLocker locker(&pgsql_ver_mtx);
 	return pgsql_ver;
 }
 
@@ -1103,11 +1114,14 @@ void BaseObject::operator = (BaseObject &obj)
 	this->is_protected=obj.is_protected;
 	this->sql_disabled=obj.sql_disabled;
 	this->system_obj=obj.system_obj;
-	this->setCodeInvalidated(use_cached_code);
+	this->setCodeInvalidated(true);
 }
 
 void BaseObject::setCodeInvalidated(bool value)
 {
+	if(value && database && database != this)
+		database->notifyObjectModified(this);
+
 	if(use_cached_code && value!=code_invalidated)
 	{
 		if(value)
@@ -1202,7 +1216,7 @@ bool BaseObject::isCodeDiffersFrom(BaseObject *object, const QStringList &ignore
 
 QString BaseObject::getCachedCode(unsigned def_type, bool reduced_form)
 {
-	if(use_cached_code && def_type==SchemaParser::SqlCode && schparser.getPgSQLVersion()!=BaseObject::pgsql_ver)
+	if(use_cached_code && def_type==SchemaParser::SqlCode && schparser.getPgSQLVersion()!=BaseObject::getPgSQLVersion())
 		code_invalidated=true;
 
 	if(!code_invalidated &&
@@ -1227,7 +1241,7 @@ QString BaseObject::getDropCode(bool cascade)
 			attribs_map attribs;
 
 			setBasicAttributes(true);
-			schparser.setPgSQLVersion(BaseObject::pgsql_ver);
+			schparser.setPgSQLVersion(BaseObject::getPgSQLVersion());
 			schparser.ignoreUnkownAttributes(true);
 			schparser.ignoreEmptyAttributes(true);
 
@@ -1258,7 +1272,7 @@ QString BaseObject::getAlterCode(QString sch_name, attribs_map &attribs, bool ig
 		SchemaParser schparser;
 		QString alter_sch_file=GlobalAttributes::getSchemaFilePath(GlobalAttributes::AlterSchemaDir, sch_name);
 
-		schparser.setPgSQLVersion(BaseObject::pgsql_ver);
+		schparser.setPgSQLVersion(BaseObject::getPgSQLVersion());
 		schparser.ignoreEmptyAttributes(ignore_empty_attribs);
 		schparser.ignoreUnkownAttributes(ignore_ukn_attribs);
 		return schparser.getSourceCode(alter_sch_file, attribs);
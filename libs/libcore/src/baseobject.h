@@ -31,6 +31,8 @@
 #include "schemaparser.h"
 #include "xmlparser.h"
 #include <map>
+#include <atomic>
+#include <QMutex>
 #include <QRegularExpression>
 #include <QStringList>
 #include <QTextStream>
@@ -86,15 +88,23 @@ enum class ObjectType: unsigned {
  * to be used by QVariant */
 Q_DECLARE_METATYPE(ObjectType)
 
+/*! \note Models can be loaded in worker threads (see ModelWidget::loadModel()) while other objects are created or have
+ * their code generated in the main thread. For that reason the static members that can be touched during the loading of
+ * a model (the object id generators, the PostgreSQL version and the code generation switches below, and the user defined
+ * types registry in PgSqlType) are either atomic or guarded by a mutex. Any other static member must only be touched
+ * by the main thread */
 class __libcore BaseObject {
 	private:
 		//! \brief Current PostgreSQL version used in SQL code generation
 		static QString pgsql_ver;
 
+		//! \brief Controls the concurrent access to the PostgreSQL version used in SQL code generation
+		static QMutex pgsql_ver_mtx;
+
 		//! \brief Indicates the the cached code enabled.
-		static bool use_cached_code;
+		static std::atomic<bool> use_cached_code;
 
-		static bool escape_comments;
+		static std::atomic<bool> escape_comments;
 
 		//! \brief Stores the set of special (valid) chars that forces the object's name quoting
 		static const QByteArray special_chars;
@@ -108,8 +118,9 @@ class __libcore BaseObject {
 		/*! \brief This static attribute is used to generate the unique identifier for objects.
 		 As object instances are created this value ​​are incremented. In some classes
 		 like Schema, DatabaseModel, Tablespace, Role, Type and Function id generators are
-		 used each with a custom different numbering range (see cited classes declaration). */
-		static unsigned global_id;
+		 used each with a custom different numbering range (see cited classes declaration).
+		 The generators are atomic since models can be loaded in worker threads while other objects are created */
+		static std::atomic<unsigned> global_id;
 
 		/*! \brief Stores the unique identifier for the object. This id is nothing else
 		 than the current value of global_id. This identifier is used
@@ -248,6 +259,10 @@ class __libcore BaseObject {
 
 		QString getAlterCommentDefinition(BaseObject *object, attribs_map attributes);
 
+		/*! \brief Called on the database that owns an object every time the object (or one of its children, in case of tables)
+		 * has its code invalidated. The default implementation does nothing. See DatabaseModel::notifyObjectModified() */
+		virtual void notifyObjectModified(BaseObject *) {}
+
 	public:
 		//! \brief Maximum number of characters that an object name on PostgreSQL can have
 		static constexpr int ObjectNameMaxLength=63;
@@ -527,6 +542,7 @@ class __libcore BaseObject {
 		friend class DatabaseImportHelper;
 		friend class SwapObjectsIdsWidget;
 		friend class ModelWidget;
+		friend class ObjectCloneHelper;
 };
 
 #endif
@@ -48,7 +48,7 @@ void Column::setName(const QString &name)
 {
 	try
 	{
-		QString prev_name;
+		QString prev_name, prev_old_name=this->old_name;
 
 		//The current column name will be used as the old name
 		prev_name=this->obj_name;
@@ -59,6 +59,8 @@ void Column::setName(const QString &name)
 		/* Case no error is raised stored the old name on the
 		 respective column attribute */
 		this->old_name=prev_name;
+
+		updateParentNameIndex(prev_name, prev_old_name);
 	}
 	catch(Exception &e)
 	{
@@ -412,6 +414,8 @@ void Column::configureSearchAttributes()
 
 void Column::operator = (Column &col)
 {
+	QString prev_name=this->obj_name, prev_old_name=this->old_name;
+
 	this->comment=col.comment;
 	this->is_protected=col.is_protected;
 
@@ -440,6 +444,8 @@ void Column::operator = (Column &col)
 	this->setAddedByGeneralization(false);
 	this->setAddedByLinking(false);
 	this->setCodeInvalidated(true);
+
+	updateParentNameIndex(prev_name, prev_old_name);
 }
 
 QString Column::getDataDictionary(const attribs_map &extra_attribs)
@@ -20,16 +20,26 @@
 #include "coreutilsns.h"
 #include "defaultlanguages.h"
 #include <QtDebug>
+#include <QElapsedTimer>
+#include <QCryptographicHash>
+#include <QThread>
+#include <QThreadPool>
+#include <QSaveFile>
 #include <random>
+#include <exception>
 #include "utilsns.h"
 
-unsigned DatabaseModel::dbmodel_id=2000;
+std::atomic<unsigned> DatabaseModel::dbmodel_id=2000;
+const QString DatabaseModel::DataDictObjsPlaceholder("<!-- datadict-objects -->");
+QString DatabaseModel::snapshots_dir;
 
 DatabaseModel::DatabaseModel()
 {
 	this->model_wgt=nullptr;
 	object_id=DatabaseModel::dbmodel_id++;
 	obj_type=ObjectType::Database;
+	revision=creation_orders_rev=0;
+	modifs_blocked=false;
 
 	layers.append(tr("Default layer"));
 	active_layers.push_back(0);
@@ -52,7 +62,8 @@ DatabaseModel::DatabaseModel()
 
 	conn_limit=-1;
 	last_zoom=1;
-	loading_model=invalidated=append_at_eod=prepend_at_bod=false;
+	loading_model=invalidated=append_at_eod=prepend_at_bod=track_changes=false;
+	role_perms_outdated=false;
 	attributes[Attributes::Encoding]="";
 	attributes[Attributes::TemplateDb]="";
 	attributes[Attributes::ConnLimit]="";
@@ -322,6 +333,7 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 	if(!object)
 		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
+	checkModificationsBlocked();
 	obj_type=object->getObjectType();
 
 #ifdef DEMO_VERSION
@@ -423,6 +435,12 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 	}
 
 	object->setDatabase(this);
+	search_idx.addObject(object);
+	revision++;
+
+	if(track_changes)
+		changed_objs.insert(object);
+
 	emit s_objectAdded(object);
 	this->setInvalidated(true);
 }
@@ -433,6 +451,8 @@ void DatabaseModel::__removeObject(BaseObject *object, int obj_idx, bool check_r
 		throw Exception(ErrorCode::RemNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	else
 	{
+		checkModificationsBlocked();
+
 		std::vector<BaseObject *> *obj_list=nullptr;
 		ObjectType obj_type;
 
@@ -493,6 +513,9 @@ void DatabaseModel::__removeObject(BaseObject *object, int obj_idx, bool check_r
 			}
 		}
 
+		search_idx.removeObject(object);
+		changed_objs.remove(object);
+		revision++;
 		object->setDatabase(nullptr);
 		emit s_objectRemoved(object);
 	}
@@ -713,6 +736,10 @@ void DatabaseModel::destroyObjects()
 	//Blocking signals of all graphical objects to avoid uneeded updates in the destruction
 	this->blockSignals(true);
 
+	//The objects are destroyed without being removed so the search index and the tracked changes are discarded beforehand
+	search_idx.clear();
+	stopChangesTracking();
+
 	for(unsigned i=0; i < 5; i++)
 	{
 		for(auto &object : *this->getObjectList(graph_types[i]))
@@ -739,7 +766,7 @@ void DatabaseModel::destroyObjects()
 		qDebug() << e.getExceptionsText().toStdString().c_str() << Qt::endl;
 	}
 
-	objects = getCreationOrder(SchemaParser::XmlCode, true);
+	objects = __getCreationOrder(SchemaParser::XmlCode, true, false);
 	ritr = objects.rbegin();
 	ritr_end = objects.rend();
 
@@ -777,6 +804,9 @@ void DatabaseModel::destroyObjects()
 		delete perm;
 
 	permissions.clear();
+	obj_perms.clear();
+	role_perms.clear();
+	role_perms_outdated=false;
 
 	for(auto &inv_obj : invalid_special_objs)
 		delete inv_obj;
@@ -793,6 +823,11 @@ void DatabaseModel::destroyObjects()
 		for(auto type : rem_obj_types)
 			getObjectList(type)->clear();
 	}
+
+	//Discarding the memoized creation orders since they reference destroyed objects
+	creation_orders.clear();
+	objs_creation_orders.clear();
+	revision++;
 }
 
 void DatabaseModel::addTable(Table *table, int obj_idx)
@@ -2903,19 +2938,22 @@ void DatabaseModel::addPermission(Permission *perm)
 		if(!perm)
 			throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
+		checkModificationsBlocked();
+
 		TableObject *tab_obj=dynamic_cast<TableObject *>(perm->getObject());
+		BaseObject *object=(tab_obj ? tab_obj->getParentTable() : perm->getObject());
 
-		if(getPermissionIndex(perm, false) >=0)
+		if(getConflictingPermission(perm))
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::AsgDuplicatedPermission)
 							.arg(perm->getObject()->getName())
 							.arg(perm->getObject()->getTypeName()),
 							ErrorCode::AsgDuplicatedPermission,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		}
-		//Raises an error if the permission is referencing an object that does not exists on model
+		/* Raises an error if the permission is referencing an object that does not exists on model.
+		 * The objects in the model have their database assigned so the list of objects is scanned only when it isn't the case */
 		else if(perm->getObject()!=this &&
-				((tab_obj && (getObjectIndex(tab_obj->getParentTable()) < 0)) ||
-				 (!tab_obj && (getObjectIndex(perm->getObject()) < 0))))
+						(!object || (object->getDatabase()!=this && getObjectIndex(object) < 0)))
 			throw Exception(Exception::getErrorMessage(ErrorCode::RefObjectInexistsModel)
 							.arg(perm->getName())
 							.arg(perm->getObject()->getTypeName())
@@ -2924,6 +2962,9 @@ void DatabaseModel::addPermission(Permission *perm)
 							ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 		permissions.push_back(perm);
+		obj_perms[perm->getObject()].push_back(perm);
+		role_perms_outdated=true;
+		revision++;
 		perm->setDatabase(this);
 	}
 	catch(Exception &e)
@@ -2945,6 +2986,19 @@ void DatabaseModel::removePermission(Permission *perm)
 	try
 	{
 		__removeObject(perm);
+
+		auto itr=obj_perms.find(perm->getObject());
+
+		if(itr!=obj_perms.end())
+		{
+			std::vector<Permission *> &perms=itr->second;
+			perms.erase(std::remove(perms.begin(), perms.end(), perm), perms.end());
+
+			if(perms.empty())
+				obj_perms.erase(itr);
+		}
+
+		role_perms_outdated=true;
 	}
 	catch(Exception &e)
 	{
@@ -2954,57 +3008,115 @@ void DatabaseModel::removePermission(Permission *perm)
 
 void DatabaseModel::removePermissions(BaseObject *object)
 {
-	std::vector<BaseObject *>::iterator itr, itr_end;
-	Permission *perm=nullptr;
-	unsigned idx=0;
-
 	if(!object)
 		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-	itr=permissions.begin();
-	itr_end=permissions.end();
+	checkModificationsBlocked();
 
-	while(itr!=itr_end)
-	{
-		perm=dynamic_cast<Permission *>(*itr);
+	auto itr=obj_perms.find(object);
 
-		if(perm->getObject()==object)
-		{
-			invalid_special_objs.push_back(perm);
+	if(itr==obj_perms.end())
+		return;
 
-			permissions.erase(itr);
-			itr=itr_end=permissions.end();
+	invalid_special_objs.insert(invalid_special_objs.end(), itr->second.begin(), itr->second.end());
+	obj_perms.erase(itr);
 
-			if(!permissions.empty())
-				itr=permissions.begin() + idx;
-		}
-		else
-		{ itr++; idx++; }
-	}
+	//Removing all the object's permissions in a single pass preserving the order of the remaining ones
+	permissions.erase(std::remove_if(permissions.begin(), permissions.end(),
+																	 [object](BaseObject *perm){
+		return dynamic_cast<Permission *>(perm)->getObject()==object;
+	}), permissions.end());
+	role_perms_outdated=true;
+	revision++;
 }
 
 void DatabaseModel::getPermissions(BaseObject *object, std::vector<Permission *> &perms)
 {
-	std::vector<BaseObject *>::iterator itr, itr_end;
-	Permission *perm=nullptr;
-
 	if(!object)
 		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-	itr=permissions.begin();
-	itr_end=permissions.end();
+	auto itr=obj_perms.find(object);
 
-	perms.clear();
+	if(itr!=obj_perms.end())
+		perms=itr->second;
+	else
+		perms.clear();
+}
 
-	while(itr!=itr_end)
+Permission *DatabaseModel::getConflictingPermission(Permission *perm)
+{
+	if(!perm)
+		return nullptr;
+
+	auto itr=obj_perms.find(perm->getObject());
+
+	if(itr==obj_perms.end())
+		return nullptr;
+
+	unsigned count=perm->getRoleCount();
+
+	for(auto &perm_aux : itr->second)
 	{
-		perm=dynamic_cast<Permission *>(*itr);
+		if(perm==perm_aux)
+			return perm_aux;
 
-		if(perm->getObject()==object)
-			perms.push_back(perm);
+		//If the permissions references the same roles but one is a REVOKE and other GRANT they a considered different
+		if(perm->isRevoke()!=perm_aux->isRevoke())
+			continue;
 
-		itr++;
+		for(unsigned i=0; i < count; i++)
+		{
+			if(perm_aux->isRoleExists(perm->getRole(i)))
+				return perm_aux;
+		}
 	}
+
+	return nullptr;
+}
+
+void DatabaseModel::updateRolePermissionsIndex()
+{
+	QMutexLocker locker(&role_perms_mtx);
+
+	if(role_perms_outdated)
+	{
+		Permission *perm=nullptr;
+		unsigned count=0;
+
+		role_perms.clear();
+
+		for(auto &obj : permissions)
+		{
+			perm=dynamic_cast<Permission *>(obj);
+			count=perm->getRoleCount();
+
+			for(unsigned i=0; i < count; i++)
+			{
+				std::vector<Permission *> &perms=role_perms[perm->getRole(i)];
+
+				//Avoiding duplicated entries in case the same role is assigned more than once to the permission
+				if(perms.empty() || perms.back()!=perm)
+					perms.push_back(perm);
+			}
+		}
+
+		role_perms_outdated=false;
+	}
+}
+
+const std::vector<Permission *> &DatabaseModel::getRolePermissions(Role *role)
+{
+	static const std::vector<Permission *> no_perms;
+
+	updateRolePermissionsIndex();
+
+	QMutexLocker locker(&role_perms_mtx);
+	auto itr=role_perms.find(role);
+
+	if(itr==role_perms.end())
+		return no_perms;
+
+	return itr->second;
 }
 
 int DatabaseModel::getPermissionIndex(Permission *perm, bool exact_match)
@@ -3013,14 +3125,17 @@ int DatabaseModel::getPermissionIndex(Permission *perm, bool exact_match)
 
 	if(perm)
 	{
-		Permission *perm_aux=nullptr;
 		std::vector<BaseObject *>::iterator itr, itr_end;
 
 		itr=permissions.begin();
 		itr_end=permissions.end();
 
+		/* In exact match the objects of the permissions can be compared by their signatures (e.g. permissions from
+		 * different models) so the index by object can't be used and all the permissions must be checked */
 		if(exact_match)
 		{
+			Permission *perm_aux=nullptr;
+
 			while(itr!=itr_end)
 			{
 				perm_aux=dynamic_cast<Permission *>(*itr);
@@ -3036,39 +3151,14 @@ int DatabaseModel::getPermissionIndex(Permission *perm, bool exact_match)
 		}
 		else
 		{
-			BaseObject *object=nullptr;
-			Role *role=nullptr;
-			unsigned count, i;
-			bool ref_role=false;
+			Permission *perm_aux=getConflictingPermission(perm);
 
-			object=perm->getObject();
-
-			while(itr!=itr_end)
+			if(perm_aux)
 			{
-				perm_aux=dynamic_cast<Permission *>(*itr);
-
-				/* When the object of the auxiliary permission is the same as the
-		   specified permission it will be check if the existant roles are
-		   the same on both permissions */
-				if(object==perm_aux->getObject())
-				{
-					count=perm->getRoleCount();
+				itr=std::find(itr, itr_end, perm_aux);
 
-					for(i=0; i < count && !ref_role; i++)
-					{
-						role=perm->getRole(i);
-						ref_role=perm_aux->isRoleExists(role);
-					}
-				}
-
-				//If the permissions references the same roles but one is a REVOKE and other GRANT they a considered different
-				if(perm==perm_aux || (ref_role && perm->isRevoke()==perm_aux->isRevoke()))
-				{
+				if(itr!=itr_end)
 					perm_idx=itr-permissions.begin();
-					break;
-				}
-
-				itr++;
 			}
 		}
 	}
@@ -3162,7 +3252,12 @@ void DatabaseModel::loadModel(const QString &filename)
 
 		try
 		{
+			QElapsedTimer timer;
+
 			loading_model=true;
+			loading_times.clear();
+			timer.start();
+			progress_thr.reset();
 			xmlparser.restartParser();
 
 			//Loads the root DTD
@@ -3170,8 +3265,18 @@ void DatabaseModel::loadModel(const QString &filename)
 								 GlobalAttributes::ObjectDTDExt,
 								 GlobalAttributes::RootDTD);
 
-			//Loads the file validating it against the root DTD
-			xmlparser.loadXMLFile(filename);
+			/* Opens the file in streaming mode, so only the root element is read at this point.
+			 * Each top-level object is then parsed, validated against the root DTD and created
+			 * in sequence, being freed right after, instead of building the whole document tree in memory.
+			 * If the snapshots are enabled the (already validated) elements are read from the file's snapshot */
+			if(!snapshots_dir.isEmpty())
+			{
+				xmlparser.openXMLStream(filename, getSnapshotFilePath(filename), getSnapshotStamp(filename),
+																[&filename](){ return getSnapshotKey(filename); });
+				loading_times.push_back({ tr("Snapshot validation"), timer.restart() });
+			}
+			else
+				xmlparser.openXMLStream(filename);
 
 			//Gets the basic model information
 			xmlparser.getElementAttributes(attribs);
@@ -3266,7 +3371,7 @@ void DatabaseModel::loadModel(const QString &filename)
 			def_objs[ObjectType::Collation]=attribs[Attributes::DefaultCollation];
 			def_objs[ObjectType::Tablespace]=attribs[Attributes::DefaultTablespace];
 
-			if(xmlparser.accessElement(XmlParser::ChildElement))
+			if(xmlparser.readNextStreamElement())
 			{
 				do
 				{
@@ -3319,11 +3424,14 @@ void DatabaseModel::loadModel(const QString &filename)
 											dynamic_cast<Relationship *>(object)->getRelationshipType()==BaseRelationship::RelationshipGen)
 										found_inh_rel=true; */
 
-									emit s_objectLoaded((xmlparser.getCurrentBufferLine()/static_cast<double>(xmlparser.getBufferLineCount()))*100,
-														tr("Loading: `%1' (%2)")
-														.arg(object->getName())
-														.arg(object->getTypeName()),
-														enum_t(obj_type));
+									if(progress_thr.isReportDue(xmlparser.getStreamProgress()))
+									{
+										emit s_objectLoaded(xmlparser.getStreamProgress(),
+															tr("Loading: `%1' (%2)")
+															.arg(object->getName())
+															.arg(object->getTypeName()),
+															enum_t(obj_type));
+									}
 								}
 
 								xmlparser.restorePosition();
@@ -3336,9 +3444,10 @@ void DatabaseModel::loadModel(const QString &filename)
 						}
 					}
 				}
-				while(xmlparser.accessElement(XmlParser::NextElement));
+				while(xmlparser.readNextStreamElement());
 			}
 
+			xmlparser.restartParser();
 			this->BaseObject::setProtected(protected_model);
 
 			//Validating default objects
@@ -3363,6 +3472,12 @@ void DatabaseModel::loadModel(const QString &filename)
 			}
 
 			loading_model=false;
+			loading_times.push_back({ xmlparser.isSnapshotLoaded() ? tr("Snapshot reading and objects creation") :
+																															 tr("XML parsing, validation and objects creation"), timer.restart() });
+
+			// A new snapshot was written so the exceeding ones are removed
+			if(!snapshots_dir.isEmpty() && !xmlparser.isSnapshotLoaded())
+				pruneSnapshots();
 
 			//If there are relationship make a relationship validation to recreate any special object left behind
 			if(!relationships.empty())
@@ -3371,6 +3486,7 @@ void DatabaseModel::loadModel(const QString &filename)
 				storeSpecialObjectsXML();
 				disconnectRelationships();
 				validateRelationships();
+				loading_times.push_back({ tr("Relationships validation"), timer.restart() });
 			}
 
 			this->setInvalidated(false);
@@ -3384,8 +3500,11 @@ void DatabaseModel::loadModel(const QString &filename)
 			} */
 
 			updateTablesFKRelationships();
+			loading_times.push_back({ tr("Foreign key relationships update"), timer.restart() });
+
 			emit s_objectLoaded(100, tr("Rendering database model..."), enum_t(ObjectType::BaseObject));
 			this->setObjectsModified();
+			loading_times.push_back({ tr("Graphical objects update"), timer.elapsed() });
 		}
 		catch(Exception &e)
 		{
@@ -3406,6 +3525,89 @@ void DatabaseModel::loadModel(const QString &filename)
 	}
 }
 
+void DatabaseModel::setSnapshotsDirectory(const QString &dir)
+{
+	if(!dir.isEmpty() && !QDir().mkpath(dir))
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(dir),
+										ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	snapshots_dir = dir;
+	pruneSnapshots();
+}
+
+void DatabaseModel::pruneSnapshots()
+{
+	if(snapshots_dir.isEmpty())
+		return;
+
+	// The snapshots are sorted from the most recently to the least recently used one
+	QFileInfoList snapshots = QDir(snapshots_dir).entryInfoList({ "*.snapshot" }, QDir::Files, QDir::Time);
+	qint64 total_size = 0;
+	int count = 0;
+
+	for(auto &fi : snapshots)
+	{
+		total_size += fi.size();
+		count++;
+
+		// Removal failures (e.g. a snapshot being read by another model) are ignored since the snapshots are only a cache
+		if(count > 1 && (count > MaxSnapshots || total_size > MaxSnapshotsSize))
+			QFile::remove(fi.absoluteFilePath());
+	}
+}
+
+QString DatabaseModel::getSnapshotsDirectory()
+{
+	return snapshots_dir;
+}
+
+QString DatabaseModel::getSnapshotFilePath(const QString &filename)
+{
+	/* The snapshot file is named after the hash of the model file's absolute path so each
+	 * model file has only one snapshot which is replaced every time the model file changes */
+	QByteArray path_hash = QCryptographicHash::hash(QFileInfo(filename).absoluteFilePath().toUtf8(),
+																									QCryptographicHash::Sha1).toHex();
+
+	return snapshots_dir + GlobalAttributes::DirSeparator + path_hash + ".snapshot";
+}
+
+QByteArray DatabaseModel::getSnapshotStamp(const QString &filename)
+{
+	QFileInfo fi(filename);
+	QCryptographicHash hash(QCryptographicHash::Sha1);
+
+	/* The stamp is built only from the file's metadata, so it's computed without reading the file. The metadata change time
+	 * is used together with the modification time to detect files replaced by others (e.g. a backup restored over the file) */
+	hash.addData(GlobalAttributes::PgModelerVersion.toUtf8());
+	hash.addData(GlobalAttributes::PgModelerBuildNumber.toUtf8());
+	hash.addData(fi.absoluteFilePath().toUtf8());
+	hash.addData(QByteArray::number(fi.size()));
+	hash.addData(QByteArray::number(fi.lastModified().toMSecsSinceEpoch()));
+	hash.addData(QByteArray::number(fi.metadataChangeTime().toMSecsSinceEpoch()));
+
+	return hash.result().toHex();
+}
+
+QByteArray DatabaseModel::getSnapshotKey(const QString &filename)
+{
+	QFile input(filename);
+	QCryptographicHash hash(QCryptographicHash::Sha1);
+
+	if(!input.open(QFile::ReadOnly))
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(filename),
+										ErrorCode::FileDirectoryNotAccessed,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	hash.addData(GlobalAttributes::PgModelerVersion.toUtf8());
+	hash.addData(GlobalAttributes::PgModelerBuildNumber.toUtf8());
+	hash.addData(&input);
+
+	return hash.result().toHex();
+}
+
 BaseObject *DatabaseModel::createObject(ObjectType obj_type)
 {
 	BaseObject *object=nullptr;
@@ -7583,6 +7785,7 @@ QString DatabaseModel::getSourceCode(SchemaParser::CodeType def_type, bool expor
 	try
 	{
 		cancel_saving = false;
+		progress_thr.reset();
 		objects_map=getCreationOrder(def_type);
 		general_obj_cnt=objects_map.size();
 		gen_defs_count=0;
@@ -7670,8 +7873,9 @@ QString DatabaseModel::getSourceCode(SchemaParser::CodeType def_type, bool expor
 
 			gen_defs_count++;
 
-			if((def_type==SchemaParser::SqlCode && !object->isSQLDisabled()) ||
-					(def_type==SchemaParser::XmlCode && !object->isSystemObject()))
+			if(((def_type==SchemaParser::SqlCode && !object->isSQLDisabled()) ||
+					(def_type==SchemaParser::XmlCode && !object->isSystemObject())) &&
+				 progress_thr.isReportDue((gen_defs_count/static_cast<double>(general_obj_cnt)) * 100))
 			{
 				emit s_objectLoaded((gen_defs_count/static_cast<double>(general_obj_cnt)) * 100,
 									msg.arg(def_type_str)
@@ -7773,7 +7977,61 @@ void DatabaseModel::setDatabaseModelAttributes(attribs_map &attribs, SchemaParse
 	}
 }
 
+void DatabaseModel::validateCreationOrders()
+{
+	if(creation_orders_rev == revision)
+		return;
+
+	creation_orders.clear();
+	objs_creation_orders.clear();
+	creation_orders_rev = revision;
+}
+
+void DatabaseModel::setCodeInvalidated(bool value)
+{
+	//Changes in the database's attributes (e.g. owner, tablespace) also affect the creation orders
+	if(value)
+		revision++;
+
+	BaseObject::setCodeInvalidated(value);
+}
+
+quint64 DatabaseModel::getRevision()
+{
+	return revision;
+}
+
+void DatabaseModel::setModificationsBlocked(bool value)
+{
+	modifs_blocked = value;
+}
+
+bool DatabaseModel::isModificationsBlocked()
+{
+	return modifs_blocked;
+}
+
+void DatabaseModel::checkModificationsBlocked()
+{
+	if(modifs_blocked)
+		throw Exception(Exception::getErrorMessage(ErrorCode::OprModelModificationsBlocked).arg(getName()),
+										ErrorCode::OprModelModificationsBlocked,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+}
+
 std::map<unsigned, BaseObject *> DatabaseModel::getCreationOrder(SchemaParser::CodeType def_type, bool incl_relnn_objs, bool incl_rel1n_constrs)
+{
+	validateCreationOrders();
+
+	auto key = std::make_tuple(def_type, incl_relnn_objs, incl_rel1n_constrs);
+	auto itr = creation_orders.find(key);
+
+	if(itr == creation_orders.end())
+		itr = creation_orders.emplace(key, __getCreationOrder(def_type, incl_relnn_objs, incl_rel1n_constrs)).first;
+
+	return itr->second;
+}
+
+std::map<unsigned, BaseObject *> DatabaseModel::__getCreationOrder(SchemaParser::CodeType def_type, bool incl_relnn_objs, bool incl_rel1n_constrs)
 {
 	BaseObject *object=nullptr;
 	std::vector<BaseObject *> fkeys, fk_rels, aux_tables;
@@ -8005,13 +8263,13 @@ void DatabaseModel::__getObjectDependencies(BaseObject *object, std::vector<Base
 			objs.insert(objs.end(), dep_objs.begin(), dep_objs.end());
 		}
 
-		//Including ancestor tables and their dependencies
+		/* Including ancestor tables and their dependencies. The dependencies are accumulated in a single list
+		 * (so the ones shared by the ancestors are visited once) which is appended to the result at the end */
 		dep_objs.clear();
 		for(unsigned i=0; i < table->getAncestorTableCount(); i++)
-		{
 			__getObjectDependencies(table->getAncestorTable(i), dep_objs);
-			objs.insert(objs.end(), dep_objs.begin(), dep_objs.end());
-		}
+
+		objs.insert(objs.end(), dep_objs.begin(), dep_objs.end());
 	}
 
 	//If there is the need to include the children objects
@@ -8026,10 +8284,9 @@ void DatabaseModel::__getObjectDependencies(BaseObject *object, std::vector<Base
 			objs.insert(objs.end(), chld_objs.begin(), chld_objs.end());
 
 			for(BaseObject *aux_obj : chld_objs)
-			{
 				__getObjectDependencies(aux_obj, dep_objs);
-				objs.insert(objs.end(), dep_objs.begin(), dep_objs.end());
-			}
+
+			objs.insert(objs.end(), dep_objs.begin(), dep_objs.end());
 		}
 		else
 		{
@@ -8067,6 +8324,22 @@ void DatabaseModel::__getObjectDependencies(BaseObject *object, std::vector<Base
 }
 
 std::vector<BaseObject *> DatabaseModel::getCreationOrder(BaseObject *object, bool only_children)
+{
+	if(!object)
+		return std::vector<BaseObject *>();
+
+	validateCreationOrders();
+
+	auto key = std::make_pair(object, only_children);
+	auto itr = objs_creation_orders.find(key);
+
+	if(itr == objs_creation_orders.end())
+		itr = objs_creation_orders.emplace(key, __getCreationOrder(object, only_children)).first;
+
+	return itr->second;
+}
+
+std::vector<BaseObject *> DatabaseModel::__getCreationOrder(BaseObject *object, bool only_children)
 {
 	if(!object)
 		return std::vector<BaseObject *>();
@@ -8210,7 +8483,7 @@ void DatabaseModel::saveModel(const QString &filename, SchemaParser::CodeType de
 	}
 }
 
-bool DatabaseModel::saveSplitCustomSQL(bool save_appended, const QString &path, const QString &file_prefix)
+bool DatabaseModel::saveSplitCustomSQL(bool save_appended, SplitSQLManifest &manifest, const QString &file_prefix)
 {
 	QString filename, msg;
 	QByteArray buffer;
@@ -8231,14 +8504,14 @@ bool DatabaseModel::saveSplitCustomSQL(bool save_appended, const QString &path,
 	if(!buffer.isEmpty())
 	{
 		emit s_objectLoaded(!save_appended ? 0 : 100, msg, enum_t(ObjectType::Database));
-		UtilsNs::saveFile(path + GlobalAttributes::DirSeparator + filename, buffer);
+		manifest.saveScript(filename, buffer);
 		return true;
 	}
 
 	return false;
 }
 
-void DatabaseModel::saveSplitSQLDefinition(const QString &path, CodeGenMode code_gen_mode)
+void DatabaseModel::saveSplitSQLDefinition(const QString &path, CodeGenMode code_gen_mode, bool incremental)
 {
 	QFileInfo fi(path);
 	QDir dir;
@@ -8254,7 +8527,7 @@ void DatabaseModel::saveSplitSQLDefinition(const QString &path, CodeGenMode code
 	if(!fi.exists())
 		dir.mkdir(path);
 
-	QFile output;
+	SplitSQLManifest manifest(path, incremental);
 	QByteArray buffer;
 	std::map<unsigned, BaseObject *> objects = getCreationOrder(SchemaParser::SqlCode);
 	int pad_size = QString::number(objects.size()).size(), idx = 1;
@@ -8269,12 +8542,13 @@ void DatabaseModel::saveSplitSQLDefinition(const QString &path, CodeGenMode code
 	try
 	{
 		cancel_saving = false;
+		progress_thr.reset();
 		general_obj_cnt = objects.size();
 		shell_types = configureShellTypes(false);
 
 		/* We try to save prepended code as the first script. In case of success increment the script index
 		 * to keep generating the other scripts in the right order */
-		if(saveSplitCustomSQL(false, path, QString::number(idx).rightJustified(pad_size, '0')))
+		if(saveSplitCustomSQL(false, manifest, QString::number(idx).rightJustified(pad_size, '0')))
 			idx++;
 
 		for(auto &itr : objects)
@@ -8306,7 +8580,7 @@ void DatabaseModel::saveSplitSQLDefinition(const QString &path, CodeGenMode code
 									enum_t(ObjectType::Type));
 
 				buffer.append(shell_types.toUtf8());
-				UtilsNs::saveFile(path + GlobalAttributes::DirSeparator + filename, buffer);
+				manifest.saveScript(filename, buffer);
 				buffer.clear();
 				shell_types.clear();
 			}
@@ -8359,14 +8633,17 @@ void DatabaseModel::saveSplitSQLDefinition(const QString &path, CodeGenMode code
 								 .arg(obj->getSchemaName())
 								 .arg(obj->getObjectId());
 
-			emit s_objectLoaded((gen_defs_idx/static_cast<double>(general_obj_cnt)) * 100,
-								tr("Saving SQL of `%1' (%2) to file `%3'.")
-								.arg(obj->getName())
-								.arg(obj->getTypeName())
-								.arg(filename),
-								enum_t(obj->getObjectType()));
+			if(progress_thr.isReportDue((gen_defs_idx/static_cast<double>(general_obj_cnt)) * 100))
+			{
+				emit s_objectLoaded((gen_defs_idx/static_cast<double>(general_obj_cnt)) * 100,
+									tr("Saving SQL of `%1' (%2) to file `%3'.")
+									.arg(obj->getName())
+									.arg(obj->getTypeName())
+									.arg(filename),
+									enum_t(obj->getObjectType()));
+			}
 
-			UtilsNs::saveFile(path + GlobalAttributes::DirSeparator + filename, buffer);
+			manifest.saveScript(filename, buffer);
 			buffer.clear();
 
 			/* If the current object is the database itself, we need to save the sessionopts
@@ -8385,14 +8662,25 @@ void DatabaseModel::saveSplitSQLDefinition(const QString &path, CodeGenMode code
 														enum_t(ObjectType::Database));
 
 				buffer.append(schparser.getSourceCode(Attributes::SessionOpts, attribs, SchemaParser::SqlCode).toUtf8());
-				UtilsNs::saveFile( path + GlobalAttributes::DirSeparator + filename, buffer);
+				manifest.saveScript(filename, buffer);
 				buffer.clear();
 			}
 		}
 
 		// Saving the prepended sql file
-		saveSplitCustomSQL(true, path, QString::number(idx).rightJustified(pad_size, '0'));
+		saveSplitCustomSQL(true, manifest, QString::number(idx).rightJustified(pad_size, '0'));
 		configureShellTypes(true);
+
+		/* The stale scripts are only removed when the export finishes normally, a canceled export
+		 * keeps the previous manifest so the next run still knows the files it must handle */
+		if(!cancel_saving && manifest.isIncremental())
+		{
+			manifest.finish();
+			emit s_objectLoaded(100, tr("Incremental export finished: %1 file(s) written, %2 renamed, %3 unchanged and %4 removed.")
+													.arg(manifest.getWrittenCount()).arg(manifest.getRenamedCount())
+													.arg(manifest.getUnchangedCount()).arg(manifest.getRemovedCount()),
+													enum_t(ObjectType::Database));
+		}
 	}
 	catch (Exception &e)
 	{
@@ -9634,21 +9922,15 @@ void DatabaseModel::getRoleReferences(BaseObject *object, std::vector<BaseObject
 	std::vector<ObjectType>::iterator itr_tp, itr_tp_end;
 	Role *role_aux=nullptr;
 	Role *role=dynamic_cast<Role *>(object);
-	Permission *perm=nullptr;
 
 	//Check if the role is being referencend by permissions
-	itr=permissions.begin();
-	itr_end=permissions.end();
-	while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+	for(auto &perm : getRolePermissions(role))
 	{
-		perm=dynamic_cast<Permission *>(*itr);
-		itr++;
+		if(exclusion_mode && refer)
+			break;
 
-		if(perm->isRoleExists(role))
-		{
-			refer=true;
-			refs.push_back(perm);
-		}
+		refer=true;
+		refs.push_back(perm);
 	}
 
 	//Check if the role is being referenced in other roles
@@ -10322,26 +10604,22 @@ void DatabaseModel::getObjectReferences(BaseObject *object, std::vector<BaseObje
 	if(!object)
 		return;
 
-	std::vector<BaseObject *>::iterator itr_perm, itr_perm_end;
 	ObjectType obj_type=object->getObjectType();
 	bool refer=false;
-	Permission *perm=nullptr;
 
 	if(!exclude_perms)
 	{
-		//Get the permissions thata references the object
-		itr_perm=permissions.begin();
-		itr_perm_end=permissions.end();
+		//Get the permissions that references the object
+		auto itr_perms=obj_perms.find(object);
 
-		while(itr_perm!=itr_perm_end && (!exclusion_mode || (exclusion_mode && !refer)))
+		if(itr_perms!=obj_perms.end() && !itr_perms->second.empty())
 		{
-			perm=dynamic_cast<Permission *>(*itr_perm);
-			if(perm->getObject()==object)
-			{
-				refer=true;
-				refs.push_back(perm);
-			}
-			itr_perm++;
+			refer=true;
+
+			if(exclusion_mode)
+				refs.push_back(itr_perms->second.front());
+			else
+				refs.insert(refs.end(), itr_perms->second.begin(), itr_perms->second.end());
 		}
 	}
 
@@ -10723,7 +11001,8 @@ std::vector<BaseObject *> DatabaseModel::findObjects(const QString &pattern, std
 {
 	std::vector<BaseObject *> list, objs;
 	std::vector<BaseObject *>::iterator end;
-	std::vector<ObjectType>::iterator itr_tp=types.begin();
+	std::vector<ObjectType> scan_types, idx_types;
+	std::vector<ObjectType>::iterator itr_tp;
 	std::vector<BaseObject *> tables;
 	bool inc_tabs=false, inc_views=false, inc_rels = false;
 	QRegularExpression regexp;
@@ -10742,8 +11021,40 @@ std::vector<BaseObject *> DatabaseModel::findObjects(const QString &pattern, std
 	else
 		regexp.setPattern(QRegularExpression::wildcardToRegularExpression(pattern));
 
+	/* Objects handled by the search index are retrieved from it directly, the remaining
+	 * types (or all types if the attribute isn't indexed) are searched in the object lists */
+	if(ObjectSearchIndex::isAttributeIndexed(search_attr))
+	{
+		for(auto &obj_type : types)
+		{
+			if(!ObjectSearchIndex::isTypeIndexed(obj_type))
+				scan_types.push_back(obj_type);
+			// Base relationships (fk rels and table-view rels) are treated as table to table relationship in the search
+			else if(obj_type == ObjectType::BaseRelationship || obj_type == ObjectType::Relationship)
+			{
+				idx_types.push_back(ObjectType::BaseRelationship);
+				idx_types.push_back(ObjectType::Relationship);
+			}
+			else
+				idx_types.push_back(obj_type);
+		}
+
+		if(!idx_types.empty())
+		{
+			for(auto &obj : search_idx.findObjects(pattern, is_regexp, exact_match, search_attr, regexp))
+			{
+				if(std::find(idx_types.begin(), idx_types.end(), obj->getObjectType()) != idx_types.end())
+					list.push_back(obj);
+			}
+		}
+	}
+	else
+		scan_types = types;
+
+	itr_tp = scan_types.begin();
+
 	//If there is some table object types on the type list, gather tables and views
-	while(itr_tp!=types.end() && (!inc_views || !inc_tabs))
+	while(itr_tp!=scan_types.end() && (!inc_views || !inc_tabs))
 	{
 		if(!inc_tabs && TableObject::isTableObject(*itr_tp))
 		{
@@ -10762,7 +11073,7 @@ std::vector<BaseObject *> DatabaseModel::findObjects(const QString &pattern, std
 	}
 
 	//Gathering all other objects
-	for(auto &obj_type : types)
+	for(auto &obj_type : scan_types)
 	{
 		if(obj_type == ObjectType::Database)
 			objs.push_back(this);
@@ -10811,6 +11122,66 @@ std::vector<BaseObject *> DatabaseModel::findObjects(const QString &pattern, std
 	return list;
 }
 
+void DatabaseModel::notifyObjectModified(BaseObject *object)
+{
+	search_idx.setObjectModified(object);
+	revision++;
+
+	//The roles of a modified permission may have changed so the index by role must be rebuilt
+	if(object->getObjectType()==ObjectType::Permission)
+		role_perms_outdated=true;
+
+	if(track_changes)
+		changed_objs.insert(object);
+}
+
+void DatabaseModel::startChangesTracking()
+{
+	changed_objs.clear();
+	track_changes = true;
+}
+
+void DatabaseModel::stopChangesTracking()
+{
+	changed_objs.clear();
+	track_changes = false;
+}
+
+bool DatabaseModel::isTrackingChanges()
+{
+	return track_changes;
+}
+
+std::vector<BaseObject *> DatabaseModel::getChangedObjects()
+{
+	return std::vector<BaseObject *>(changed_objs.begin(), changed_objs.end());
+}
+
+std::vector<std::pair<QString, qint64>> DatabaseModel::getLoadingTimes()
+{
+	return loading_times;
+}
+
+void DatabaseModel::moveGraphicObjectsToThread(QThread *thread)
+{
+	BaseGraphicObject *graph_obj = nullptr;
+
+	if(!thread)
+		return;
+
+	for(auto &obj_type : { ObjectType::Schema, ObjectType::Table, ObjectType::ForeignTable, ObjectType::View,
+												 ObjectType::Textbox, ObjectType::Relationship, ObjectType::BaseRelationship })
+	{
+		for(auto &object : *getObjectList(obj_type))
+		{
+			graph_obj = dynamic_cast<BaseGraphicObject *>(object);
+
+			if(graph_obj && graph_obj->thread() != thread)
+				graph_obj->moveToThread(thread);
+		}
+	}
+}
+
 void DatabaseModel::setInvalidated(bool value)
 {
 	this->invalidated=value;
@@ -10921,6 +11292,8 @@ void DatabaseModel::saveObjectsMetadata(const QString &filename, MetaAttrOptions
 
 	try
 	{
+		progress_thr.reset();
+
 		if(save_textboxes || save_tags || save_genericsqls)
 		{
 			if(save_textboxes)
@@ -11013,9 +11386,14 @@ void DatabaseModel::saveObjectsMetadata(const QString &filename, MetaAttrOptions
 			//When handling a tag , textbox or generic sql we just extract their XML code
 			if(obj_type==ObjectType::Textbox || obj_type==ObjectType::Tag || obj_type == ObjectType::GenericSql)
 			{
-				emit s_objectLoaded(((idx++)/static_cast<double>(objects.size()))*100,
-														tr("Saving object `%1' (%2)")
-														.arg(object->getName()).arg(object->getTypeName()), enum_t(obj_type));
+				if(progress_thr.isReportDue((idx/static_cast<double>(objects.size()))*100))
+				{
+					emit s_objectLoaded((idx/static_cast<double>(objects.size()))*100,
+															tr("Saving object `%1' (%2)")
+															.arg(object->getName()).arg(object->getTypeName()), enum_t(obj_type));
+				}
+
+				idx++;
 
 				objs_def+=object->getSourceCode(SchemaParser::XmlCode);
 				continue;
@@ -11210,9 +11588,14 @@ void DatabaseModel::saveObjectsMetadata(const QString &filename, MetaAttrOptions
 				 (save_objs_z_value && !attribs[Attributes::ZValue].isEmpty()) ||
 				 (save_objs_layers_cfg && !attribs[Attributes::Layers].isEmpty()))
 			{
-				emit s_objectLoaded(((idx++)/static_cast<double>(objects.size()))*100,
-														tr("Saving metadata of the object `%1' (%2)")
-														.arg(object->getSignature()).arg(object->getTypeName()), enum_t(obj_type));
+				if(progress_thr.isReportDue((idx/static_cast<double>(objects.size()))*100))
+				{
+					emit s_objectLoaded((idx/static_cast<double>(objects.size()))*100,
+															tr("Saving metadata of the object `%1' (%2)")
+															.arg(object->getSignature()).arg(object->getTypeName()), enum_t(obj_type));
+				}
+
+				idx++;
 
 				schparser.ignoreUnkownAttributes(true);
 				objs_def+=XmlParser::convertCharsToXMLEntities(
@@ -11293,6 +11676,7 @@ void DatabaseModel::loadObjectsMetadata(const QString &filename, MetaAttrOptions
 
 	try
 	{
+		progress_thr.reset();
 		labels_attrs[Attributes::SrcLabel]=BaseRelationship::SrcCardLabel;
 		labels_attrs[Attributes::DstLabel]=BaseRelationship::DstCardLabel;
 		labels_attrs[Attributes::NameLabel]=BaseRelationship::RelNameLabel;
@@ -11327,9 +11711,12 @@ void DatabaseModel::loadObjectsMetadata(const QString &filename, MetaAttrOptions
 
 						if(!aux_obj)
 						{
-							emit s_objectLoaded(progress, tr("Creating object `%1' (%2)")
-																	.arg(attribs[Attributes::Name])
-																	.arg(BaseObject::getTypeName(obj_type)), enum_t(obj_type));
+							if(progress_thr.isReportDue(progress))
+							{
+								emit s_objectLoaded(progress, tr("Creating object `%1' (%2)")
+																		.arg(attribs[Attributes::Name])
+																		.arg(BaseObject::getTypeName(obj_type)), enum_t(obj_type));
+							}
 
 							addObject(new_object);
 						}
@@ -11424,8 +11811,11 @@ void DatabaseModel::loadObjectsMetadata(const QString &filename, MetaAttrOptions
 
 						if(object)
 						{
-							emit s_objectLoaded(progress, tr("Loading metadata for object `%1' (%2)")
-																	.arg(object->getName()).arg(object->getTypeName()), enum_t(obj_type));
+							if(progress_thr.isReportDue(progress))
+							{
+								emit s_objectLoaded(progress, tr("Loading metadata for object `%1' (%2)")
+																		.arg(object->getName()).arg(object->getTypeName()), enum_t(obj_type));
+							}
 
 							if(!object->isSystemObject() &&
 								 ((!attribs[Attributes::Protected].isEmpty() && load_objs_prot) ||
@@ -11918,13 +12308,12 @@ TableClass *DatabaseModel::createPhysicalTable()
 	return table;
 }
 
-void DatabaseModel::getDataDictionary(attribs_map &datadict, bool browsable, bool split)
+void DatabaseModel::generateDataDictionary(bool browsable, bool split, unsigned thread_cnt, const std::function<void (const QString &, const QString &)> &save_func)
 {
-	int idx = 0;
 	BaseTable *base_tab = nullptr;
 	std::vector<BaseObject *> objects;
 	std::map<QString, BaseObject *> objs_map;
-	QString styles, id, dict_index, items, buffer;
+	QString styles, id, dict_index, page_tail;
 	attribs_map attribs, aux_attribs;
 	QStringList dict_index_list;
 	QString dict_sch_file = GlobalAttributes::getSchemaFilePath(GlobalAttributes::DataDictSchemaDir, GlobalAttributes::DataDictSchemaDir),
@@ -11957,7 +12346,6 @@ void DatabaseModel::getDataDictionary(attribs_map &datadict, bool browsable, boo
 	}
 
 	dict_index_list.sort();
-	datadict.clear();
 
 	// Generates the the stylesheet
 	styles = schparser.getSourceCode(style_sch_file, attribs);
@@ -11973,61 +12361,14 @@ void DatabaseModel::getDataDictionary(attribs_map &datadict, bool browsable, boo
 		attribs[Attributes::Styles] = styles;
 	else
 		// Otherwise we create a separated stylesheet file
-		datadict[Attributes::Styles + QString(".css")] = styles;
+		save_func(Attributes::Styles + QString(".css"), styles);
 
-	// Generating individual data dictionaries
-	for(auto &itr : objs_map)
-	{
-		base_tab = dynamic_cast<BaseTable *>( itr.second);
-
-		// Generate the individual data dictionaries
-		aux_attribs[Attributes::DataDictIndex] = browsable ? Attributes::True : "";
-		aux_attribs[Attributes::Previous] = idx - 1 >= 0 ? dict_index_list.at(idx - 1) : "";
-		aux_attribs[Attributes::Next] = (++idx <= dict_index_list.size() - 1) ? dict_index_list.at(idx) : "";	
-
-		if(base_tab->getObjectType() != ObjectType::View)
-		{
-			Column *col = nullptr;
-			std::vector<TableObject *> *cols = dynamic_cast<PhysicalTable *>(base_tab)->getObjectList(ObjectType::Column);
-			std::map<Sequence *, QStringList> col_seqs;
-
-			aux_attribs[Attributes::Sequences] = "";
-
-			for(auto itr =  cols->begin(); itr != cols->end(); itr++)
-			{
-				col = dynamic_cast<Column *>(*itr);
-
-				if(col->getSequence())
-					col_seqs[dynamic_cast<Sequence *>(col->getSequence())].append(col->getName());
-			}
-
-			for(auto &itr : col_seqs)
-			{
-				aux_attribs[Attributes::Sequences] +=
-						itr.first->getDataDictionary({{ Attributes::Columns, itr.second.join(", ") }});
-			}
-
-			col_seqs.clear();
-		}
-		else
-			aux_attribs[Attributes::Sequences] = "";
-
-		attribs[Attributes::Objects] += base_tab->getDataDictionary(split, aux_attribs);
-
-		// If the generation is configured to be splitted we generate a complete HTML file for the current table
-		if(split && !attribs[Attributes::Objects].isEmpty())
-		{
-			id = itr.first + QString(".html");
-			schparser.ignoreEmptyAttributes(true);			
-			datadict[id] = schparser.getSourceCode(dict_sch_file, attribs);
-			attribs[Attributes::Objects].clear();
-		}
-	}
-
-	// If the data dictionary is browsable we proceed with the index generation
+	/* If the data dictionary is browsable we proceed with the index generation.
+	 * The index only holds one link per table so it's generated prior to the pages
+	 * since in a standalone HTML it is placed before the tables */
 	if(browsable)
 	{
-		attribs_map idx_attribs;
+		attribs_map idx_attribs, item_attribs;
 
 		idx_attribs[BaseObject::getSchemaName(ObjectType::Table)] = "";
 		idx_attribs[BaseObject::getSchemaName(ObjectType::View)] = "";
@@ -12037,9 +12378,9 @@ void DatabaseModel::getDataDictionary(attribs_map &datadict, bool browsable, boo
 		// Generating the index items
 		for(auto &item : dict_index_list)
 		{
-			aux_attribs[Attributes::Split] = attribs[Attributes::Split];
-			aux_attribs[Attributes::Item] = item;
-			idx_attribs[objs_map[item]->getSchemaName()] += schparser.getSourceCode(item_sch_file, aux_attribs);
+			item_attribs[Attributes::Split] = attribs[Attributes::Split];
+			item_attribs[Attributes::Item] = item;
+			idx_attribs[objs_map[item]->getSchemaName()] += schparser.getSourceCode(item_sch_file, item_attribs);
 		}
 
 		idx_attribs[Attributes::Name] = this->obj_name;
@@ -12051,24 +12392,156 @@ void DatabaseModel::getDataDictionary(attribs_map &datadict, bool browsable, boo
 
 	// If the data dictionary is browsable and splitted the index goes into a separated file
 	if(split && browsable)
-		datadict[Attributes::Index + QString(".html")] = dict_index;
+		save_func(Attributes::Index + QString(".html"), dict_index);
 	else if(!split)
 	{
+		/* In a standalone HTML the page is generated with a placeholder in place of the tables so
+		 * the contents before it can be saved right away and the tables are appended as they are produced */
+		QString page;
+		int pos = -1;
+
 		attribs[Attributes::DataDictIndex] = dict_index;
+		attribs[Attributes::Objects] = DataDictObjsPlaceholder;
 		schparser.ignoreEmptyAttributes(true);
-		datadict[Attributes::Database] = schparser.getSourceCode(dict_sch_file, attribs);
+		page = schparser.getSourceCode(dict_sch_file, attribs);
+		attribs[Attributes::Objects].clear();
+
+		pos = page.indexOf(DataDictObjsPlaceholder);
+		page_tail = page.mid(pos + DataDictObjsPlaceholder.size());
+		page.truncate(pos);
+		save_func(Attributes::Database, page);
+	}
+
+	/* Generating individual data dictionaries. The tables are handled in chunks whose dictionaries are
+	 * rendered in parallel and saved in alphabetical order as soon as the whole chunk is done, so only the
+	 * pages of a single chunk are held in memory at once. Each table uses its own schema parser (as well its
+	 * children objects) while the parsers of the sequences are shared by the tables, so the sequences
+	 * dictionaries are generated in the current thread */
+	QThreadPool thread_pool;
+	int idx = 0, chunk_size = 0, tab_cnt = dict_index_list.size();
+	std::vector<attribs_map> tab_attribs;
+	std::vector<QString> pages;
+	std::vector<std::exception_ptr> errors;
+
+	if(thread_cnt == 0)
+		thread_cnt = QThread::idealThreadCount();
+
+	thread_pool.setMaxThreadCount(thread_cnt);
+	chunk_size = std::max(1u, thread_cnt) * DataDictChunkFactor;
+	tab_attribs.resize(chunk_size);
+	pages.resize(chunk_size);
+	errors.resize(chunk_size);
+
+	for(int start = 0; start < tab_cnt; start += chunk_size)
+	{
+		int cnt = std::min(chunk_size, tab_cnt - start);
+
+		for(int chk_idx = 0; chk_idx < cnt; chk_idx++)
+		{
+			idx = start + chk_idx;
+			base_tab = dynamic_cast<BaseTable *>(objs_map[dict_index_list.at(idx)]);
+			aux_attribs.clear();
+			aux_attribs[Attributes::DataDictIndex] = browsable ? Attributes::True : "";
+			aux_attribs[Attributes::Previous] = idx - 1 >= 0 ? dict_index_list.at(idx - 1) : "";
+			aux_attribs[Attributes::Next] = (idx + 1 <= tab_cnt - 1) ? dict_index_list.at(idx + 1) : "";
+			aux_attribs[Attributes::Sequences] = "";
+
+			if(base_tab->getObjectType() != ObjectType::View)
+			{
+				Column *col = nullptr;
+				std::vector<TableObject *> *cols = dynamic_cast<PhysicalTable *>(base_tab)->getObjectList(ObjectType::Column);
+				std::map<Sequence *, QStringList> col_seqs;
+
+				for(auto itr =  cols->begin(); itr != cols->end(); itr++)
+				{
+					col = dynamic_cast<Column *>(*itr);
+
+					if(col->getSequence())
+						col_seqs[dynamic_cast<Sequence *>(col->getSequence())].append(col->getName());
+				}
+
+				for(auto &itr : col_seqs)
+				{
+					aux_attribs[Attributes::Sequences] +=
+							itr.first->getDataDictionary({{ Attributes::Columns, itr.second.join(", ") }});
+				}
+			}
+
+			tab_attribs[chk_idx] = aux_attribs;
+			errors[chk_idx] = nullptr;
+
+			thread_pool.start([&tab_attribs, &pages, &errors, &attribs, &dict_sch_file, base_tab, chk_idx, split](){
+				try
+				{
+					QString objs = base_tab->getDataDictionary(split, tab_attribs[chk_idx]);
+
+					// If the generation is configured to be splitted we generate a complete HTML file for the current table
+					if(split && !objs.isEmpty())
+					{
+						SchemaParser page_parser;
+						attribs_map page_attribs = attribs;
+
+						page_attribs[Attributes::Objects] = objs;
+						page_parser.ignoreEmptyAttributes(true);
+						pages[chk_idx] = page_parser.getSourceCode(dict_sch_file, page_attribs);
+					}
+					else
+						pages[chk_idx] = objs;
+				}
+				catch(...)
+				{
+					errors[chk_idx] = std::current_exception();
+				}
+			});
+		}
+
+		thread_pool.waitForDone();
+
+		for(int chk_idx = 0; chk_idx < cnt; chk_idx++)
+		{
+			if(errors[chk_idx])
+				std::rethrow_exception(errors[chk_idx]);
+
+			if(!pages[chk_idx].isEmpty())
+				save_func(split ? dict_index_list.at(start + chk_idx) + QString(".html") : Attributes::Database, pages[chk_idx]);
+
+			pages[chk_idx].clear();
+		}
+
+		emit s_objectLoaded(((start + cnt) / static_cast<double>(tab_cnt)) * 100,
+												tr("Generating data dictionary (%1/%2 tables)...").arg(start + cnt).arg(tab_cnt),
+												enum_t(ObjectType::Table));
 	}
+
+	if(!split)
+		save_func(Attributes::Database, page_tail);
 }
 
-void DatabaseModel::saveDataDictionary(const QString &path, bool browsable, bool split)
+void DatabaseModel::getDataDictionary(attribs_map &datadict, bool browsable, bool split)
+{
+	try
+	{
+		datadict.clear();
+		generateDataDictionary(browsable, split, 0, [&datadict](const QString &id, const QString &buffer){
+			datadict[id] += buffer;
+		});
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+	}
+}
+
+void DatabaseModel::saveDataDictionary(const QString &path, bool browsable, bool split, unsigned thread_cnt)
 {
 	try
 	{
-		attribs_map datadict;
-		QByteArray buffer;
 		QFileInfo finfo(path);
 		QDir dir;
-		QString filename;
+
+		/* In standalone mode the file is written to a temporary file which replaces the
+		 * original one only when the whole dictionary is written (see QSaveFile::commit()) */
+		QSaveFile output;
 
 		if(split)
 		{
@@ -12080,17 +12553,38 @@ void DatabaseModel::saveDataDictionary(const QString &path, bool browsable, bool
 				dir.mkpath(path);
 		}
 
-		getDataDictionary(datadict, browsable, split);
-		filename = path;
-
-		for(auto &itr : datadict)
-		{
+		/* The pages are written as soon as they are generated. In split mode each page is a separated file
+		 * while in standalone mode the parts of the single HTML file are appended to it */
+		generateDataDictionary(browsable, split, thread_cnt, [&path, &output, split](const QString &id, const QString &buffer){
 			if(split)
-				filename = path + GlobalAttributes::DirSeparator + itr.first;
+			{
+				UtilsNs::saveFile(path + GlobalAttributes::DirSeparator + id, buffer.toUtf8());
+				return;
+			}
 
-			buffer.append(itr.second.toUtf8());
-			UtilsNs::saveFile(filename, buffer);
-			buffer.clear();
+			if(!output.isOpen())
+			{
+				output.setFileName(path);
+				output.open(QFile::WriteOnly);
+
+				if(!output.isOpen())
+					throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(path),
+													ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			}
+
+			QByteArray buf = buffer.toUtf8();
+
+			if(output.write(buf) != buf.size())
+			{
+				throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(path),
+												ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__, nullptr, output.errorString());
+			}
+		});
+
+		if(output.isOpen() && !output.commit())
+		{
+			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(path),
+											ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__, nullptr, output.errorString());
 		}
 	}
 	catch(Exception &e)
@@ -31,6 +31,7 @@ Additionally, this class, saves, loads and generates the XML/SQL definition of a
 #include <QObject>
 #include <QStringList>
 #include <QDateTime>
+#include <QMutex>
 #include "baseobject.h"
 #include "table.h"
 #include "function.h"
@@ -62,8 +63,12 @@ Additionally, this class, saves, loads and generates the XML/SQL definition of a
 #include "transform.h"
 #include "procedure.h"
 #include <algorithm>
+#include <functional>
 #include <locale.h>
 #include "operation.h"
+#include "objectsearchindex.h"
+#include "splitsqlmanifest.h"
+#include "progressthrottle.h"
 
 class ModelWidget;
 
@@ -88,7 +93,27 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		 * to return the list according to the provided type */
 		std::map<ObjectType, std::vector<BaseObject *> *> obj_lists;
 
-		static unsigned dbmodel_id;
+		//! \brief Indexes the name and comment of the objects so findObjects() doesn't need to visit all objects
+		ObjectSearchIndex search_idx;
+
+		static std::atomic<unsigned> dbmodel_id;
+
+		/*! \brief Amount of tables per worker thread handled in each chunk of the data dictionary generation.
+		 * The pages of a whole chunk are kept in memory until they are saved (see generateDataDictionary()) */
+		static constexpr unsigned DataDictChunkFactor = 8;
+
+		//! \brief Placeholder used to split the standalone data dictionary page around the tables dictionaries
+		static const QString DataDictObjsPlaceholder;
+
+		/*! \brief Directory where the binary snapshots of the loaded model files are stored.
+		 * When empty (default) no snapshot is used (see setSnapshotsDirectory()) */
+		static QString snapshots_dir;
+
+		//! \brief Maximum amount of snapshot files kept in the snapshots directory (see pruneSnapshots())
+		static constexpr int MaxSnapshots = 50;
+
+		//! \brief Maximum size (in bytes) of all snapshot files kept in the snapshots directory (see pruneSnapshots())
+		static constexpr qint64 MaxSnapshotsSize = 512LL * 1024 * 1024;
 
 		XmlParser xmlparser;
 
@@ -174,6 +199,23 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		transforms,
 		procedures;
 
+		/*! \brief Stores the permissions indexed by the objects they are applied to. The permissions of
+		 * each object are kept in the same order they appear in the permissions list (which is the one used
+		 * in the code generation) so this index can be used in place of a full scan of that list */
+		std::map<BaseObject *, std::vector<Permission *>> obj_perms;
+
+		/*! \brief Stores the permissions indexed by the roles they reference. Since the roles of a permission
+		 * can be changed after it is added to the model this index is rebuilt on demand (see getRolePermissions()) */
+		std::map<Role *, std::vector<Permission *>> role_perms;
+
+		/*! \brief Indicates that the permissions by role index must be rebuilt before its next use.
+		 * This flag is set when permissions are added, removed or modified */
+		bool role_perms_outdated;
+
+		/*! \brief Serializes the rebuild of the permissions by role index since getObjectReferences() (which uses
+		 * the index) can be called from several threads at once (see ModelValidationHelper) */
+		QMutex role_perms_mtx;
+
 		/*! \brief Stores the xml definition for special objects. This map is used
 		 when revalidating the relationships */
 		std::map<unsigned, QString> xml_special_objs;
@@ -193,13 +235,57 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		append_at_eod,
 
 		//! \brief Indicates that prepended SQL commands must be put at the very beginning of model definition
-		prepend_at_bod;
+		prepend_at_bod,
+
+		//! \brief Indicates that the objects added/modified in the model are being tracked (see startChangesTracking())
+		track_changes;
+
+		//! \brief Stores the objects added or modified since the changes tracking was (re)started
+		QSet<BaseObject *> changed_objs;
+
+		/*! \brief Revision of the model's contents. It is incremented every time an object is added to,
+		 * removed from or modified in the model (see notifyObjectModified()) */
+		quint64 revision,
+
+		//! \brief The revision in which the memoized creation orders were computed (see validateCreationOrders())
+		creation_orders_rev;
+
+		/*! \brief Indicates that objects can't be added to or removed from the model (see setModificationsBlocked()).
+		 * This flag is atomic since it's checked by the thread that owns the model while set by another one */
+		std::atomic<bool> modifs_blocked;
+
+		//! \brief Raises an exception in case the modifications of the model are blocked
+		void checkModificationsBlocked();
+
+		/*! \brief Memoized results of getCreationOrder(SchemaParser::CodeType, bool, bool) in the current revision
+		 * indexed by the combination of the method's parameters */
+		std::map<std::tuple<SchemaParser::CodeType, bool, bool>, std::map<unsigned, BaseObject *>> creation_orders;
+
+		/*! \brief Memoized results of getCreationOrder(BaseObject *, bool) in the current revision indexed by
+		 * the object and the only_children parameter */
+		std::map<std::pair<BaseObject *, bool>, std::vector<BaseObject *>> objs_creation_orders;
+
+		//! \brief Stores the time (in milliseconds) spent in each phase of the last call to loadModel()
+		std::vector<std::pair<QString, qint64>> loading_times;
+
+		/*! \brief Limits the rate of the progress signals emitted per object while loading, saving or generating
+		 * the code of the model so the messages are formatted only when they are actually reported */
+		ProgressThrottle progress_thr;
 
 		//! \brief Stores the last position on the model where the user was editing objects
 		QPoint last_pos;
 
 		double last_zoom;
 
+		//! \brief Discards the memoized creation orders in case they were computed in a previous revision of the model
+		void validateCreationOrders();
+
+		//! \brief Computes the creation order of the whole model (see getCreationOrder(SchemaParser::CodeType, bool, bool))
+		std::map<unsigned, BaseObject *> __getCreationOrder(SchemaParser::CodeType def_type, bool incl_relnn_objs, bool incl_rel1n_constrs);
+
+		//! \brief Computes the creation order of a single object (see getCreationOrder(BaseObject *, bool))
+		std::vector<BaseObject *> __getCreationOrder(BaseObject *object, bool only_children);
+
 		//! \brief Returns an object seaching it by its name and type. The third parameter stores the object index
 		BaseObject *getObject(const QString &name, ObjectType obj_type, int &obj_idx);
 
@@ -223,6 +309,15 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Creates a IndexElement or ExcludeElement from XML depending on type of the 'elem' param.
 		void createElement(Element &elem, TableObject *tab_obj, BaseObject *parent_obj);
 
+		/*! \brief Returns the permission in the model that conflicts with the provided one, this is, the permission
+		 * applied to the same object which has at least one role in common and is of the same kind (GRANT/REVOKE).
+		 * If the provided permission is already in the model it is returned. Returns nullptr when there's no conflict */
+		Permission *getConflictingPermission(Permission *perm);
+
+		/*! \brief Returns the permissions that reference the provided role rebuilding the index by role if needed.
+		 * The returned list remains valid while no permission is added, removed or modified */
+		const std::vector<Permission *> &getRolePermissions(Role *role);
+
 		//! \brief Returns extra error info when loading database models
 		QString getErrorExtraInfo();
 
@@ -286,9 +381,16 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 
 		/*! \brief Saves the appended/prepended code of the database model to a separated file.
 		 * The parameter save_appended tells the method to save appended code instead of prepended code.
-		 * The parameter path is where the file will be saved. The file_prefix is a string that is prepended
-		 * to the filename. Returns true when the file could be saved. */
-		bool saveSplitCustomSQL(bool save_appended, const QString &path, const QString &file_prefix);
+		 * The parameter manifest is the one that handles the writing of the files in the output directory. The file_prefix
+		 * is a string that is prepended to the filename. Returns true when the file could be saved. */
+		bool saveSplitCustomSQL(bool save_appended, SplitSQLManifest &manifest, const QString &file_prefix);
+
+		/*! \brief Generates the data dictionary of all tables rendering them in parallel using the provided amount
+		 * of threads (zero means the ideal thread count). Each generated part is passed, in order, to save_func
+		 * together with the filename it belongs to. In standalone mode (split = false) all parts belong to the same
+		 * file and must be appended to each other */
+		void generateDataDictionary(bool browsable, bool split, unsigned thread_cnt,
+																const std::function<void(const QString &, const QString &)> &save_func);
 
 		//! \brief Returns true if there is at least one relationship in an invalid state
 		bool hasInvalidRelatioships();
@@ -301,6 +403,10 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		void updateRelsGeneratedObjects();
 
 	protected:
+		/*! \brief Flags the object as modified in the search index so it can be reindexed in the next search
+		 * and increments the model's revision discarding the memoized creation orders */
+		virtual void notifyObjectModified(BaseObject *object);
+
 		//! \brief Set the layer names (only to be written in the XML definition)
 		void setLayers(const QStringList &layers);
 
@@ -423,6 +529,34 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		destroyObjects() or delete the entire model */
 		void loadModel(const QString &filename);
 
+		/*! \brief Configures the directory where the binary snapshots of the loaded model files are stored. The snapshot
+		 * of a file is created in the first time it is loaded and it is used in the subsequent loadings while the file
+		 * contents and pgModeler's version don't change, skipping the XML parsing and validation. Note that the snapshot
+		 * stores only the validated XML tree, so the objects creation, relationships validation and foreign key relationships
+		 * update still run in every loading. The file contents are only hashed when its metadata (size and modification times)
+		 * differs from the one stored in the snapshot. An empty directory disables the snapshots usage. The directory is created
+		 * if it doesn't exist and the exceeding snapshots in it are removed (see pruneSnapshots()) */
+		static void setSnapshotsDirectory(const QString &dir);
+
+		/*! \brief Removes the least recently used snapshots (the ones with the oldest modification time, which is renewed
+		 * in each reading) from the snapshots directory while it holds more than MaxSnapshots files or more than MaxSnapshotsSize bytes.
+		 * The most recently used snapshot is always kept. This is called when the snapshots directory is configured and after
+		 * a new snapshot is written */
+		static void pruneSnapshots();
+
+		static QString getSnapshotsDirectory();
+
+		//! \brief Returns the path to the snapshot file of the provided model file
+		static QString getSnapshotFilePath(const QString &filename);
+
+		/*! \brief Returns the stamp that identifies a valid snapshot of the provided model file without reading it,
+		 * which is the hash of the file's path, size, modification and metadata change times combined with pgModeler's version */
+		static QByteArray getSnapshotStamp(const QString &filename);
+
+		/*! \brief Returns the key that identifies a valid snapshot of the provided model file which is the hash
+		 * of the file contents combined with pgModeler's version. This is only computed when the stamp doesn't match */
+		static QByteArray getSnapshotKey(const QString &filename);
+
 		//! \brief Sets the database encoding
 		void setEncoding(EncodingType encod);
 
@@ -497,13 +631,37 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Indicate if the model invalidated
 		void setInvalidated(bool value);
 
+		/*! \brief Starts (or restarts) the tracking of the objects added or modified in the model discarding the ones
+		 * tracked so far. For table children objects the parent table is tracked instead */
+		void startChangesTracking();
+
+		//! \brief Stops the tracking of added/modified objects discarding the ones tracked so far
+		void stopChangesTracking();
+
+		//! \brief Returns if the objects added/modified in the model are being tracked
+		bool isTrackingChanges();
+
+		//! \brief Returns the objects added or modified since the last call to startChangesTracking()
+		std::vector<BaseObject *> getChangedObjects();
+
+		/*! \brief Returns the phases of the last model loading (parsing, objects creation, relationships validation, etc)
+		 * and the time (in milliseconds) spent in each one, in the order they were executed */
+		std::vector<std::pair<QString, qint64>> getLoadingTimes();
+
+		/*! \brief Changes the thread affinity of the graphical objects of the model (the ones that are QObjects).
+		 * This method must be called from the thread in which the objects were created, e.g., at the end of
+		 * a model loading running in a worker thread, so their signals can be safely handled in the provided thread */
+		void moveGraphicObjectsToThread(QThread *thread);
+
 		//! \brief Saves the specified code definition for the model on the specified filename
 		void saveModel(const QString &filename, SchemaParser::CodeType def_type);
 
 		/*! \brief Saves the model's SQL code definition by creating separated files for each object
 		 * The provided path must be a directory. If it does not exists then the method will create
-		 * it prior to the generation of the files. */
-		void saveSplitSQLDefinition(const QString &path, CodeGenMode code_gen_mode = OriginalSql);
+		 * it prior to the generation of the files. In incremental mode a manifest of the generated files
+		 * (see SplitSQLManifest) is kept in the output directory so only the files whose contents changed
+		 * since the previous export are written and the ones that aren't generated anymore are removed. */
+		void saveSplitSQLDefinition(const QString &path, CodeGenMode code_gen_mode = OriginalSql, bool incremental = false);
 
 		/*! \brief Returns the complete SQL/XML defintion for the entire model (including all the other objects).
 		 The parameter 'export_file' is used to format the generated code in a way that can be saved
@@ -541,6 +699,22 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		the object. */
 		std::vector<BaseObject *> getCreationOrder(BaseObject *object, bool only_children);
 
+		/*! \brief Rebuilds the index of permissions by role in case it is outdated. This method must be called before
+		 * calling getObjectReferences() from several threads so the workers only read the index */
+		void updateRolePermissionsIndex();
+
+		/*! \brief Returns the current revision of the model. The revision changes every time an object is added, removed or modified,
+		 * so the creation orders returned by getCreationOrder() are computed only once per revision and reused in the subsequent calls */
+		quint64 getRevision();
+
+		/*! \brief Blocks/unblocks the addition and removal of objects and permissions. While blocked any attempt to
+		 * change the model's contents raises an exception before touching the model. This is used by operations that
+		 * read the model in several threads at once (e.g. ModelValidationHelper::validateModel()) */
+		void setModificationsBlocked(bool value);
+
+		//! \brief Returns if the addition and removal of objects are blocked
+		bool isModificationsBlocked();
+
 		void addRelationship(BaseRelationship *rel, int obj_idx=-1);
 		void removeRelationship(BaseRelationship *rel, int obj_idx=-1);
 		BaseRelationship *getRelationship(unsigned obj_idx, ObjectType rel_type);
@@ -856,11 +1030,17 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Returns the ALTER definition between the current model and the provided one
 		virtual QString getAlterCode(BaseObject *object) final;
 
-		//! \brief Returns the data dictionary of all tables in a single HTML code
+		//! \brief Invalidates the code of the database also incrementing the model's revision (see getRevision())
+		virtual void setCodeInvalidated(bool value) override;
+
+		/*! \brief Returns the data dictionary of all tables. In split mode the map holds each page indexed by its
+		 * filename, otherwise it holds a single HTML code indexed by the attribute Attributes::Database */
 		void getDataDictionary(attribs_map &datadict, bool browsable, bool split);
 
-		//! \brief Saves the data dictionary of all tables in a single HTML file or splitted in several files for each table
-		void saveDataDictionary(const QString &path, bool browsable, bool split);
+		/*! \brief Saves the data dictionary of all tables in a single HTML file or splitted in several files for each table.
+		 * The tables dictionaries are rendered in parallel using the provided amount of threads (zero means the ideal thread count
+		 * of the system) and written as soon as they are generated so the whole data dictionary is never held in memory */
+		void saveDataDictionary(const QString &path, bool browsable, bool split, unsigned thread_cnt = 0);
 
 		/*! \brief Save the graphical objects positions, custom colors and custom points (for relationship lines) to an special file
 				that can be loaded by another model in order to change their objects position */
@@ -371,6 +371,9 @@ void Index::setColumns(const std::vector<Column *> &cols)
 {
 	try
 	{
+		included_cols.clear();
+		setCodeInvalidated(true);
+
 		for(auto &col : cols)
 			addColumn(col);
 	}
@@ -384,6 +387,9 @@ void Index::setSimpleColumns(const std::vector<SimpleColumn> &cols)
 {
 	try
 	{
+		incl_simple_cols.clear();
+		setCodeInvalidated(true);
+
 		for(auto &col : cols)
 			addSimpleColumn(col);
 	}
@@ -0,0 +1,524 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "objectclonehelper.h"
+#include "coreutilsns.h"
+
+ObjectCloneHelper::ObjectCloneHelper(DatabaseModel *model, bool incl_rel_added_objs)
+{
+	if(!model)
+		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	this->model = model;
+	this->incl_rel_added_objs = incl_rel_added_objs;
+}
+
+bool ObjectCloneHelper::isCloneSupported(BaseObject *object, bool incl_rel_added_objs)
+{
+	if(!object || object->isSystemObject())
+		return false;
+
+	ObjectType obj_type = object->getObjectType();
+
+	if(obj_type == ObjectType::Schema || obj_type == ObjectType::Tag ||
+		 obj_type == ObjectType::Textbox || obj_type == ObjectType::Sequence ||
+		 obj_type == ObjectType::Domain)
+		return true;
+
+	/* Partitions and tables with objects added by relationships (in case they are not being cloned
+	 * as ordinary objects) depend on relationships which aren't handled by the cloning process */
+	if(obj_type == ObjectType::Table)
+	{
+		Table *table = dynamic_cast<Table *>(object);
+		return !table->isPartition() && (incl_rel_added_objs || !table->isReferRelationshipAddedObject());
+	}
+
+	if(TableObject::isTableObject(obj_type))
+	{
+		TableObject *tab_obj = dynamic_cast<TableObject *>(object);
+
+		return tab_obj->getParentTable() &&
+					 tab_obj->getParentTable()->getObjectType() == ObjectType::Table &&
+					 (incl_rel_added_objs || !tab_obj->isAddedByRelationship());
+	}
+
+	return false;
+}
+
+bool ObjectCloneHelper::isCloneSupported(const std::vector<BaseObject *> &objects, bool incl_rel_added_objs)
+{
+	TableObject *tab_obj = nullptr;
+
+	if(objects.empty())
+		return false;
+
+	for(auto &object : objects)
+	{
+		if(!isCloneSupported(object, incl_rel_added_objs))
+			return false;
+
+		tab_obj = dynamic_cast<TableObject *>(object);
+
+		if(tab_obj && std::find(objects.begin(), objects.end(), tab_obj->getParentTable()) == objects.end())
+			return false;
+	}
+
+	return true;
+}
+
+void *ObjectCloneHelper::getUserTypeReference(BaseObject *object)
+{
+	if(!object)
+		return nullptr;
+
+	/* The user-defined types are registered using the pointer of the concrete class
+	 * (see DatabaseModel::addTable(), addSequence() and addDomain()) */
+	if(object->getObjectType() == ObjectType::Table)
+		return reinterpret_cast<void *>(dynamic_cast<Table *>(object));
+
+	if(object->getObjectType() == ObjectType::Sequence)
+		return reinterpret_cast<void *>(dynamic_cast<Sequence *>(object));
+
+	if(object->getObjectType() == ObjectType::Domain)
+		return reinterpret_cast<void *>(dynamic_cast<Domain *>(object));
+
+	return nullptr;
+}
+
+std::vector<TableObject *> ObjectCloneHelper::getClonedChildren(PhysicalTable *table)
+{
+	std::vector<TableObject *> child_objs;
+
+	for(auto &type : BaseObject::getChildObjectTypes(table->getObjectType()))
+	{
+		for(auto &child : *table->getObjectList(type))
+		{
+			if(incl_rel_added_objs || !child->isAddedByRelationship())
+				child_objs.push_back(child);
+		}
+	}
+
+	return child_objs;
+}
+
+BaseObject *ObjectCloneHelper::cloneObject(BaseObject *object)
+{
+	if(!object)
+		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	if(clones.count(object))
+		return clones[object];
+
+	if(!isCloneSupported(object, incl_rel_added_objs) || TableObject::isTableObject(object->getObjectType()))
+		throw Exception(ErrorCode::OprObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	BaseObject *clone = nullptr, *child_clone = nullptr;
+	PhysicalTable *table = dynamic_cast<PhysicalTable *>(object);
+	void *ptype = getUserTypeReference(object);
+
+	CoreUtilsNs::copyObject(&clone, object, object->getObjectType());
+
+	// The clone is not part of any model until it is inserted in the destination model
+	clone->setDatabase(nullptr);
+	clones[object] = clone;
+
+	if(ptype)
+		user_types[ptype] = getUserTypeReference(clone);
+
+	if(table)
+	{
+		for(auto &child : getClonedChildren(table))
+		{
+			child_clone = nullptr;
+			CoreUtilsNs::copyObject(&child_clone, child, child->getObjectType());
+			dynamic_cast<TableObject *>(child_clone)->setParentTable(nullptr);
+			child_clone->setDatabase(nullptr);
+			children[clone].push_back({ child, dynamic_cast<TableObject *>(child_clone) });
+		}
+	}
+
+	return clone;
+}
+
+BaseObject *ObjectCloneHelper::getClone(BaseObject *object)
+{
+	auto itr = clones.find(object);
+	return itr != clones.end() ? itr->second : nullptr;
+}
+
+void ObjectCloneHelper::discardClone(BaseObject *object)
+{
+	clones.erase(object);
+	user_types.erase(getUserTypeReference(object));
+}
+
+void ObjectCloneHelper::destroyClone(BaseObject *clone)
+{
+	if(!clone)
+		return;
+
+	for(auto itr = clones.begin(); itr != clones.end(); itr++)
+	{
+		if(itr->second == clone)
+		{
+			discardClone(itr->first);
+			break;
+		}
+	}
+
+	// Children not inserted in the cloned table (including the pending foreign keys) aren't destroyed together with it
+	for(auto &child : children[clone])
+	{
+		if(child.second->getParentTable() != clone)
+			delete child.second;
+	}
+
+	children.erase(clone);
+
+	pending_fks.erase(std::remove_if(pending_fks.begin(), pending_fks.end(),
+																	 [clone](const std::pair<PhysicalTable *, Constraint *> &pend){
+		return pend.first == clone;
+	}), pending_fks.end());
+
+	pending_seqs.erase(std::remove_if(pending_seqs.begin(), pending_seqs.end(),
+																		[clone](const std::pair<Sequence *, Column *> &pend){
+		return pend.first == clone;
+	}), pending_seqs.end());
+
+	delete clone;
+}
+
+BaseObject *ObjectCloneHelper::resolveReference(BaseObject *object, BaseObject *ref)
+{
+	if(!ref)
+		return nullptr;
+
+	auto itr = clones.find(ref);
+
+	if(itr != clones.end())
+		return itr->second;
+
+	BaseObject *obj = nullptr;
+	TableObject *tab_obj = dynamic_cast<TableObject *>(ref);
+
+	if(tab_obj)
+	{
+		BaseTable *parent = dynamic_cast<BaseTable *>(resolveReference(object, tab_obj->getParentTable()));
+
+		if(parent == tab_obj->getParentTable())
+			return ref;
+
+		obj = parent->getObject(tab_obj->getName(), tab_obj->getObjectType());
+	}
+	else if(ref->getDatabase() == model)
+		return ref;
+	else
+		obj = model->getObject(ref->getSignature(), ref->getObjectType());
+
+	if(!obj)
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::RefObjectInexistsModel)
+										.arg(object->getName(true), object->getTypeName(),
+												 ref->getSignature(), ref->getTypeName()),
+										ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	return obj;
+}
+
+std::vector<Column *> ObjectCloneHelper::resolveColumns(BaseObject *object, const std::vector<Column *> &cols)
+{
+	std::vector<Column *> res_cols;
+
+	for(auto &col : cols)
+		res_cols.push_back(dynamic_cast<Column *>(resolveReference(object, col)));
+
+	return res_cols;
+}
+
+PgSqlType ObjectCloneHelper::resolveType(BaseObject *object, PgSqlType type)
+{
+	if(!type.isUserType())
+		return type;
+
+	void *ptype = type.getUserTypeReference();
+	auto itr = user_types.find(ptype);
+	unsigned type_id = PgSqlType::Null;
+
+	if(itr != user_types.end())
+		type_id = PgSqlType::getUserTypeIndex("", itr->second, model);
+	else if(PgSqlType::getUserTypeIndex("", ptype, model) != PgSqlType::Null)
+		return type;
+	else
+		type_id = PgSqlType::getUserTypeIndex(~type, nullptr, model);
+
+	if(type_id == PgSqlType::Null)
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::RefUserTypeInexistsModel),
+										ErrorCode::RefUserTypeInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__, nullptr,
+										QString("%1 (%2)").arg(object->getName(true), object->getTypeName()));
+	}
+
+	// Only the type index changes, dimension, length and the other attributes are preserved
+	type = type_id;
+	return type;
+}
+
+void ObjectCloneHelper::resolveElement(BaseObject *object, Element &elem)
+{
+	if(elem.getColumn())
+		elem.setColumn(dynamic_cast<Column *>(resolveReference(object, elem.getColumn())));
+
+	if(elem.getOperatorClass())
+		elem.setOperatorClass(dynamic_cast<OperatorClass *>(resolveReference(object, elem.getOperatorClass())));
+
+	if(elem.getCollation())
+		elem.setCollation(dynamic_cast<Collation *>(resolveReference(object, elem.getCollation())));
+
+	if(elem.getOperator())
+		elem.setOperator(dynamic_cast<Operator *>(resolveReference(object, elem.getOperator())));
+}
+
+void ObjectCloneHelper::resolveBaseReferences(BaseObject *orig_obj, BaseObject *clone)
+{
+	if(orig_obj->getSchema())
+		clone->setSchema(resolveReference(orig_obj, orig_obj->getSchema()));
+
+	if(orig_obj->getOwner())
+		clone->setOwner(resolveReference(orig_obj, orig_obj->getOwner()));
+
+	if(orig_obj->getTablespace())
+		clone->setTablespace(resolveReference(orig_obj, orig_obj->getTablespace()));
+
+	// The collation is not copied by the assignment operators so it's always taken from the original object
+	if(orig_obj->getCollation())
+		clone->setCollation(resolveReference(orig_obj, orig_obj->getCollation()));
+}
+
+void ObjectCloneHelper::resolveChildReferences(TableObject *orig_obj, TableObject *clone)
+{
+	ObjectType obj_type = clone->getObjectType();
+	std::vector<Column *> cols;
+
+	resolveBaseReferences(orig_obj, clone);
+
+	if(obj_type == ObjectType::Column)
+	{
+		Column *col = dynamic_cast<Column *>(clone);
+
+		// Columns cloned from relationship added ones become ordinary columns
+		col->setParentRelationship(nullptr);
+		col->setType(resolveType(orig_obj, col->getType()));
+
+		if(col->getSequence())
+			col->setSequence(resolveReference(orig_obj, col->getSequence()));
+	}
+	else if(obj_type == ObjectType::Constraint)
+	{
+		Constraint *constr = dynamic_cast<Constraint *>(clone);
+		std::vector<ExcludeElement> elems = constr->getExcludeElements();
+
+		/* The column lists are replaced (instead of removed via removeColumns()) because the removal
+		 * would change the not-null state of the columns of the original table in case of primary keys */
+		constr->addColumns(resolveColumns(orig_obj, constr->getColumns(Constraint::SourceCols)), Constraint::SourceCols);
+
+		if(constr->getReferencedTable())
+		{
+			constr->setReferencedTable(dynamic_cast<BaseTable *>(resolveReference(orig_obj, constr->getReferencedTable())));
+			constr->addColumns(resolveColumns(orig_obj, constr->getColumns(Constraint::ReferencedCols)), Constraint::ReferencedCols);
+		}
+
+		if(!elems.empty())
+		{
+			for(auto &elem : elems)
+				resolveElement(orig_obj, elem);
+
+			constr->addExcludeElements(elems);
+		}
+	}
+	else if(obj_type == ObjectType::Index)
+	{
+		Index *index = dynamic_cast<Index *>(clone);
+		std::vector<IndexElement> elems = index->getIndexElements();
+
+		for(auto &elem : elems)
+			resolveElement(orig_obj, elem);
+
+		index->addIndexElements(elems);
+		index->setColumns(resolveColumns(orig_obj, index->getColumns()));
+	}
+	else if(obj_type == ObjectType::Trigger)
+	{
+		Trigger *trigger = dynamic_cast<Trigger *>(clone);
+
+		if(trigger->getFunction())
+			trigger->setFunction(dynamic_cast<Function *>(resolveReference(orig_obj, trigger->getFunction())));
+
+		if(trigger->getReferencedTable())
+			trigger->setReferecendTable(dynamic_cast<BaseTable *>(resolveReference(orig_obj, trigger->getReferencedTable())));
+
+		for(unsigned idx = 0; idx < trigger->getColumnCount(); idx++)
+			cols.push_back(trigger->getColumn(idx));
+
+		trigger->removeColumns();
+
+		for(auto &col : resolveColumns(orig_obj, cols))
+			trigger->addColumn(col);
+	}
+	else if(obj_type == ObjectType::Policy)
+	{
+		Policy *policy = dynamic_cast<Policy *>(clone);
+		std::vector<Role *> roles = policy->getRoles();
+
+		policy->removeRoles();
+
+		for(auto &role : roles)
+			policy->addRole(dynamic_cast<Role *>(resolveReference(orig_obj, role)));
+	}
+}
+
+void ObjectCloneHelper::resolveReferences(BaseObject *object)
+{
+	BaseObject *clone = getClone(object);
+
+	if(!clone)
+		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	try
+	{
+		ObjectType obj_type = object->getObjectType();
+
+		resolveBaseReferences(object, clone);
+
+		if(obj_type == ObjectType::Domain)
+		{
+			Domain *domain = dynamic_cast<Domain *>(clone);
+			domain->setType(resolveType(object, domain->getType()));
+		}
+		else if(obj_type == ObjectType::Sequence)
+		{
+			Sequence *seq = dynamic_cast<Sequence *>(clone);
+
+			// The owner column is set only when the table that owns it is in the model (see finishCloning())
+			if(seq->getOwnerColumn())
+			{
+				pending_seqs.push_back({ seq, seq->getOwnerColumn() });
+				seq->setOwnerColumn(nullptr);
+			}
+		}
+		else if(obj_type == ObjectType::Table)
+		{
+			Table *table = dynamic_cast<Table *>(object), *tab_clone = dynamic_cast<Table *>(clone);
+			std::vector<PartitionKey> part_keys = tab_clone->getPartitionKeys();
+			Constraint *constr = nullptr;
+
+			if(table->getTag())
+				tab_clone->setTag(dynamic_cast<Tag *>(resolveReference(object, table->getTag())));
+
+			for(auto &[child, child_clone] : children[clone])
+			{
+				constr = dynamic_cast<Constraint *>(child_clone);
+
+				/* Foreign keys are inserted only when all objects are in the model since they can
+				 * reference tables that are inserted after the current one. Their source columns, on
+				 * the other hand, belong to the cloned table so they are resolved right away */
+				if(constr && constr->getConstraintType() == ConstraintType::ForeignKey)
+				{
+					constr->addColumns(resolveColumns(child, constr->getColumns(Constraint::SourceCols)), Constraint::SourceCols);
+					pending_fks.push_back({ tab_clone, constr });
+					continue;
+				}
+
+				resolveChildReferences(child, child_clone);
+				tab_clone->addObject(child_clone);
+			}
+
+			if(!part_keys.empty())
+			{
+				for(auto &part_key : part_keys)
+					resolveElement(object, part_key);
+
+				tab_clone->addPartitionKeys(part_keys);
+			}
+		}
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+	}
+}
+
+void ObjectCloneHelper::finishCloning(std::vector<Constraint *> &added_fks, std::vector<Exception> &errors)
+{
+	std::vector<Table *> upd_tables;
+	Table *table = nullptr;
+
+	for(auto &[tab_clone, fk] : pending_fks)
+	{
+		table = dynamic_cast<Table *>(tab_clone);
+
+		try
+		{
+			// The foreign key is discarded if its table could not be inserted in the model
+			if(tab_clone->getDatabase() != model)
+			{
+				delete fk;
+				continue;
+			}
+
+			resolveChildReferences(fk, fk);
+			tab_clone->addObject(fk);
+			added_fks.push_back(fk);
+
+			if(std::find(upd_tables.begin(), upd_tables.end(), table) == upd_tables.end())
+				upd_tables.push_back(table);
+		}
+		catch(Exception &e)
+		{
+			if(tab_clone->getObjectIndex(fk) < 0)
+				delete fk;
+
+			errors.push_back(Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e));
+		}
+	}
+
+	for(auto &[seq, owner_col] : pending_seqs)
+	{
+		try
+		{
+			if(seq->getDatabase() == model)
+				seq->setOwnerColumn(dynamic_cast<Column *>(resolveReference(seq, owner_col)));
+		}
+		catch(Exception &e)
+		{
+			errors.push_back(Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e));
+		}
+	}
+
+	for(auto &tab : upd_tables)
+	{
+		model->updateTableFKRelationships(tab);
+		tab->setModified(true);
+	}
+
+	clones.clear();
+	children.clear();
+	user_types.clear();
+	pending_fks.clear();
+	pending_seqs.clear();
+}
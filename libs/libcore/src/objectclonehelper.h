@@ -0,0 +1,121 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libcore
+\class ObjectCloneHelper
+\brief Implements the in-process (deep) copy of a set of objects into a database model without generating and parsing
+their XML code. Each original object is cloned via CoreUtilsNs::copyObject() and the references of the clones (schema,
+owner, tablespace, collation, data types, columns, referenced tables, etc) are remapped to the clones of the referenced
+objects or, when the referenced objects are not being cloned, to the objects with the same signature in the destination model.
+The usual workflow is: cloneObject() for every object, resolveReferences() just before inserting each clone in the model
+and finishCloning() after all clones are inserted so deferred references (foreign keys and sequence owners) can be set.
+*/
+
+#ifndef OBJECT_CLONE_HELPER_H
+#define OBJECT_CLONE_HELPER_H
+
+#include "databasemodel.h"
+
+class __libcore ObjectCloneHelper {
+	private:
+		//! \brief The model in which the clones will be inserted
+		DatabaseModel *model;
+
+		//! \brief Indicates that the objects added by relationships must be cloned as ordinary objects
+		bool incl_rel_added_objs;
+
+		//! \brief Maps the original objects to their clones
+		std::map<BaseObject *, BaseObject *> clones;
+
+		/*! \brief Stores the original children objects and their clones (in this order) of each cloned table.
+		 * References to table children are always resolved by name through their (resolved) parent tables */
+		std::map<BaseObject *, std::vector<std::pair<TableObject *, TableObject *>>> children;
+
+		//! \brief Maps the original user-defined types (tables, sequences and domains) to their clones
+		std::map<void *, void *> user_types;
+
+		//! \brief Foreign keys that are only resolved and added to their (cloned) tables in finishCloning()
+		std::vector<std::pair<PhysicalTable *, Constraint *>> pending_fks;
+
+		//! \brief Cloned sequences (and their original owner columns) that will have the owner column set in finishCloning()
+		std::vector<std::pair<Sequence *, Column *>> pending_seqs;
+
+		//! \brief Returns the pointer used to register the object as user-defined type (see PgSqlType::addUserType())
+		static void *getUserTypeReference(BaseObject *object);
+
+		//! \brief Returns the table children that must be cloned together with the provided table
+		std::vector<TableObject *> getClonedChildren(PhysicalTable *table);
+
+		/*! \brief Returns the object in the destination model that must replace the provided reference in the clone of object.
+		 * An exception is raised if the reference can't be resolved */
+		BaseObject *resolveReference(BaseObject *object, BaseObject *ref);
+
+		//! \brief Returns the provided columns resolved via resolveReference()
+		std::vector<Column *> resolveColumns(BaseObject *object, const std::vector<Column *> &cols);
+
+		//! \brief Returns the provided data type remapped to the clone or to the equivalent type in the destination model
+		PgSqlType resolveType(BaseObject *object, PgSqlType type);
+
+		//! \brief Remaps the column, operator class, collation and operator referenced by the element
+		void resolveElement(BaseObject *object, Element &elem);
+
+		//! \brief Remaps the schema, owner, tablespace and collation of the clone using the values of the original object
+		void resolveBaseReferences(BaseObject *orig_obj, BaseObject *clone);
+
+		//! \brief Remaps the references of a cloned table child object
+		void resolveChildReferences(TableObject *orig_obj, TableObject *clone);
+
+	public:
+		ObjectCloneHelper(DatabaseModel *model, bool incl_rel_added_objs);
+
+		//! \brief Returns if the object (and its children, in case of tables) can be cloned
+		static bool isCloneSupported(BaseObject *object, bool incl_rel_added_objs);
+
+		/*! \brief Returns if all the objects in the list can be cloned. Table children objects in the list
+		 * are supported only if their parent tables are in the list too since they are cloned together with them */
+		static bool isCloneSupported(const std::vector<BaseObject *> &objects, bool incl_rel_added_objs);
+
+		/*! \brief Creates the clone of the object (tables are cloned together with their children) keeping the references
+		 * to the original objects. Table children objects can't be cloned individually. The returned object is not inserted
+		 * in the model and belongs to the caller, in case it can't be inserted it must be deallocated via destroyClone() */
+		BaseObject *cloneObject(BaseObject *object);
+
+		//! \brief Returns the clone of the original object or nullptr if it was not cloned
+		BaseObject *getClone(BaseObject *object);
+
+		/*! \brief Removes the clone of the object from the remapping table so the references to the original object are
+		 * resolved to the object with the same signature in the destination model. This is used when the clone needs
+		 * to be renamed due to conflicts with existing objects */
+		void discardClone(BaseObject *object);
+
+		//! \brief Deallocates a clone (and its children) that could not be inserted in the model
+		void destroyClone(BaseObject *clone);
+
+		/*! \brief Remaps the references of the clone of the provided original object. This method must be called just before
+		 * inserting the clone in the model. In case of tables, the cloned children are inserted in the cloned table
+		 * except for the foreign keys which are inserted by finishCloning() */
+		void resolveReferences(BaseObject *object);
+
+		/*! \brief Inserts the pending foreign keys in their tables and sets the owner columns of the cloned sequences.
+		 * The foreign keys inserted are returned in added_fks (so they can be registered in the operation history) and
+		 * the errors raised during the process are returned in errors. The helper is reset after calling this method */
+		void finishCloning(std::vector<Constraint *> &added_fks, std::vector<Exception> &errors);
+};
+
+#endif
@@ -0,0 +1,310 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "objectsearchindex.h"
+#include "physicaltable.h"
+#include "view.h"
+
+const QChar ObjectSearchIndex::StartDelimiter(0x02);
+const QChar ObjectSearchIndex::EndDelimiter(0x03);
+
+ObjectSearchIndex::ObjectSearchIndex()
+{
+	attr_idxs[Attributes::Name];
+	attr_idxs[Attributes::Comment];
+}
+
+bool ObjectSearchIndex::isAttributeIndexed(const QString &search_attr)
+{
+	return search_attr == Attributes::Name || search_attr == Attributes::Comment;
+}
+
+bool ObjectSearchIndex::isTypeIndexed(ObjectType obj_type)
+{
+	/* Database and permissions aren't stored in the index as well as objects
+	 * which names are generated from other objects (casts, transforms and user mappings)
+	 * since they can change without any notification to the index */
+	static const std::vector<ObjectType> excl_types = {
+		ObjectType::Database, ObjectType::Permission, ObjectType::Cast,
+		ObjectType::Transform, ObjectType::UserMapping, ObjectType::BaseObject
+	};
+
+	return std::find(excl_types.begin(), excl_types.end(), obj_type) == excl_types.end();
+}
+
+QStringList ObjectSearchIndex::getTrigrams(const QString &str)
+{
+	QStringList trigrams;
+
+	for(int pos = 0; pos + 3 <= str.size(); pos++)
+		trigrams.append(str.mid(pos, 3));
+
+	return trigrams;
+}
+
+QString ObjectSearchIndex::getAttributeValue(BaseObject *object, const QString &search_attr)
+{
+	if(search_attr == Attributes::Comment)
+		return object->getComment();
+
+	return object->getName(false);
+}
+
+std::vector<BaseObject *> ObjectSearchIndex::getIndexedChildren(BaseObject *object)
+{
+	PhysicalTable *table = dynamic_cast<PhysicalTable *>(object);
+
+	if(table)
+		return table->getObjects();
+
+	View *view = dynamic_cast<View *>(object);
+
+	// For views only rules and triggers are searchable (see DatabaseModel::findObjects)
+	if(view)
+		return view->getObjects({ ObjectType::Index });
+
+	return {};
+}
+
+void ObjectSearchIndex::indexObject(BaseObject *object)
+{
+	QString value, folded;
+
+	for(auto &[attr, attr_idx] : attr_idxs)
+	{
+		value = getAttributeValue(object, attr);
+		folded = value.toLower();
+
+		attr_idx.values[object] = value;
+		attr_idx.exact_idx[folded].insert(object);
+
+		for(auto &trigram : getTrigrams(StartDelimiter + folded + EndDelimiter))
+			attr_idx.trigram_idx[trigram].insert(object);
+	}
+}
+
+void ObjectSearchIndex::unindexObject(BaseObject *object)
+{
+	QString folded;
+
+	for(auto &[attr, attr_idx] : attr_idxs)
+	{
+		if(!attr_idx.values.contains(object))
+			continue;
+
+		/* The previous value stored in the index is used to locate the entries of the object
+		 * since the object itself can have been modified (or even destroyed) */
+		folded = attr_idx.values.take(object).toLower();
+
+		if(attr_idx.exact_idx.contains(folded))
+		{
+			attr_idx.exact_idx[folded].remove(object);
+
+			if(attr_idx.exact_idx[folded].isEmpty())
+				attr_idx.exact_idx.remove(folded);
+		}
+
+		for(auto &trigram : getTrigrams(StartDelimiter + folded + EndDelimiter))
+		{
+			if(!attr_idx.trigram_idx.contains(trigram))
+				continue;
+
+			attr_idx.trigram_idx[trigram].remove(object);
+
+			if(attr_idx.trigram_idx[trigram].isEmpty())
+				attr_idx.trigram_idx.remove(trigram);
+		}
+	}
+}
+
+void ObjectSearchIndex::reindexObject(BaseObject *object)
+{
+	unindexObject(object);
+	indexObject(object);
+
+	if(children.contains(object))
+	{
+		for(auto &child : children.take(object))
+		{
+			unindexObject(child);
+
+			/* If the address of a destroyed child was reused by an object registered
+			 * in the meantime we need to restore the entries of that object */
+			if(objects.contains(child))
+				indexObject(child);
+		}
+	}
+
+	std::vector<BaseObject *> child_objs = getIndexedChildren(object);
+
+	if(child_objs.empty())
+		return;
+
+	for(auto &child : child_objs)
+		indexObject(child);
+
+	children[object] = child_objs;
+}
+
+void ObjectSearchIndex::updateIndex()
+{
+	for(auto &object : std::as_const(modified_objs))
+		reindexObject(object);
+
+	modified_objs.clear();
+}
+
+void ObjectSearchIndex::addObject(BaseObject *object)
+{
+	if(!object || !isTypeIndexed(object->getObjectType()))
+		return;
+
+	objects.insert(object);
+	modified_objs.remove(object);
+	reindexObject(object);
+}
+
+void ObjectSearchIndex::removeObject(BaseObject *object)
+{
+	if(!object || !objects.contains(object))
+		return;
+
+	unindexObject(object);
+
+	if(children.contains(object))
+	{
+		for(auto &child : children.take(object))
+			unindexObject(child);
+	}
+
+	objects.remove(object);
+	modified_objs.remove(object);
+}
+
+void ObjectSearchIndex::setObjectModified(BaseObject *object)
+{
+	if(objects.contains(object))
+		modified_objs.insert(object);
+}
+
+void ObjectSearchIndex::clear()
+{
+	for(auto &[attr, attr_idx] : attr_idxs)
+	{
+		attr_idx.values.clear();
+		attr_idx.exact_idx.clear();
+		attr_idx.trigram_idx.clear();
+	}
+
+	objects.clear();
+	children.clear();
+	modified_objs.clear();
+}
+
+std::vector<BaseObject *> ObjectSearchIndex::findObjects(const QString &pattern, bool is_regexp, bool exact_match,
+																												 const QString &search_attr, const QRegularExpression &regexp)
+{
+	static const QRegularExpression regexp_meta_chars("[\\\\^$.|?*+()\\[\\]{}]"),
+			wildcard_chars("[*?]");
+
+	std::vector<BaseObject *> list;
+
+	if(!isAttributeIndexed(search_attr))
+		return list;
+
+	updateIndex();
+
+	AttributeIndex &attr_idx = attr_idxs[search_attr];
+	QString folded = pattern.toLower();
+	QStringList trigrams;
+	bool use_exact_idx = false, scan_values = false;
+
+	if(!is_regexp)
+	{
+		// Character classes and escapes in wildcard patterns are handled by the regexp only
+		if(pattern.contains('[') || pattern.contains('\\'))
+			scan_values = true;
+		else if(!pattern.contains(wildcard_chars))
+			use_exact_idx = true;
+		else
+		{
+			/* Since the wildcard patterns are anchored, the delimiters are prepended/appended
+			 * to the literal pieces so prefix and suffix searches also use the trigrams */
+			for(auto &piece : QString(StartDelimiter + folded + EndDelimiter).split(wildcard_chars, Qt::SkipEmptyParts))
+				trigrams.append(getTrigrams(piece));
+		}
+	}
+	else if(pattern.contains(regexp_meta_chars))
+		scan_values = true;
+	else if(exact_match)
+		use_exact_idx = true;
+	else
+		trigrams = getTrigrams(folded);
+
+	if(use_exact_idx)
+	{
+		for(auto &object : attr_idx.exact_idx.value(folded))
+		{
+			if(regexp.match(attr_idx.values[object]).hasMatch())
+				list.push_back(object);
+		}
+	}
+	else if(scan_values || trigrams.isEmpty())
+	{
+		for(auto itr = attr_idx.values.cbegin(); itr != attr_idx.values.cend(); itr++)
+		{
+			if(regexp.match(itr.value()).hasMatch())
+				list.push_back(itr.key());
+		}
+	}
+	else
+	{
+		std::vector<const QSet<BaseObject *> *> postings;
+
+		trigrams.removeDuplicates();
+
+		for(auto &trigram : trigrams)
+		{
+			// A single missing trigram means no value can match the pattern
+			if(!attr_idx.trigram_idx.contains(trigram))
+				return list;
+
+			postings.push_back(&attr_idx.trigram_idx[trigram]);
+		}
+
+		// Starting the intersection from the smallest posting list reduces the amount of lookups
+		std::sort(postings.begin(), postings.end(), [](const QSet<BaseObject *> *p1, const QSet<BaseObject *> *p2){
+			return p1->size() < p2->size();
+		});
+
+		bool match = false;
+
+		for(auto &object : *postings.front())
+		{
+			match = true;
+
+			for(auto itr = postings.begin() + 1; itr != postings.end() && match; itr++)
+				match = (*itr)->contains(object);
+
+			if(match && regexp.match(attr_idx.values[object]).hasMatch())
+				list.push_back(object);
+		}
+	}
+
+	return list;
+}
@@ -0,0 +1,118 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libcore
+\class ObjectSearchIndex
+\brief Implements an incrementally maintained index of the search attributes of the objects in a database model.
+For each indexed attribute the index keeps an exact value hash and a trigram index so searches using exact names,
+wildcards or substrings don't need to visit (and configure the search attributes of) every object in the model.
+Objects are only reindexed on demand, when a search occurs, if they were flagged as modified (see setObjectModified()).
+Patterns that can't take advantage of the index (arbitrary regular expressions) are matched against the values cached
+in the index.
+*/
+
+#ifndef OBJECT_SEARCH_INDEX_H
+#define OBJECT_SEARCH_INDEX_H
+
+#include "baseobject.h"
+#include <QHash>
+#include <QSet>
+#include <QRegularExpression>
+
+class __libcore ObjectSearchIndex {
+	private:
+		//! \brief Stores the indexes of a single search attribute
+		struct AttributeIndex {
+			//! \brief The values (as returned by the objects) used to match the search patterns
+			QHash<BaseObject *, QString> values;
+
+			//! \brief Maps the case folded values to the objects
+			QHash<QString, QSet<BaseObject *>> exact_idx;
+
+			//! \brief Maps each trigram of the case folded (and delimited) values to the objects
+			QHash<QString, QSet<BaseObject *>> trigram_idx;
+		};
+
+		//! \brief Characters used to delimit the values so anchored patterns (prefix/suffix) generate trigrams too
+		static const QChar StartDelimiter, EndDelimiter;
+
+		//! \brief Stores the indexes of each supported search attribute
+		std::map<QString, AttributeIndex> attr_idxs;
+
+		//! \brief Stores the objects registered in the index via addObject()
+		QSet<BaseObject *> objects;
+
+		//! \brief Stores the children objects indexed for each table/view
+		QHash<BaseObject *, std::vector<BaseObject *>> children;
+
+		//! \brief Stores the objects that need to be reindexed in the next search
+		QSet<BaseObject *> modified_objs;
+
+		//! \brief Returns the trigrams of the provided (already case folded) string
+		static QStringList getTrigrams(const QString &str);
+
+		//! \brief Returns the value of the search attribute of the object
+		static QString getAttributeValue(BaseObject *object, const QString &search_attr);
+
+		//! \brief Returns the children objects of a table/view that must be indexed
+		static std::vector<BaseObject *> getIndexedChildren(BaseObject *object);
+
+		//! \brief Inserts the object (not its children) in the indexes of all attributes
+		void indexObject(BaseObject *object);
+
+		//! \brief Removes the object (not its children) from the indexes of all attributes without dereferencing it
+		void unindexObject(BaseObject *object);
+
+		//! \brief Reindexes the object and, if it's a table/view, its children objects
+		void reindexObject(BaseObject *object);
+
+		//! \brief Reindexes all the objects flagged as modified
+		void updateIndex();
+
+	public:
+		ObjectSearchIndex();
+
+		//! \brief Returns true if the provided search attribute is handled by the index
+		static bool isAttributeIndexed(const QString &search_attr);
+
+		//! \brief Returns true if the objects of the provided type are handled by the index
+		static bool isTypeIndexed(ObjectType obj_type);
+
+		//! \brief Registers the object in the index. Tables and views have their children objects indexed too
+		void addObject(BaseObject *object);
+
+		//! \brief Removes the object (and its children when it's a table/view) from the index
+		void removeObject(BaseObject *object);
+
+		/*! \brief Flags the object as modified so it can be reindexed in the next search. This method
+		 * is cheap and can be called several times for the same object. Objects not registered are ignored */
+		void setObjectModified(BaseObject *object);
+
+		//! \brief Removes all objects from the index
+		void clear();
+
+		/*! \brief Returns the objects (of any type) whose value of the provided attribute matches the pattern.
+		 * The pattern, is_regexp and exact_match have the same semantics of DatabaseModel::findObjects() and
+		 * the regexp is the expression configured from them which is used to confirm the matches.
+		 * An empty list is returned if the attribute isn't indexed (see isAttributeIndexed()) */
+		std::vector<BaseObject *> findObjects(const QString &pattern, bool is_regexp, bool exact_match,
+																					const QString &search_attr, const QRegularExpression &regexp);
+};
+
+#endif
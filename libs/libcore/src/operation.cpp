@@ -26,6 +26,8 @@ Operation::Operation()
 	object_idx=-1;
 	chain_type=NoChain;
 	op_type=NoOperation;
+	object_type=ObjectType::BaseObject;
+	mem_usage=0;
 }
 
 QString Operation::generateOperationId()
@@ -87,6 +89,22 @@ void Operation::setXMLDefinition(const QString &xml_def)
 	xml_definition=xml_def;
 }
 
+void Operation::setPosition(const QPointF &pos)
+{
+	position=pos;
+}
+
+void Operation::setObjectSignature(const QString &name, ObjectType type)
+{
+	object_name=name;
+	object_type=type;
+}
+
+void Operation::setMemoryUsage(size_t size)
+{
+	mem_usage=size;
+}
+
 int Operation::getObjectIndex()
 {
 	return object_idx;
@@ -127,6 +145,26 @@ QString Operation::getXMLDefinition()
 	return xml_definition;
 }
 
+QPointF Operation::getPosition()
+{
+	return position;
+}
+
+QString Operation::getObjectName()
+{
+	return object_name;
+}
+
+ObjectType Operation::getObjectType()
+{
+	return object_type;
+}
+
+size_t Operation::getMemoryUsage()
+{
+	return mem_usage;
+}
+
 bool Operation::isOperationValid()
 {
 	return (operation_id==generateOperationId());
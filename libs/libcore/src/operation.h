@@ -28,6 +28,7 @@
 #include "baseobject.h"
 #include "permission.h"
 #include <QString>
+#include <QPointF>
 
 class __libcore Operation {
 	public:
@@ -88,6 +89,19 @@ class __libcore Operation {
 		//! \brief Stores the object's permission before it's removal
 		std::vector<Permission *> permissions;
 
+		/*! \brief Stores the position of the graphical object before the operation. This attribute is used only by
+		 * ObjMoved operations which store the previous position instead of a copy of the whole object in the pool */
+		QPointF position;
+
+		/*! \brief Stores the name and type of the object that suffered the operation. These attributes are used to
+		 * describe the operations that don't hold an object in the pool (see position) */
+		QString object_name;
+
+		ObjectType object_type;
+
+		//! \brief Estimated amount of memory (in bytes) retained by the operation and its pool object
+		size_t mem_usage;
+
 		//! \brief Generate an unique id for the operation based upon the memory addresses of objects held by it
 		QString generateOperationId();
 
@@ -102,6 +116,9 @@ class __libcore Operation {
 		void setParentObject(BaseObject *object);
 		void setPermissions(const std::vector<Permission *> &perms);
 		void setXMLDefinition(const QString &xml_def);
+		void setPosition(const QPointF &pos);
+		void setObjectSignature(const QString &name, ObjectType type);
+		void setMemoryUsage(size_t size);
 
 		int getObjectIndex();
 		ChainType getChainType();
@@ -111,6 +128,10 @@ class __libcore Operation {
 		BaseObject *getParentObject();
 		std::vector<Permission *> getPermissions();
 		QString getXMLDefinition();
+		QPointF getPosition();
+		QString getObjectName();
+		ObjectType getObjectType();
+		size_t getMemoryUsage();
 		bool isOperationValid();
 };
 
@@ -20,6 +20,7 @@
 #include "coreutilsns.h"
 
 unsigned OperationList::max_size=500;
+size_t OperationList::max_memory=128 * 1024 * 1024;
 
 OperationList::OperationList(DatabaseModel *model)
 {
@@ -31,6 +32,7 @@ OperationList::OperationList(DatabaseModel *model)
 	this->model=model;
 	xmlparser=model->getXMLParser();
 	current_index=0;
+	mem_usage=0;
 	next_op_chain=Operation::NoChain;
 	ignore_chain=false;
 	operations.reserve(max_size);
@@ -51,6 +53,16 @@ unsigned OperationList::getMaximumSize()
 	return max_size;
 }
 
+size_t OperationList::getMaximumMemory()
+{
+	return max_memory;
+}
+
+size_t OperationList::getMemoryUsage()
+{
+	return mem_usage;
+}
+
 int OperationList::getCurrentIndex()
 {
 	return current_index;
@@ -110,16 +122,13 @@ bool OperationList::isOperationChainStarted()
 
 bool OperationList::isObjectRegistered(BaseObject *object, Operation::OperType op_type)
 {
-	bool registered=false;
-	std::vector<Operation *>::iterator itr=operations.begin();
-
-	while(itr!=operations.end() && !registered)
+	for(auto itr = registered_ops.constFind(object); itr != registered_ops.cend() && itr.key() == object; itr++)
 	{
-		registered=((*itr)->getOriginalObject()==object && (*itr)->getOperationType()==op_type);
-		itr++;
+		if(itr.value()->getOperationType() == op_type)
+			return true;
 	}
 
-	return registered;
+	return false;
 }
 
 bool OperationList::isRedoAvailable()
@@ -146,6 +155,40 @@ void OperationList::setMaximumSize(unsigned max)
 	max_size=max;
 }
 
+void OperationList::setMaximumMemory(size_t max)
+{
+	if(max==0)
+		throw Exception(ErrorCode::AsgInvalidMaxSizeOpList,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	max_memory=max;
+}
+
+size_t OperationList::estimateMemoryUsage(Operation *oper)
+{
+	BaseTable *table=nullptr;
+	size_t size=sizeof(Operation) +
+							(oper->getXMLDefinition().size() * sizeof(QChar)) +
+							(oper->getPermissions().size() * sizeof(Permission *));
+
+	if(oper->getPoolObject())
+	{
+		size+=EstimatedObjectSize;
+		table=dynamic_cast<BaseTable *>(oper->getPoolObject());
+
+		//Tables (and their copies) hold their children objects too
+		if(table)
+			size+=table->getObjects().size() * EstimatedObjectSize;
+	}
+
+	return size;
+}
+
+void OperationList::unregisterOperation(Operation *oper)
+{
+	registered_ops.remove(oper->getOriginalObject(), oper);
+	mem_usage-=std::min(mem_usage, oper->getMemoryUsage());
+}
+
 void OperationList::addToPool(BaseObject *object, Operation::OperType op_type)
 {
 	ObjectType obj_type;
@@ -159,8 +202,12 @@ void OperationList::addToPool(BaseObject *object, Operation::OperType op_type)
 
 		obj_type=object->getObjectType();
 
+		/* Graphical objects about to be moved don't have a copy stored since only their positions
+		 * will change, so the operation itself stores the previous position (see registerObject()) */
+		if(op_type==Operation::ObjMoved && dynamic_cast<BaseGraphicObject *>(object))
+			object_pool.push_back(nullptr);
 		//Stores a copy of the object if its about to be moved or modified
-		if(op_type==Operation::ObjModified ||
+		else if(op_type==Operation::ObjModified ||
 				op_type==Operation::ObjMoved)
 		{
 			BaseObject *copy_obj=nullptr;
@@ -180,6 +227,9 @@ void OperationList::addToPool(BaseObject *object, Operation::OperType op_type)
 		else
 			//Inserts the original object on the pool (in case of adition or deletion operations)
 			object_pool.push_back(object);
+
+		if(object_pool.back())
+			pool_refs[object_pool.back()]++;
 	}
 	catch(Exception &e)
 	{
@@ -203,7 +253,7 @@ void OperationList::removeOperations()
 		/* If the operation is not valid means that in some moment the pool object inside it
 	   was destroyed (by a relationship invalidation for instance) and to avoid crashes
 	   this object is stored in a invalid objects list */
-		if(!oper->isOperationValid())
+		if(!oper->isOperationValid() && oper->getPoolObject())
 			invalid_objs.push_back(oper->getPoolObject());
 
 		delete oper;
@@ -263,6 +313,9 @@ void OperationList::removeOperations()
 	}
 
 	current_index=0;
+	mem_usage=0;
+	registered_ops.clear();
+	pool_refs.clear();
 	unallocated_objs.clear();
 }
 
@@ -278,11 +331,12 @@ void OperationList::validateOperations()
 	{
 		oper=(*itr);
 
-		//Case the object isn't on the pool
-		if(!isObjectOnPool((*itr)->getPoolObject()) ||
+		//Case the object isn't on the pool (operations that don't hold a pool object are ignored)
+		if((oper->getPoolObject() && !isObjectOnPool(oper->getPoolObject())) ||
 				!oper->isOperationValid())
 		{
 			//Remove the operation
+			unregisterOperation(oper);
 			operations.erase(itr);
 			delete oper;
 			itr=operations.begin();
@@ -294,21 +348,10 @@ void OperationList::validateOperations()
 
 bool OperationList::isObjectOnPool(BaseObject *object)
 {
-	bool found=false;
-	std::vector<BaseObject *>::iterator itr, itr_end;
-
 	if(!object)
 		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-	itr=object_pool.begin();
-	itr_end=object_pool.end();
-	while(!found && itr!=itr_end)
-	{
-		found=*(itr)==object;
-		itr++;
-	}
-
-	return found;
+	return pool_refs.contains(object);
 }
 
 void OperationList::removeFromPool(unsigned obj_idx)
@@ -327,6 +370,13 @@ void OperationList::removeFromPool(unsigned obj_idx)
 	//Removes the object from pool
 	object_pool.erase(itr);
 
+	//Operations that don't hold a pool object have a null entry in the pool
+	if(!object)
+		return;
+
+	if(--pool_refs[object] == 0)
+		pool_refs.remove(object);
+
 	/* Stores the object that was in the pool on the 'not_removed_objs' vector.
 		The object will be deleted in the destructor of the list. Note: The object is not
 		deleted immediately because the model / table / list of operations may still
@@ -362,8 +412,9 @@ int OperationList::registerObject(BaseObject *object, Operation::OperType op_typ
 				 ((obj_type==ObjectType::Trigger || obj_type==ObjectType::Rule || obj_type==ObjectType::Index) && !dynamic_cast<BaseTable *>(parent_obj))))
 			throw Exception(ErrorCode::OprObjectInvalidType,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-		//If the operations list is full makes the automatic cleaning before inserting a new operation
-		if(current_index == static_cast<int>(max_size-1))
+		/* If the operations list is full or the memory retained by the operations reached its limit
+		 makes the automatic cleaning before inserting a new operation */
+		if(current_index == static_cast<int>(max_size-1) || mem_usage >= max_memory)
 			removeOperations();
 
 		/* If adding an operation and the current index is not pointing
@@ -379,6 +430,16 @@ int OperationList::registerObject(BaseObject *object, Operation::OperType op_typ
 			while(i >= current_index)
 			{
 				removeFromPool(i);
+
+				/* Operations that don't hold a pool object aren't removed by validateOperations()
+				 * so they are explicitly removed here */
+				if(!operations[i]->getPoolObject())
+				{
+					unregisterOperation(operations[i]);
+					delete operations[i];
+					operations.erase(operations.begin() + i);
+				}
+
 				i--;
 			}
 
@@ -397,6 +458,10 @@ int OperationList::registerObject(BaseObject *object, Operation::OperType op_typ
 
 		//Assigns the pool object to the operation
 		operation->setPoolObject(object_pool.back());
+		operation->setObjectSignature(object->getName(true), obj_type);
+
+		if(!operation->getPoolObject())
+			operation->setPosition(dynamic_cast<BaseGraphicObject *>(object)->getPosition());
 
 		//Stores the object's permission befor its removal
 		if(op_type==Operation::ObjRemoved)
@@ -462,9 +527,11 @@ int OperationList::registerObject(BaseObject *object, Operation::OperType op_typ
 		}
 		else
 		{
-			if((obj_type==ObjectType::Sequence && dynamic_cast<Sequence *>(object)->isReferRelationshipAddedColumn()) ||
+			//Operations that only store the object's position don't need the XML definition
+			if(operation->getPoolObject() &&
+				 ((obj_type==ObjectType::Sequence && dynamic_cast<Sequence *>(object)->isReferRelationshipAddedColumn()) ||
 					(obj_type==ObjectType::View && dynamic_cast<View *>(object)->isReferRelationshipAddedColumn()) ||
-					(obj_type==ObjectType::GenericSql && dynamic_cast<GenericSQL *>(object)->isReferRelationshipAddedObject()))
+					(obj_type==ObjectType::GenericSql && dynamic_cast<GenericSQL *>(object)->isReferRelationshipAddedObject())))
 				operation->setXMLDefinition(object->getSourceCode(SchemaParser::XmlCode));
 
 			//Case a specific index wasn't specified
@@ -480,7 +547,10 @@ int OperationList::registerObject(BaseObject *object, Operation::OperType op_typ
 			operation->setXMLDefinition(object->getSourceCode(SchemaParser::XmlCode));
 
 		operation->setObjectIndex(obj_idx);
+		operation->setMemoryUsage(estimateMemoryUsage(operation));
 		operations.push_back(operation);
+		registered_ops.insert(object, operation);
+		mem_usage+=operation->getMemoryUsage();
 		current_index=operations.size();
 
 		//Registering a log entry for the object modification in database model's change log
@@ -514,11 +584,21 @@ void OperationList::getOperationData(unsigned oper_idx, unsigned &oper_type, QSt
 	if(operation->isOperationValid())
 	{
 		pool_obj=operation->getPoolObject();
-		obj_type=pool_obj->getObjectType();
-		obj_name=pool_obj->getName(true);
 
-		if(TableObject::isTableObject(obj_type))
-			obj_name=operation->getParentObject()->getName(true) + QString(".") + obj_name;
+		//Operations without pool object use the name and type of the object at the moment of the registration
+		if(!pool_obj)
+		{
+			obj_type=operation->getObjectType();
+			obj_name=operation->getObjectName();
+		}
+		else
+		{
+			obj_type=pool_obj->getObjectType();
+			obj_name=pool_obj->getName(true);
+
+			if(TableObject::isTableObject(obj_type))
+				obj_name=operation->getParentObject()->getName(true) + QString(".") + obj_name;
+		}
 	}
 	else
 	{
@@ -696,7 +776,7 @@ void OperationList::executeOperation(Operation *oper, bool redo)
 		int obj_idx=-1;
 
 		object=oper->getPoolObject();
-		obj_type=object->getObjectType();
+		obj_type=(object ? object->getObjectType() : oper->getObjectType());
 		parent_obj=oper->getParentObject();
 		xml_def=oper->getXMLDefinition();
 		op_type=oper->getOperationType();
@@ -743,9 +823,24 @@ void OperationList::executeOperation(Operation *oper, bool redo)
 				aux_obj=model->createGenericSQL();
 		}
 
+		/* If the operation is a moved object without copy in the pool, the current position
+			of the object is swapped with the one stored in the operation so it can be undone/redone */
+		if(op_type==Operation::ObjMoved && !object)
+		{
+			BaseGraphicObject *graph_obj=dynamic_cast<BaseGraphicObject *>(model->getObject(obj_idx, obj_type));
+			QPointF curr_pos;
+
+			if(!graph_obj)
+				throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			curr_pos=graph_obj->getPosition();
+			graph_obj->setPosition(oper->getPosition());
+			oper->setPosition(curr_pos);
+			object=graph_obj;
+		}
 		/* If the operation is a modified/moved object, the object copy
 			stored in the pool will be restored */
-		if(op_type==Operation::ObjModified || op_type==Operation::ObjMoved)
+		else if(op_type==Operation::ObjModified || op_type==Operation::ObjMoved)
 		{
 			if(obj_type==ObjectType::Relationship)
 			{
@@ -999,7 +1094,10 @@ void OperationList::removeLastOperation()
 
 		//Erasing the excluded operations
 		for(int i=operations.size()-1; i > oper_idx ; i--)
+		{
+			unregisterOperation(operations[i]);
 			operations.erase(operations.begin() + i);
+		}
 
 		//Validates the remaining operations
 		validateOperations();
@@ -1013,21 +1111,10 @@ void OperationList::removeLastOperation()
 
 void OperationList::updateObjectIndex(BaseObject *object, unsigned new_idx)
 {
-	std::vector<Operation *>::iterator itr, itr_end;
-	Operation *oper=nullptr;
-
 	if(!object)
 		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-	itr=operations.begin();
-	itr_end=operations.end();
-
-	while(itr!=itr_end)
-	{
-		oper=(*itr);
-		if(oper->getOriginalObject()==object)
-			oper->setObjectIndex(new_idx);
-		itr++;
-	}
+	for(auto itr = registered_ops.constFind(object); itr != registered_ops.cend() && itr.key() == object; itr++)
+		itr.value()->setObjectIndex(new_idx);
 }
 
@@ -35,6 +35,10 @@ class __libcore OperationList: public QObject {
 	private:
 		Q_OBJECT
 
+		/*! \brief Amount of memory (in bytes) assumed for each object held by the pool. This is a rough
+		 * estimation used only to limit the memory retained by the operations (see max_memory) */
+		static constexpr size_t EstimatedObjectSize = 2048;
+
 		//! \brief Inidcates that operation chaining is ignored temporarily
 		bool ignore_chain;
 
@@ -55,12 +59,24 @@ class __libcore OperationList: public QObject {
 		//! \brief Stores the operations executed by the user
 		std::vector<Operation *> operations;
 
+		//! \brief Stores how many times each object appears in the pool (used to speed up isObjectOnPool())
+		QHash<BaseObject *, unsigned> pool_refs;
+
+		//! \brief Maps the original objects to the operations in which they are registered (used to speed up isObjectRegistered())
+		QMultiHash<BaseObject *, Operation *> registered_ops;
+
+		//! \brief Estimated amount of memory (in bytes) retained by the operations in the list
+		size_t mem_usage;
+
 		//! \brief Database model that is linked with this operation list
 		DatabaseModel *model;
 
 		//! \brief Maximum number of stored operations (global)
 		static unsigned max_size;
 
+		//! \brief Maximum amount of memory (in bytes, estimated) retained by the stored operations (global)
+		static size_t max_memory;
+
 		/*! \brief Stores the type of chain to the next operation to be stored
 		 in the list. This attribute is used in conjunction with the chaining
 		 initialization / finalization methods. */
@@ -93,6 +109,13 @@ class __libcore OperationList: public QObject {
 		//! \brief Returns the chain size from the current element
 		unsigned getChainSize();
 
+		//! \brief Returns the estimated amount of memory (in bytes) retained by the operation and its pool object
+		size_t estimateMemoryUsage(Operation *oper);
+
+		/*! \brief Removes the references to the operation from the auxiliary structures (registered objects
+		 * and memory usage). This method must be called before an operation is removed from the list */
+		void unregisterOperation(Operation *oper);
+
 	public:
 		OperationList(DatabaseModel *model);
 		virtual ~OperationList();
@@ -138,6 +161,10 @@ class __libcore OperationList: public QObject {
 		//! \brief Sets the maximum size for the list
 		static void setMaximumSize(unsigned max);
 
+		/*! \brief Sets the maximum amount of memory (in bytes) that can be retained by the operations. When this limit
+		 * is reached the list is cleaned in the same way it's done when the maximum size is reached */
+		static void setMaximumMemory(size_t max);
+
 		/*! \brief Registers in the list of operations that the passed object suffered some kind
 		 of modification (modified, removed, inserted, moved) in addition the method stores
 		 its original content.
@@ -146,6 +173,8 @@ class __libcore OperationList: public QObject {
 		 object the order of restoration / re-execution of operations can be broken and cause
 	 segmentations fault.
 
+	 For ObjMoved operations over graphical objects only the object's position is stored instead of a copy of the object.
+
 	 In case of success this method returns an integer indicating the last registered operation ID */
 		int registerObject(BaseObject *object, Operation::OperType op_type, int object_idx=-1, BaseObject *parent_obj=nullptr);
 
@@ -155,6 +184,12 @@ class __libcore OperationList: public QObject {
 		//! \brief Gets the current size for the operation list
 		unsigned getCurrentSize();
 
+		//! \brief Gets the maximum amount of memory (in bytes) that can be retained by the operations
+		size_t getMaximumMemory();
+
+		//! \brief Gets the estimated amount of memory (in bytes) retained by the operations currently in the list
+		size_t getMemoryUsage();
+
 		//! \brief Gets the current operation index
 		int getCurrentIndex();
 
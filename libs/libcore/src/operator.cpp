@@ -86,6 +86,7 @@ void Operator::setName(const QString &name)
 	else	if(!isValidName(name))
 		throw Exception(ErrorCode::AsgInvalidNameObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
+	setCodeInvalidated(this->obj_name != name);
 	this->obj_name=name;
 }
 
@@ -21,6 +21,8 @@
 
 std::vector<UserTypeConfig> PgSqlType::user_types;
 
+QRecursiveMutex PgSqlType::user_types_mtx;
+
 QStringList PgSqlType::type_names =
 {
 	"", // Reserved for Class::Null
@@ -304,6 +306,8 @@ unsigned PgSqlType::operator = (const QString &type_name)
 
 void *PgSqlType::getUserTypeReference()
 {
+	QMutexLocker locker(&user_types_mtx);
+
 	if(this->isUserType())
 		return (user_types[this->type_idx - (PseudoEnd + 1)].ptype);
 	else
@@ -312,6 +316,8 @@ void *PgSqlType::getUserTypeReference()
 
 unsigned PgSqlType::getUserTypeConfig()
 {
+	QMutexLocker locker(&user_types_mtx);
+
 	if(this->isUserType())
 		return (user_types[this->type_idx - (PseudoEnd + 1)].type_conf);
 	else
@@ -496,6 +502,8 @@ void PgSqlType::setWithTimezone(bool with_tz)
 
 unsigned PgSqlType::setUserType(unsigned type_id)
 {
+	QMutexLocker locker(&user_types_mtx);
+
 	unsigned lim1 = PseudoEnd + 1,
 			lim2 = lim1 + PgSqlType::user_types.size();
 
@@ -522,6 +530,8 @@ unsigned PgSqlType::setUserType(void *ptype)
 
 void PgSqlType::addUserType(const QString &type_name, void *ptype, void *pmodel, UserTypeConfig::TypeConf type_conf)
 {
+	QMutexLocker locker(&user_types_mtx);
+
 	if(!type_name.isEmpty() && ptype && pmodel &&
 			/*(type_conf==UserTypeConfig::DomainType ||
 			 type_conf==UserTypeConfig::SequenceType ||
@@ -545,6 +555,8 @@ void PgSqlType::addUserType(const QString &type_name, void *ptype, void *pmodel,
 
 void PgSqlType::removeUserType(const QString &type_name, void *ptype)
 {
+	QMutexLocker locker(&user_types_mtx);
+
 	if(PgSqlType::user_types.size() > 0 &&
 			!type_name.isEmpty() && ptype)
 	{
@@ -570,6 +582,8 @@ void PgSqlType::removeUserType(const QString &type_name, void *ptype)
 
 void PgSqlType::renameUserType(const QString &type_name, void *ptype,const QString &new_name)
 {
+	QMutexLocker locker(&user_types_mtx);
+
 	if(PgSqlType::user_types.size() > 0 &&
 			!type_name.isEmpty() && ptype && type_name!=new_name)
 	{
@@ -592,6 +606,8 @@ void PgSqlType::renameUserType(const QString &type_name, void *ptype,const QStri
 
 void PgSqlType::removeUserTypes(void *pmodel)
 {
+	QMutexLocker locker(&user_types_mtx);
+
 	if(pmodel)
 	{
 		std::vector<UserTypeConfig>::iterator itr;
@@ -626,6 +642,8 @@ unsigned PgSqlType::getBaseTypeIndex(const QString &type_name)
 
 unsigned PgSqlType::getUserTypeIndex(const QString &type_name, void *ptype, void *pmodel)
 {
+	QMutexLocker locker(&user_types_mtx);
+
 	if(user_types.size() > 0 && (!type_name.isEmpty() || ptype))
 	{
 		std::vector<UserTypeConfig>::iterator itr, itr_end;
@@ -655,6 +673,8 @@ unsigned PgSqlType::getUserTypeIndex(const QString &type_name, void *ptype, void
 
 QString PgSqlType::getUserTypeName(unsigned type_id)
 {
+	QMutexLocker locker(&user_types_mtx);
+
 	unsigned lim1, lim2;
 
 	lim1=PseudoEnd + 1;
@@ -670,6 +690,8 @@ QString PgSqlType::getUserTypeName(unsigned type_id)
 
 void PgSqlType::getUserTypes(QStringList &type_list, void *pmodel, unsigned inc_usr_types)
 {
+	QMutexLocker locker(&user_types_mtx);
+
 	unsigned idx,total;
 
 	type_list.clear();
@@ -686,6 +708,8 @@ void PgSqlType::getUserTypes(QStringList &type_list, void *pmodel, unsigned inc_
 
 void PgSqlType::getUserTypes(std::vector<void *> &ptypes, void *pmodel, unsigned inc_usr_types)
 {
+	QMutexLocker locker(&user_types_mtx);
+
 	unsigned idx, total;
 
 	ptypes.clear();
@@ -703,7 +727,10 @@ void PgSqlType::getUserTypes(std::vector<void *> &ptypes, void *pmodel, unsigned
 QString PgSqlType::operator ~ ()
 {
 	if(type_idx >= PseudoEnd + 1)
+	{
+		QMutexLocker locker(&user_types_mtx);
 		return (user_types[type_idx - (PseudoEnd + 1)].name);
+	}
 	else
 	{
 		QString name = type_names[type_idx];
@@ -976,6 +1003,7 @@ void PgSqlType::setDimension(unsigned dim)
 {
 	if(dim > 0 && this->isUserType())
 	{
+		QMutexLocker locker(&user_types_mtx);
 		int idx=getUserTypeIndex(~(*this), nullptr) - (PseudoEnd + 1);
 		if(static_cast<unsigned>(idx) < user_types.size() &&
 				user_types[idx].type_conf==UserTypeConfig::SequenceType)
@@ -30,6 +30,7 @@
 #include "spatialtype.h"
 #include "templatetype.h"
 #include "schemaparser.h"
+#include <QRecursiveMutex>
 
 class __libcore PgSqlType: public TemplateType<PgSqlType>{
 	private:
@@ -51,6 +52,11 @@ class __libcore PgSqlType: public TemplateType<PgSqlType>{
 		//! \brief Configuration for user defined types
 		static std::vector<UserTypeConfig> user_types;
 
+		/*! \brief Controls the concurrent access to the user defined types since models can be loaded
+		 * in worker threads while other models register their types. It's recursive because some methods
+		 * that handle the user types call each other (e.g. addUserType() calls getUserTypeIndex()) */
+		static QRecursiveMutex user_types_mtx;
+
 		//! \brief Dimension of the type if it's configured as array
 		unsigned dimension,
 
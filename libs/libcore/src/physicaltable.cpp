@@ -58,6 +58,8 @@ void PhysicalTable::destroyObjects()
 
 	ancestor_tables.clear();
 	partition_tables.clear();
+	obj_names_idx.clear();
+	col_old_names_idx.clear();
 }
 
 void PhysicalTable::setName(const QString &name)
@@ -377,7 +379,6 @@ void PhysicalTable::addObject(BaseObject *obj, int obj_idx)
 		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	else
 	{
-		int idx;
 		obj_type=obj->getObjectType();
 
 #ifdef DEMO_VERSION
@@ -396,7 +397,7 @@ void PhysicalTable::addObject(BaseObject *obj, int obj_idx)
 		try
 		{
 			//Raises an error if already exists a object with the same name and type
-			if(getObject(obj->getName(),obj_type,idx))
+			if(getObject(obj->getName(),obj_type))
 			{
 				throw Exception(Exception::getErrorMessage(ErrorCode::AsgDuplicatedObject)
 												.arg(obj->getName(true))
@@ -460,6 +461,8 @@ void PhysicalTable::addObject(BaseObject *obj, int obj_idx)
 						obj_list->push_back(tab_obj);
 				}
 
+				addObjectNameIndex(tab_obj);
+
 				if(obj_type==ObjectType::Column || obj_type==ObjectType::Constraint)
 				{
 					updateAlterCmdsStatus();
@@ -721,6 +724,7 @@ void PhysicalTable::removeObject(unsigned obj_idx, ObjectType obj_type)
 			TableObject *tab_obj=(*itr);
 			Constraint *constr=dynamic_cast<Constraint *>(tab_obj);
 
+			removeObjectNameIndex(tab_obj);
 			tab_obj->setParentTable(nullptr);
 			obj_list->erase(itr);
 
@@ -759,6 +763,7 @@ void PhysicalTable::removeObject(unsigned obj_idx, ObjectType obj_type)
 								ErrorCode::RemColumnRefByPartitionKey,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 			}
 
+			removeObjectNameIndex(column);
 			column->setParentTable(nullptr);
 			columns.erase(itr);
 		}
@@ -875,65 +880,139 @@ int PhysicalTable::getObjectIndex(BaseObject *obj)
 	TableObject *tab_obj=dynamic_cast<TableObject *>(obj);
 	std::vector<TableObject *> *obj_list = nullptr;
 	std::vector<TableObject *>::iterator itr, itr_end;
-	bool found=false;
+	TableObject *aux_obj = nullptr;
 
-	if(!obj) return -1;
+	if(!tab_obj) return -1;
 
 	obj_list = getObjectList(obj->getObjectType());
 	if(!obj_list) return -1;
 
+	/* The object is located by its address (when it belongs to the table) or by its name,
+	 * the one that comes first in the list is the one considered */
+	aux_obj=getObject(tab_obj->getName(), tab_obj->getObjectType());
 	itr=obj_list->begin();
 	itr_end=obj_list->end();
 
-	while(itr!=itr_end && !found)
+	while(itr!=itr_end)
 	{
-		found=((tab_obj->getParentTable()==this && (*itr)==tab_obj) ||
-				 (tab_obj->getName()==(*itr)->getName()));
-		if(!found) itr++;
+		if((*itr)==aux_obj || (tab_obj->getParentTable()==this && (*itr)==tab_obj))
+			return (itr-obj_list->begin());
+
+		itr++;
 	}
 
-	if(found)
-		return (itr-obj_list->begin());
-	else
-		return -1;
+	return -1;
 }
 
 BaseObject *PhysicalTable::getObject(const QString &name, ObjectType obj_type)
 {
+	//Table objects are retrieved directly from the index avoiding the calculation of their positions in the list
+	if(TableObject::isTableObject(obj_type) && getObjectList(obj_type))
+		return getIndexedObject(name, obj_type, obj_names_idx[obj_type]);
+
 	int idx;
 	return (getObject(name, obj_type, idx));
 }
 
-BaseObject *PhysicalTable::getObject(const QString &name, ObjectType obj_type, int &obj_idx)
+TableObject *PhysicalTable::getIndexedObject(const QString &name, ObjectType obj_type, const QMultiHash<QString, TableObject *> &names_idx, bool old_names)
 {
-	BaseObject *object=nullptr;
-	bool found=false, format=false;
 	std::vector<TableObject *> *obj_list=getObjectList(obj_type);
+	TableObject *object=nullptr;
+	bool format=name.contains('"');
+	QList<TableObject *> objs;
 
-	//Checks if the name contains ", if so, the search will consider formatted names
-	format=name.contains('"');
+	if(!obj_list || name.isEmpty())
+		return nullptr;
 
-	if(TableObject::isTableObject(obj_type) && obj_list)
+	/* Formatted names are searched in the index without the quotes
+	 * and the found objects are compared using their formatted names */
+	objs=names_idx.values(format ? QString(name).remove('"') : name);
+
+	if(format)
 	{
-		std::vector<TableObject *>::iterator itr, itr_end;
-		QString aux_name=name;
+		objs.removeIf([&name, old_names](TableObject *obj){
+			return (old_names ? dynamic_cast<Column *>(obj)->getOldName(true) : obj->getName(true)) != name;
+		});
+	}
 
-		itr=obj_list->begin();
-		itr_end=obj_list->end();
+	if(objs.size()==1)
+		return objs.front();
 
-		while(itr!=itr_end)
+	/* In case of many objects with the same name, something that can happen only
+	 * after renaming objects, the one that comes first in the list is returned.
+	 * Formatted names not found in the index (e.g. names with quotes) are searched in the whole list */
+	for(auto &obj : *obj_list)
+	{
+		if((!objs.isEmpty() && objs.contains(obj)) ||
+			 (objs.isEmpty() && format && (old_names ? dynamic_cast<Column *>(obj)->getOldName(true) : obj->getName(true))==name))
 		{
-			found=((*itr)->getName(format)==aux_name);
-			if(!found) itr++;
-			else break;
+			object=obj;
+			break;
 		}
+	}
 
-		if(found)
-		{
+	return object;
+}
+
+void PhysicalTable::addObjectNameIndex(TableObject *tab_obj)
+{
+	Column *col=dynamic_cast<Column *>(tab_obj);
+
+	obj_names_idx[tab_obj->getObjectType()].insert(tab_obj->getName(), tab_obj);
+
+	if(col && !col->getOldName().isEmpty())
+		col_old_names_idx.insert(col->getOldName(), col);
+}
+
+void PhysicalTable::removeObjectNameIndex(TableObject *tab_obj)
+{
+	Column *col=dynamic_cast<Column *>(tab_obj);
+
+	obj_names_idx[tab_obj->getObjectType()].remove(tab_obj->getName(), tab_obj);
+
+	if(col)
+		col_old_names_idx.remove(col->getOldName(), col);
+}
+
+void PhysicalTable::updateObjectNameIndex(TableObject *tab_obj, const QString &prev_name, const QString &prev_old_name)
+{
+	if(!tab_obj || !TableObject::isTableObject(tab_obj->getObjectType()) ||
+		 obj_names_idx[tab_obj->getObjectType()].remove(prev_name, tab_obj) == 0)
+		return;
+
+	Column *col=dynamic_cast<Column *>(tab_obj);
+
+	obj_names_idx[tab_obj->getObjectType()].insert(tab_obj->getName(), tab_obj);
+
+	if(col)
+	{
+		col_old_names_idx.remove(prev_old_name, col);
+
+		if(!col->getOldName().isEmpty())
+			col_old_names_idx.insert(col->getOldName(), col);
+	}
+}
+
+BaseObject *PhysicalTable::getObject(const QString &name, ObjectType obj_type, int &obj_idx)
+{
+	BaseObject *object=nullptr;
+	bool found=false;
+	std::vector<TableObject *> *obj_list=getObjectList(obj_type);
+
+	if(TableObject::isTableObject(obj_type) && obj_list)
+	{
+		std::vector<TableObject *>::iterator itr;
+
+		object=getIndexedObject(name, obj_type, obj_names_idx[obj_type]);
+		itr=(object ? std::find(obj_list->begin(), obj_list->end(), object) : obj_list->end());
+
+		if(itr!=obj_list->end())
 			obj_idx=(itr-obj_list->begin());
-			object=(*itr);
+		else
+		{
+			obj_idx=-1;
+			object=nullptr;
 		}
-		else obj_idx=-1;
 	}
 	else if(isPhysicalTable(obj_type))
 	{
@@ -1024,31 +1103,10 @@ Constraint *PhysicalTable::getPrimaryKey()
 Column *PhysicalTable::getColumn(const QString &name, bool ref_old_name)
 {
 	if(!ref_old_name)
-	{
-		int idx;
-		return dynamic_cast<Column *>(getObject(name, ObjectType::Column, idx));
-	}
-	else
-	{
-		Column *column=nullptr;
-		std::vector<TableObject *>::iterator itr, itr_end;
-		bool found=false, format=false;
+		return dynamic_cast<Column *>(getObject(name, ObjectType::Column));
 
-		format=name.contains('"');
-		itr=columns.begin();
-		itr_end=columns.end();
-
-		//Search the column referencing the old name
-		while(itr!=itr_end && !found)
-		{
-			column=dynamic_cast<Column *>(*itr);
-			itr++;
-			found=(!name.isEmpty() && column->getOldName(format)==name);
-		}
-
-		if(!found) column=nullptr;
-		return column;
-	}
+	//Search the column referencing the old name
+	return dynamic_cast<Column *>(getIndexedObject(name, ObjectType::Column, col_old_names_idx, true));
 }
 
 Column *PhysicalTable::getColumn(unsigned idx)
@@ -1058,8 +1116,7 @@ Column *PhysicalTable::getColumn(unsigned idx)
 
 Trigger *PhysicalTable::getTrigger(const QString &name)
 {
-	int idx;
-	return dynamic_cast<Trigger *>(getObject(name,ObjectType::Trigger,idx));
+	return dynamic_cast<Trigger *>(getObject(name,ObjectType::Trigger));
 }
 
 Trigger *PhysicalTable::getTrigger(unsigned idx)
@@ -1069,8 +1126,7 @@ Trigger *PhysicalTable::getTrigger(unsigned idx)
 
 Constraint *PhysicalTable::getConstraint(const QString &name)
 {
-	int idx;
-	return dynamic_cast<Constraint *>(getObject(name,ObjectType::Constraint,idx));
+	return dynamic_cast<Constraint *>(getObject(name,ObjectType::Constraint));
 }
 
 Constraint *PhysicalTable::getConstraint(unsigned idx)
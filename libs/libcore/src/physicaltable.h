@@ -25,6 +25,7 @@
 #define PHYSICAL_TABLE_H
 
 #include <QStringList>
+#include <QMultiHash>
 #include "basegraphicobject.h"
 #include "basetable.h"
 #include "column.h"
@@ -79,6 +80,30 @@ class __libcore PhysicalTable: public BaseTable {
 		//! \brief The partitioning mode/type used by the table
 		PartitioningType partitioning_type;
 
+		/*! \brief Stores the children objects of each type indexed by their names so getObject() doesn't need to
+		 * scan the objects lists. This index is updated by addObject(), removeObject() and by the children objects
+		 * themselves when their names change (see updateObjectNameIndex()) */
+		std::map<ObjectType, QMultiHash<QString, TableObject *>> obj_names_idx;
+
+		//! \brief Stores the columns indexed by their old names (see getColumn())
+		QMultiHash<QString, TableObject *> col_old_names_idx;
+
+		/*! \brief Returns the first object (in the order of the objects list) among the ones which name is the
+		 * provided one in the index. When searching formatted names (containing quotes) the list is also scanned
+		 * in case the object isn't found in the index */
+		TableObject *getIndexedObject(const QString &name, ObjectType obj_type, const QMultiHash<QString, TableObject *> &names_idx, bool old_names = false);
+
+		//! \brief Inserts the object (and the column's old name) in the names index
+		void addObjectNameIndex(TableObject *tab_obj);
+
+		//! \brief Removes the object (and the column's old name) from the names index
+		void removeObjectNameIndex(TableObject *tab_obj);
+
+		/*! \brief Updates the names index when one of the children objects has its name changed.
+		 * The previous old name is used only when the object is a column. The index is not changed if
+		 * the object isn't indexed under the previous name (e.g. it wasn't added to the table) */
+		void updateObjectNameIndex(TableObject *tab_obj, const QString &prev_name, const QString &prev_old_name);
+
 		/*! \brief Gets one table ancestor (ObjectType::Table) or copy (ObjectType::ObjBaseTable) using its name and stores
 		 the index of the found object on parameter 'obj_idx' */
 		BaseObject *getObject(const QString &name, ObjectType obj_type, int &obj_idx);
@@ -375,6 +400,7 @@ class __libcore PhysicalTable: public BaseTable {
 
 		friend class Relationship;
 		friend class OperationList;
+		friend class TableObject;
 };
 
 #endif
@@ -19,6 +19,7 @@
 #include "relationship.h"
 #include "coreutilsns.h"
 #include <QApplication>
+#include <QHash>
 
 const QString Relationship::SuffixSeparator("_");
 const QString Relationship::SrcTabToken("{st}");
@@ -915,6 +916,8 @@ void Relationship::addColumnsRelGenPart(bool missing_only)
 			dst_flags[2]={false,false};
 	QString str_aux, msg;
 	PgSqlType src_type, dst_type;
+	QHash<QString, Column *> src_cols;
+	QSet<QString> gen_col_names;
 
 	try
 	{
@@ -926,6 +929,22 @@ void Relationship::addColumnsRelGenPart(bool missing_only)
 		dst_count=dst_tab->getColumnCount();
 		rejected_col_count=0;
 
+		/* Indexing the columns of the reference (source) table by their names so the
+		 * conflicting names can be resolved without comparing every pair of columns */
+		src_cols.reserve(src_count);
+
+		for(i1=0; i1 < src_count; i1++)
+		{
+			src_col=src_tab->getColumn(i1);
+			src_cols.insert(src_col->getName(), src_col);
+		}
+
+		if(missing_only)
+		{
+			for(auto &col : gen_columns)
+				gen_col_names.insert(col->getName());
+		}
+
 		/*  If the relationship is partitioning the destination table (partitioned) shoud have
 		 *  a partitioning type defined otherwise and error is raised */
 		if(rel_type == RelationshipPart && !dst_tab->isPartitioned())
@@ -941,114 +960,98 @@ void Relationship::addColumnsRelGenPart(bool missing_only)
 			//Gets the column from the receiver (destination) table
 			dst_col=dst_tab->getColumn(i);
 
-			/* The copied column have the 'serial' like types converted to
-			integer like types in order to avoid error when configuring the
-			relationship foreign key */
-			dst_type=dst_col->getType();
-
-			/* if(dst_type == "serial") dst_type = "integer";
-			else if(dst_type == "bigserial") dst_type = "bigint";
-			else if(dst_type == "smallserial") dst_type = "smallint"; */
-
-			if(dst_type.isSerialType())
-				dst_type = dst_type.getAliasType();
-
 			/* This flag indicates that the column name is registered
 			in the other table column (duplication). This situation need
 			to be resolved in order to evict the creation of duplicated column
 			on the receiver table */
-			duplic=false;
+			src_col=src_cols.value(dst_col->getName());
+			duplic=(src_col!=nullptr);
 
-			for(i1=0; i1 < src_count && !duplic; i1++)
+			//In case of duplication
+			if(duplic)
 			{
-				//Gets the reference (source) column converting its type
-				src_col=src_tab->getColumn(i1);
+				/* The copied column have the 'serial' like types converted to
+				integer like types in order to avoid error when configuring the
+				relationship foreign key */
+				dst_type=dst_col->getType();
 				src_type=src_col->getType();
 
-				/*if(src_type == "serial") src_type = "integer";
-				else if(src_type == "bigserial") src_type = "bigint";
-				else if(dst_type == "smallserial") dst_type = "smallint";*/
+				if(dst_type.isSerialType())
+					dst_type = dst_type.getAliasType();
 
 				if(src_type.isSerialType())
 					src_type = src_type.getAliasType();
 
-				//Check the duplication on the column names
-				duplic=(src_col->getName()==dst_col->getName());
+				/* It is necessary to check if the source column (reference) is of the table itself,
+			if it came from a parent table or a table copy. The same verification is the
+			destination column.
 
-				//In case of duplication
-				if(duplic)
+			The duplicity of columns only generates error when the source column is
+			of the table itself and the target column was not from a parent table
+			of the receiver table in the case of a copy relationship.
+
+			If the source column is of the reference table or coming from a
+			copy relationship and the type of the current relationship is
+			inheritance, the only case in which the duplicity generates error is
+			the type incompatibility of the columns involved, otherwise they are merged. */
+				for(id_tab=0; id_tab < 2; id_tab++)
 				{
-					/* It is necessary to check if the source column (reference) is of the table itself,
-				if it came from a parent table or a table copy. The same verification is the
-				destination column.
-
-				The duplicity of columns only generates error when the source column is
-				of the table itself and the target column was not from a parent table
-				of the receiver table in the case of a copy relationship.
-
-				If the source column is of the reference table or coming from a
-				copy relationship and the type of the current relationship is
-				inheritance, the only case in which the duplicity generates error is
-				the type incompatibility of the columns involved, otherwise they are merged. */
-					for(id_tab=0; id_tab < 2; id_tab++)
+					if(id_tab==0)
 					{
-						if(id_tab==0)
+						aux_col=src_col;
+						aux_tab=src_tab;
+					}
+					else
+					{
+						aux_col=dst_col;
+						aux_tab=dst_tab;
+					}
+
+					for(i2=0; i2 < 2; i2++)
+					{
+						//Checking if the column came from a generalization relationship
+						if(PhysicalTable::isPhysicalTable(types[i2]))
 						{
-							aux_col=src_col;
-							aux_tab=src_tab;
+							tab_count=aux_tab->getObjectCount(ObjectType::Table);
+							for(idx=0; idx < tab_count; idx++)
+							{
+								parent_tab=dynamic_cast<PhysicalTable *>(aux_tab->getObject(idx, ObjectType::Table));
+								cond=(aux_col->getParentTable()==parent_tab && aux_col->isAddedByGeneralization());
+							}
 						}
+						//Checking if the column came from a copy relationship
 						else
 						{
-							aux_col=dst_col;
-							aux_tab=dst_tab;
+							parent_tab=aux_tab->getCopyTable();
+							cond=(parent_tab && rel_type == RelationshipDep &&
+									aux_col->getParentTable()==parent_tab && aux_col->isAddedByCopy());
 						}
 
-						for(i2=0; i2 < 2; i2++)
-						{
-							//Checking if the column came from a generalization relationship
-							if(PhysicalTable::isPhysicalTable(types[i2]))
-							{
-								tab_count=aux_tab->getObjectCount(ObjectType::Table);
-								for(idx=0; idx < tab_count; idx++)
-								{
-									parent_tab=dynamic_cast<PhysicalTable *>(aux_tab->getObject(idx, ObjectType::Table));
-									cond=(aux_col->getParentTable()==parent_tab && aux_col->isAddedByGeneralization());
-								}
-							}
-							//Checking if the column came from a copy relationship
-							else
-							{
-								parent_tab=aux_tab->getCopyTable();
-								cond=(parent_tab && rel_type == RelationshipDep &&
-										aux_col->getParentTable()==parent_tab && aux_col->isAddedByCopy());
-							}
-
-							if(id_tab==0)
-								src_flags[i2]=cond;
-							else
-								dst_flags[i2]=cond;
-						}
+						if(id_tab==0)
+							src_flags[i2]=cond;
+						else
+							dst_flags[i2]=cond;
 					}
+				}
 
-					/* Error condition 1: The relationship type is dependency and the source
-				column is from the table itself or it came from a copy table and the
-				destination column is from the destination table or came from a copy table
-				of the destination table itself */
-					if((rel_type==RelationshipDep) &&
+				/* Error condition 1: The relationship type is dependency and the source
+			column is from the table itself or it came from a copy table and the
+			destination column is from the destination table or came from a copy table
+			of the destination table itself */
+				if((rel_type==RelationshipDep) &&
 
-							((!src_flags[0] && !src_flags[1]) ||
-							 (!src_flags[0] &&  src_flags[1])) &&
+						((!src_flags[0] && !src_flags[1]) ||
+						 (!src_flags[0] &&  src_flags[1])) &&
 
-							((!dst_flags[0] && !dst_flags[1]) ||
-							 (!dst_flags[0] &&  dst_flags[1])))
-					{
-						err_code=ErrorCode::InvCopyRelationshipDuplicCols;
-					}
-					/* Error condition 2: The relationship type is generalization and the column
-					 * types is incompatible */
-					else if((rel_type == RelationshipGen || rel_type==RelationshipPart) && src_type != dst_type)
-						err_code=ErrorCode::InvInheritRelationshipIncompCols;
+						((!dst_flags[0] && !dst_flags[1]) ||
+						 (!dst_flags[0] &&  dst_flags[1])))
+				{
+					err_code=ErrorCode::InvCopyRelationshipDuplicCols;
 				}
+				/* Error condition 2: The relationship type is generalization and the column
+				 * types is incompatible */
+				else if((rel_type == RelationshipGen || rel_type==RelationshipPart) && src_type != dst_type)
+					err_code=ErrorCode::InvInheritRelationshipIncompCols;
 			}
 
 			//In case that no error was detected (ERR_CUSTOM)
@@ -1057,23 +1060,9 @@ void Relationship::addColumnsRelGenPart(bool missing_only)
 				//In case there is no column duplicity
 				if(!duplic)
 				{
-					if(missing_only)
-					{
-						bool found = false;
-
-						for(auto &col : gen_columns)
-						{
-							if(col->getName() == dst_col->getName())
-							{
-								found = true;
-								break;
-							}
-						}
-
-						if(found)
-							continue;
-					}
-
+					//Skipping the columns already created by the relationship
+					if(missing_only && gen_col_names.contains(dst_col->getName()))
+						continue;
 
 					//Creates a new column making the initial configurations
 					column=new Column;
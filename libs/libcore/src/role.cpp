@@ -18,7 +18,7 @@
 
 #include "role.h"
 
-unsigned Role::role_id=0;
+std::atomic<unsigned> Role::role_id=0;
 
 Role::Role()
 {
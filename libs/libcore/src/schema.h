@@ -31,7 +31,7 @@
 
 class __libcore Schema: public BaseGraphicObject {
 	private:
-		static unsigned schema_id;
+		static std::atomic<unsigned> schema_id;
 		QColor fill_color;
 		bool rect_visible;
 
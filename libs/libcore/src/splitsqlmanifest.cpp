@@ -0,0 +1,210 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+#include "splitsqlmanifest.h"
+#include "exception.h"
+#include "utilsns.h"
+#include "globalattributes.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QCryptographicHash>
+#include <QRegularExpression>
+#include <QSet>
+
+const QString SplitSQLManifest::ManifestFile("split.manifest");
+const QString SplitSQLManifest::ManifestHeader("# pgModeler split SQL manifest v1");
+
+SplitSQLManifest::SplitSQLManifest(const QString &path, bool incremental)
+{
+	this->path = path;
+	this->incremental = incremental;
+	written_cnt = renamed_cnt = unchanged_cnt = removed_cnt = 0;
+
+	if(incremental)
+		loadManifest();
+}
+
+QString SplitSQLManifest::getScriptKey(const QString &filename)
+{
+	static const QRegularExpression prefix_regexp("^\\d+_");
+	return QString(filename).remove(prefix_regexp);
+}
+
+QByteArray SplitSQLManifest::getContentsHash(const QByteArray &buffer)
+{
+	return QCryptographicHash::hash(buffer, QCryptographicHash::Sha1).toHex();
+}
+
+QString SplitSQLManifest::getFilePath(const QString &filename)
+{
+	return path + GlobalAttributes::DirSeparator + filename;
+}
+
+void SplitSQLManifest::loadManifest()
+{
+	QFile input(getFilePath(ManifestFile));
+	QStringList values;
+	QString line;
+	ManifestEntry entry;
+
+	prev_entries.clear();
+
+	if(!input.open(QFile::ReadOnly | QFile::Text))
+		return;
+
+	// Manifests with an unknown header are ignored so all the scripts are written again
+	if(QString(input.readLine()).trimmed() != ManifestHeader)
+		return;
+
+	while(!input.atEnd())
+	{
+		line = QString(input.readLine()).trimmed();
+		values = line.split('\t');
+
+		if(values.size() != 2 || values[1].isEmpty() ||
+			 values[1].contains(GlobalAttributes::DirSeparator))
+			continue;
+
+		entry.hash = values[0].toUtf8();
+		entry.filename = values[1];
+		prev_entries[getScriptKey(entry.filename)] = entry;
+	}
+}
+
+void SplitSQLManifest::saveScript(const QString &filename, const QByteArray &buffer)
+{
+	try
+	{
+		if(!incremental)
+		{
+			UtilsNs::saveFile(getFilePath(filename), buffer);
+			written_cnt++;
+			return;
+		}
+
+		QString key = getScriptKey(filename), file_path = getFilePath(filename);
+		QByteArray hash = getContentsHash(buffer);
+		auto itr = prev_entries.find(key);
+		bool target_exists = QFileInfo::exists(file_path);
+
+		curr_entries[key] = ManifestEntry { hash, filename };
+
+		if(itr != prev_entries.end() && itr->second.hash == hash)
+		{
+			if(itr->second.filename == filename && target_exists)
+			{
+				unchanged_cnt++;
+				return;
+			}
+
+			// Only the creation order prefix changed so we just rename the previous file
+			if(itr->second.filename != filename && !target_exists &&
+				 QFile::rename(getFilePath(itr->second.filename), file_path))
+			{
+				renamed_cnt++;
+				return;
+			}
+		}
+		/* Without a previous entry (e.g. the first incremental export over a directory
+		 * populated by a full export) the file on disk is compared against the new contents */
+		else if(itr == prev_entries.end() && target_exists &&
+						getContentsHash(UtilsNs::loadFile(file_path)) == hash)
+		{
+			unchanged_cnt++;
+			return;
+		}
+
+		UtilsNs::saveFile(file_path, buffer);
+		written_cnt++;
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void SplitSQLManifest::finish()
+{
+	if(!incremental)
+		return;
+
+	QSet<QString> curr_files;
+	QByteArray buffer;
+
+	for(auto &itr : curr_entries)
+		curr_files.insert(itr.second.filename);
+
+	// Removing the scripts of the previous export that weren't generated this time
+	for(auto &itr : prev_entries)
+	{
+		if(curr_files.contains(itr.second.filename))
+			continue;
+
+		if(QFile::remove(getFilePath(itr.second.filename)))
+			removed_cnt++;
+	}
+
+	buffer.append(ManifestHeader.toUtf8());
+	buffer.append('\n');
+
+	for(auto &itr : curr_entries)
+	{
+		buffer.append(itr.second.hash);
+		buffer.append('\t');
+		buffer.append(itr.second.filename.toUtf8());
+		buffer.append('\n');
+	}
+
+	try
+	{
+		UtilsNs::saveFile(getFilePath(ManifestFile), buffer);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+
+	prev_entries = curr_entries;
+	curr_entries.clear();
+}
+
+bool SplitSQLManifest::isIncremental()
+{
+	return incremental;
+}
+
+unsigned SplitSQLManifest::getWrittenCount()
+{
+	return written_cnt;
+}
+
+unsigned SplitSQLManifest::getRenamedCount()
+{
+	return renamed_cnt;
+}
+
+unsigned SplitSQLManifest::getUnchangedCount()
+{
+	return unchanged_cnt;
+}
+
+unsigned SplitSQLManifest::getRemovedCount()
+{
+	return removed_cnt;
+}
@@ -0,0 +1,106 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+/**
+\ingroup libcore
+\class SplitSQLManifest
+\brief Implements the manifest used by the incremental split SQL export (see DatabaseModel::saveSplitSQLDefinition()).
+The manifest is a plain text file stored in the output directory that maps each generated script to the hash of its
+contents and to its current filename. Scripts are identified by their filenames without the creation order prefix
+(e.g. the key of 012_customer_public_1503.sql is customer_public_1503.sql) so a script that only changed its position
+in the creation order is renamed instead of rewritten. Scripts whose contents didn't change are left untouched and the
+ones listed in the previous manifest that are not generated anymore are removed from the output directory.
+When the incremental mode is disabled every script is written and no manifest is read or saved.
+*/
+
+#ifndef SPLIT_SQL_MANIFEST_H
+#define SPLIT_SQL_MANIFEST_H
+
+#include "coreglobal.h"
+#include <QString>
+#include <QByteArray>
+#include <map>
+
+class __libcore SplitSQLManifest {
+	private:
+		//! \brief Stores the hash of the contents and the filename of a script
+		struct ManifestEntry {
+			QByteArray hash;
+			QString filename;
+		};
+
+		//! \brief The header written in the first line of the manifest (used to validate the file)
+		static const QString ManifestHeader;
+
+		//! \brief Indicates if the scripts are written incrementally (see the class description)
+		bool incremental;
+
+		//! \brief The output directory in which the scripts are written
+		QString path;
+
+		//! \brief The entries read from the manifest of the previous export indexed by their keys
+		std::map<QString, ManifestEntry> prev_entries;
+
+		//! \brief The entries of the scripts handled by the current export indexed by their keys
+		std::map<QString, ManifestEntry> curr_entries;
+
+		//! \brief Counters of the scripts written, renamed, unchanged and removed by the current export
+		unsigned written_cnt, renamed_cnt, unchanged_cnt, removed_cnt;
+
+		//! \brief Returns the key that identifies the script by removing the creation order prefix from its filename
+		static QString getScriptKey(const QString &filename);
+
+		//! \brief Returns the hash of the provided contents
+		static QByteArray getContentsHash(const QByteArray &buffer);
+
+		//! \brief Returns the full path to the provided filename in the output directory
+		QString getFilePath(const QString &filename);
+
+		//! \brief Reads the manifest of the previous export. Missing or invalid manifests are ignored
+		void loadManifest();
+
+	public:
+		//! \brief The name of the manifest file created in the output directory
+		static const QString ManifestFile;
+
+		/*! \brief Creates a manifest for the provided output directory. In incremental mode the manifest
+		 * of the previous export, if any, is read from the directory */
+		SplitSQLManifest(const QString &path, bool incremental);
+
+		/*! \brief Saves the provided contents to the script. In incremental mode the script is only written when
+		 * its contents changed since the previous export. When only the creation order prefix changed the
+		 * previous file is renamed */
+		void saveScript(const QString &filename, const QByteArray &buffer);
+
+		/*! \brief Finishes the export by removing the stale scripts (the ones generated by the previous export that
+		 * were not generated by the current one) and saving the manifest. Does nothing if the incremental mode is disabled */
+		void finish();
+
+		bool isIncremental();
+
+		unsigned getWrittenCount();
+
+		unsigned getRenamedCount();
+
+		unsigned getUnchangedCount();
+
+		unsigned getRemovedCount();
+};
+
+#endif
@@ -244,8 +244,7 @@ void Table::removePolicy(unsigned idx)
 
 Index *Table::getIndex(const QString &name)
 {
-	int idx;
-	return dynamic_cast<Index *>(getObject(name,ObjectType::Index,idx));
+	return dynamic_cast<Index *>(getObject(name,ObjectType::Index));
 }
 
 Index *Table::getIndex(unsigned idx)
@@ -255,8 +254,7 @@ Index *Table::getIndex(unsigned idx)
 
 Rule *Table::getRule(const QString &name)
 {
-	int idx;
-	return dynamic_cast<Rule *>(getObject(name,ObjectType::Rule,idx));
+	return dynamic_cast<Rule *>(getObject(name,ObjectType::Rule));
 }
 
 Rule *Table::getRule(unsigned idx)
@@ -266,8 +264,7 @@ Rule *Table::getRule(unsigned idx)
 
 Policy *Table::getPolicy(const QString &name)
 {
-	int idx;
-	return dynamic_cast<Policy *>(getObject(name, ObjectType::Policy,idx));
+	return dynamic_cast<Policy *>(getObject(name, ObjectType::Policy));
 }
 
 Policy *Table::getPolicy(unsigned idx)
@@ -17,6 +17,7 @@
 */
 
 #include "tableobject.h"
+#include "physicaltable.h"
 
 TableObject::TableObject()
 {
@@ -35,6 +36,24 @@ BaseTable *TableObject::getParentTable()
 	return parent_table;
 }
 
+void TableObject::setName(const QString &name)
+{
+	QString prev_name=this->obj_name;
+
+	BaseObject::setName(name);
+
+	if(prev_name!=this->obj_name)
+		updateParentNameIndex(prev_name);
+}
+
+void TableObject::updateParentNameIndex(const QString &prev_name, const QString &prev_old_name)
+{
+	PhysicalTable *table=dynamic_cast<PhysicalTable *>(parent_table);
+
+	if(table)
+		table->updateObjectNameIndex(this, prev_name, prev_old_name);
+}
+
 void TableObject::setAddedByLinking(bool value)
 {
 	add_by_linking=value;
@@ -95,12 +114,17 @@ bool TableObject::isTableObject(ObjectType type)
 
 void TableObject::operator = (TableObject &object)
 {
+	QString prev_name=this->obj_name;
+
 	*(dynamic_cast<BaseObject *>(this))=dynamic_cast<BaseObject &>(object);
 	this->parent_table=object.parent_table;
 	this->add_by_copy=false;
 	this->add_by_generalization=false;
 	this->add_by_linking=false;
 	this->decl_in_table=object.decl_in_table;
+
+	if(prev_name!=this->obj_name)
+		updateParentNameIndex(prev_name);
 }
 
 void TableObject::setCodeInvalidated(bool value)
@@ -64,6 +64,10 @@ class __libcore TableObject: public BaseObject {
 	types of child objects will ignore it */
 		void setDeclaredInTable(bool value);
 
+		/*! \brief Updates the names index of the parent table (when it's a physical table) after the object's name changes.
+		 * The previous old name is used only by columns (see Column::setName()) */
+		void updateParentNameIndex(const QString &prev_name, const QString &prev_old_name = "");
+
 	public:
 		TableObject();
 
@@ -73,6 +77,9 @@ class __libcore TableObject: public BaseObject {
 		//! \brief Returns the object parent table
 		BaseTable *getParentTable();
 
+		//! \brief Defines the object's name updating the names index of the parent table
+		virtual void setName(const QString &name);
+
 		/*! \brief This method is purely virtual to force the derived classes
 	overload this method. This also makes class TableObject
 	not instantiable */
@@ -18,7 +18,7 @@
 
 #include "tag.h"
 
-unsigned Tag::tag_id=4000;
+std::atomic<unsigned> Tag::tag_id=4000;
 
 Tag::Tag()
 {
@@ -42,6 +42,7 @@ void Tag::setName(const QString &name)
 	else if(name.size() > BaseObject::ObjectNameMaxLength)
 		throw Exception(ErrorCode::AsgLongNameObject ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
+	setCodeInvalidated(this->obj_name != name);
 	this->obj_name=name;
 }
 
@@ -77,6 +77,9 @@ src/tools/datamanipulationform.cpp \
 src/tools/modelexportform.cpp \
 src/tools/modelrestorationform.cpp \
 src/tools/sqlexecutionhelper.cpp \
+src/tools/objectslistinghelper.cpp \
+src/tools/csvcopyhelper.cpp \
+src/tools/databaseimportcache.cpp \
 src/tools/databaseimportform.cpp \
 src/tools/metadatahandlingform.cpp \
 src/tools/modelexporthelper.cpp \
@@ -90,6 +93,8 @@ src/utils/deletableitemdelegate.cpp \
 src/utils/htmlitemdelegate.cpp \
 src/utils/plaintextitemdelegate.cpp \
 src/utils/resultsetmodel.cpp \
+src/utils/modelobjectstreemodel.cpp \
+src/utils/pngstreamwriter.cpp \
 src/utils/syntaxhighlighter.cpp \
 src/utils/textblockinfo.cpp \
 src/widgets/aboutwidget.cpp \
@@ -195,6 +200,9 @@ src/tools/datamanipulationform.h \
 src/tools/modelexportform.h \
 src/tools/modelrestorationform.h \
 src/tools/sqlexecutionhelper.h \
+src/tools/objectslistinghelper.h \
+src/tools/csvcopyhelper.h \
+src/tools/databaseimportcache.h \
 src/tools/databaseimportform.h \
 src/tools/metadatahandlingform.h \
 src/tools/modelexporthelper.h \
@@ -208,6 +216,8 @@ src/utils/deletableitemdelegate.h \
 src/utils/htmlitemdelegate.h \
 src/utils/plaintextitemdelegate.h \
 src/utils/resultsetmodel.h \
+src/utils/modelobjectstreemodel.h \
+src/utils/pngstreamwriter.h \
 src/utils/syntaxhighlighter.h \
 src/utils/textblockinfo.h \
 src/widgets/aboutwidget.h \
@@ -343,7 +353,8 @@ unix|windows: LIBS += $$LIBCANVAS_LIB \
 		      $$LIBCONNECTOR_LIB \
 		      $$LIBCORE_LIB \
 		      $$LIBPARSERS_LIB \
-		      $$LIBUTILS_LIB
+		      $$LIBUTILS_LIB \
+		      $$ZLIB_LIB
 
 INCLUDEPATH += $$LIBCANVAS_INC \
 	       $$LIBCONNECTOR_INC \
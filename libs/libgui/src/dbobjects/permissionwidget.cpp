@@ -318,6 +318,9 @@ void PermissionWidget::updatePermission()
 
 		if(perm_idx < 0 || (perm_idx >=0 && model->getObject(perm_idx,ObjectType::Permission)==permission))
 		{
+			/* Assigning the model to the configured permission so the edited one keeps referencing it
+			 * after the copy below and the model gets notified about the changes in the permission */
+			perm->setDatabase(model);
 			(*permission)=(*perm);
 			listPermissions();
 			cancelOperation();
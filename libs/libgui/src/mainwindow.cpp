@@ -627,10 +627,20 @@ void MainWindow::restoreTemporaryModels()
 					//Get the model widget generated from file
 					model=dynamic_cast<ModelWidget *>(models_tbw->widget(models_tbw->count()-1));
 
-					//Set the model as modified forcing the user to save when the autosave timer ends
-					model->setModified(true);
-					model->filename.clear();
-					restoration_form->removeTemporaryModel(model_file);
+					/* The model is loaded asynchronously so the restoration is finished when the loading ends.
+					 * These handlers run after the ones connected by addModel() */
+					connect(model, &ModelWidget::s_modelLoaded, this, [this, model, model_file](){
+						//Set the model as modified forcing the user to save when the autosave timer ends
+						model->setModified(true);
+						model->filename.clear();
+						restoration_form->removeTemporaryModel(model_file);
+					});
+
+					connect(model, &ModelWidget::s_modelLoadFailed, this, [this, model_file](){
+						//Destroy the temp file if the "keep  models" isn't checked
+						if(!restoration_form->keep_models_chk->isChecked())
+							restoration_form->removeTemporaryModel(model_file);
+					});
 				}
 				catch(Exception &e)
 				{
@@ -954,7 +964,8 @@ void MainWindow::saveTemporaryModels()
 				model=dynamic_cast<ModelWidget *>(models_tbw->widget(i));
 				bg_saving_pb->setValue(((i+1)/static_cast<double>(count)) * 100);
 
-				if(model->isModified())
+				// Models being loaded can't be accessed until the loading finishes
+				if(model->isModified() && !model->isLoadingModel())
 					model->getDatabaseModel()->saveModel(model->getTempFilename(), SchemaParser::XmlCode);
 			}
 
@@ -1057,7 +1068,6 @@ void MainWindow::addModel(const QString &filename)
 	{
 		ModelWidget *model_tab=nullptr;
 		QString obj_name, tab_name, str_aux;
-		Schema *public_sch=nullptr;
 		bool start_timers=(models_tbw->count() == 0);
 
 		//Set a name for the tab widget
@@ -1080,27 +1090,27 @@ void MainWindow::addModel(const QString &filename)
 		models_tbw->blockSignals(false);
 		models_tbw->currentWidget()->layout()->setContentsMargins(0,0,0,0);
 
-		//Creating the system objects (public schema and languages C, SQL and pgpgsql)
-		model_tab->db_model->createSystemObjects(filename.isEmpty());
-
 		if(filename.isEmpty())
+		{
+			//Creating the system objects (public schema and languages C, SQL and pgpgsql)
+			model_tab->db_model->createSystemObjects(true);
 			model_tab->updateSceneLayers();
+		}
 		else
 		{
+			/* The model file is loaded in a worker thread so the loading of each file runs independently
+			 * and the UI is kept responsive. The tab is configured when the loading finishes */
+			connect(model_tab, &ModelWidget::s_modelLoaded, this, [this, model_tab, filename](){
+				handleModelLoaded(model_tab, filename);
+			});
+
+			connect(model_tab, &ModelWidget::s_modelLoadFailed, this, [this, model_tab, filename](Exception e){
+				handleModelLoadFailure(model_tab, filename, e);
+			});
+
 			try
 			{
 				model_tab->loadModel(filename);
-				models_tbw->setTabToolTip(models_tbw->currentIndex(), filename);
-
-				//Get the "public" schema and set as system object
-				public_sch=dynamic_cast<Schema *>(model_tab->db_model->getObject(QString("public"), ObjectType::Schema));
-				if(public_sch)	public_sch->setSystemObject(true);
-
-				model_tab->db_model->setInvalidated(false);
-				model_tab->restoreLastCanvasPosition();
-
-				//Making a copy of the loaded database model file as the first version of the temp. model
-				QFile::copy(filename, model_tab->getTempFilename());
 			}
 			catch(Exception &e)
 			{
@@ -1143,6 +1153,77 @@ void MainWindow::addModel(const QString &filename)
 	}
 }
 
+void MainWindow::handleModelLoaded(ModelWidget *model_tab, const QString &filename)
+{
+	QStringList load_times;
+	Schema *public_sch=nullptr;
+
+	// The time spent in each loading phase is displayed in the tab's tooltip
+	for(auto &[phase, msecs] : model_tab->getLoadingTimes())
+		load_times.append(tr("%1: %2 ms").arg(phase).arg(msecs));
+
+	models_tbw->setTabToolTip(models_tbw->indexOf(model_tab), filename + "\n\n" + load_times.join("\n"));
+	models_tbw->setTabText(models_tbw->indexOf(model_tab), model_tab->db_model->getName());
+	model_nav_wgt->updateModelText(models_tbw->indexOf(model_tab), model_tab->db_model->getName(), filename);
+
+	//Get the "public" schema and set as system object
+	public_sch=dynamic_cast<Schema *>(model_tab->db_model->getObject(QString("public"), ObjectType::Schema));
+	if(public_sch)	public_sch->setSystemObject(true);
+
+	model_tab->db_model->setInvalidated(false);
+	model_tab->restoreLastCanvasPosition();
+
+	//Making a copy of the loaded database model file as the first version of the temp. model
+	QFile::copy(filename, model_tab->getTempFilename());
+
+	model_tab->setModified(false);
+
+	if(action_alin_objs_grade->isChecked())
+		model_tab->scene->alignObjectsToGrid();
+
+	// The widgets attached to the model being loaded must be reconfigured with the loaded database model
+	if(model_tab == current_model)
+		setCurrentModel();
+}
+
+void MainWindow::handleModelLoadFailure(ModelWidget *model_tab, const QString &filename, Exception &e)
+{
+	int tab_idx = models_tbw->indexOf(model_tab);
+
+	/* The tab is removed without calling closeModel() since it disconnects all the signals of the
+	 * model widget, which would prevent the other receivers of the failure signal to be notified */
+	if(tab_idx >= 0)
+	{
+		model_nav_wgt->removeModel(tab_idx);
+		model_tree_states.erase(model_tab);
+		models_tbw->removeTab(tab_idx);
+	}
+
+	//Destroy the temp file generated by allocating a new model widget
+	restoration_form->removeTemporaryModel(model_tab->getTempFilename());
+	model_tab->deleteLater();
+
+	if(current_model == model_tab)
+		current_model = nullptr;
+
+	if(models_tbw->count() == 0)
+	{
+		model_save_timer.stop();
+		tmpmodel_save_timer.stop();
+	}
+
+	welcome_wgt->update();
+	setCurrentModel();
+
+	if(QFileInfo(filename).exists())
+		showFixMessage(e, filename);
+	else
+	{
+		Messagebox msg_box;
+		msg_box.show(e);
+	}
+}
+
 void MainWindow::addModel(ModelWidget *model_wgt)
 {
 	try
@@ -1216,10 +1297,7 @@ void MainWindow::setCurrentModel()
 	edit_menu->addAction(action_redo);
 	edit_menu->addSeparator();
 
-	//Avoids the tree state saving in order to restore the current model tree state
-	model_objs_wgt->saveTreeState(false);
-
-	//Restore the tree state
+	//Saves the tree state of the current model in order to restore it when the model is activated again
 	if(current_model)
 		model_objs_wgt->saveTreeState(model_tree_states[current_model]);
 
@@ -1360,8 +1438,6 @@ void MainWindow::setCurrentModel()
 	if(current_model)
 		model_objs_wgt->restoreTreeState(model_tree_states[current_model]);
 
-	model_objs_wgt->saveTreeState(true);
-
 	resizeGeneralToolbarButtons();
 
 	emit s_currentModelChanged(current_model);
@@ -1565,9 +1641,16 @@ void MainWindow::saveAllModels()
 	{
 		int i, count;
 
+		ModelWidget *model=nullptr;
+
 		count=models_tbw->count();
 		for(i=0; i < count; i++)
-			this->saveModel(dynamic_cast<ModelWidget *>(models_tbw->widget(i)));
+		{
+			model=dynamic_cast<ModelWidget *>(models_tbw->widget(i));
+
+			if(!model->isLoadingModel())
+				this->saveModel(model);
+		}
 	}
 }
 
@@ -1952,7 +2035,8 @@ void MainWindow::__updateToolsState()
 
 void MainWindow::updateToolsState(bool model_closed)
 {
-	bool enabled=(!model_closed && current_model);
+	// Models being loaded are handled as closed ones since their database models can't be modified or saved yet
+	bool enabled=(!model_closed && current_model && !current_model->isLoadingModel());
 
 	action_print->setEnabled(enabled);
 	action_save_as->setEnabled(enabled);
@@ -1977,7 +2061,7 @@ void MainWindow::updateToolsState(bool model_closed)
 
 	action_handle_metadata->setEnabled(enabled);
 
-	if(!model_closed && current_model && models_tbw->count() > 0)
+	if(enabled && models_tbw->count() > 0)
 	{
 		action_undo->setEnabled(current_model->op_list->isUndoAvailable());
 		action_redo->setEnabled(current_model->op_list->isRedoAvailable());
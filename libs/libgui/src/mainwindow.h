@@ -178,6 +178,12 @@ class __libgui MainWindow: public QMainWindow, public Ui::MainWindow {
 		//! \brief Shows a error dialog informing that the model demands a fix after the error ocurred when loading the filename.
 		void showFixMessage(Exception &e, const QString &filename);
 
+		//! \brief Configures the model tab after its file is loaded by the worker thread (see ModelWidget::loadModel())
+		void handleModelLoaded(ModelWidget *model_tab, const QString &filename);
+
+		//! \brief Removes the model tab which file could not be loaded by the worker thread and shows the error to the user
+		void handleModelLoadFailure(ModelWidget *model_tab, const QString &filename, Exception &e);
+
 		/*! \brief This method determines if the provided layout has togglable buttons and one of them are checked.
 		 * This is an auxiliary method used to determine if widget bars (bottom or right) can be displayed based upon
 		 * the current button toggle state. */
@@ -224,7 +230,8 @@ class __libgui MainWindow: public QMainWindow, public Ui::MainWindow {
 
 	public slots:
 		/*! \brief Creates a new empty model inside the main window. If the parameter 'filename' is specified,
-		creates the model loading it from a file */
+		creates the model loading it from a file. The file is loaded asynchronously, so this method returns before the
+		loading finishes (see handleModelLoaded() and handleModelLoadFailure()) */
 		void addModel(const QString &filename="");
 
 		/*! \brief Creates a new model inside the main window using the specified model widget. The method will raise
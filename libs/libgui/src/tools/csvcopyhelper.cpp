@@ -0,0 +1,193 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "csvcopyhelper.h"
+#include "csvreader.h"
+
+CsvCopyHelper::CsvCopyHelper() : QObject(nullptr)
+{
+	cols_in_first_row = false;
+	copy_cancelled = false;
+}
+
+void CsvCopyHelper::setConnection(Connection conn)
+{
+	connection = conn;
+}
+
+void CsvCopyHelper::setCopyParameters(const QString &filename, const QString &schema, const QString &table, const QStringList &col_names,
+																			const QChar &separator, const QChar &text_delim, bool cols_in_first_row)
+{
+	this->filename = filename;
+	this->col_names = col_names;
+	this->separator = separator;
+	this->text_delim = text_delim;
+	this->cols_in_first_row = cols_in_first_row;
+
+	// Embedded double quotes are doubled as done for the columns names in copyFile()
+	table_name = QString("\"%1\".\"%2\"").arg(QString(schema).replace("\"", "\"\""),
+																					QString(table).replace("\"", "\"\""));
+}
+
+QString CsvCopyHelper::getTableName()
+{
+	return table_name;
+}
+
+void CsvCopyHelper::cancelCopy()
+{
+	copy_cancelled = true;
+}
+
+void CsvCopyHelper::encodeRows(const QList<QStringList> &rows, QByteArray &buffer)
+{
+	for(auto &row : rows)
+	{
+		for(int col = 0; col < row.size(); col++)
+		{
+			QByteArray value = row.at(col).toUtf8();
+
+			if(col > 0)
+				buffer.append('\t');
+
+			if(value.isEmpty())
+			{
+				buffer.append("\\N");
+				continue;
+			}
+
+			for(char chr : value)
+			{
+				if(chr == '\\')
+					buffer.append("\\\\");
+				else if(chr == '\t')
+					buffer.append("\\t");
+				else if(chr == '\n')
+					buffer.append("\\n");
+				else if(chr == '\r')
+					buffer.append("\\r");
+				else
+					buffer.append(chr);
+			}
+		}
+
+		buffer.append('\n');
+	}
+}
+
+void CsvCopyHelper::copyFile()
+{
+	CsvReader csv_reader;
+	QList<QStringList> rows;
+	QStringList copy_cols;
+	QByteArray copy_buf;
+	bool copy_started = false;
+	qint64 row_cnt = 0;
+
+	copy_cancelled = false;
+
+	try
+	{
+		csv_reader.setSpecialChars(separator, text_delim);
+		csv_reader.setColumnInFirstRow(cols_in_first_row);
+		csv_reader.open(filename);
+
+		connection.connect();
+		connection.executeDDLCommand("SET client_encoding TO 'UTF8'");
+
+		while(!copy_cancelled && csv_reader.readRows(rows) > 0)
+		{
+			/* The COPY command is started only after reading the first batch since,
+			 * when the file doesn't have the column names, they are determined by the
+			 * amount of values in the first row */
+			if(!copy_started)
+			{
+				QStringList csv_cols = csv_reader.getColumnNames();
+
+				if(csv_cols.isEmpty())
+					csv_cols = col_names.mid(0, rows.at(0).size());
+
+				for(auto &col : csv_cols)
+					copy_cols.append(QString("\"%1\"").arg(QString(col).replace("\"", "\"\"")));
+
+				connection.startCopy(QString("COPY %1 (%2) FROM STDIN").arg(table_name, copy_cols.join(", ")));
+				copy_started = true;
+			}
+
+			copy_buf.clear();
+			encodeRows(rows, copy_buf);
+			connection.putCopyData(copy_buf);
+			row_cnt += rows.size();
+
+			emit s_progressUpdated(csv_reader.getSize() > 0 ? (csv_reader.getBytesRead() * 100) / csv_reader.getSize() : 100,
+														 tr("Copying rows to <strong>%1</strong>... (%2 rows copied)").arg(table_name).arg(row_cnt));
+		}
+
+		if(copy_cancelled)
+		{
+			/* Aborting the COPY command in progress (if any) so the server discards all
+			 * rows sent so far. The error raised by the aborted command is expected */
+			if(copy_started)
+			{
+				copy_started = false;
+
+				try
+				{
+					connection.endCopy(tr("Operation cancelled by the user."));
+				}
+				catch(Exception &)
+				{}
+			}
+
+			connection.close();
+			csv_reader.close();
+			emit s_copyCancelled();
+			return;
+		}
+
+		if(copy_started)
+		{
+			copy_started = false;
+			connection.endCopy();
+		}
+
+		connection.close();
+		csv_reader.close();
+		emit s_copyFinished(row_cnt);
+	}
+	catch(Exception &e)
+	{
+		/* Aborting the COPY command in progress (if any) so the server discards all
+		 * rows sent so far. The error raised by the aborted command is ignored */
+		if(copy_started)
+		{
+			try
+			{
+				connection.endCopy(e.getErrorMessage());
+			}
+			catch(Exception &)
+			{}
+		}
+
+		if(connection.isStablished())
+			connection.close();
+
+		csv_reader.close();
+		emit s_copyAborted(Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e));
+	}
+}
@@ -0,0 +1,97 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libgui
+\class CsvCopyHelper
+\brief Implements the copy of large CSV files directly into a table using the COPY command in a thread so the data
+manipulation form isn't frozen during the operation. The file is read in batches (see CsvReader) and each batch is sent
+to the server as soon as it is read so the document is never held entirely in memory. When the copy is cancelled or fails
+the COPY command is aborted so the server discards all the rows sent so far.
+*/
+
+#ifndef CSV_COPY_HELPER_H
+#define CSV_COPY_HELPER_H
+
+#include <QObject>
+#include <atomic>
+#include "guiglobal.h"
+#include "connection.h"
+
+class __libgui CsvCopyHelper: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Connection used to execute the COPY command
+		Connection connection;
+
+		//! \brief The CSV file to be copied
+		QString filename,
+
+		//! \brief The schema qualified name of the table (already quoted) that receives the rows
+		table_name;
+
+		//! \brief The table columns used when the file doesn't have the column names in the first row
+		QStringList col_names;
+
+		//! \brief Separator and text delimiter used in the CSV file
+		QChar separator, text_delim;
+
+		//! \brief Indicates that the first row of the file contains the column names
+		bool cols_in_first_row;
+
+		//! \brief Indicates that the copy was cancelled by the user (see cancelCopy())
+		std::atomic<bool> copy_cancelled;
+
+		//! \brief Encodes the rows in the text format of the COPY command appending them to the provided buffer
+		static void encodeRows(const QList<QStringList> &rows, QByteArray &buffer);
+
+	public:
+		CsvCopyHelper();
+
+		void setConnection(Connection conn);
+
+		/*! \brief Configures the file to be copied into the provided table. The columns names are used when the file
+		 * doesn't have them in the first row, in that case, the amount of values of the first row determines how many of them are used */
+		void setCopyParameters(const QString &filename, const QString &schema, const QString &table, const QStringList &col_names,
+													 const QChar &separator, const QChar &text_delim, bool cols_in_first_row);
+
+		//! \brief Returns the schema qualified and quoted name of the table configured by setCopyParameters()
+		QString getTableName();
+
+	public slots:
+		void copyFile();
+
+		//! \brief Requests the cancellation of the copy in progress. This method can be called from any thread
+		void cancelCopy();
+
+	signals:
+		//! \brief This signal is emitted after each batch of rows is sent to the server
+		void s_progressUpdated(int progress, QString msg);
+
+		//! \brief This signal is emitted when all the rows are copied (and committed) into the table
+		void s_copyFinished(qint64 row_count);
+
+		//! \brief This signal is emitted when the copy is cancelled by the user. No row is copied in that case
+		void s_copyCancelled();
+
+		//! \brief This signal is emitted when the copy fails. No row is copied in that case
+		void s_copyAborted(Exception e);
+};
+
+#endif
@@ -20,6 +20,7 @@
 #include "databaseimportform.h"
 #include "sqltoolwidget.h"
 #include "sqlexecutionwidget.h"
+#include "catalogcache.h"
 #include "settings/snippetsconfigwidget.h"
 #include "utils/plaintextitemdelegate.h"
 #include "utilsns.h"
@@ -145,6 +146,7 @@ DatabaseExplorerWidget::DatabaseExplorerWidget(QWidget *parent): QWidget(parent)
 	curr_scroll_value = 0;
 	filter_parent->setVisible(false);
 	sort_column = 0;
+	last_req_id = 0;
 	splitter->setSizes({ 80, 20 });
 
 	properties_tbw->setItemDelegate(new PlainTextItemDelegate(this, true));
@@ -213,8 +215,11 @@ DatabaseExplorerWidget::DatabaseExplorerWidget(QWidget *parent): QWidget(parent)
 	});
 
 	connect(collapse_all_tb, &QToolButton::clicked, objects_trw, &QTreeWidget::collapseAll);
-	connect(by_oid_chk, &QCheckBox::toggled, this, &DatabaseExplorerWidget::filterObjects);
-	connect(filter_edt, &QLineEdit::textChanged, this, &DatabaseExplorerWidget::filterObjects);
+	filter_timer.setSingleShot(true);
+	filter_timer.setInterval(500);
+	connect(&filter_timer, &QTimer::timeout, this, &DatabaseExplorerWidget::filterObjects);
+	connect(by_oid_chk, &QCheckBox::toggled, &filter_timer, qOverload<>(&QTimer::start));
+	connect(filter_edt, &QLineEdit::textChanged, &filter_timer, qOverload<>(&QTimer::start));
 
 	connect(drop_db_tb,  &QToolButton::clicked, this, [this]() {
 		emit s_databaseDropRequested(connection.getConnectionParam(Connection::ParamDbName));
@@ -234,15 +239,7 @@ DatabaseExplorerWidget::DatabaseExplorerWidget(QWidget *parent): QWidget(parent)
 		objects_trw->blockSignals(false);
 	});
 
-	connect(objects_trw, &QTreeWidget::itemExpanded, this, [this](QTreeWidgetItem *item){
-		ObjectType obj_type=static_cast<ObjectType>(item->data(DatabaseImportForm::ObjectTypeId, Qt::UserRole).toUInt());
-		unsigned oid=item->data(DatabaseImportForm::ObjectId, Qt::UserRole).toUInt();
-
-		if((obj_type==ObjectType::Schema || BaseTable::isBaseTable(obj_type)) && oid > 0 && item->childCount() <= 1)
-		{
-			updateItem(item, false);
-		}
-	});
+	connect(objects_trw, &QTreeWidget::itemExpanded, this, &DatabaseExplorerWidget::loadItemChildren);
 
 	connect(sort_by_name_tb, &QToolButton::clicked, this, [this]() {
 			sort_column = sort_by_name_tb->isChecked() ? 0 : DatabaseImportForm::ObjectId;
@@ -259,6 +256,21 @@ DatabaseExplorerWidget::DatabaseExplorerWidget(QWidget *parent): QWidget(parent)
 
 	refresh_tb->setPopupMode(QToolButton::InstantPopup);
 	refresh_tb->setMenu(refresh_menu);
+
+	listing_hlp.moveToThread(&listing_thread);
+	connect(&listing_hlp, &ObjectsListingHelper::s_objectsCounted, this, &DatabaseExplorerWidget::handleObjectsCounted);
+	connect(&listing_hlp, &ObjectsListingHelper::s_objectsListed, this, &DatabaseExplorerWidget::handleObjectsListed);
+	connect(&listing_hlp, &ObjectsListingHelper::s_objectsFound, this, &DatabaseExplorerWidget::handleObjectsFound);
+	connect(&listing_hlp, &ObjectsListingHelper::s_listingFailed, this, &DatabaseExplorerWidget::handleListingFailed);
+	listing_thread.start();
+}
+
+DatabaseExplorerWidget::~DatabaseExplorerWidget()
+{
+	listing_hlp.discardRequests(last_req_id);
+	listing_thread.quit();
+	listing_thread.wait();
+	listing_hlp.closeConnection();
 }
 
 bool DatabaseExplorerWidget::eventFilter(QObject *object, QEvent *event)
@@ -1018,10 +1030,18 @@ void DatabaseExplorerWidget::listObjects()
 	{
 		QAction *act=qobject_cast<QAction *>(sender());
 		bool quick_refresh=(act ? act->data().toBool() : true);
+		QTreeWidgetItem *root = nullptr, *db_item = nullptr;
+		QString db_name = connection.getConnectionParam(Connection::ParamDbName);
+		std::vector<attribs_map> attribs;
 
-		configureImportHelper();
-		objects_trw->blockSignals(true);
+		/* In a full refresh the cached catalog results of the connection are discarded so
+		 * all the data is retrieved again even if the catalog change probe didn't detect changes */
+		if(!quick_refresh)
+			CatalogCache::invalidate(CatalogCache::getConnectionKey(connection.getConnectionParams()));
 
+		cancelObjectRename();
+		configureListingHelper();
+		objects_trw->blockSignals(true);
 
 		/* If the database version is ignored we display the
 		 * alert message if the current db version is unsupported */
@@ -1036,61 +1056,416 @@ void DatabaseExplorerWidget::listObjects()
 
 		saveTreeState();
 		clearObjectProperties();
+		discardPendingRequests();
 
-		if(quick_refresh)
-			QApplication::setOverrideCursor(Qt::WaitCursor);
-
-		DatabaseImportForm::listObjects(import_helper, objects_trw, false, false, true, quick_refresh, sort_column);
+		objects_trw->clear();
+		objects_trw->setColumnHidden(1, true);
 
-		QTreeWidgetItem *root = new QTreeWidgetItem, *curr_root = nullptr;
-
-		//Changing the root item of the generated tree to be a special item containing info about the connected server
-		curr_root = objects_trw->topLevelItem(0);
-		objects_trw->takeTopLevelItem(0);
+		//The root item is a special item containing info about the connected server
+		root = new QTreeWidgetItem;
 		root->setText(0, connection.getConnectionId(true));
 		root->setIcon(0, QPixmap(GuiUtilsNs::getIconPath("server")));
 		root->setData(DatabaseImportForm::ObjectId, Qt::UserRole, -1);
 		root->setData(DatabaseImportForm::ObjectTypeId, Qt::UserRole, enum_t(ObjectType::BaseObject));
 		root->setData(DatabaseImportForm::ObjectSource, Qt::UserRole, tr("-- Source code unavailable for this kind of object --"));
-		root->addChild(curr_root);
+
+		/* Only the database item is created here, its children are retrieved
+		 * in background by the listing helper when the item is expanded */
+		attribs = catalog.getObjectsAttributes(ObjectType::Database, "", "", {}, {{Attributes::Name, db_name}});
+		db_item = new QTreeWidgetItem(root);
+		db_item->setText(0, db_name);
+		db_item->setIcon(0, QPixmap(GuiUtilsNs::getIconPath(ObjectType::Database)));
+		db_item->setData(DatabaseImportForm::ObjectId, Qt::UserRole, attribs[0].at(Attributes::Oid).toUInt());
+		db_item->setData(DatabaseImportForm::ObjectTypeId, Qt::UserRole, enum_t(ObjectType::Database));
+		db_item->setToolTip(0, QString("OID: %1").arg(attribs[0].at(Attributes::Oid)));
+		createDummyItem(db_item);
+
 		objects_trw->addTopLevelItem(root);
 		root->setExpanded(true);
 		root->setSelected(true);
 		objects_trw->setCurrentItem(root);
-
-		restoreTreeState();
-
-		QApplication::restoreOverrideCursor();
 		objects_trw->blockSignals(false);
 
-		import_helper.closeConnection();
 		catalog.closeConnection();
+
+		if(!filter_edt->text().isEmpty())
+			filterObjects();
+		else
+			db_item->setExpanded(true);
 	}
 	catch(Exception &e)
 	{
-		QApplication::restoreOverrideCursor();
+		objects_trw->blockSignals(false);
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
 	}
 }
 
-void DatabaseExplorerWidget::configureImportHelper()
+void DatabaseExplorerWidget::configureListingHelper()
 {
-	import_helper.setConnection(connection);
-	import_helper.setCurrentDatabase(connection.getConnectionParam(Connection::ParamDbName));
-	import_helper.setImportOptions(show_sys_objs->isChecked(),
-																 show_ext_objs->isChecked(),
-																 false, false, false, false, false);
+	Connection conn = connection;
+	Catalog::QueryFilter filter = Catalog::ListAllObjects | Catalog::ExclBuiltinArrayTypes;
+
+	if(!show_sys_objs->isChecked())
+		filter |= Catalog::ExclSystemObjs;
+
+	if(!show_ext_objs->isChecked())
+		filter |= Catalog::ExclExtensionObjs;
+
+	//The helper's connection is configured in its own thread before any subsequent request is processed
+	QMetaObject::invokeMethod(&listing_hlp, [this, conn, filter](){
+		listing_hlp.setConnection(conn, filter);
+	}, Qt::QueuedConnection);
 
 	catalog.closeConnection();
 	catalog.setQueryFilter(Catalog::ListAllObjects);
 	catalog.setConnection(connection);
 }
 
+QTreeWidgetItem *DatabaseExplorerWidget::getDatabaseItem()
+{
+	QTreeWidgetItem *root = objects_trw->topLevelItem(0);
+	return (root && root->childCount() > 0 ? root->child(0) : nullptr);
+}
+
+QTreeWidgetItem *DatabaseExplorerWidget::createDummyItem(QTreeWidgetItem *parent)
+{
+	QTreeWidgetItem *item = new QTreeWidgetItem(parent);
+	item->setText(0, QString("..."));
+	item->setData(DatabaseImportForm::ObjectOtherData, Qt::UserRole, QVariant::fromValue<int>(-1));
+	return item;
+}
+
+QTreeWidgetItem *DatabaseExplorerWidget::getDummyItem(QTreeWidgetItem *parent)
+{
+	//The placeholder is always the first child of the item
+	if(!parent || parent->childCount() == 0 ||
+		 parent->child(0)->data(DatabaseImportForm::ObjectOtherData, Qt::UserRole).toInt() >= 0)
+		return nullptr;
+
+	return parent->child(0);
+}
+
+void DatabaseExplorerWidget::getChildrenParentNames(QTreeWidgetItem *item, QString &sch_name, QString &tab_name)
+{
+	ObjectType obj_type = static_cast<ObjectType>(item->data(DatabaseImportForm::ObjectTypeId, Qt::UserRole).toUInt());
+	unsigned oid = item->data(DatabaseImportForm::ObjectId, Qt::UserRole).toUInt();
+
+	sch_name = item->data(DatabaseImportForm::ObjectSchema, Qt::UserRole).toString();
+	tab_name = item->data(DatabaseImportForm::ObjectTable, Qt::UserRole).toString();
+
+	//Groups store the parent names of their objects, schemas and tables are the parents of their children
+	if(oid > 0 && obj_type == ObjectType::Schema)
+		sch_name = item->data(DatabaseImportForm::ObjectName, Qt::UserRole).toString();
+	else if(oid > 0 && BaseTable::isBaseTable(obj_type))
+		tab_name = item->data(DatabaseImportForm::ObjectName, Qt::UserRole).toString();
+}
+
+void DatabaseExplorerWidget::loadItemChildren(QTreeWidgetItem *item)
+{
+	QTreeWidgetItem *dummy = getDummyItem(item);
+
+	if(!dummy)
+		return;
+
+	for(auto &itr : pending_reqs)
+	{
+		//The children of the item are already being retrieved
+		if(itr.second == item)
+			return;
+	}
+
+	ObjectType obj_type = static_cast<ObjectType>(item->data(DatabaseImportForm::ObjectTypeId, Qt::UserRole).toUInt());
+	unsigned oid = item->data(DatabaseImportForm::ObjectId, Qt::UserRole).toUInt();
+	QString sch_name, tab_name;
+
+	getChildrenParentNames(item, sch_name, tab_name);
+	dummy->setText(0, tr("Loading..."));
+
+	if(oid == 0)
+	{
+		sendListingRequest(item, [this, obj_type, sch_name, tab_name](unsigned req_id){
+			listing_hlp.listObjects(req_id, obj_type, sch_name, tab_name);
+		});
+	}
+	else
+	{
+		std::vector<ObjectType> types = BaseObject::getChildObjectTypes(obj_type);
+
+		sendListingRequest(item, [this, types, sch_name, tab_name](unsigned req_id){
+			listing_hlp.countObjects(req_id, types, sch_name, tab_name);
+		});
+	}
+}
+
+unsigned DatabaseExplorerWidget::sendListingRequest(QTreeWidgetItem *item, std::function<void(unsigned)> request)
+{
+	unsigned req_id = ++last_req_id;
+
+	pending_reqs[req_id] = item;
+	QMetaObject::invokeMethod(&listing_hlp, [request, req_id](){
+		request(req_id);
+	}, Qt::QueuedConnection);
+
+	return req_id;
+}
+
+void DatabaseExplorerWidget::finishListingRequest(unsigned req_id)
+{
+	pending_reqs.erase(req_id);
+
+	/* When all the items expanded by the saved tree state are loaded
+	 * the state is discarded and the scroll position is restored */
+	if(pending_reqs.empty() && !items_state.isEmpty())
+	{
+		items_state.clear();
+		objects_trw->verticalScrollBar()->setValue(curr_scroll_value);
+	}
+}
+
+void DatabaseExplorerWidget::discardPendingRequests(QTreeWidgetItem *item)
+{
+	if(!item)
+	{
+		pending_reqs.clear();
+		listing_hlp.discardRequests(last_req_id);
+		return;
+	}
+
+	QTreeWidgetItem *parent = nullptr;
+
+	for(auto itr = pending_reqs.begin(); itr != pending_reqs.end();)
+	{
+		parent = itr->second;
+
+		while(parent && parent != item)
+			parent = parent->parent();
+
+		/* The results of the discarded requests are ignored when received. The helper itself
+		 * isn't notified since it processes the requests of other items in the same queue */
+		if(parent)
+			itr = pending_reqs.erase(itr);
+		else
+			itr++;
+	}
+}
+
+void DatabaseExplorerWidget::handleObjectsCounted(unsigned req_id, std::map<ObjectType, unsigned> counts)
+{
+	auto itr = pending_reqs.find(req_id);
+
+	if(itr == pending_reqs.end())
+		return;
+
+	QTreeWidgetItem *item = itr->second, *group = nullptr;
+	ObjectType obj_type = static_cast<ObjectType>(item->data(DatabaseImportForm::ObjectTypeId, Qt::UserRole).toUInt());
+	QString sch_name, tab_name;
+
+	getChildrenParentNames(item, sch_name, tab_name);
+	objects_trw->setUpdatesEnabled(false);
+	delete getDummyItem(item);
+
+	for(auto &type : BaseObject::getChildObjectTypes(obj_type))
+	{
+		group = DatabaseImportForm::createGroupItem(type, item, sch_name, tab_name);
+		DatabaseImportForm::setGroupItemCount(group, counts[type]);
+
+		//Only groups containing objects can be expanded
+		if(counts[type] > 0)
+			createDummyItem(group);
+	}
+
+	item->sortChildren(sort_column, Qt::AscendingOrder);
+	objects_trw->setUpdatesEnabled(true);
+	finishListingRequest(req_id);
+
+	for(int idx = 0; idx < item->childCount(); idx++)
+		restoreItemState(item->child(idx));
+}
+
+void DatabaseExplorerWidget::handleObjectsListed(unsigned req_id, std::vector<attribs_map> objects, bool finished)
+{
+	auto itr = pending_reqs.find(req_id);
+
+	if(itr == pending_reqs.end())
+		return;
+
+	QTreeWidgetItem *group = itr->second, *item = nullptr;
+	std::vector<QTreeWidgetItem *> items;
+	ObjectType obj_type;
+	QString sch_name, tab_name;
+
+	getChildrenParentNames(group, sch_name, tab_name);
+	objects_trw->setUpdatesEnabled(false);
+
+	for(auto &attribs : objects)
+	{
+		item = DatabaseImportForm::createObjectItem(attribs, group, sch_name, tab_name);
+		obj_type = static_cast<ObjectType>(item->data(DatabaseImportForm::ObjectTypeId, Qt::UserRole).toUInt());
+
+		//Schemas and tables have their children retrieved when they are expanded
+		if(obj_type == ObjectType::Schema || BaseTable::isBaseTable(obj_type))
+			createDummyItem(item);
+
+		items.push_back(item);
+	}
+
+	if(finished)
+	{
+		delete getDummyItem(group);
+		DatabaseImportForm::setGroupItemCount(group, group->childCount());
+		group->sortChildren(sort_column, Qt::AscendingOrder);
+	}
+	else if(getDummyItem(group))
+		getDummyItem(group)->setText(0, tr("Loading... (%1/%2)").arg(group->childCount() - 1)
+																	.arg(group->data(DatabaseImportForm::ObjectCount, Qt::UserRole).toUInt()));
+
+	objects_trw->setUpdatesEnabled(true);
+
+	if(finished)
+		finishListingRequest(req_id);
+
+	for(auto &item : items)
+		restoreItemState(item);
+}
+
+void DatabaseExplorerWidget::handleObjectsFound(unsigned req_id, std::vector<attribs_map> objects, std::vector<attribs_map> schemas)
+{
+	auto itr = pending_reqs.find(req_id);
+
+	if(itr == pending_reqs.end())
+		return;
+
+	QTreeWidgetItem *db_item = itr->second, *parent = nullptr, *item = nullptr;
+	std::map<QTreeWidgetItem *, std::map<ObjectType, QTreeWidgetItem *>> groups;
+	std::map<QString, QTreeWidgetItem *> sch_items;
+	attribs_map sch_oids;
+	ObjectType obj_type;
+	QString sch_name, schema_type = BaseObject::getSchemaName(ObjectType::Schema);
+
+	for(auto &attribs : schemas)
+		sch_oids[attribs[Attributes::Name]] = attribs[Attributes::Oid];
+
+	auto get_group = [&groups](QTreeWidgetItem *root, ObjectType type, const QString &sch_name) {
+		QTreeWidgetItem *&group = groups[root][type];
+
+		if(!group)
+			group = DatabaseImportForm::createGroupItem(type, root, sch_name);
+
+		return group;
+	};
+
+	//Returns the schema item creating it (even if it doesn't match the filter) as parent of the matching objects
+	auto get_schema = [&](const QString &name) {
+		QTreeWidgetItem *&sch_item = sch_items[name];
+
+		if(!sch_item)
+		{
+			attribs_map attribs = {{ Attributes::Oid, sch_oids[name] },
+														 { Attributes::Name, name },
+														 { Attributes::ObjectType, QString::number(enum_t(ObjectType::Schema)) }};
+
+			sch_item = DatabaseImportForm::createObjectItem(attribs, get_group(db_item, ObjectType::Schema, ""));
+		}
+
+		return sch_item;
+	};
+
+	objects_trw->setUpdatesEnabled(false);
+	qDeleteAll(db_item->takeChildren());
+
+	for(auto &attribs : objects)
+	{
+		obj_type = static_cast<ObjectType>(attribs[Attributes::ObjectType].toUInt());
+
+		if(obj_type == ObjectType::Schema)
+		{
+			get_schema(attribs[Attributes::Name]);
+			continue;
+		}
+
+		sch_name = (attribs[Attributes::ParentType] == schema_type ? attribs[Attributes::Parent] : "");
+		parent = (sch_name.isEmpty() ? db_item : get_schema(sch_name));
+		item = DatabaseImportForm::createObjectItem(attribs, get_group(parent, obj_type, sch_name), sch_name);
+
+		//Tables can still be expanded in order to browse their children
+		if(BaseTable::isBaseTable(obj_type))
+			createDummyItem(item);
+	}
+
+	for(auto &grp_itr : groups)
+	{
+		for(auto &itr : grp_itr.second)
+		{
+			DatabaseImportForm::setGroupItemCount(itr.second, itr.second->childCount());
+			itr.second->sortChildren(sort_column, Qt::AscendingOrder);
+			itr.second->setExpanded(true);
+		}
+
+		grp_itr.first->sortChildren(sort_column, Qt::AscendingOrder);
+		grp_itr.first->setExpanded(true);
+	}
+
+	if(objects.size() >= FilterResultsLimit)
+	{
+		item = new QTreeWidgetItem(db_item);
+		item->setText(0, tr("Only the first %1 matching objects are listed. Refine the filter to narrow the results.").arg(FilterResultsLimit));
+		item->setData(DatabaseImportForm::ObjectId, Qt::UserRole, -1);
+		item->setDisabled(true);
+	}
+	else if(objects.empty())
+	{
+		item = new QTreeWidgetItem(db_item);
+		item->setText(0, tr("No objects matching the filter were found."));
+		item->setData(DatabaseImportForm::ObjectId, Qt::UserRole, -1);
+		item->setDisabled(true);
+	}
+
+	objects_trw->setUpdatesEnabled(true);
+	finishListingRequest(req_id);
+}
+
+void DatabaseExplorerWidget::handleListingFailed(unsigned req_id, Exception e)
+{
+	auto itr = pending_reqs.find(req_id);
+
+	if(itr == pending_reqs.end())
+		return;
+
+	QTreeWidgetItem *item = itr->second;
+
+	/* The partially loaded children are removed and the placeholder is
+	 * restored so the user can retry the loading by clicking it */
+	discardPendingRequests(item);
+	qDeleteAll(item->takeChildren());
+	createDummyItem(item);
+	item->setExpanded(false);
+	finishListingRequest(req_id);
+
+	Messagebox msg_box;
+	msg_box.show(e);
+}
+
+void DatabaseExplorerWidget::restoreItemState(QTreeWidgetItem *item)
+{
+	if(!item || items_state.isEmpty())
+		return;
+
+	int oid = item->data(DatabaseImportForm::ObjectId, Qt::UserRole).toInt(),
+			grp_id = item->data(DatabaseImportForm::ObjectGroupId, Qt::UserRole).toInt(),
+			idx = items_state.indexOf(QRegularExpression(QString("(%1)(\\:)(.)+").arg(grp_id < 0 ? grp_id : oid)));
+
+	//Expanding the item makes it retrieve its children which have their state restored as well
+	if(idx >= 0)
+		item->setExpanded(items_state.at(idx).split(':').at(1).toInt() == 1);
+}
+
 void DatabaseExplorerWidget::handleObject(QTreeWidgetItem *item, int)
 {
 	if(item->data(DatabaseImportForm::ObjectOtherData, Qt::UserRole).toInt() < 0)
 	{
-		updateItem(item->parent(), true);
+		//Clicking the placeholder item retrieves the children of its parent
+		item->parent()->setExpanded(true);
+		loadItemChildren(item->parent());
 	}
 	else if(QApplication::mouseButtons()==Qt::MiddleButton && item->data(DatabaseImportForm::ObjectId, Qt::UserRole).toInt() >= 0)
 	{
@@ -1372,6 +1747,8 @@ void DatabaseExplorerWidget::dropObject(QTreeWidgetItem *item, bool cascade)
 					parent->setData(DatabaseImportForm::ObjectCount, Qt::UserRole, QVariant::fromValue<unsigned>(cnt));
 				}
 
+				discardPendingRequests(item);
+
 				if(parent)
 					parent->takeChild(parent->indexOfChild(item));
 				else
@@ -1441,6 +1818,8 @@ void DatabaseExplorerWidget::saveTreeState()
 	QTreeWidgetItem *item = nullptr;
 	int oid = 0, grp_id = 0;
 
+	items_state.clear();
+
 	while(*itr)
 	{
 		item = *itr;
@@ -1459,35 +1838,25 @@ void DatabaseExplorerWidget::restoreTreeState()
 		return;
 
 	QTreeWidgetItemIterator itr(objects_trw);
-	QTreeWidgetItem *item = nullptr;	
-	QStringList st_info;
-	int oid = 0, grp_id = 0, idx = 0;
-
-	objects_trw->setUpdatesEnabled(false);
+	std::vector<QTreeWidgetItem *> items;
 
+	/* The items are collected before being expanded since the expansion
+	 * of an item may trigger the loading of its children */
 	while(*itr)
 	{
-		item = *itr;
-		oid = item->data(DatabaseImportForm::ObjectId, Qt::UserRole).toInt();
-		grp_id = item->data(DatabaseImportForm::ObjectGroupId, Qt::UserRole).toInt();
-
-		if(grp_id < 0)
-			idx = items_state.indexOf(QRegularExpression(QString("(%1)(\\:)(.)+").arg(grp_id)));
-		else
-			idx = items_state.indexOf(QRegularExpression(QString("(%1)(\\:)(.)+").arg(oid)));
-
-		if(idx >= 0)
-		{
-			st_info = items_state.at(idx).split(':');
-			item->setExpanded(st_info[1].toInt() == 1);
-		}
-
+		items.push_back(*itr);
 		++itr;
 	}
 
-	objects_trw->setUpdatesEnabled(true);
-	items_state.clear();	
-	objects_trw->verticalScrollBar()->setValue(curr_scroll_value);
+	for(auto &item : items)
+		restoreItemState(item);
+
+	//The saved state is discarded only when all the items expanded above finish loading their children
+	if(pending_reqs.empty())
+	{
+		items_state.clear();
+		objects_trw->verticalScrollBar()->setValue(curr_scroll_value);
+	}
 }
 
 void DatabaseExplorerWidget::truncateTable(QTreeWidgetItem *item, bool cascade)
@@ -1516,98 +1885,51 @@ void DatabaseExplorerWidget::updateItem(QTreeWidgetItem *item, bool restore_tree
 
 	try
 	{
-		QTreeWidgetItem *root=nullptr, *parent=nullptr, *aux_item=nullptr;
 		ObjectType obj_type=static_cast<ObjectType>(item->data(DatabaseImportForm::ObjectTypeId, Qt::UserRole).toUInt());
 		unsigned obj_id=item->data(DatabaseImportForm::ObjectId, Qt::UserRole).toUInt();
-		QString sch_name, tab_name;
-		std::vector<QTreeWidgetItem *> gen_items;
-
-		QApplication::setOverrideCursor(Qt::WaitCursor);
-
-		if(restore_tree_state)
-			saveTreeState();
+		QTreeWidgetItem *root = item;
 
 		if(obj_type==ObjectType::Database)
-			listObjects();
-		else
 		{
-			clearObjectProperties();
-			parent=item->parent();
-			sch_name=item->data(DatabaseImportForm::ObjectSchema, Qt::UserRole).toString();
-			tab_name=item->data(DatabaseImportForm::ObjectTable, Qt::UserRole).toString();
+			listObjects();
+			return;
+		}
 
-			if(parent)
-			{
-				if(obj_id==0)
-				{
-					root=parent;
-					parent->takeChild(parent->indexOfChild(item));
-				}
-				else
-				{
-					if(obj_type==ObjectType::Schema || BaseTable::isBaseTable(obj_type))
-					{
-						root=item;
-						root->takeChildren();
+		cancelObjectRename();
+		clearObjectProperties();
 
-						if(obj_type == ObjectType::Schema)
-							sch_name=item->text(0);
-						else
-							tab_name=item->text(0);
-					}
-					else
-					{
-						root=parent->parent();
-						root->takeChild(root->indexOfChild(parent));
-					}
-				}
-			}
+		if(restore_tree_state)
+			saveTreeState();
 
-			configureImportHelper();
+		/* Groups, schemas and tables have their children retrieved again
+		 * while the other objects have their whole group updated */
+		if(obj_id > 0 && obj_type!=ObjectType::Schema && !BaseTable::isBaseTable(obj_type))
+			root = item->parent();
 
-			//Updates the group type only
-			if(obj_id==0 || (!BaseTable::isBaseTable(obj_type) && obj_type!=ObjectType::Schema))
-				gen_items=DatabaseImportForm::updateObjectsTree(import_helper, objects_trw, { obj_type }, false, false, root, sch_name, tab_name);
-			else
-				//Updates all child objcts when the selected object is a schema or table or view
-				gen_items=DatabaseImportForm::updateObjectsTree(import_helper, objects_trw,
-																BaseObject::getChildObjectTypes(obj_type), false, false, root, sch_name, tab_name);
+		if(!root)
+			return;
 
-			//Creating dummy items for schemas and tables
-			if(obj_type==ObjectType::Schema || BaseTable::isBaseTable(obj_type))
-			{
-				for(auto &item : gen_items)
-				{
-					aux_item=new QTreeWidgetItem(item);
-					aux_item->setText(0, QString("..."));
-					aux_item->setData(DatabaseImportForm::ObjectOtherData, Qt::UserRole, QVariant::fromValue<int>(-1));
-				}
-			}
+		objects_trw->setCurrentItem(nullptr);
+		discardPendingRequests(root);
+		qDeleteAll(root->takeChildren());
+		createDummyItem(root);
 
-			import_helper.closeConnection();
-			objects_trw->sortItems(sort_column, Qt::AscendingOrder);
-			objects_trw->setCurrentItem(nullptr);
+		/* The objects are retrieved in background and the saved state of the
+		 * tree (if any) is applied to the new items as they are inserted */
+		loadItemChildren(root);
 
-			if(BaseTable::isBaseTable(obj_type))
-			{
-				objects_trw->blockSignals(true);
-				objects_trw->setCurrentItem(item);
-				showObjectProperties(true);
-				objects_trw->setCurrentItem(nullptr);
-				objects_trw->blockSignals(false);
-			}
+		if(BaseTable::isBaseTable(obj_type) && obj_id > 0)
+		{
+			objects_trw->blockSignals(true);
+			objects_trw->setCurrentItem(item);
+			showObjectProperties(true);
+			objects_trw->setCurrentItem(nullptr);
+			objects_trw->blockSignals(false);
 		}
-
-		if(restore_tree_state)
-			restoreTreeState();
-
-		QApplication::restoreOverrideCursor();
 	}
 	catch(Exception &e)
 	{
 		objects_trw->blockSignals(false);
-		objects_trw->setUpdatesEnabled(true);
-		QApplication::restoreOverrideCursor();
 		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
 	}
 }
@@ -2088,8 +2410,34 @@ void DatabaseExplorerWidget::loadObjectSource()
 
 void DatabaseExplorerWidget::filterObjects()
 {
-	DatabaseImportForm::filterObjects(objects_trw, filter_edt->text(),
-																		(by_oid_chk->isChecked() ? DatabaseImportForm::ObjectId : 0), false);
+	QTreeWidgetItem *db_item = getDatabaseItem();
+	QString pattern = filter_edt->text();
+	bool by_oid = by_oid_chk->isChecked();
+
+	if(!db_item)
+		return;
+
+	//Clearing the filter restores the full (lazily loaded) tree
+	if(pattern.isEmpty())
+	{
+		listObjects();
+		return;
+	}
+
+	cancelObjectRename();
+	clearObjectProperties();
+	objects_trw->setCurrentItem(nullptr);
+	discardPendingRequests();
+	qDeleteAll(db_item->takeChildren());
+	createDummyItem(db_item)->setText(0, tr("Searching..."));
+
+	/* The filtering is performed by the server so objects not loaded in
+	 * the tree yet can be found, the amount of results is limited though */
+	sendListingRequest(db_item, [this, pattern, by_oid](unsigned req_id){
+		listing_hlp.findObjects(req_id, pattern, by_oid, FilterResultsLimit);
+	});
+
+	db_item->setExpanded(true);
 }
 
 QString DatabaseExplorerWidget::getObjectSource(BaseObject *object, DatabaseModel *dbmodel)
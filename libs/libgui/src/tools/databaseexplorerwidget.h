@@ -19,7 +19,9 @@
 /**
 \ingroup libgui
 \class DatabaseExplorerWidge
-\brief Implements the operations to browse and manipulate database instances
+\brief Implements the operations to browse and manipulate database instances. The objects tree is populated
+on demand: only the amount of objects in each group is retrieved until a group is expanded, and the objects are
+retrieved in a background connection (see ObjectsListingHelper) and inserted in the tree in batches.
 */
 
 #ifndef DATABASE_EXPLORER_WIDGET_H
@@ -27,7 +29,11 @@
 
 #include "ui_databaseexplorerwidget.h"
 #include "databaseimporthelper.h"
+#include "objectslistinghelper.h"
 #include "schemaparser.h"
+#include <QThread>
+#include <QTimer>
+#include <functional>
 
 class __libgui DatabaseExplorerWidget: public QWidget, public Ui::DatabaseExplorerWidget {
 	private:
@@ -41,9 +47,13 @@ class __libgui DatabaseExplorerWidget: public QWidget, public Ui::DatabaseExplor
 		 * The elements in this list have the form (oid|groupid):(0|1).
 		 * The first part is the id/group id of the tree item and the second (after :)
 		 * is the expanded status (0->false, 1->true).
-		 * This attribute is used by saveTreeState() and restoreTreeState() */
+		 * This attribute is used by saveTreeState() and restoreTreeState(). Since the
+		 * items are loaded on demand, the saved state is kept until all the pending listing requests finish */
 		QStringList items_state;
 
+		//! \brief Maximum amount of objects retrieved from the server when filtering the tree
+		static constexpr unsigned FilterResultsLimit = 1000;
+
 		static const QString DepNotDefined,
 		DepNotFound,
 		DefaultSourceCode;
@@ -57,9 +67,21 @@ class __libgui DatabaseExplorerWidget: public QWidget, public Ui::DatabaseExplor
 
 		QString default_db;
 		
-		//! \brief Database import helper used to list objects from current connection
-		DatabaseImportHelper import_helper;
-		
+		//! \brief Thread in which the listing helper retrieves the objects from the database
+		QThread listing_thread;
+
+		//! \brief Helper used to count and list the objects of the current connection in background
+		ObjectsListingHelper listing_hlp;
+
+		//! \brief The id of the last request sent to the listing helper
+		unsigned last_req_id;
+
+		//! \brief Stores the items waiting for the results of listing requests (the key is the request id)
+		std::map<unsigned, QTreeWidgetItem *> pending_reqs;
+
+		//! \brief Delays the server-side filtering of the objects until the user stops typing the pattern
+		QTimer filter_timer;
+
 		//! \brief Catalog instance used to retrieve object's attributes
 		Catalog catalog;
 		
@@ -82,7 +104,38 @@ class __libgui DatabaseExplorerWidget: public QWidget, public Ui::DatabaseExplor
 		
 		int sort_column;
 
-		void configureImportHelper();
+		//! \brief Configures the connection and the query filter of the catalog and the listing helper
+		void configureListingHelper();
+
+		//! \brief Returns the item that represents the current database in the tree (if any)
+		QTreeWidgetItem *getDatabaseItem();
+
+		//! \brief Creates the placeholder item that indicates that the children of the parent weren't retrieved yet
+		QTreeWidgetItem *createDummyItem(QTreeWidgetItem *parent);
+
+		//! \brief Returns the placeholder item of the parent (if any)
+		QTreeWidgetItem *getDummyItem(QTreeWidgetItem *parent);
+
+		/*! \brief Retrieves the names of schema and table in which the children of the item (a group, schema or table) are.
+		 * The names are stored in the provided references */
+		void getChildrenParentNames(QTreeWidgetItem *item, QString &sch_name, QString &tab_name);
+
+		/*! \brief Requests the children of the item in case they weren't retrieved yet. Groups have their objects listed
+		 * while the database, schemas and tables have the objects of their child groups counted */
+		void loadItemChildren(QTreeWidgetItem *item);
+
+		//! \brief Sends a request to the listing helper returning its id. The request is associated to the provided item
+		unsigned sendListingRequest(QTreeWidgetItem *item, std::function<void(unsigned)> request);
+
+		//! \brief Removes the request from the pending ones and restores the scroll position when all requests are finished
+		void finishListingRequest(unsigned req_id);
+
+		/*! \brief Ignores the results of the pending requests of the item and its children (or of all items in the
+		 * tree when no item is specified). This method must be called before removing items from the tree */
+		void discardPendingRequests(QTreeWidgetItem *item = nullptr);
+
+		//! \brief Restores the expanded status of a single item from the saved tree state
+		void restoreItemState(QTreeWidgetItem *item);
 		
 		//! \brief Drops the object represented by the specified item
 		void dropObject(QTreeWidgetItem *item, bool cascade);
@@ -157,6 +210,7 @@ class __libgui DatabaseExplorerWidget: public QWidget, public Ui::DatabaseExplor
 
 	public:
 		DatabaseExplorerWidget(QWidget * parent = nullptr);
+		virtual ~DatabaseExplorerWidget();
 		
 		//! \brief Configures the connection used to retrieve and manipulate objects on database
 		void setConnection(Connection conn, const QString &default_db);
@@ -203,8 +257,14 @@ class __libgui DatabaseExplorerWidget: public QWidget, public Ui::DatabaseExplor
 
 		void loadObjectSource();
 
+		//! \brief Queries the server for the objects matching the filter or lists all the objects when the filter is empty
 		void filterObjects();
 
+		void handleObjectsCounted(unsigned req_id, std::map<ObjectType, unsigned> counts);
+		void handleObjectsListed(unsigned req_id, std::vector<attribs_map> objects, bool finished);
+		void handleObjectsFound(unsigned req_id, std::vector<attribs_map> objects, std::vector<attribs_map> schemas);
+		void handleListingFailed(unsigned req_id, Exception e);
+
 	signals:
 		//! \brief This signal is emmited to indicate that a sql execution widget need to be opened
 		void s_sqlExecutionRequested();
@@ -0,0 +1,477 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "databaseimportcache.h"
+#include "catalogcache.h"
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QDataStream>
+
+QString DatabaseImportCache::cache_dir;
+
+const QString DatabaseImportCache::MarkersFileExt(".markers");
+
+DatabaseImportCache::DatabaseImportCache()
+{
+	reimported_count = 0;
+}
+
+void DatabaseImportCache::setCacheDirectory(const QString &dir)
+{
+	if(!dir.isEmpty() && !QDir().mkpath(dir))
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(dir),
+										ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	cache_dir = dir;
+}
+
+QString DatabaseImportCache::getCacheDirectory()
+{
+	return cache_dir;
+}
+
+void DatabaseImportCache::setCacheKey(const attribs_map &conn_params, const QStringList &import_opts)
+{
+	QCryptographicHash hash(QCryptographicHash::Sha1);
+
+	hash.addData(GlobalAttributes::PgModelerVersion.toUtf8());
+	hash.addData(GlobalAttributes::PgModelerBuildNumber.toUtf8());
+	hash.addData(CatalogCache::getConnectionKey(conn_params).toUtf8());
+	hash.addData(import_opts.join(QChar('\n')).toUtf8());
+
+	cache_key = hash.result().toHex();
+	cached_objs.clear();
+}
+
+QString DatabaseImportCache::getCacheFilePath(const QString &ext)
+{
+	return cache_dir + GlobalAttributes::DirSeparator + cache_key + ext;
+}
+
+void DatabaseImportCache::retrieveMarkers(Catalog &catalog, const std::map<ObjectType, std::vector<unsigned>> &obj_oids)
+{
+	try
+	{
+		std::map<unsigned, QString> markers;
+		std::map<unsigned, unsigned> parents;
+		ObjectEntry entry;
+
+		curr_objs.clear();
+		catalog.getObjectsMarkers(markers, parents);
+
+		for(auto &[obj_type, oids] : obj_oids)
+		{
+			//The database is always imported again so it has no entry
+			if(obj_type == ObjectType::Database)
+				continue;
+
+			for(auto &oid : oids)
+			{
+				entry.obj_type = obj_type;
+				entry.parent_oid = (TableObject::isTableObject(obj_type) ? parents[oid] : 0);
+
+				/* Objects not covered by the markers query receive an empty marker
+				 * which is never considered up to date (see loadCachedModel()) */
+				entry.marker = markers[oid];
+				curr_objs[oid] = entry;
+			}
+		}
+	}
+	catch(Exception &e)
+	{
+		//Without the current markers the cache can't be used nor updated
+		curr_objs.clear();
+		cache_key.clear();
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+bool DatabaseImportCache::loadMarkersFile()
+{
+	QFile input(getCacheFilePath(MarkersFileExt));
+	QDataStream stream;
+	quint32 magic = 0, version = 0, count = 0, oid = 0, parent_oid = 0, obj_type = 0;
+	QString key;
+	ObjectEntry entry;
+
+	cached_objs.clear();
+
+	if(!input.open(QFile::ReadOnly))
+		return false;
+
+	stream.setDevice(&input);
+	stream.setVersion(QDataStream::Qt_6_0);
+	stream >> magic >> version >> key >> count;
+
+	if(stream.status() != QDataStream::Ok ||
+		 magic != Magic || version != FormatVersion || key != cache_key)
+		return false;
+
+	for(quint32 i = 0; i < count && stream.status() == QDataStream::Ok; i++)
+	{
+		stream >> oid >> parent_oid >> obj_type >> entry.marker >> entry.name;
+		entry.obj_type = static_cast<ObjectType>(obj_type);
+		entry.parent_oid = parent_oid;
+		cached_objs[oid] = entry;
+	}
+
+	if(stream.status() != QDataStream::Ok)
+	{
+		cached_objs.clear();
+		return false;
+	}
+
+	return true;
+}
+
+void DatabaseImportCache::saveMarkersFile()
+{
+	QSaveFile output(getCacheFilePath(MarkersFileExt));
+	QDataStream stream;
+
+	if(!output.open(QFile::WriteOnly))
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(output.fileName()),
+										ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	stream.setDevice(&output);
+	stream.setVersion(QDataStream::Qt_6_0);
+	stream << Magic << FormatVersion << cache_key << static_cast<quint32>(curr_objs.size());
+
+	for(auto &[oid, entry] : curr_objs)
+	{
+		stream << static_cast<quint32>(oid) << static_cast<quint32>(entry.parent_oid)
+					 << static_cast<quint32>(entry.obj_type) << entry.marker << entry.name;
+	}
+
+	if(stream.status() != QDataStream::Ok || !output.commit())
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(output.fileName()),
+										ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+}
+
+bool DatabaseImportCache::removeOutdatedObjects(DatabaseModel *model, const std::vector<BaseObject *> &outdated_objs, std::vector<BaseObject *> &removed_objs)
+{
+	std::map<unsigned, BaseObject *> objs_map;
+	std::vector<BaseObject *> pending_objs = outdated_objs, refs, tab_objs;
+	std::vector<BaseRelationship *> rels;
+	BaseObject *object = nullptr;
+	BaseRelationship *rel = nullptr;
+	TableObject *tab_obj = nullptr;
+	BaseTable *table = nullptr;
+	size_t prev_count = 0;
+
+	/* Retrieving all the objects that reference the outdated ones (directly or indirectly).
+	 * Since table children objects are imported together with their tables, the parent table
+	 * of a referencing child object is removed as well as the tables linked by relationships */
+	while(!pending_objs.empty())
+	{
+		object = pending_objs.back();
+		pending_objs.pop_back();
+
+		if(!object || objs_map.count(object->getObjectId()))
+			continue;
+
+		objs_map[object->getObjectId()] = object;
+		model->getObjectReferences(object, refs, false, true);
+
+		for(auto &ref_obj : refs)
+		{
+			tab_obj = dynamic_cast<TableObject *>(ref_obj);
+			rel = dynamic_cast<BaseRelationship *>(ref_obj);
+
+			if(tab_obj)
+				pending_objs.push_back(tab_obj->getParentTable());
+			else if(rel)
+			{
+				/* Base relationships (fk and view relationships) are handled by the model
+				 * when their tables/foreign keys are removed */
+				if(rel->getObjectType() != ObjectType::Relationship ||
+					 std::find(rels.begin(), rels.end(), rel) != rels.end())
+					continue;
+
+				rels.push_back(rel);
+				pending_objs.push_back(rel->getTable(BaseRelationship::SrcTable));
+				pending_objs.push_back(rel->getTable(BaseRelationship::DstTable));
+			}
+			else if(ref_obj != model)
+				pending_objs.push_back(ref_obj);
+		}
+	}
+
+	try
+	{
+		for(auto &aux_rel : rels)
+		{
+			model->removeObject(aux_rel);
+			removed_objs.push_back(aux_rel);
+		}
+
+		/* The children objects (except columns) are detached from the tables to be removed
+		 * since the model doesn't remove a table while it has triggers, indexes, rules, etc */
+		for(auto &[obj_id, obj] : objs_map)
+		{
+			table = dynamic_cast<BaseTable *>(obj);
+
+			if(!table)
+				continue;
+
+			tab_objs = table->getObjects({ ObjectType::Column });
+
+			for(auto &child : tab_objs)
+			{
+				table->removeObject(child);
+				removed_objs.push_back(child);
+			}
+
+			if(table->getObjectType() == ObjectType::Table)
+				model->updateTableFKRelationships(dynamic_cast<Table *>(table));
+		}
+
+		for(auto itr = objs_map.rbegin(); itr != objs_map.rend(); itr++)
+			pending_objs.push_back(itr->second);
+	}
+	catch(Exception &)
+	{
+		return false;
+	}
+
+	/* An object can only be removed after the objects referencing it, so the removal is
+	 * done in several passes until all objects are removed or no progress is made */
+	do
+	{
+		prev_count = pending_objs.size();
+
+		for(auto itr = pending_objs.begin(); itr != pending_objs.end();)
+		{
+			try
+			{
+				model->removeObject(*itr);
+				removed_objs.push_back(*itr);
+				itr = pending_objs.erase(itr);
+			}
+			catch(Exception &)
+			{
+				itr++;
+			}
+		}
+	}
+	while(!pending_objs.empty() && pending_objs.size() < prev_count);
+
+	return pending_objs.empty();
+}
+
+DatabaseModel *DatabaseImportCache::loadCachedModel(std::map<ObjectType, std::vector<unsigned>> &obj_oids, std::map<unsigned, std::vector<unsigned>> &col_oids)
+{
+	QString model_file = getCacheFilePath(GlobalAttributes::DbModelExt);
+	DatabaseModel *model = nullptr;
+	std::vector<BaseObject *> outdated_objs, removed_objs;
+	bool is_valid = true;
+
+	reused_oids.clear();
+	reimported_count = 0;
+
+	if(cache_dir.isEmpty() || cache_key.isEmpty() ||
+		 !QFileInfo::exists(model_file) || !loadMarkersFile())
+		return nullptr;
+
+	try
+	{
+		std::map<unsigned, BaseObject *> oids_objs;
+		std::map<BaseObject *, unsigned> objs_oids;
+		std::set<unsigned> outdated_oids, reimport_oids;
+		std::map<ObjectType, std::vector<unsigned>> filtered_oids;
+		std::map<unsigned, std::vector<unsigned>> filtered_col_oids;
+		BaseObject *object = nullptr;
+
+		model = new DatabaseModel;
+		model->createSystemObjects(false);
+		model->loadModel(model_file);
+
+		for(auto &[oid, entry] : cached_objs)
+		{
+			auto itr = curr_objs.find(oid);
+
+			//Locating in the model the objects imported previously
+			if(entry.parent_oid == 0 && !entry.name.isEmpty())
+			{
+				object = model->getObject(entry.name, entry.obj_type);
+
+				if(object)
+				{
+					oids_objs[oid] = object;
+					objs_oids[object] = oid;
+				}
+			}
+
+			//Objects dropped or changed since the previous import (changes in table children affect the parent tables)
+			if(entry.marker.isEmpty() || itr == curr_objs.end() ||
+				 itr->second.marker != entry.marker || itr->second.obj_type != entry.obj_type)
+				outdated_oids.insert(entry.parent_oid != 0 ? entry.parent_oid : oid);
+		}
+
+		//Objects created since the previous import
+		for(auto &[oid, entry] : curr_objs)
+		{
+			if(cached_objs.count(oid) == 0)
+				outdated_oids.insert(entry.parent_oid != 0 ? entry.parent_oid : oid);
+		}
+
+		for(auto &oid : outdated_oids)
+		{
+			auto obj_itr = oids_objs.find(oid);
+			auto entry_itr = cached_objs.find(oid);
+
+			if(obj_itr != oids_objs.end())
+				outdated_objs.push_back(obj_itr->second);
+
+			/* If an outdated object imported previously can't be located in the model its
+			 * old definition can't be removed so the cached model is discarded */
+			else if(entry_itr != cached_objs.end() && !entry_itr->second.name.isEmpty())
+				is_valid = false;
+		}
+
+		is_valid = is_valid && removeOutdatedObjects(model, outdated_objs, removed_objs);
+		reimport_oids = outdated_oids;
+
+		for(auto &rem_obj : removed_objs)
+		{
+			if(!is_valid)
+				break;
+
+			//Relationships and table children objects are recreated by the import of the tables
+			if(rem_obj->getObjectType() == ObjectType::Relationship ||
+				 TableObject::isTableObject(rem_obj->getObjectType()))
+				continue;
+
+			//Removed objects that aren't associated to an oid can't be imported again
+			if(objs_oids.count(rem_obj) == 0)
+				is_valid = false;
+			else
+				reimport_oids.insert(objs_oids[rem_obj]);
+		}
+
+		if(is_valid)
+		{
+			for(auto &[obj_type, oids] : obj_oids)
+			{
+				for(auto &oid : oids)
+				{
+					auto itr = curr_objs.find(oid);
+
+					if(obj_type == ObjectType::Database || reimport_oids.count(oid) ||
+						 (itr != curr_objs.end() && reimport_oids.count(itr->second.parent_oid)))
+						filtered_oids[obj_type].push_back(oid);
+				}
+			}
+
+			for(auto &[tab_oid, cols] : col_oids)
+			{
+				if(reimport_oids.count(tab_oid))
+					filtered_col_oids[tab_oid] = cols;
+			}
+
+			for(auto &[oid, obj] : oids_objs)
+			{
+				if(reimport_oids.count(oid) == 0)
+					reused_oids.insert(oid);
+			}
+
+			reimported_count = reimport_oids.size();
+			obj_oids = filtered_oids;
+			col_oids = filtered_col_oids;
+		}
+	}
+	catch(Exception &)
+	{
+		is_valid = false;
+	}
+
+	/* The removed objects are destroyed in the order of the removal so the relationships
+	 * and table children objects are destroyed while their tables still exist */
+	for(auto &rem_obj : removed_objs)
+		delete rem_obj;
+
+	if(!is_valid)
+	{
+		delete model;
+		reused_oids.clear();
+		reimported_count = 0;
+		return nullptr;
+	}
+
+	return model;
+}
+
+void DatabaseImportCache::saveCachedModel(DatabaseModel *model, const std::map<unsigned, QString> &objs_names)
+{
+	if(cache_dir.isEmpty() || cache_key.isEmpty() || !model)
+		return;
+
+	try
+	{
+		/* The objects imported in the last import receive the names used by the import helper
+		 * while the ones reused from the cached model keep the names stored previously. The objects
+		 * that are not in the model (e.g. failed to be imported) have their markers cleared so
+		 * they are always considered outdated */
+		for(auto &[oid, entry] : curr_objs)
+		{
+			auto name_itr = objs_names.find(oid);
+
+			if(entry.parent_oid != 0)
+				continue;
+
+			if(name_itr != objs_names.end())
+				entry.name = name_itr->second;
+			else if(reused_oids.count(oid))
+				entry.name = cached_objs[oid].name;
+			else
+			{
+				entry.name.clear();
+				entry.marker.clear();
+			}
+		}
+
+		model->saveModel(getCacheFilePath(GlobalAttributes::DbModelExt), SchemaParser::XmlCode);
+		saveMarkersFile();
+		cached_objs = curr_objs;
+	}
+	catch(Exception &e)
+	{
+		QFile::remove(getCacheFilePath(GlobalAttributes::DbModelExt));
+		QFile::remove(getCacheFilePath(MarkersFileExt));
+		cached_objs.clear();
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+unsigned DatabaseImportCache::getReusedCount()
+{
+	return reused_oids.size();
+}
+
+unsigned DatabaseImportCache::getReimportedCount()
+{
+	return reimported_count;
+}
@@ -0,0 +1,129 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libgui
+\class DatabaseImportCache
+\brief Implements a persistent cache of the models imported by the diff process so a new comparison against the same
+database only needs to retrieve the objects created, changed or dropped since the previous import. Along with the imported
+model the cache stores the change markers of the imported objects (see Catalog::getObjectsMarkers()) which are compared
+with the current ones in order to determine the outdated objects. Those objects, as well as the ones that reference them,
+are removed from the cached model and only them are imported again. Table children objects are always imported together
+with their parent tables. When the cached model can't be reused (missing or invalid cache files, objects that can't be
+located in the cached model, etc.) the caller must perform a full import.
+*/
+
+#ifndef DATABASE_IMPORT_CACHE_H
+#define DATABASE_IMPORT_CACHE_H
+
+#include "guiglobal.h"
+#include "catalog.h"
+#include "databasemodel.h"
+#include <set>
+
+class __libgui DatabaseImportCache {
+	private:
+		//! \brief Identifies the markers files (the chars "PGMI")
+		static constexpr quint32 Magic = 0x50474D49;
+
+		//! \brief Version of the markers file format. This must be incremented every time the format is changed
+		static constexpr quint32 FormatVersion = 1;
+
+		//! \brief Extension of the files that store the markers of the objects in the cached model
+		static const QString MarkersFileExt;
+
+		struct ObjectEntry {
+			ObjectType obj_type;
+
+			//! \brief The oid of the parent table (table children objects only)
+			unsigned parent_oid;
+
+			//! \brief The change marker of the object retrieved from the catalog
+			QString marker;
+
+			//! \brief The name used to locate the object in the cached model (empty for table children objects)
+			QString name;
+
+			ObjectEntry() : obj_type(ObjectType::BaseObject), parent_oid(0) {}
+		};
+
+		/*! \brief Directory where the cache files are stored.
+		 * When empty (default) no cache is used (see setCacheDirectory()) */
+		static QString cache_dir;
+
+		//! \brief Identifies the cache files of the database and import options in use (see setCacheKey())
+		QString cache_key;
+
+		//! \brief The entries of the objects in the cached model indexed by their oids
+		std::map<unsigned, ObjectEntry> cached_objs;
+
+		//! \brief The entries of the objects selected for the current import indexed by their oids (see retrieveMarkers())
+		std::map<unsigned, ObjectEntry> curr_objs;
+
+		//! \brief The oids of the objects reused from the cached model in the last call to loadCachedModel()
+		std::set<unsigned> reused_oids;
+
+		//! \brief Amount of objects imported again into the cached model in the last call to loadCachedModel()
+		unsigned reimported_count;
+
+		//! \brief Returns the path to the cache file with the provided extension
+		QString getCacheFilePath(const QString &ext);
+
+		//! \brief Reads the markers file filling the cached objects entries. Returns false if the file is missing or invalid
+		bool loadMarkersFile();
+
+		//! \brief Writes the current objects entries to the markers file
+		void saveMarkersFile();
+
+		/*! \brief Removes from the model the provided objects as well all objects that reference them (directly or
+		 * indirectly) storing the removed objects in the provided vector. Returns false when the objects can't be removed */
+		bool removeOutdatedObjects(DatabaseModel *model, const std::vector<BaseObject *> &outdated_objs, std::vector<BaseObject *> &removed_objs);
+
+	public:
+		DatabaseImportCache();
+
+		/*! \brief Configures the directory where the cache files are stored. An empty value disables the cache.
+		 * The directory is created if it doesn't exist */
+		static void setCacheDirectory(const QString &dir);
+
+		static QString getCacheDirectory();
+
+		/*! \brief Configures the key that identifies the cache files from the connection parameters (including the database)
+		 * and the options that change the set of imported objects (e.g. import of system objects, partial diff filters) */
+		void setCacheKey(const attribs_map &conn_params, const QStringList &import_opts);
+
+		/*! \brief Retrieves the current change markers of the objects selected for the import (see Catalog::getObjectsOIDs()).
+		 * This method must be called before loadCachedModel() */
+		void retrieveMarkers(Catalog &catalog, const std::map<ObjectType, std::vector<unsigned>> &obj_oids);
+
+		/*! \brief Loads the cached model removing the outdated objects from it and filters the provided oids maps so they
+		 * contain only the objects that must be imported again into the returned model. Returns nullptr (leaving the maps untouched)
+		 * when the cache can't be used, in that case a full import must be performed */
+		DatabaseModel *loadCachedModel(std::map<ObjectType, std::vector<unsigned>> &obj_oids, std::map<unsigned, std::vector<unsigned>> &col_oids);
+
+		/*! \brief Stores the imported model and the markers retrieved by retrieveMarkers() in the cache. The names of the objects
+		 * imported in the last import (see DatabaseImportHelper::getImportedObjectsNames()) are used to locate them in the next loading.
+		 * In case of errors the cache files are removed so the next import is a full one */
+		void saveCachedModel(DatabaseModel *model, const std::map<unsigned, QString> &objs_names);
+
+		unsigned getReusedCount();
+
+		unsigned getReimportedCount();
+};
+
+#endif
@@ -921,14 +921,13 @@ std::vector<QTreeWidgetItem *> DatabaseImportForm::updateObjectsTree(DatabaseImp
 		QTreeWidgetItem *group=nullptr, *item=nullptr;
 		QFont grp_fnt=tree_wgt->font();
 		attribs_map extra_attribs={{Attributes::FilterTableTypes, Attributes::True}};
-		QString tooltip=QString("OID: %1"), name, label;
+		QString name;
 		bool child_checked=false;
 		std::vector<attribs_map> objects_vect;
 		std::map<ObjectType, QTreeWidgetItem *> gen_groups;
 		ObjectType obj_type;
 		QList<QTreeWidgetItem*> groups_list;
 		unsigned oid=0;
-		int start=-1, end=-1;
 
 		grp_fnt.setItalic(true);
 		tree_wgt->blockSignals(true);
@@ -940,18 +939,7 @@ std::vector<QTreeWidgetItem *> DatabaseImportForm::updateObjectsTree(DatabaseImp
 			for(ObjectType grp_type : types)
 			{
 				//Create a group item for the current type
-				group=new QTreeWidgetItem(root);
-				group->setIcon(0, QPixmap(GuiUtilsNs::getIconPath(BaseObject::getSchemaName(grp_type))));
-				group->setFont(0, grp_fnt);
-
-				//Group items does contains a zero valued id to indicate that is not a valide object
-				group->setData(ObjectId, Qt::UserRole, 0);
-				group->setData(ObjectTypeId, Qt::UserRole, enum_t(grp_type));
-				group->setData(ObjectCount, Qt::UserRole, 0);
-				group->setData(ObjectSchema, Qt::UserRole, schema);
-				group->setData(ObjectTable, Qt::UserRole, table);
-				group->setData(ObjectGroupId, Qt::UserRole, -(enum_t(grp_type) + (root ? root->data(ObjectId, 0).toUInt() : 0)));
-
+				group=createGroupItem(grp_type, root, schema, table);
 				gen_groups[grp_type]=group;
 				groups_list.push_back(group);
 			}
@@ -966,26 +954,9 @@ std::vector<QTreeWidgetItem *> DatabaseImportForm::updateObjectsTree(DatabaseImp
 											 group->data(ObjectCount, Qt::UserRole).toUInt() + 1);
 
 				//Creates individual items for each object of the current type
-				oid=attribs[Attributes::Oid].toUInt();
-
-				attribs[Attributes::Name].remove(QRegularExpression(QString("( )(without)( time zone)")));
-				label=name=attribs[Attributes::Name];
-
-				//Removing the trailing type string from op. families or op. classes names
-				if(obj_type==ObjectType::OpFamily || obj_type==ObjectType::OpClass)
-				{
-					start=name.indexOf(QChar('['));
-					end=name.lastIndexOf(QChar(']'));
-					name.remove(start, (end-start)+1);
-					name=name.trimmed();
-				}
-
-				item=new QTreeWidgetItem(group);
-				item->setIcon(0, QPixmap(GuiUtilsNs::getIconPath(obj_type)));
-				item->setText(0, label);
-				item->setText(ObjectId, attribs[Attributes::Oid].rightJustified(10, '0'));
-				item->setData(ObjectId, Qt::UserRole, attribs[Attributes::Oid].toUInt());
-				item->setData(ObjectName, Qt::UserRole, name);
+				item=createObjectItem(attribs, group, schema, table);
+				oid=item->data(ObjectId, Qt::UserRole).toUInt();
+				name=item->data(ObjectName, Qt::UserRole).toString();
 
 				if(checkable_items)
 				{
@@ -1006,7 +977,7 @@ std::vector<QTreeWidgetItem *> DatabaseImportForm::updateObjectsTree(DatabaseImp
 					if(obj_type==ObjectType::Type && oid <= import_helper.getLastSystemOID())
 					{
 						item->setDisabled(true);
-						item->setToolTip(0, tr("This is a PostgreSQL built-in data type and cannot be imported."));
+						item->setToolTip(0, tr("This is a PostgreSQL built-in data type and cannot be imported.") + QString("\n") + item->toolTip(0));
 					}
 					//Disabling items that refers to pgModeler's built-in system objects
 					else if((obj_type==ObjectType::Tablespace && (name==QString("pg_default") || name==QString("pg_global"))) ||
@@ -1018,25 +989,10 @@ std::vector<QTreeWidgetItem *> DatabaseImportForm::updateObjectsTree(DatabaseImp
 					{
 						item->setFont(0, grp_fnt);
 						item->setForeground(0, BaseObjectView::getFontStyle(Attributes::ProtColumn).foreground());
-						item->setToolTip(0, tr("This is a pgModeler's built-in object. It will be ignored if checked by user."));
+						item->setToolTip(0, tr("This is a pgModeler's built-in object. It will be ignored if checked by user.") + QString("\n") + item->toolTip(0));
 					}
 				}
 
-				//Stores the object's OID as the first data of the item
-				item->setData(ObjectId, Qt::UserRole, oid);
-
-				if(!item->toolTip(0).isEmpty())
-					item->setToolTip(0,item->toolTip(0) + QString("\n") + tooltip.arg(oid));
-				else
-					item->setToolTip(0,tooltip.arg(oid));
-
-				//Stores the object's type as the second data of the item
-				item->setData(ObjectTypeId, Qt::UserRole, enum_t(obj_type));
-
-				//Stores the schema and the table's name of the object
-				item->setData(ObjectSchema, Qt::UserRole, schema);
-				item->setData(ObjectTable, Qt::UserRole, table);
-
 				if(obj_type==ObjectType::Schema || BaseTable::isBaseTable(obj_type))
 					items_vect.push_back(item);
 			}
@@ -1045,8 +1001,8 @@ std::vector<QTreeWidgetItem *> DatabaseImportForm::updateObjectsTree(DatabaseImp
 			for(ObjectType grp_type : types)
 			{
 				group=gen_groups[grp_type];
+				setGroupItemCount(group, group->data(ObjectCount, Qt::UserRole).toUInt());
 				group->setDisabled(disable_empty_grps && group->data(ObjectCount, Qt::UserRole).toUInt() == 0);
-				group->setText(0, BaseObject::getTypeName(grp_type) + QString(" (%1)").arg(group->data(ObjectCount, Qt::UserRole).toUInt()));
 
 				if(checkable_items)
 				{
@@ -1068,3 +1024,74 @@ std::vector<QTreeWidgetItem *> DatabaseImportForm::updateObjectsTree(DatabaseImp
 	}
 	return items_vect;
 }
+
+QTreeWidgetItem *DatabaseImportForm::createGroupItem(ObjectType grp_type, QTreeWidgetItem *root, const QString &schema, const QString &table)
+{
+	QTreeWidgetItem *group=new QTreeWidgetItem(root);
+	QFont grp_fnt=(root && root->treeWidget() ? root->treeWidget()->font() : group->font(0));
+
+	grp_fnt.setItalic(true);
+	group->setIcon(0, QPixmap(GuiUtilsNs::getIconPath(BaseObject::getSchemaName(grp_type))));
+	group->setFont(0, grp_fnt);
+
+	//Group items does contains a zero valued id to indicate that is not a valide object
+	group->setData(ObjectId, Qt::UserRole, 0);
+	group->setData(ObjectTypeId, Qt::UserRole, enum_t(grp_type));
+	group->setData(ObjectCount, Qt::UserRole, 0);
+	group->setData(ObjectSchema, Qt::UserRole, schema);
+	group->setData(ObjectTable, Qt::UserRole, table);
+	group->setData(ObjectGroupId, Qt::UserRole, -(enum_t(grp_type) + (root ? root->data(ObjectId, 0).toUInt() : 0)));
+
+	return group;
+}
+
+void DatabaseImportForm::setGroupItemCount(QTreeWidgetItem *group, unsigned count)
+{
+	if(!group)
+		return;
+
+	ObjectType grp_type=static_cast<ObjectType>(group->data(ObjectTypeId, Qt::UserRole).toUInt());
+
+	group->setData(ObjectCount, Qt::UserRole, count);
+	group->setText(0, BaseObject::getTypeName(grp_type) + QString(" (%1)").arg(count));
+}
+
+QTreeWidgetItem *DatabaseImportForm::createObjectItem(attribs_map &attribs, QTreeWidgetItem *group, const QString &schema, const QString &table)
+{
+	QTreeWidgetItem *item=nullptr;
+	ObjectType obj_type=static_cast<ObjectType>(attribs[Attributes::ObjectType].toUInt());
+	unsigned oid=attribs[Attributes::Oid].toUInt();
+	QString name, label;
+	int start=-1, end=-1;
+
+	attribs[Attributes::Name].remove(QRegularExpression(QString("( )(without)( time zone)")));
+	label=name=attribs[Attributes::Name];
+
+	//Removing the trailing type string from op. families or op. classes names
+	if(obj_type==ObjectType::OpFamily || obj_type==ObjectType::OpClass)
+	{
+		start=name.indexOf(QChar('['));
+		end=name.lastIndexOf(QChar(']'));
+		name.remove(start, (end-start)+1);
+		name=name.trimmed();
+	}
+
+	item=new QTreeWidgetItem(group);
+	item->setIcon(0, QPixmap(GuiUtilsNs::getIconPath(obj_type)));
+	item->setText(0, label);
+	item->setText(ObjectId, attribs[Attributes::Oid].rightJustified(10, '0'));
+	item->setData(ObjectName, Qt::UserRole, name);
+
+	//Stores the object's OID as the first data of the item
+	item->setData(ObjectId, Qt::UserRole, oid);
+	item->setToolTip(0, QString("OID: %1").arg(oid));
+
+	//Stores the object's type as the second data of the item
+	item->setData(ObjectTypeId, Qt::UserRole, enum_t(obj_type));
+
+	//Stores the schema and the table's name of the object
+	item->setData(ObjectSchema, Qt::UserRole, schema);
+	item->setData(ObjectTable, Qt::UserRole, table);
+
+	return item;
+}
@@ -146,6 +146,17 @@ class __libgui DatabaseImportForm: public QDialog, public Ui::DatabaseImportForm
 																											 bool checkable_items=false, bool disable_empty_grps=true, QTreeWidgetItem *root=nullptr,
 																											 const QString &schema="", const QString &table="");
 
+		/*! \brief Creates a group item for the provided object type as child of root (when specified).
+		 * The schema and table are the names of the parent objects of the group's objects */
+		static QTreeWidgetItem *createGroupItem(ObjectType grp_type, QTreeWidgetItem *root, const QString &schema="", const QString &table="");
+
+		//! \brief Stores the amount of objects in the group item updating its text
+		static void setGroupItemCount(QTreeWidgetItem *group, unsigned count);
+
+		/*! \brief Creates an item for the object described by the attributes (oid, name and object type) as child of the group.
+		 * The schema and table are the names of the parent objects of the object */
+		static QTreeWidgetItem *createObjectItem(attribs_map &attribs, QTreeWidgetItem *group, const QString &schema="", const QString &table="");
+
 	private slots:
 		void importDatabase();
 		void listObjects();
@@ -33,6 +33,11 @@ DatabaseImportHelper::DatabaseImportHelper(QObject *parent) : QObject(parent)
 	import_filter=Catalog::ListAllObjects | Catalog::ExclExtensionObjs | Catalog::ExclSystemObjs;
 	xmlparser=nullptr;
 	dbmodel=nullptr;
+	import_cache=nullptr;
+
+	/* The reverse engineering (also used by the diff) always reads the catalog directly from
+	 * the database since a change not yet detected by the catalog probe would produce an outdated model */
+	catalog.setCacheEnabled(false);
 }
 
 void DatabaseImportHelper::setConnection(Connection &conn)
@@ -74,6 +79,7 @@ void DatabaseImportHelper::setSelectedOIDs(DatabaseModel *db_model, const std::m
 
 	dbmodel=db_model;
 	xmlparser=dbmodel->getXMLParser();
+	imported_names.clear();
 	object_oids.insert(obj_oids.begin(), obj_oids.end());
 	column_oids.insert(col_oids.begin(), col_oids.end());
 
@@ -90,6 +96,11 @@ void DatabaseImportHelper::setSelectedOIDs(DatabaseModel *db_model, const std::m
 	system_objs.clear();
 }
 
+void DatabaseImportHelper::setImportCache(DatabaseImportCache *cache)
+{
+	import_cache = cache;
+}
+
 void DatabaseImportHelper::setImportOptions(bool import_sys_objs, bool import_ext_objs, bool auto_resolve_deps, bool ignore_errors, bool debug_mode, bool rand_rel_colors, bool update_rels)
 {
 	this->import_sys_objs=import_sys_objs;
@@ -112,6 +123,11 @@ void DatabaseImportHelper::setImportOptions(bool import_sys_objs, bool import_ex
 		import_filter=Catalog::ListAllObjects | Catalog::ExclBuiltinArrayTypes | Catalog::ExclExtensionObjs | Catalog::ExclSystemObjs;
 }
 
+std::map<unsigned, QString> DatabaseImportHelper::getImportedObjectsNames()
+{
+	return imported_names;
+}
+
 unsigned DatabaseImportHelper::getLastSystemOID()
 {
 	return catalog.getLastSysObjectOID();
@@ -208,10 +224,11 @@ void DatabaseImportHelper::retrieveSystemObjects()
 		objects=catalog.getObjectsAttributes(sys_objs[i]);
 		itr=objects.begin();
 
+		// The attributes are moved into the map since the retrieved objects are discarded right after
 		while(itr!=objects.end() && !import_canceled)
 		{
 			oid=itr->at(Attributes::Oid).toUInt();
-			(*obj_map)[oid]=(*itr);
+			(*obj_map)[oid]=std::move(*itr);
 			itr++;
 		}
 
@@ -245,7 +262,7 @@ void DatabaseImportHelper::retrieveUserObjects()
 		while(itr!=objects.end() && !import_canceled)
 		{
 			oid=itr->at(Attributes::Oid).toUInt();
-			user_objs[oid]=(*itr);
+			user_objs[oid]=std::move(*itr);
 			itr++;
 		}
 
@@ -286,7 +303,7 @@ void DatabaseImportHelper::retrieveTableColumns(const QString &sch_name, const Q
 		{
 			col_oid=itr.at(Attributes::Oid).toUInt();
 			tab_oid=itr.at(Attributes::Table).toUInt();
-			columns[tab_oid][col_oid]=itr;
+			columns[tab_oid][col_oid]=std::move(itr);
 		}
 	}
 	catch(Exception &e)
@@ -567,6 +584,8 @@ void DatabaseImportHelper::importDatabase()
 		if(!dbmodel)
 			throw Exception(ErrorCode::OprNotAllocatedObject ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
+		loadCachedModel();
+
 		dbmodel->setLoadingModel(true);
 		dbmodel->setObjectListsCapacity(creation_order.size());
 
@@ -647,6 +666,10 @@ void DatabaseImportHelper::importDatabase()
 				}
 			}
 
+			//The imported model is only cached when the import finishes without errors
+			if(import_cache && errors.empty())
+				saveCachedModel();
+
 			emit s_importFinished();
 		}
 
@@ -666,6 +689,57 @@ void DatabaseImportHelper::importDatabase()
 	}
 }
 
+void DatabaseImportHelper::loadCachedModel()
+{
+	std::map<ObjectType, std::vector<unsigned>> obj_oids = object_oids;
+	std::map<unsigned, std::vector<unsigned>> col_oids = column_oids;
+	DatabaseModel *cached_model = nullptr;
+
+	if(!import_cache)
+		return;
+
+	try
+	{
+		emit s_progressUpdated(0, tr("Retrieving the objects changed since the previous import..."), ObjectType::BaseObject);
+		import_cache->retrieveMarkers(catalog, obj_oids);
+		cached_model = import_cache->loadCachedModel(obj_oids, col_oids);
+	}
+	catch(Exception &e)
+	{
+		/* Failing to use the cache is not critical since the database can be fully imported,
+		 * so the error is only displayed as a progress message */
+		emit s_progressUpdated(0, e.getErrorMessage(), ObjectType::BaseObject);
+	}
+
+	if(!cached_model)
+		return;
+
+	emit s_progressUpdated(0, tr("Reusing `%1' object(s) from the previous import, `%2' object(s) will be imported again.")
+												 .arg(import_cache->getReusedCount()).arg(import_cache->getReimportedCount()), ObjectType::BaseObject);
+
+	//The cached model is handed to the caller so it must live in the same thread as the replaced one
+	cached_model->moveToThread(dbmodel->thread());
+	emit s_cachedModelLoaded(cached_model);
+
+	//The import continues in the cached model creating only the outdated objects
+	object_oids.clear();
+	column_oids.clear();
+	setSelectedOIDs(cached_model, obj_oids, col_oids);
+}
+
+void DatabaseImportHelper::saveCachedModel()
+{
+	try
+	{
+		emit s_progressUpdated(100, tr("Storing the imported model in the cache..."), ObjectType::BaseObject);
+		import_cache->saveCachedModel(dbmodel, imported_names);
+	}
+	catch(Exception &e)
+	{
+		emit s_progressUpdated(100, e.getErrorMessage(), ObjectType::BaseObject);
+	}
+}
+
 void DatabaseImportHelper::setObjectFilters(QStringList filter, bool only_matching, bool match_signature, QStringList force_tab_obj_types)
 {
 	catalog.setObjectFilters(filter, only_matching, match_signature, force_tab_obj_types);
@@ -773,6 +847,9 @@ void DatabaseImportHelper::createObject(attribs_map &attribs)
 			/* Register that the object was successfully created in order to avoid
 			 * creating it again on the recursive object creation. (see getDependencyObject()) */
 			created_objs.push_back(oid);
+
+			if(!TableObject::isTableObject(obj_type))
+				imported_names[oid] = obj_name;
 		}
 	}
 	catch(Exception &e)
@@ -780,7 +857,12 @@ void DatabaseImportHelper::createObject(attribs_map &attribs)
 		/* We just ignore the object duplication error and just mark the
 		 * related object's attribs so it'll not be processed again */
 		if(e.getErrorCode() == ErrorCode::AsgDuplicatedObject)
+		{
 			created_objs.push_back(oid);
+
+			if(!TableObject::isTableObject(obj_type))
+				imported_names[oid] = obj_name;
+		}
 		else
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::ObjectNotImported)
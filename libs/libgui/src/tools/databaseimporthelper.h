@@ -28,6 +28,7 @@
 #include <QObject>
 #include <QThread>
 #include "catalog.h"
+#include "databaseimportcache.h"
 #include "widgets/modelwidget.h"
 #include <random>
 
@@ -105,6 +106,10 @@ class __libgui DatabaseImportHelper: public QObject {
 		//! \brief Stores the OIDs of the objects successfully created
 		std::vector<unsigned> created_objs;
 
+		/*! \brief Stores the names (signatures for functions and operators) of the non table children objects created
+		 * in the last import indexed by their OIDs. This map is kept after the import finishes (see getImportedObjectsNames()) */
+		std::map<unsigned, QString> imported_names;
+
 		//! \brief Stores all selected columns attributes
 		std::map<unsigned, std::map<unsigned, attribs_map>> columns;
 		
@@ -132,6 +137,10 @@ class __libgui DatabaseImportHelper: public QObject {
 		XmlParser *xmlparser;
 		
 		SchemaParser schparser;
+
+		/*! \brief The cache of the model imported previously used to import only the changed objects (see setImportCache()).
+		 * When null (default) all the selected objects are imported */
+		DatabaseImportCache *import_cache;
 		
 		void configureBaseFunctionAttribs(attribs_map &attribs);
 		void configureDatabase(attribs_map &attribs);
@@ -225,6 +234,13 @@ class __libgui DatabaseImportHelper: public QObject {
 		//! \brief Return a string containing all attributes and their values in a formatted way
 		QString dumpObjectAttributes(attribs_map &attribs);
 
+		/*! \brief Loads the model stored in the import cache replacing the model in use and keeping selected
+		 * only the objects that must be imported again. When the cached model can't be used nothing is changed */
+		void loadCachedModel();
+
+		//! \brief Stores the imported model in the import cache. Errors are only reported as progress messages
+		void saveCachedModel();
+
 	public:
 		DatabaseImportHelper(QObject *parent = nullptr);
 		
@@ -241,11 +257,21 @@ class __libgui DatabaseImportHelper: public QObject {
 		//! \brief Defines the selected object to be imported. This method always expect filled maps. Hint: use the method Catalog::getObjectOIDs()
 		void setSelectedOIDs(DatabaseModel *db_model, const std::map<ObjectType, std::vector<unsigned>> &obj_oids, const std::map<unsigned, std::vector<unsigned>> &col_oids);
 		
+		/*! \brief Configures the cache used to import only the objects changed since the previous import (the key of the cache
+		 * must be configured beforehand). The change markers retrieval and the loading of the cached model are done in importDatabase(),
+		 * so in thread mode they don't block the caller. When the cached model is reused the signal s_cachedModelLoaded() is emitted.
+		 * The imported model is stored in the cache when the import finishes without errors. A null cache disables the incremental import */
+		void setImportCache(DatabaseImportCache *cache);
+
 		//! \brief Configures the import parameters
 		void setImportOptions(bool import_sys_objs, bool import_ext_objs, bool auto_resolve_deps, bool ignore_errors, bool debug_mode, bool rand_rel_colors, bool update_fk_rels);
 		
 		//! \brief Returns the last system OID value for the current database
 		unsigned getLastSystemOID();
+
+		/*! \brief Returns the names of the database/schema level objects created (or already existing) in the model during the
+		 * last import indexed by their OIDs. The names are those used to locate the objects via DatabaseModel::getObject() */
+		std::map<unsigned, QString> getImportedObjectsNames();
 		
 		//! \brief Returns the current database in which the helper is working on
 		QString getCurrentDatabase();
@@ -289,6 +315,11 @@ class __libgui DatabaseImportHelper: public QObject {
 		//! \brief This singal is emitted whenever the export progress changes
 		void s_progressUpdated(int progress, QString msg, ObjectType obj_type=ObjectType::BaseObject);
 		
+		/*! \brief This signal is emitted when the cached model is used in place of the one passed to setSelectedOIDs().
+		 * The receiver takes the ownership of the cached model and becomes responsible for the replaced one. Since the import
+		 * continues in the cached model right after the emission, in thread mode it must use a Qt::BlockingQueuedConnection */
+		void s_cachedModelLoaded(DatabaseModel *model);
+
 		//! \brief This signal is emited when the import has finished
 		void s_importFinished(Exception e = Exception());
 		
@@ -133,6 +133,7 @@ DataManipulationForm::DataManipulationForm(QWidget * parent, Qt::WindowFlags f):
 	csv_load_parent->setVisible(false);
 
 	csv_load_wgt = new CsvLoadWidget(this, false);
+	csv_load_wgt->setLargeFileStreaming(true);
 	QVBoxLayout *layout = new QVBoxLayout;
 
 	layout->addWidget(csv_load_wgt);
@@ -205,6 +206,32 @@ DataManipulationForm::DataManipulationForm(QWidget * parent, Qt::WindowFlags f):
 		loadDataFromCsv();
 	});
 
+	connect(csv_load_wgt, &CsvLoadWidget::s_largeCsvFileSelected, this, &DataManipulationForm::copyCsvFileToTable);
+
+	csv_copy_prog_wgt = new TaskProgressWidget(this);
+	csv_copy_prog_wgt->setWindowTitle(tr("Copying CSV file"));
+	csv_copy_prog_wgt->setCancelable(true);
+	csv_copy_hlp.moveToThread(&csv_copy_thread);
+
+	connect(&csv_copy_thread, &QThread::started, &csv_copy_hlp, &CsvCopyHelper::copyFile);
+	connect(csv_copy_prog_wgt, &TaskProgressWidget::s_cancelRequested, &csv_copy_hlp, &CsvCopyHelper::cancelCopy, Qt::DirectConnection);
+
+	connect(&csv_copy_hlp, &CsvCopyHelper::s_progressUpdated, this, [this](int progress, QString msg){
+		csv_copy_prog_wgt->updateProgress(progress, msg, enum_t(ObjectType::Table));
+	});
+
+	connect(&csv_copy_hlp, &CsvCopyHelper::s_copyFinished, this, [this](){
+		finishCsvFileCopy(true);
+	});
+
+	connect(&csv_copy_hlp, &CsvCopyHelper::s_copyCancelled, this, [this](){
+		finishCsvFileCopy(false);
+	});
+
+	connect(&csv_copy_hlp, &CsvCopyHelper::s_copyAborted, this, [this](Exception e){
+		finishCsvFileCopy(false, e);
+	});
+
 	connect(results_tbw->horizontalHeader(), &QHeaderView::sortIndicatorChanged, this, [this](int section, Qt::SortOrder sort_order){
 		// Applying the sorting on the clicked column when the Control key is pressed
 		if(qApp->keyboardModifiers() == Qt::ControlModifier)
@@ -251,6 +278,16 @@ void DataManipulationForm::setAttributes(Connection conn, const QString curr_sch
 	}
 }
 
+DataManipulationForm::~DataManipulationForm()
+{
+	if(csv_copy_thread.isRunning())
+	{
+		csv_copy_hlp.cancelCopy();
+		csv_copy_thread.quit();
+		csv_copy_thread.wait();
+	}
+}
+
 void DataManipulationForm::reject()
 {
   GeneralConfigWidget::saveWidgetGeometry(this);
@@ -713,6 +750,51 @@ void DataManipulationForm::loadDataFromCsv(bool load_from_clipboard, bool force_
 	QApplication::restoreOverrideCursor();
 }
 
+void DataManipulationForm::copyCsvFileToTable(const QString &filename)
+{
+#ifdef DEMO_VERSION
+#warning "DEMO VERSION: data manipulation csv copy feature disabled warning."
+	Messagebox msg_box;
+	msg_box.show(tr("Warning"),
+				 tr("You're running a demonstration version! The save feature of the data manipulation form is available only in the full version!"),
+				 Messagebox::AlertIcon, Messagebox::OkButton);
+#else
+	Messagebox msg_box;
+
+	if(csv_copy_thread.isRunning())
+		return;
+
+	csv_copy_hlp.setCopyParameters(filename, schema_cmb->currentText(), table_cmb->currentText(), col_names,
+																 csv_load_wgt->getSeparator(), csv_load_wgt->getTextDelimiter(), csv_load_wgt->isColumnsInFirstRow());
+
+	msg_box.show(tr("The file <strong>%1</strong> is too large to be loaded in the grid. Do you want to copy its rows directly into the table <strong>%2</strong>? \
+Empty values will be copied as <strong>NULL</strong> and, once finished, it will not be possible to undo the operation!")
+							 .arg(filename, csv_copy_hlp.getTableName()), Messagebox::AlertIcon, Messagebox::YesNoButtons);
+
+	if(msg_box.result() != QDialog::Accepted)
+		return;
+
+	csv_copy_hlp.setConnection(Connection(tmpl_conn_params));
+	csv_copy_prog_wgt->show();
+	csv_copy_thread.start();
+#endif
+}
+
+void DataManipulationForm::finishCsvFileCopy(bool copied, Exception e)
+{
+	csv_copy_thread.quit();
+	csv_copy_thread.wait();
+	csv_copy_prog_wgt->close();
+
+	if(!e.getErrorMessage().isEmpty())
+	{
+		Messagebox msg_box;
+		msg_box.show(Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e));
+	}
+	else if(copied)
+		retrieveData();
+}
+
 void DataManipulationForm::removeSortColumnFromList()
 {
 	if(qApp->mouseButtons()==Qt::NoButton || qApp->mouseButtons()==Qt::LeftButton)
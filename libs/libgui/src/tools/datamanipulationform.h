@@ -30,6 +30,9 @@
 #include "utils/syntaxhighlighter.h"
 #include "widgets/codecompletionwidget.h"
 #include "widgets/csvloadwidget.h"
+#include "widgets/taskprogresswidget.h"
+#include "csvcopyhelper.h"
+#include <QThread>
 
 class __libgui DataManipulationForm: public QDialog, public Ui::DataManipulationForm {
 	private:
@@ -45,6 +48,14 @@ class __libgui DataManipulationForm: public QDialog, public Ui::DataManipulation
 
 		CsvLoadWidget *csv_load_wgt;
 
+		//! \brief Helper (and the thread in which it runs) that copies large csv files into the current table (see copyCsvFileToTable())
+		CsvCopyHelper csv_copy_hlp;
+
+		QThread csv_copy_thread;
+
+		//! \brief Displays the progress of the csv file copy allowing the user to cancel it
+		TaskProgressWidget *csv_copy_prog_wgt;
+
 		SyntaxHighlighter *filter_hl;
 		
 		CodeCompletionWidget *code_compl_wgt;
@@ -120,6 +131,8 @@ class __libgui DataManipulationForm: public QDialog, public Ui::DataManipulation
 
 	public:
 		DataManipulationForm(QWidget * parent = nullptr, Qt::WindowFlags f = Qt::Widget);
+
+		virtual ~DataManipulationForm();
 		
 		//! \brief Defines the connection and current schema and table to be handled, this method should be called before show the dialog
 		void setAttributes(Connection conn, const QString curr_schema=QString("public"), const QString curr_table_name="", const QString &filter="");
@@ -193,6 +206,13 @@ class __libgui DataManipulationForm: public QDialog, public Ui::DataManipulation
 		//! \brief Add new rows to the grid based upon the CSV loaded
 		void loadDataFromCsv(bool load_from_clipboard = false, bool force_csv_parsing = false);
 
+		/*! \brief Copies the rows of a large csv file directly into the current table using the COPY command.
+		 * The copy runs in a separated thread (see CsvCopyHelper) and can be cancelled by the user */
+		void copyCsvFileToTable(const QString &filename);
+
+		//! \brief Finishes the csv file copy reporting the result to the user and reloading the table data when all rows were copied
+		void finishCsvFileCopy(bool copied, Exception e = Exception());
+
 		//! \brief Browse the referenced table data using the selected row in the results grid
 		void browseReferencedTable();
 
@@ -295,6 +295,11 @@ void ModelDatabaseDiffForm::createThread(ThreadId thread_id)
 			updateProgress(progress, msg, obj_type);
 		}, Qt::BlockingQueuedConnection);
 
+		connect(src_import_helper, &DatabaseImportHelper::s_cachedModelLoaded, this,
+						[this](DatabaseModel *model) {
+			replaceImportedModel(SrcImportThread, model);
+		}, Qt::BlockingQueuedConnection);
+
 		connect(src_import_helper, &DatabaseImportHelper::s_importFinished, this, &ModelDatabaseDiffForm::handleImportFinished);
 		connect(src_import_helper, &DatabaseImportHelper::s_importAborted, this, &ModelDatabaseDiffForm::captureThreadError);
 	}
@@ -311,6 +316,11 @@ void ModelDatabaseDiffForm::createThread(ThreadId thread_id)
 			updateProgress(progress, msg, obj_type);
 		}, Qt::BlockingQueuedConnection);
 
+		connect(import_helper, &DatabaseImportHelper::s_cachedModelLoaded, this,
+						[this](DatabaseModel *model) {
+			replaceImportedModel(ImportThread, model);
+		}, Qt::BlockingQueuedConnection);
+
 		connect(import_helper, &DatabaseImportHelper::s_importFinished, this, &ModelDatabaseDiffForm::handleImportFinished);
 		connect(import_helper, &DatabaseImportHelper::s_importAborted, this, &ModelDatabaseDiffForm::captureThreadError);
 	}
@@ -614,24 +624,23 @@ void ModelDatabaseDiffForm::importDatabase(ThreadId thread_id)
 		catalog.getObjectsOIDs(obj_oids, col_oids, {{Attributes::FilterTableTypes, Attributes::True}});
 		obj_oids[ObjectType::Database].push_back(db_cmb->currentData().value<unsigned>());
 
+		db_model = new DatabaseModel;
+		db_model->createSystemObjects(true);
+
 		if(thread_id == SrcImportThread)
-		{
-			source_model=new DatabaseModel;
-			source_model->createSystemObjects(true);
-			db_model = source_model;
-		}
+			source_model = db_model;
 		else
-		{
-			imported_model=new DatabaseModel;
-			imported_model->createSystemObjects(true);
-			db_model = imported_model;
-		}
+			imported_model = db_model;
 
 		import_hlp->setConnection(conn1);
 		import_hlp->setSelectedOIDs(db_model, obj_oids, col_oids);
 		import_hlp->setCurrentDatabase(db_cmb->currentText());
 		import_hlp->setImportOptions(import_sys_objs_chk->isChecked(), import_ext_objs_chk->isChecked(), true,
 																 ignore_errors_chk->isChecked(), debug_mode_chk->isChecked(), false, false);
+
+		/* In the incremental import the change markers are retrieved and the cached model
+		 * is loaded/stored by the import helper itself in its thread */
+		import_hlp->setImportCache(incremental_import_chk->isChecked() ? configureImportCache(thread_id, conn, pd_filters) : nullptr);
 		thread->start();
 	}
 	catch(Exception &e)
@@ -640,6 +649,35 @@ void ModelDatabaseDiffForm::importDatabase(ThreadId thread_id)
 	}
 }
 
+DatabaseImportCache *ModelDatabaseDiffForm::configureImportCache(ThreadId thread_id, Connection &conn, const QStringList &pd_filters)
+{
+	DatabaseImportCache &import_cache = (thread_id == SrcImportThread ? src_import_cache : dst_import_cache);
+	QStringList import_opts = pd_filters;
+
+	if(DatabaseImportCache::getCacheDirectory().isEmpty())
+		return nullptr;
+
+	/* The options that change the set of imported objects are part of the cache key
+	 * so each combination of them has its own cached model */
+	import_opts.append(QString("%1%2%3%4")
+										 .arg(import_sys_objs_chk->isChecked())
+										 .arg(import_ext_objs_chk->isChecked())
+										 .arg(pd_filter_wgt->isOnlyMatching())
+										 .arg(pd_filter_wgt->isMatchSignature() || gen_filters_from_log_chk->isChecked()));
+	import_opts.append(pd_filter_wgt->getForceObjectsFilter());
+	import_cache.setCacheKey(conn.getConnectionParams(), import_opts);
+
+	return &import_cache;
+}
+
+void ModelDatabaseDiffForm::replaceImportedModel(ThreadId thread_id, DatabaseModel *model)
+{
+	DatabaseModel *&db_model = (thread_id == SrcImportThread ? source_model : imported_model);
+
+	delete db_model;
+	db_model = model;
+}
+
 void ModelDatabaseDiffForm::diffModels()
 {
 	createThread(DiffThread);
@@ -882,6 +920,8 @@ void ModelDatabaseDiffForm::captureThreadError(Exception e)
 
 void ModelDatabaseDiffForm::handleImportFinished(Exception e)
 {
+	bool src_import = (src_import_thread && src_import_thread->isRunning());
+
 	if(!e.getErrorMessage().isEmpty())
 	{
 		Messagebox msgbox;
@@ -890,7 +930,7 @@ void ModelDatabaseDiffForm::handleImportFinished(Exception e)
 
 	curr_step++;
 
-	if(src_import_thread && src_import_thread->isRunning())
+	if(src_import)
 	{
 		src_import_thread->quit();
 		src_import_item->setExpanded(false);
@@ -1205,6 +1245,7 @@ void ModelDatabaseDiffForm::selectPreset()
 
 	import_sys_objs_chk->setChecked(conf[Attributes::ImportSysObjs] == Attributes::True);
 	import_ext_objs_chk->setChecked(conf[Attributes::ImportExtObjs] == Attributes::True);
+	incremental_import_chk->setChecked(conf[Attributes::IncrementalImport] == Attributes::True);
 	ignore_duplic_chk->setChecked(conf[Attributes::IgnoreDuplicErrors] == Attributes::True);
 	ignore_errors_chk->setChecked(conf[Attributes::IgnoreImportErrors] == Attributes::True);
 	ignore_error_codes_chk->setChecked(!conf[Attributes::IgnoreErrorCodes].isEmpty());
@@ -1302,6 +1343,7 @@ void ModelDatabaseDiffForm::savePreset()
 
 	conf[Attributes::ImportSysObjs] = import_sys_objs_chk->isChecked() ? Attributes::True : Attributes::False;
 	conf[Attributes::ImportExtObjs] = import_ext_objs_chk->isChecked() ? Attributes::True : Attributes::False;
+	conf[Attributes::IncrementalImport] = incremental_import_chk->isChecked() ? Attributes::True : Attributes::False;
 	conf[Attributes::IgnoreDuplicErrors] = ignore_duplic_chk->isChecked() ? Attributes::True : Attributes::False;
 	conf[Attributes::IgnoreImportErrors] = ignore_errors_chk->isChecked() ? Attributes::True : Attributes::False;
 	conf[Attributes::IgnoreErrorCodes] = error_codes_edt->text();
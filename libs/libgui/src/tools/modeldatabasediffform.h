@@ -28,6 +28,7 @@
 #include "ui_modeldatabasediffform.h"
 #include "modelsdiffhelper.h"
 #include "databaseimporthelper.h"
+#include "databaseimportcache.h"
 #include "modelexporthelper.h"
 #include "utils/syntaxhighlighter.h"
 #include "utils/htmlitemdelegate.h"
@@ -80,6 +81,9 @@ class __libgui ModelDatabaseDiffForm: public BaseConfigWidget, public Ui::ModelD
 		//! \brief Helper that will execute the database import
 		DatabaseImportHelper *import_helper, *src_import_helper;
 
+		//! \brief Caches of the models imported from the source and destination databases (incremental import)
+		DatabaseImportCache src_import_cache, dst_import_cache;
+
 		//! \brief Helper that will execute the diff export to database
 		ModelExportHelper *export_helper;
 
@@ -154,6 +158,14 @@ class __libgui ModelDatabaseDiffForm: public BaseConfigWidget, public Ui::ModelD
 		 * filtered objects (type -> oids) in the database */
 		void getFilteredObjects(std::map<ObjectType, std::vector<unsigned> > &obj_oids);
 
+		/*! \brief Configures the key of the import cache of the provided thread from the connection and the options
+		 * that change the set of imported objects. Returns nullptr when no cache directory is configured */
+		DatabaseImportCache *configureImportCache(ThreadId thread_id, Connection &conn, const QStringList &pd_filters);
+
+		/*! \brief Replaces the model of the provided import thread by the cached one loaded by the import helper
+		 * destroying the replaced model (see DatabaseImportHelper::s_cachedModelLoaded()) */
+		void replaceImportedModel(ThreadId thread_id, DatabaseModel *model);
+
 	public:
 		ModelDatabaseDiffForm(QWidget * parent = nullptr, Qt::WindowFlags flags = Qt::Widget);
 		virtual ~ModelDatabaseDiffForm();
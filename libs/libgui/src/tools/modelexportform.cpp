@@ -26,7 +26,6 @@ bool ModelExportForm::low_verbosity = false;
 ModelExportForm::ModelExportForm(QWidget *parent, Qt::WindowFlags f) : QDialog(parent, f)
 {
 	model=nullptr;
-	viewp=nullptr;
 	setupUi(this);
 
 	sql_file_sel = new FileSelectorWidget(this);
@@ -203,10 +202,8 @@ void ModelExportForm::exportModel()
 		//Export to png
 		if(export_to_img_rb->isChecked())
 		{
-			viewp=new QGraphicsView(model->scene);
-
 			if(png_rb->isChecked())
-				export_hlp.setExportToPNGParams(model->scene, viewp, img_file_sel->getSelectedFile(),
+				export_hlp.setExportToPNGParams(model->scene, img_file_sel->getSelectedFile(),
 																				zoom_cmb->itemData(zoom_cmb->currentIndex()).toDouble(),
 																				show_grid_chk->isChecked(), show_delim_chk->isChecked(),
 																				page_by_page_chk->isChecked());
@@ -337,13 +334,6 @@ void ModelExportForm::finishExport(const QString &msg)
 	progress_pb->setValue(100);
 	progress_lbl->setText(msg);
 	progress_lbl->repaint();
-
-	if(viewp)
-	{
-		export_thread->wait();
-		delete viewp;
-		viewp=nullptr;
-	}
 }
 
 void ModelExportForm::enableExportModes(bool value)
@@ -52,9 +52,6 @@ class __libgui ModelExportForm: public QDialog, public Ui::ModelExportForm {
 		//! \brief Thread used to manage the export helper when dealing with dbms export
 		QThread *export_thread;
 
-		//! \brief Auxiliary viewport passed to export helper when dealing with PNG export
-		QGraphicsView *viewp;
-
 		FileSelectorWidget *sql_file_sel,
 		*img_file_sel,
 		*dict_file_sel;
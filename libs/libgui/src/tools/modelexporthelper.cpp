@@ -1,6 +1,9 @@
 #include "modelexporthelper.h"
 #include <QSvgGenerator>
+#include <QPicture>
+#include <QThreadPool>
 #include "guiutilsns.h"
+#include "utils/pngstreamwriter.h"
 
 ModelExportHelper::ModelExportHelper(QObject *parent) : QObject(parent)
 {
@@ -18,7 +21,6 @@ void ModelExportHelper::resetExportParams()
 	scene=nullptr;
 	zoom=100;
 	show_grid=show_delim=page_by_page=split=browsable=false;
-	viewp=nullptr;
 	code_gen_mode=DatabaseModel::OriginalSql;
 }
 
@@ -61,7 +63,7 @@ void ModelExportHelper::setIgnoredErrors(const QStringList &err_codes)
 	ignored_errors.removeDuplicates();
 }
 
-void ModelExportHelper::exportToSQL(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver, bool split, DatabaseModel::CodeGenMode code_gen_mode)
+void ModelExportHelper::exportToSQL(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver, bool split, DatabaseModel::CodeGenMode code_gen_mode, bool incremental)
 {
 	if(!db_model)
 		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
@@ -84,7 +86,7 @@ void ModelExportHelper::exportToSQL(DatabaseModel *db_model, const QString &file
 		}
 		else
 		{
-			db_model->saveSplitSQLDefinition(filename, code_gen_mode);
+			db_model->saveSplitSQLDefinition(filename, code_gen_mode, incremental);
 			emit s_progressUpdated(100, tr("SQL files successfully written in `%1'.").arg(filename), ObjectType::BaseObject);
 		}
 
@@ -102,37 +104,131 @@ void ModelExportHelper::exportToSQL(DatabaseModel *db_model, const QString &file
 	disconnect(db_model, nullptr, this, nullptr);
 }
 
-void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename, double zoom, bool show_grid, bool show_delim, bool page_by_page, QGraphicsView *viewp)
+void ModelExportHelper::renderPageToPNG(ObjectsScene *scene, const QRectF &pg_rect, const QString &file, double scale, unsigned page_idx, unsigned page_cnt)
+{
+	PngStreamWriter png_writer;
+	QThreadPool thread_pool;
+	int img_width = std::ceil(pg_rect.width() * scale),
+			img_height = std::ceil(pg_rect.height() * scale),
+			band_height = 0, tile_cnt = (img_width / TileSize) + (img_width % TileSize ? 1 : 0),
+			pg_progress = 0, prev_pg_progress = -1;
+	std::vector<QPicture> pictures(tile_cnt);
+	std::vector<QImage> tiles(tile_cnt);
+	Qt::ConnectionType conn_type = (QThread::currentThread() == scene->thread() ? Qt::DirectConnection : Qt::BlockingQueuedConnection);
+
+	try
+	{
+		png_writer.open(file, img_width, img_height);
+
+		for(int y = 0; y < img_height && !export_canceled; y += BandHeight)
+		{
+			band_height = std::min(BandHeight, img_height - y);
+
+			pg_progress = (y * 100.0) / img_height;
+
+			// The progress is emitted only when it changes to avoid flooding the receivers on very tall images
+			if(pg_progress != prev_pg_progress)
+			{
+				emit s_progressUpdated(((page_idx - 1 + (pg_progress / 100.0)) / page_cnt) * 90,
+															 tr("Rendering objects to page %1/%2 (%3%).").arg(page_idx).arg(page_cnt).arg(pg_progress),
+															 ObjectType::BaseObject);
+				prev_pg_progress = pg_progress;
+			}
+
+			/* Each tile of the band is recorded (as drawing commands) in its own picture by the thread that owns the scene.
+			 * Since the scene only paints the items that intersect the source rectangle, each picture holds just the items
+			 * of its tile. When the helper runs in a separated thread the recording is done by the GUI thread which is blocked meanwhile */
+			QMetaObject::invokeMethod(scene, [scene, &pg_rect, &pictures, tile_cnt, img_width, band_height, y, scale](){
+				QPainter pic_painter;
+				QRectF src_rect;
+
+				for(int tile = 0; tile < tile_cnt; tile++)
+				{
+					src_rect = QRectF(pg_rect.left() + ((tile * TileSize) / scale), pg_rect.top() + (y / scale),
+														std::min(TileSize, img_width - (tile * TileSize)) / scale, band_height / scale);
+
+					pictures[tile] = QPicture();
+					pic_painter.begin(&pictures[tile]);
+					scene->render(&pic_painter, QRectF(QPointF(0, 0), src_rect.size()), src_rect, Qt::IgnoreAspectRatio);
+					pic_painter.end();
+				}
+			}, conn_type);
+
+			// Each tile of the band rasterizes, in parallel, its own picture at the final scale
+			for(int tile = 0; tile < tile_cnt; tile++)
+			{
+				thread_pool.start([&pictures, &tiles, tile, img_width, band_height, scale](){
+					QPainter painter;
+					QImage &img = tiles[tile];
+
+					img = QImage(std::min(TileSize, img_width - (tile * TileSize)), band_height, QImage::Format_RGB32);
+
+					if(img.isNull())
+						return;
+
+					// The image uses the same resolution of the picture so the fonts are rasterized with the recorded sizes
+					img.setDotsPerMeterX(qRound(pictures[tile].logicalDpiX() / 0.0254));
+					img.setDotsPerMeterY(qRound(pictures[tile].logicalDpiY() / 0.0254));
+					img.fill(Qt::white);
+
+					painter.begin(&img);
+					painter.setRenderHint(QPainter::Antialiasing, true);
+					painter.setRenderHint(QPainter::TextAntialiasing, true);
+					painter.setRenderHint(QPainter::SmoothPixmapTransform, true);
+					painter.scale(scale, scale);
+					painter.drawPicture(0, 0, pictures[tile]);
+					painter.end();
+				});
+			}
+
+			thread_pool.waitForDone();
+
+			for(auto &img : tiles)
+			{
+				if(img.isNull())
+				{
+					throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(file),
+													ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				}
+			}
+
+			// Only the current band is kept in memory, it's encoded and discarded before the next one is rendered
+			png_writer.writeRows(tiles);
+		}
+
+		// Incomplete images are removed when the export is canceled
+		if(export_canceled)
+			png_writer.discard();
+		else
+			png_writer.close();
+	}
+	catch(Exception &e)
+	{
+		// Partially written images are removed on failure
+		thread_pool.waitForDone();
+		png_writer.discard();
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename, double zoom, bool show_grid, bool show_delim, bool page_by_page)
 {
 	if(!scene)
 		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
+	bool prev_show_grd = ObjectsScene::isShowGrid(),
+			prev_show_dlm = ObjectsScene::isShowPageDelimiters();
+	QColor bg_color = ObjectsScene::getCanvasColor();
+
 	try
 	{
-		QPixmap pix;
-		bool prev_show_grd, prev_show_dlm;
-		QGraphicsView *view = nullptr;
 		QList<QRectF> pages;
 		unsigned v_cnt=0, h_cnt=0, page_idx=1;
 		QString tmpl_filename, file;
-		QColor bg_color = ObjectsScene::getCanvasColor();
-
-		/* If an external view is specified it will be used instead of creating a local one,
-		 * this is a workaround to the error below when running the helper in a separated thread
-		 * QCoreApplication::sendPostedEvents: Cannot send posted events for objects in another thread */
-		if(viewp)
-			view = viewp;
-		else
-			view = new QGraphicsView(scene);
 
 		//Clear the object scene selection to avoid drawing the selectoin rectangle of the objects
 		scene->clearSelection();
 
-		//Make a backup of the current scene options
-		prev_show_grd = ObjectsScene::isShowGrid();
-		prev_show_dlm = ObjectsScene::isShowPageDelimiters();
-		bg_color = ObjectsScene::getCanvasColor();
-
 		//Sets the options passed by the user
 		ObjectsScene::setCanvasColor(QColor(255,255,255));
 		ObjectsScene::setShowGrid(show_grid);
@@ -165,52 +261,17 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 		//Updates the scene to apply the change on grid and delimiter
 		scene->update();
 
-		QPainter painter;
-		QRect rect;
-
-		view->setAlignment(Qt::AlignLeft | Qt::AlignTop);
-		view->resetTransform();
-		view->centerOn(0,0);
-
-		/* We consider the device pixel ration when applying scale to the viewport
-		 * so the resulting pixmap can have a compatible size in hi-dpi screens */
-		view->scale(zoom * qApp->devicePixelRatio(), zoom * qApp->devicePixelRatio());
-
 		for(auto &pg_rect : pages)
 		{
 			if(export_canceled) break;
 
-			rect = view->mapFromScene(pg_rect).boundingRect();
-			pix = QPixmap(rect.size());
-			pix.fill();
-
-			//Setting optimizations on the painter
-			painter.begin(&pix);
-			painter.setRenderHint(QPainter::Antialiasing, true);
-			painter.setRenderHint(QPainter::TextAntialiasing, true);
-			painter.setRenderHint(QPainter::SmoothPixmapTransform, true);
-
-			emit s_progressUpdated((page_idx/static_cast<double>(pages.size())) * 90,
-														 tr("Rendering objects to page %1/%2.").arg(page_idx).arg(pages.size()), ObjectType::BaseObject);
-
-			view->render(&painter, QRect(), rect);
-			painter.end();
-
 			if(page_by_page)
-				file = tmpl_filename.arg(page_idx++);
+				file = tmpl_filename.arg(page_idx);
 
-			//If the pixmap is not saved raises an error
-			if(!pix.save(file))
-			{
-				//Restoring the scene settings before throw error
-				ObjectsScene::setCanvasColor(bg_color);
-				ObjectsScene::setShowGrid(prev_show_grd);
-				ObjectsScene::setShowPageDelimiters(prev_show_dlm);
-				scene->update();
-
-				throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(file),
-												ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-			}
+			/* We consider the device pixel ration when applying scale to the page
+			 * so the resulting image can have a compatible size in hi-dpi screens */
+			renderPageToPNG(scene, pg_rect, file, zoom * qApp->devicePixelRatio(), page_idx, pages.size());
+			page_idx++;
 		}
 
 		//Restoring the scene settings
@@ -227,12 +288,16 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 		}
 		else
 			emit s_exportCanceled();
-
-		if(view != viewp)
-			delete view;
 	}
 	catch(Exception &e)
 	{
+		//Restoring the scene settings before throw error
+		ObjectsScene::setCanvasColor(bg_color);
+		ObjectsScene::setShowGrid(prev_show_grd);
+		ObjectsScene::setShowPageDelimiters(prev_show_dlm);
+		scene->setShowSceneLimits(true);
+		scene->update();
+
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
 	}
 }
@@ -598,7 +663,7 @@ void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, Connection conn, c
 	}
 }
 
-void ModelExportHelper::exportToDataDict(DatabaseModel *db_model, const QString &path, bool browsable, bool split)
+void ModelExportHelper::exportToDataDict(DatabaseModel *db_model, const QString &path, bool browsable, bool split, unsigned thread_cnt)
 {
 	if(!db_model)
 		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
@@ -612,7 +677,7 @@ void ModelExportHelper::exportToDataDict(DatabaseModel *db_model, const QString
 													 tr("Starting data dictionary generation..."),
 													 ObjectType::BaseObject);
 		progress=1;
-		db_model->saveDataDictionary(path, browsable, split);
+		db_model->saveDataDictionary(path, browsable, split, thread_cnt);
 
 		emit s_progressUpdated(100, tr("Data dictionary successfully saved into `%1'.").arg(path), ObjectType::BaseObject);
 		emit s_exportFinished();
@@ -1137,10 +1202,9 @@ void ModelExportHelper::setExportToSQLParams(DatabaseModel *db_model, const QStr
 	this->code_gen_mode=code_gen_mode;
 }
 
-void ModelExportHelper::setExportToPNGParams(ObjectsScene *scene, QGraphicsView *viewp, const QString &filename, double zoom, bool show_grid, bool show_delim, bool page_by_page)
+void ModelExportHelper::setExportToPNGParams(ObjectsScene *scene, const QString &filename, double zoom, bool show_grid, bool show_delim, bool page_by_page)
 {
 	this->scene=scene;
-	this->viewp=viewp;
 	this->filename=filename;
 	this->zoom=zoom;
 	this->show_grid=show_grid;
@@ -1194,7 +1258,7 @@ void ModelExportHelper::exportToPNG()
 {
 	try
 	{
-		exportToPNG(scene, filename, zoom, show_grid, show_delim, page_by_page, viewp);
+		exportToPNG(scene, filename, zoom, show_grid, show_delim, page_by_page);
 		resetExportParams();
 	}
 	catch(Exception &e)
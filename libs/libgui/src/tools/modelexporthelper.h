@@ -32,6 +32,11 @@ class __libgui ModelExportHelper: public QObject {
 	private:
 		Q_OBJECT
 
+		/*! \brief Dimensions (in pixels) of the tiles rendered in parallel during the PNG export.
+		 * A band of tiles (BandHeight rows) is the only portion of the image kept in memory */
+		static constexpr int TileSize = 1024,
+		BandHeight = 128;
+
 		//! \brief  Stores the total progress
 		int progress,
 
@@ -108,8 +113,6 @@ class __libgui ModelExportHelper: public QObject {
 
 		ObjectsScene *scene;
 
-		QGraphicsView *viewp;
-
 		QString filename;
 
 		double zoom;
@@ -150,6 +153,12 @@ class __libgui ModelExportHelper: public QObject {
 		3) abort the export by immediatelly redirecting the error to the user */
 		void handleSQLError(Exception &e, const QString &sql_cmd, bool ignore_dup);
 
+		/*! \brief Renders the page rectangle of the scene to a PNG file using the provided scale. The page is rendered band by band,
+		 * each band is split in tiles which are recorded by the thread owning the scene (only the items of each tile are recorded),
+		 * rasterized in parallel and then streamed to the file. The file is removed if the export fails or is canceled.
+		 * The page index and page count are used only to compute the progress */
+		void renderPageToPNG(ObjectsScene *scene, const QRectF &pg_rect, const QString &file, double scale, unsigned page_idx, unsigned page_cnt);
+
 	public:
 		ModelExportHelper(QObject *parent = nullptr);
 
@@ -159,16 +168,15 @@ class __libgui ModelExportHelper: public QObject {
 		Error catalog is available at: postgresql.org/docs/current/static/errcodes-appendix.html */
 		void setIgnoredErrors(const QStringList &err_codes);
 
-		//! \brief Exports the model to a named SQL file. The PostgreSQL version syntax must be specified.
-		void exportToSQL(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver, bool split, DatabaseModel::CodeGenMode code_gen_mode);
+		/*! \brief Exports the model to a named SQL file. The PostgreSQL version syntax must be specified.
+		 * The incremental option is only used in split mode (see DatabaseModel::saveSplitSQLDefinition()) */
+		void exportToSQL(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver, bool split, DatabaseModel::CodeGenMode code_gen_mode, bool incremental = false);
 
 		/*! \brief Exports the model to a named PNG image. The boolean parameters controls the grid exhibition
-		as well the page delimiters on the output image. The zoom parameter controls the zoom applied to the viewport
-		before draw it on the pixmap. It is possible to specified an viewport (QGraphicsView instance) previously allocated
-		and the method will use it instead of allocate a local one. This is a workaround to error raised by QCoreApplication::sendPostedEvents
-		when running the helper in a thread */
-		void exportToPNG(ObjectsScene *scene, const QString &filename, double zoom, bool show_grid, bool show_delim,
-										 bool page_by_page, QGraphicsView *viewp=nullptr);
+		as well the page delimiters on the output image. The zoom parameter controls the scale applied to the scene
+		when rendering the image. The image is rendered in tiles (in parallel) and written band by band so the memory
+		used doesn't depend on the image's height, allowing the export of huge models at high zoom factors */
+		void exportToPNG(ObjectsScene *scene, const QString &filename, double zoom, bool show_grid, bool show_delim, bool page_by_page);
 
 		//! \brief Exports the model to a named SVG file.
 		void exportToSVG(ObjectsScene *scene, const QString &filename, bool show_grid, bool show_delim);
@@ -182,8 +190,9 @@ class __libgui ModelExportHelper: public QObject {
 
 		/*! \brief Exports the model to a named data dictionary. The options browsable and splitted indicate,
 		 * respectively, that the data dictionary should have an object index and the dictionary should be split
-		 * in different files per table */
-		void exportToDataDict(DatabaseModel *db_model, const QString &path, bool browsable, bool split);
+		 * in different files per table. The thread_cnt is the amount of threads used to render the tables dictionaries
+		 * (zero means the ideal thread count of the system) */
+		void exportToDataDict(DatabaseModel *db_model, const QString &path, bool browsable, bool split, unsigned thread_cnt = 0);
 
 		/*! \brief Configures the DBMS export params before start the export thread (when in thread mode).
 		This form receive a database model as input and the sql code to be exported will be generated from it.
@@ -200,8 +209,8 @@ class __libgui ModelExportHelper: public QObject {
 		void setExportToSQLParams(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver, bool split, DatabaseModel::CodeGenMode code_gen_mode);
 
 		/*! \brief Configures the PNG export params before start the export thread (when in thread mode).
-		This form receive the objects scene, a viewport, the output filename, zoom factor, grid options and page by page export options */
-		void setExportToPNGParams(ObjectsScene *scene, QGraphicsView *viewp, const QString &filename, double zoom,
+		This form receive the objects scene, the output filename, zoom factor, grid options and page by page export options */
+		void setExportToPNGParams(ObjectsScene *scene, const QString &filename, double zoom,
 															bool show_grid, bool show_delim, bool page_by_page);
 
 		/*! \brief Configures the SVG export params before start the export thread (when in thread mode).
@@ -233,6 +233,8 @@ void ModelsDiffHelper::diffModels()
 		if(!source_model || !imported_model)
 			throw Exception(ErrorCode::OprNotAllocatedObject ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
+		progress_thr.reset();
+
 		//First, we need to detect the objects to be dropped
 		diffModels(ObjectsDiffInfo::DropObject);
 		//Second, we will check the objects to be created or modified
@@ -418,9 +420,12 @@ void ModelsDiffHelper::diffModels(ObjectsDiffInfo::DiffType diff_type)
 					((diff_type==ObjectsDiffInfo::DropObject && (!diff_opts[OptKeepClusterObjs] || (diff_opts[OptKeepClusterObjs] && obj_type!=ObjectType::Role && obj_type!=ObjectType::Tablespace))) ||
 					 (diff_type!=ObjectsDiffInfo::DropObject)))
 			{
-				emit s_progressUpdated(prog + ((idx/static_cast<double>(obj_order.size())) * factor),
-															 tr("Processing object `%1' (%2)...").arg(object->getSignature()).arg(object->getTypeName()),
-															 object->getObjectType());
+				if(progress_thr.isReportDue(prog + ((idx/static_cast<double>(obj_order.size())) * factor)))
+				{
+					emit s_progressUpdated(prog + ((idx/static_cast<double>(obj_order.size())) * factor),
+																 tr("Processing object `%1' (%2)...").arg(object->getSignature()).arg(object->getTypeName()),
+																 object->getObjectType());
+				}
 
 				//Processing objects that are not database, table child object (they are processed further)
 				if(obj_type!=ObjectType::Database && !TableObject::isTableObject(obj_type))
@@ -544,9 +549,13 @@ void ModelsDiffHelper::diffModels(ObjectsDiffInfo::DiffType diff_type)
 			else
 			{
 				generateDiffInfo(ObjectsDiffInfo::IgnoreObject, object);
-				emit s_progressUpdated(prog + ((idx/static_cast<double>(obj_order.size())) * factor),
-									   tr("Skipping object `%1' (%2)...").arg(object->getSignature()).arg(object->getTypeName()),
-									   object->getObjectType());
+
+				if(progress_thr.isReportDue(prog + ((idx/static_cast<double>(obj_order.size())) * factor)))
+				{
+					emit s_progressUpdated(prog + ((idx/static_cast<double>(obj_order.size())) * factor),
+										   tr("Skipping object `%1' (%2)...").arg(object->getSignature()).arg(object->getTypeName()),
+										   object->getObjectType());
+				}
 
 				if(diff_canceled)
 					break;
@@ -852,10 +861,15 @@ void ModelsDiffHelper::processDiffInfos()
 			constr=dynamic_cast<Constraint *>(object);
 			col=dynamic_cast<Column *>(object);
 
-			emit s_progressUpdated((idx++/static_cast<double>(diff_infos.size())) * 100,
-								   tr("Processing `%1' info for object `%2' (%3)...")
-								   .arg(diff.getDiffTypeString()).arg(object->getSignature()).arg(object->getTypeName()),
-								   obj_type);
+			if(progress_thr.isReportDue((idx/static_cast<double>(diff_infos.size())) * 100))
+			{
+				emit s_progressUpdated((idx/static_cast<double>(diff_infos.size())) * 100,
+									   tr("Processing `%1' info for object `%2' (%3)...")
+									   .arg(diff.getDiffTypeString()).arg(object->getSignature()).arg(object->getTypeName()),
+									   obj_type);
+			}
+
+			idx++;
 
 			/* Preliminary verification for check constraints: there is the need to
 		 check if the constraint is added by generalization or if this is not the case
@@ -75,6 +75,9 @@ class __libgui ModelsDiffHelper: public QObject {
 		//! \brief Stores all objects filtered by the partial diff filters
 		std::map<unsigned, BaseObject *> filtered_objs;
 
+		//! \brief Limits the rate of the progress signals emitted per object during the diff
+		ProgressThrottle progress_thr;
+
 		/*! note The parameter diff_type in any methods below is one of the values in
 		ObjectsDiffInfo::CreateObject|AlterObject|DropObject */
 
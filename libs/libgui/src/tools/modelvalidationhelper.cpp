@@ -17,13 +17,16 @@
 */
 
 #include "modelvalidationhelper.h"
+#include <QThreadPool>
+#include <atomic>
 
 ModelValidationHelper::ModelValidationHelper()
 {
 	warn_count=error_count=progress=0;
 	db_model=nullptr;
 	conn=nullptr;
-	valid_canceled=fix_mode=use_tmp_names=false;
+	valid_canceled=false;
+	fix_mode=use_tmp_names=full_validation=false;
 
 	export_thread=new QThread;
 	export_helper.moveToThread(export_thread);
@@ -41,7 +44,7 @@ ModelValidationHelper::~ModelValidationHelper()
 	delete export_thread;
 }
 
-void ModelValidationHelper::generateValidationInfo(ValidationInfo::ValType val_type, BaseObject *object, std::vector<BaseObject *> refs)
+void ModelValidationHelper::generateValidationInfo(ValidationInfo::ValType val_type, BaseObject *object, std::vector<BaseObject *> refs, std::vector<ValidationInfo> *infos)
 {
 	if(!refs.empty() ||
 		 val_type==ValidationInfo::MissingExtension ||
@@ -50,15 +53,229 @@ void ModelValidationHelper::generateValidationInfo(ValidationInfo::ValType val_t
 	{
 		//Configures a validation info
 		ValidationInfo info=ValidationInfo(val_type, object, refs);
+		QMutexLocker locker(&val_info_mtx);
+
 		error_count++;
-		val_infos.push_back(info);
+
+		if(infos)
+			infos->push_back(info);
+		else
+			val_infos.push_back(info);
 
 		if(val_type==ValidationInfo::BrokenRelConfig)
 			inv_rels.push_back(object);
 
-		//Emit the signal containing the info
-		emit s_validationInfoGenerated(info);
+		/* Emit the signal containing the info. The infos generated by the reference checking workers
+		 * are emitted by the orchestrating thread once the workers finish (see validateModel()) */
+		if(!infos)
+			emit s_validationInfoGenerated(info);
+	}
+}
+
+void ModelValidationHelper::checkObjectReferences(BaseObject *object, std::vector<ValidationInfo> &infos)
+{
+	ObjectType obj_type = object->getObjectType();
+	BaseObject *refer_obj = nullptr;
+	std::vector<BaseObject *> refs, refs_aux;
+	TableObject *tab_obj = nullptr;
+	PhysicalTable *table = nullptr, *ref_tab = nullptr, *recv_tab = nullptr;
+	Constraint *constr = nullptr;
+	Column *col = nullptr;
+	Relationship *rel = nullptr;
+
+	/* Special validation case: For generalization and copy relationships validates the ids of participant tables.
+		 Reference table cannot own an id greater thant receiver table */
+	if(obj_type==ObjectType::Relationship)
+	{
+		rel=dynamic_cast<Relationship *>(object);
+		if(rel->getRelationshipType()==Relationship::RelationshipGen ||
+				rel->getRelationshipType()==Relationship::RelationshipDep ||
+			 rel->getRelationshipType()==Relationship::RelationshipPart)
+		{
+			recv_tab=rel->getReceiverTable();
+			ref_tab=rel->getReferenceTable();
+
+			if(ref_tab->getObjectId() > recv_tab->getObjectId())
+			{
+				object=ref_tab;
+				refs_aux.push_back(recv_tab);
+			}
+		}
+	}
+	else
+	{
+		db_model->getObjectReferences(object, refs);
+
+		while(!refs.empty() && !valid_canceled)
+		{
+			//Checking if the referrer object is a table object. In this case its parent table is considered
+			tab_obj=dynamic_cast<TableObject *>(refs.back());
+			constr=dynamic_cast<Constraint *>(tab_obj);
+			col=dynamic_cast<Column *>(tab_obj);
+
+			/*
+			 * If the current referrer object has an id less than reference object's id
+			 * then it will be pushed into the list of invalid references.
+			 * There's an exception which is that foreign keys are completely discarded from any validation
+			 * since they are always created at end of code definition being free of any reference breaking.
+			 */
+			if(object != refs.back() &&
+				 (
+					 ((col || (constr && constr->getConstraintType() != ConstraintType::ForeignKey)) &&
+						(tab_obj->getParentTable()->getObjectId() <= object->getObjectId())) ||
+					 (!constr && !col && refs.back()->getObjectId() <= object->getObjectId()))
+				 )
+			{
+				if(col || constr)
+					refer_obj=tab_obj->getParentTable();
+				else
+					refer_obj=refs.back();
+
+				refs_aux.push_back(refer_obj);
+			}
+
+			refs.pop_back();
+		}
+
+		/* Validating a special object. The validation made here is to check if the special object
+		 * (constraint/index/trigger/view) references a column added by a relationship and
+		 *  that relationship is being created after the creation of the special object */
+		if(BaseTable::isBaseTable(obj_type) || obj_type == ObjectType::GenericSql)
+		{
+			std::vector<ObjectType> tab_aux_types={ ObjectType::Constraint, ObjectType::Trigger, ObjectType::Index };
+			std::vector<TableObject *> *tab_objs;
+			std::vector<Column *> ref_cols;
+			std::vector<BaseObject *> rels;
+			BaseObject *rel=nullptr;
+			View *view=nullptr;
+			GenericSQL *gen_sql=nullptr;
+			Constraint *constr=nullptr;
+
+			table=dynamic_cast<PhysicalTable *>(object);
+			view=dynamic_cast<View *>(object);
+			gen_sql = dynamic_cast<GenericSQL *>(object);
+
+			if(table)
+			{
+				/* Checking the table children objects if they references some columns added by relationship.
+				 * If so, the id of the relationships are swapped with the child object if the first is created
+				 * after the latter. */
+				for(auto &obj_tp : tab_aux_types)
+				{
+					tab_objs = table->getObjectList(obj_tp);
+					if(!tab_objs) continue;
+
+					for(auto &tab_obj : (*tab_objs))
+					{
+						ref_cols.clear();
+						rels.clear();
+
+						if(!tab_obj->isAddedByRelationship())
+						{
+							if(obj_tp==ObjectType::Constraint)
+							{
+								constr=dynamic_cast<Constraint *>(tab_obj);
+
+								if(constr->getConstraintType()!=ConstraintType::PrimaryKey)
+									ref_cols=constr->getRelationshipAddedColumns();
+							}
+							else if(obj_tp==ObjectType::Trigger)
+								ref_cols=dynamic_cast<Trigger *>(tab_obj)->getRelationshipAddedColumns();
+							else
+								ref_cols=dynamic_cast<Index *>(tab_obj)->getRelationshipAddedColumns();
+						}
+
+						//Getting the relationships that owns the columns
+						for(auto &ref_col : ref_cols)
+						{
+							rel=ref_col->getParentRelationship();
+							if(rel->getObjectId() > tab_obj->getObjectId() && std::find(rels.begin(), rels.end(), rel)==rels.end())
+								rels.push_back(rel);
+						}
+
+						generateValidationInfo(ValidationInfo::SpObjBrokenReference, tab_obj, rels, &infos);
+					}
+				}
+			}
+			else if(view)
+			{
+				ref_cols=view->getRelationshipAddedColumns();
+
+				//Getting the relationships that owns the columns
+				for(auto &ref_col : ref_cols)
+				{
+					rel=ref_col->getParentRelationship();
+					if(rel->getObjectId() > object->getObjectId() && std::find(rels.begin(), rels.end(), rel)==rels.end())
+						rels.push_back(rel);
+				}
+
+				generateValidationInfo(ValidationInfo::SpObjBrokenReference, object, rels, &infos);
+			}
+			else
+			{
+				Column *col = nullptr;
+
+				for(auto &ref_obj : gen_sql->getReferencedObjects())
+				{
+					col = dynamic_cast<Column *>(ref_obj);
+					if(!col || !col->isAddedByRelationship()) continue;
+
+					rel = col->getParentRelationship();
+
+					if(rel->getObjectId() > object->getObjectId() && std::find(rels.begin(), rels.end(), rel) == rels.end())
+						rels.push_back(rel);
+				}
+
+				generateValidationInfo(ValidationInfo::SpObjBrokenReference, object, rels, &infos);
+			}
+		}
+	}
+
+	generateValidationInfo(ValidationInfo::BrokenReference, object, refs_aux, &infos);
+}
+
+std::vector<BaseObject *> ModelValidationHelper::getReferenceCheckObjects(const std::vector<ObjectType> &types)
+{
+	std::vector<BaseObject *> objects, deps;
+	QSet<BaseObject *> chg_objs;
+	BaseTable *base_tab = nullptr;
+	bool incremental = !full_validation && db_model->isTrackingChanges();
+
+	/* In incremental mode, besides the changed objects, their dependencies must be checked too since a
+	 * changed object may start to reference an object with a greater id. The relationships of changed
+	 * tables are included as well due to the id checking between receiver and reference tables */
+	if(incremental)
+	{
+		for(auto &obj : db_model->getChangedObjects())
+		{
+			deps.clear();
+			db_model->getObjectDependecies(obj, deps);
+			chg_objs.insert(obj);
+
+			for(auto &dep : deps)
+				chg_objs.insert(dep);
+
+			base_tab = dynamic_cast<BaseTable *>(obj);
+
+			if(base_tab)
+			{
+				for(auto &rel : db_model->getRelationships(base_tab))
+					chg_objs.insert(rel);
+			}
+		}
 	}
+
+	//Excluding the validation of system objects (created automatically)
+	for(auto &type : types)
+	{
+		for(auto &obj : *db_model->getObjectList(type))
+		{
+			if(!obj->isSystemObject() && (!incremental || chg_objs.contains(obj)))
+				objects.push_back(obj);
+		}
+	}
+
+	return objects;
 }
 
 void  ModelValidationHelper::resolveConflict(ValidationInfo &info)
@@ -257,6 +474,16 @@ bool ModelValidationHelper::isInFixMode()
 	return fix_mode;
 }
 
+void ModelValidationHelper::setFullValidation(bool value)
+{
+	full_validation=value;
+}
+
+bool ModelValidationHelper::isFullValidation()
+{
+	return full_validation;
+}
+
 void ModelValidationHelper::validateModel()
 {
 	if(!db_model)
@@ -272,206 +499,94 @@ void ModelValidationHelper::validateModel()
 				aux_types = { ObjectType::Table, ObjectType::ForeignTable, ObjectType::View },
 				tab_obj_types = { ObjectType::Constraint, ObjectType::Index };
 
-		ObjectType	obj_type;
-		unsigned i = 0, i1 = 0, cnt = 0, aux_cnt = 0,	count = 0, count1 = 0;
-		BaseObject *object=nullptr, *refer_obj=nullptr;
-		std::vector<BaseObject *> refs, refs_aux, *obj_list=nullptr, aux_tables;
+		unsigned i = 0, i1 = 0, cnt = 0, aux_cnt = 0, count1 = 0;
+		std::vector<BaseObject *> refs, *obj_list=nullptr, aux_tables;
 		std::vector<BaseObject *>::iterator itr;
 		TableObject *tab_obj=nullptr;
-		PhysicalTable *table=nullptr, *ref_tab=nullptr, *recv_tab=nullptr;
+		PhysicalTable *table=nullptr;
 		BaseTable *base_tab = nullptr;
 		Constraint *constr=nullptr;
 		Column *col=nullptr;
-		Relationship *rel=nullptr;
 		std::map<QString, std::vector<BaseObject *> > dup_objects;
 		std::map<QString, std::vector<BaseObject *> >::iterator mitr;
 		QString name, signal_msg=QString("`%1' (%2)");
-		bool postgis_exists = db_model->getObjectIndex(QString("postgis"), ObjectType::Extension) >= 0;
+		bool postgis_exists = db_model->getObjectIndex(QString("postgis"), ObjectType::Extension) >= 0,
+				refs_valid = false;
 
 		warn_count=error_count=progress=0;
 		val_infos.clear();
 		valid_canceled=false;
 
 		aux_cnt = aux_types.size();
-		count = types.size();
 		count1 = tab_obj_types.size();
 
 		/* Step 1: Validating broken references. This situation happens when a object references another
-		 which id is smaller than the id of the first one. */
-		for(i=0; i < count && !valid_canceled; i++)
+		 which id is smaller than the id of the first one. The checks are read-only so the objects are
+		 split in batches processed in parallel. Each object has its own list of validation infos so the
+		 final result is the same (and in the same order) as the one of a sequential validation */
+		std::vector<BaseObject *> val_objs = getReferenceCheckObjects(types);
+		std::vector<std::vector<ValidationInfo>> obj_infos(val_objs.size());
+		std::atomic<unsigned> proc_count = 0;
+		QThreadPool thread_pool;
+		unsigned batch_size = std::max<unsigned>(1, val_objs.size() / (thread_pool.maxThreadCount() * 4));
+
+		/* The permissions by role index used by DatabaseModel::getObjectReferences() is rebuilt
+		 * on demand, so it's updated before the workers start in order to be only read by them */
+		db_model->updateRolePermissionsIndex();
+
+		/* Objects can't be added to or removed from the model while the workers read it. Any attempt raises
+		 * an error before touching the model. The edition of the objects is prevented since the model and
+		 * the main window's actions are disabled by ModelValidationWidget before the validation starts */
+		db_model->setModificationsBlocked(true);
+
+		for(unsigned start = 0; start < val_objs.size(); start += batch_size)
 		{
-			obj_list=db_model->getObjectList(types[i]);
-			itr=obj_list->begin();
-
-			while(itr!=obj_list->end() && !valid_canceled)
-			{
-				object=(*itr);
-				obj_type=object->getObjectType();
-				refs_aux.clear();
-				itr++;
+			unsigned end = std::min<unsigned>(start + batch_size, val_objs.size());
 
-				//Excluding the validation of system objects (created automatically)
-				if(!object->isSystemObject())
+			thread_pool.start([this, start, end, &val_objs, &obj_infos, &proc_count](){
+				for(unsigned idx = start; idx < end && !valid_canceled; idx++)
 				{
-					emit s_objectProcessed(signal_msg.arg(object->getName()).arg(object->getTypeName()), object->getObjectType());
-
-					/* Special validation case: For generalization and copy relationships validates the ids of participant tables.
-						 Reference table cannot own an id greater thant receiver table */
-					if(obj_type==ObjectType::Relationship)
-					{
-						rel=dynamic_cast<Relationship *>(object);
-						if(rel->getRelationshipType()==Relationship::RelationshipGen ||
-								rel->getRelationshipType()==Relationship::RelationshipDep ||
-							 rel->getRelationshipType()==Relationship::RelationshipPart)
-						{
-							recv_tab=rel->getReceiverTable();
-							ref_tab=rel->getReferenceTable();
-
-							if(ref_tab->getObjectId() > recv_tab->getObjectId())
-							{
-								object=ref_tab;
-								refs_aux.push_back(recv_tab);
-							}
-						}
-					}
-					else
-					{
-						db_model->getObjectReferences(object, refs);
-
-						while(!refs.empty() && !valid_canceled)
-						{
-							//Checking if the referrer object is a table object. In this case its parent table is considered
-							tab_obj=dynamic_cast<TableObject *>(refs.back());
-							constr=dynamic_cast<Constraint *>(tab_obj);
-							col=dynamic_cast<Column *>(tab_obj);
-
-							/*
-							 * If the current referrer object has an id less than reference object's id
-							 * then it will be pushed into the list of invalid references.
-							 * There's an exception which is that foreign keys are completely discarded from any validation
-							 * since they are always created at end of code definition being free of any reference breaking.
-							 */
-							if(object != refs.back() &&
-								 (
-									 ((col || (constr && constr->getConstraintType() != ConstraintType::ForeignKey)) &&
-										(tab_obj->getParentTable()->getObjectId() <= object->getObjectId())) ||
-									 (!constr && !col && refs.back()->getObjectId() <= object->getObjectId()))
-								 )
-							{
-								if(col || constr)
-									refer_obj=tab_obj->getParentTable();
-								else
-									refer_obj=refs.back();
-
-								refs_aux.push_back(refer_obj);
-							}
-
-							refs.pop_back();
-						}
-
-						/* Validating a special object. The validation made here is to check if the special object
-						 * (constraint/index/trigger/view) references a column added by a relationship and
-						 *  that relationship is being created after the creation of the special object */
-						if(BaseTable::isBaseTable(obj_type) || obj_type == ObjectType::GenericSql)
-						{
-							std::vector<ObjectType> tab_aux_types={ ObjectType::Constraint, ObjectType::Trigger, ObjectType::Index };
-							std::vector<TableObject *> *tab_objs;
-							std::vector<Column *> ref_cols;
-							std::vector<BaseObject *> rels;
-							BaseObject *rel=nullptr;
-							View *view=nullptr;
-							GenericSQL *gen_sql=nullptr;
-							Constraint *constr=nullptr;
-
-							table=dynamic_cast<PhysicalTable *>(object);
-							view=dynamic_cast<View *>(object);
-							gen_sql = dynamic_cast<GenericSQL *>(object);
-
-							if(table)
-							{
-								/* Checking the table children objects if they references some columns added by relationship.
-								 * If so, the id of the relationships are swapped with the child object if the first is created
-								 * after the latter. */
-								for(auto &obj_tp : tab_aux_types)
-								{
-									tab_objs = table->getObjectList(obj_tp);
-									if(!tab_objs) continue;
-
-									for(auto &tab_obj : (*tab_objs))
-									{
-										ref_cols.clear();
-										rels.clear();
-
-										if(!tab_obj->isAddedByRelationship())
-										{
-											if(obj_tp==ObjectType::Constraint)
-											{
-												constr=dynamic_cast<Constraint *>(tab_obj);
-
-												if(constr->getConstraintType()!=ConstraintType::PrimaryKey)
-													ref_cols=constr->getRelationshipAddedColumns();
-											}
-											else if(obj_tp==ObjectType::Trigger)
-												ref_cols=dynamic_cast<Trigger *>(tab_obj)->getRelationshipAddedColumns();
-											else
-												ref_cols=dynamic_cast<Index *>(tab_obj)->getRelationshipAddedColumns();
-										}
-
-										//Getting the relationships that owns the columns
-										for(auto &ref_col : ref_cols)
-										{
-											rel=ref_col->getParentRelationship();
-											if(rel->getObjectId() > tab_obj->getObjectId() && std::find(rels.begin(), rels.end(), rel)==rels.end())
-												rels.push_back(rel);
-										}
-
-										generateValidationInfo(ValidationInfo::SpObjBrokenReference, tab_obj, rels);
-									}
-								}
-							}
-							else if(view)
-							{
-								ref_cols=view->getRelationshipAddedColumns();
-
-								//Getting the relationships that owns the columns
-								for(auto &ref_col : ref_cols)
-								{
-									rel=ref_col->getParentRelationship();
-									if(rel->getObjectId() > object->getObjectId() && std::find(rels.begin(), rels.end(), rel)==rels.end())
-										rels.push_back(rel);
-								}
+					checkObjectReferences(val_objs[idx], obj_infos[idx]);
+					proc_count++;
+				}
+			});
+		}
 
-								generateValidationInfo(ValidationInfo::SpObjBrokenReference, object, rels);
-							}
-							else
-							{
-								Column *col = nullptr;
+		/* Emit the signals containing the validation progress and the last processed object while the workers are running.
+		 * The progress is sampled here instead of being reported by the workers so the GUI receives a few signals per second */
+		while(!thread_pool.waitForDone(100))
+		{
+			unsigned proc_cnt = proc_count;
 
-								for(auto &ref_obj : gen_sql->getReferencedObjects())
-								{
-									col = dynamic_cast<Column *>(ref_obj);
-									if(!col || !col->isAddedByRelationship()) continue;
+			progress = (proc_cnt / static_cast<double>(val_objs.size())) * 20;
 
-									rel = col->getParentRelationship();
+			if(proc_cnt > 0)
+			{
+				BaseObject *obj = val_objs[proc_cnt - 1];
+				emit s_objectProcessed(signal_msg.arg(obj->getName()).arg(obj->getTypeName()), obj->getObjectType());
+			}
 
-									if(rel->getObjectId() > object->getObjectId() && std::find(rels.begin(), rels.end(), rel) == rels.end())
-										rels.push_back(rel);
-								}
+			emit s_progressUpdated(progress, "");
+		}
 
-								generateValidationInfo(ValidationInfo::SpObjBrokenReference, object, rels);
-							}
-						}
-					}
+		db_model->setModificationsBlocked(false);
 
-					generateValidationInfo(ValidationInfo::BrokenReference, object, refs_aux);
-				}
+		/* The infos generated by the workers are stored and emitted in the order of the checked objects
+		 * so the result is the same as the one of a sequential validation */
+		for(auto &infos : obj_infos)
+		{
+			for(auto &info : infos)
+			{
+				val_infos.push_back(info);
+				emit s_validationInfoGenerated(info);
 			}
-
-			//Emit a signal containing the validation progress
-			progress=((i+1)/static_cast<double>(count))*20;
-			emit s_progressUpdated(progress, "");
 		}
 
+		// No broken references found means the tracking of changes for the next validation can be restarted
+		refs_valid = !valid_canceled && val_infos.empty();
+
+		progress = 20;
+		emit s_progressUpdated(progress, "");
 
 		/* Step 2: Validating name conflitcs between primary keys, unique keys, exclude constraints
 		and indexs of all tables/foreign talbes/views. The tables/views names are checked too. */
@@ -602,6 +717,11 @@ void ModelValidationHelper::validateModel()
 			}
 		}
 
+		/* Once the references of all objects (or all the changed ones) are valid the next
+		 * validations can check only the objects changed from this point on */
+		if(refs_valid && !valid_canceled)
+			db_model->startChangesTracking();
+
 		if(!valid_canceled && !fix_mode)
 		{
 			//Step 3 (optional): Validating the SQL code onto a local DBMS.
@@ -631,6 +751,7 @@ void ModelValidationHelper::validateModel()
 	}
 	catch(Exception &e)
 	{
+		db_model->setModificationsBlocked(false);
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
 	}
 }
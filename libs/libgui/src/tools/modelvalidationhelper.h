@@ -26,6 +26,8 @@
 #define MODEL_VALIDATION_HELPER_H
 
 #include <QObject>
+#include <QMutex>
+#include <atomic>
 #include "validationinfo.h"
 #include "databasemodel.h"
 #include "connection.h"
@@ -55,13 +57,21 @@ class __libgui ModelValidationHelper: public QObject {
 		//! \brief Validation progress
 		int progress;
 
-		//! \brief Indicates if the validation was canceled by the user
-		bool  valid_canceled,
+		/*! \brief Indicates if the validation was canceled by the user. This flag is atomic since it is
+		 * set by the GUI thread and polled by the reference checking workers */
+		std::atomic<bool> valid_canceled;
 
 		//! \brief Indicates if the validation is on fix mode.
-		fix_mode,
+		bool fix_mode,
 
-		use_tmp_names;
+		use_tmp_names,
+
+		/*! \brief Indicates that the references of all objects must be checked instead of only the ones
+		 * changed since the last successful validation (see DatabaseModel::startChangesTracking()) */
+		full_validation;
+
+		//! \brief Serializes the generation of validation infos by the reference checking workers
+		QMutex val_info_mtx;
 
 		/*! \brief Stores the validation infos generated during validation steps.
 		This vector is read when applying fixes */
@@ -70,7 +80,19 @@ class __libgui ModelValidationHelper: public QObject {
 		//! \brief Stores the analyzed relationship marked as invalidated
 		std::vector<BaseObject *> inv_rels;
 
-		void generateValidationInfo(ValidationInfo::ValType val_type, BaseObject *object, std::vector<BaseObject *> refs);
+		/*! \brief Generates a validation info if the validation type and references represent an issue. When the infos
+		 * parameter is provided the generated info is stored in it instead of the validation infos list */
+		void generateValidationInfo(ValidationInfo::ValType val_type, BaseObject *object, std::vector<BaseObject *> refs, std::vector<ValidationInfo> *infos = nullptr);
+
+		/*! \brief Returns the objects of the provided types that must have their references checked. In incremental mode
+		 * (the default) only the objects changed since the last successful validation and their dependencies are returned */
+		std::vector<BaseObject *> getReferenceCheckObjects(const std::vector<ObjectType> &types);
+
+		/*! \brief Checks if the object is referenced by objects created before it storing the generated validation infos
+		 * in the provided vector. This method can be called by several threads at once, so it (as well as everything
+		 * reached from DatabaseModel::getObjectReferences()) must only read the model and must not emit signals.
+		 * The model has its modifications blocked while the workers run (see DatabaseModel::setModificationsBlocked()) */
+		void checkObjectReferences(BaseObject *object, std::vector<ValidationInfo> &infos);
 
 	public:
 		ModelValidationHelper();
@@ -86,6 +108,12 @@ class __libgui ModelValidationHelper: public QObject {
 		//! \brief Returns if the validator is on fix mode
 		bool isInFixMode();
 
+		//! \brief Forces the validator to check the references of all objects instead of only the changed ones
+		void setFullValidation(bool value);
+
+		//! \brief Returns if the validator checks the references of all objects
+		bool isFullValidation();
+
 		//! \brief Returns the error count (only when executing SQL validation)
 		unsigned getErrorCount();
 
@@ -109,7 +137,8 @@ class __libgui ModelValidationHelper: public QObject {
 		void cancelValidation();
 
 	signals:
-		//! \brief This signal is emitted when a validation info is generated
+		/*! \brief This signal is emitted when a validation info is generated. It's always emitted from the thread running
+		 * validateModel() (never from the reference checking workers) and in the same order as the infos are stored */
 		void s_validationInfoGenerated(ValidationInfo val_info);
 
 		//! \brief This signal is emitted when the validation progress changes
@@ -64,6 +64,11 @@ ModelValidationWidget::ModelValidationWidget(QWidget *parent): QWidget(parent)
 			clearOutput();
 		});
 
+		connect(full_valid_chk, &QCheckBox::toggled, this, [this](){
+			configureValidation();
+			clearOutput();
+		});
+
 		connect(connections_cmb, &QComboBox::currentTextChanged, this, [this](){
 			configureValidation();
 			clearOutput();
@@ -563,6 +568,7 @@ void ModelValidationWidget::configureValidation()
 		}
 
 		validation_helper->setValidationParams(model_wgt->getDatabaseModel(), conn, ver, use_tmp_names_chk->isChecked());
+		validation_helper->setFullValidation(full_valid_chk->isChecked());
 	}
 }
 
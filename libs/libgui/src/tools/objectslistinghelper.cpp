@@ -0,0 +1,143 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "objectslistinghelper.h"
+
+ObjectsListingHelper::ObjectsListingHelper() : QObject(nullptr)
+{
+	discarded_req_id = 0;
+	query_filter = Catalog::ListAllObjects;
+	catalog_connected = false;
+}
+
+bool ObjectsListingHelper::isRequestDiscarded(unsigned req_id)
+{
+	return req_id <= discarded_req_id;
+}
+
+void ObjectsListingHelper::connectCatalog()
+{
+	if(catalog_connected)
+		return;
+
+	try
+	{
+		catalog.setQueryFilter(query_filter);
+		catalog.setConnection(connection);
+		catalog_connected = true;
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void ObjectsListingHelper::setConnection(Connection conn, Catalog::QueryFilter filter)
+{
+	closeConnection();
+	connection = conn;
+	query_filter = filter;
+}
+
+void ObjectsListingHelper::closeConnection()
+{
+	catalog.closeConnection();
+	catalog_connected = false;
+}
+
+void ObjectsListingHelper::discardRequests(unsigned req_id)
+{
+	discarded_req_id = req_id;
+}
+
+void ObjectsListingHelper::countObjects(unsigned req_id, std::vector<ObjectType> types, const QString &schema, const QString &table)
+{
+	if(isRequestDiscarded(req_id))
+		return;
+
+	try
+	{
+		connectCatalog();
+		emit s_objectsCounted(req_id, catalog.getObjectsCount(types, schema, table, {{ Attributes::FilterTableTypes, Attributes::True }}));
+	}
+	catch(Exception &e)
+	{
+		emit s_listingFailed(req_id, Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e));
+	}
+}
+
+void ObjectsListingHelper::listObjects(unsigned req_id, ObjectType type, const QString &schema, const QString &table)
+{
+	if(isRequestDiscarded(req_id))
+		return;
+
+	try
+	{
+		connectCatalog();
+
+		std::vector<attribs_map> objects = catalog.getObjectsNames(std::vector<ObjectType>{ type }, schema, table,
+																																{{ Attributes::FilterTableTypes, Attributes::True }}),
+				batch;
+
+		if(objects.empty())
+		{
+			emit s_objectsListed(req_id, batch, true);
+			return;
+		}
+
+		/* The objects are sent in batches so the tree can be populated gradually
+		 * in the main thread without blocking the interface */
+		for(auto itr = objects.begin(); itr != objects.end() && !isRequestDiscarded(req_id);)
+		{
+			auto end = (static_cast<unsigned>(objects.end() - itr) > BatchSize ? itr + BatchSize : objects.end());
+
+			batch.assign(itr, end);
+			itr = end;
+			emit s_objectsListed(req_id, batch, itr == objects.end());
+		}
+	}
+	catch(Exception &e)
+	{
+		emit s_listingFailed(req_id, Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e));
+	}
+}
+
+void ObjectsListingHelper::findObjects(unsigned req_id, const QString &pattern, bool by_oid, unsigned limit)
+{
+	if(isRequestDiscarded(req_id))
+		return;
+
+	try
+	{
+		connectCatalog();
+
+		std::vector<ObjectType> types = BaseObject::getChildObjectTypes(ObjectType::Database),
+				sch_types = BaseObject::getChildObjectTypes(ObjectType::Schema);
+		std::vector<attribs_map> objects, schemas;
+
+		types.insert(types.end(), sch_types.begin(), sch_types.end());
+		objects = catalog.findObjects(types, pattern, by_oid, limit);
+		schemas = catalog.getObjectsNames(std::vector<ObjectType>{ ObjectType::Schema });
+
+		emit s_objectsFound(req_id, objects, schemas);
+	}
+	catch(Exception &e)
+	{
+		emit s_listingFailed(req_id, Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e));
+	}
+}
@@ -0,0 +1,97 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libgui
+\class ObjectsListingHelper
+\brief Implements the retrieval of objects names and counts from a database in a thread so the database explorer
+can populate its tree on demand without freezing the interface. The helper must live in its own thread and its
+methods must be invoked in that thread (e.g. via QMetaObject::invokeMethod) since it keeps its own connection to
+the database. Each request is identified by an id that is sent back in the signals so the caller can discard
+the results of outdated requests.
+*/
+
+#ifndef OBJECTS_LISTING_HELPER_H
+#define OBJECTS_LISTING_HELPER_H
+
+#include <QObject>
+#include <atomic>
+#include "guiglobal.h"
+#include "catalog.h"
+
+class __libgui ObjectsListingHelper: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Catalog (and its connection) used to query the objects
+		Catalog catalog;
+
+		//! \brief Connection configured via setConnection() and lazily opened by the first request
+		Connection connection;
+
+		//! \brief Query filter applied to the catalog when connecting to the database
+		Catalog::QueryFilter query_filter;
+
+		//! \brief Indicates if the catalog is connected using the current connection
+		bool catalog_connected;
+
+		//! \brief The requests with ids lower than or equal to this value are ignored (see discardRequests())
+		std::atomic<unsigned> discarded_req_id;
+
+		//! \brief Returns if the request was discarded before being processed
+		bool isRequestDiscarded(unsigned req_id);
+
+		//! \brief Connects the catalog to the database in case it is not connected yet. Raises an exception on failure
+		void connectCatalog();
+
+	public:
+		//! \brief Amount of objects sent to the caller in each s_objectsListed() signal
+		static constexpr unsigned BatchSize = 500;
+
+		ObjectsListingHelper();
+
+		/*! \brief Configures the connection used to query the objects and the query filter (system and extension objects).
+		 * The connection is only stablished when the next request is processed, so connection errors are reported via s_listingFailed() */
+		void setConnection(Connection conn, Catalog::QueryFilter filter);
+
+		void closeConnection();
+
+		/*! \brief Makes the helper ignore all the pending requests with ids lower than or equal to the provided one.
+		 * This method can be called from any thread */
+		void discardRequests(unsigned req_id);
+
+		//! \brief Counts the objects of each provided type in the schema/table (when specified) emitting s_objectsCounted()
+		void countObjects(unsigned req_id, std::vector<ObjectType> types, const QString &schema, const QString &table);
+
+		/*! \brief Lists the objects of the provided type in the schema/table (when specified) emitting s_objectsListed()
+		 * for each batch of (at most) BatchSize objects */
+		void listObjects(unsigned req_id, ObjectType type, const QString &schema, const QString &table);
+
+		/*! \brief Searches the database and schema level objects which names contain the pattern or, if by_oid is true,
+		 * which OIDs start with the pattern emitting s_objectsFound(). At most limit objects are returned. Since the found
+		 * objects are displayed in a tree, all the schemas of the database are also sent in the signal */
+		void findObjects(unsigned req_id, const QString &pattern, bool by_oid, unsigned limit);
+
+	signals:
+		void s_objectsCounted(unsigned req_id, std::map<ObjectType, unsigned> counts);
+		void s_objectsListed(unsigned req_id, std::vector<attribs_map> objects, bool finished);
+		void s_objectsFound(unsigned req_id, std::vector<attribs_map> objects, std::vector<attribs_map> schemas);
+		void s_listingFailed(unsigned req_id, Exception e);
+};
+
+#endif
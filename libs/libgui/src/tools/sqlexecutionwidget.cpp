@@ -215,6 +215,9 @@ void SQLExecutionWidget::setConnection(Connection conn)
 	sql_exec_hlp.setConnection(conn);
 	sql_cmd_conn = conn;
 	db_name_lbl->setText(conn.getConnectionId(true, true, true));
+
+	//The object names of the database are completed from the catalog retrieved in background
+	code_compl_wgt->setCatalogConnection(conn.getConnectionParams());
 }
 
 void SQLExecutionWidget::setSQLCommand(const QString &sql)
@@ -427,6 +430,11 @@ void SQLExecutionWidget::finishExecution(int rows_affected)
 
 		addToSQLHistory(sql_cmd_txt->toPlainText(), rows_affected);
 
+		/* Commands that create, change or drop objects make the names used by the code completion outdated
+		 * so the catalog of the connection is retrieved again in background */
+		if(sql_cmd_txt->toPlainText().contains(QRegularExpression("\\b(create|alter|drop)\\b", QRegularExpression::CaseInsensitiveOption)))
+			CompletionCatalog::refresh(sql_cmd_conn.getConnectionParams(), true);
+
 		empty = (!res_model || res_model->rowCount() == 0);
 		output_tbw->setTabEnabled(0, !empty);
 		results_parent->setVisible(!empty);
@@ -0,0 +1,792 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "modelobjectstreemodel.h"
+#include "guiutilsns.h"
+#include "objectstablewidget.h"
+#include "tableobjectview.h"
+#include <set>
+
+ModelObjectsTreeModel::TreeNode::~TreeNode()
+{
+	for(auto &child : children)
+		delete child;
+
+	children.clear();
+}
+
+ModelObjectsTreeModel::ModelObjectsTreeModel(QObject *parent) : QAbstractItemModel(parent)
+{
+	db_model = nullptr;
+	use_cache = false;
+	root = new TreeNode(RootNode, nullptr, ObjectType::BaseObject, nullptr);
+}
+
+ModelObjectsTreeModel::~ModelObjectsTreeModel()
+{
+	delete root;
+}
+
+void ModelObjectsTreeModel::setDatabaseModel(DatabaseModel *db_model)
+{
+	beginResetModel();
+
+	if(this->db_model)
+		disconnect(this->db_model, nullptr, this, nullptr);
+
+	for(auto &child : root->children)
+		delete child;
+
+	root->children.clear();
+	root->fetched = false;
+	obj_nodes.clear();
+	this->db_model = db_model;
+
+	if(db_model)
+	{
+		connect(db_model, &DatabaseModel::s_objectAdded, this, &ModelObjectsTreeModel::handleObjectAdded);
+		connect(db_model, &DatabaseModel::s_objectRemoved, this, &ModelObjectsTreeModel::handleObjectRemoved);
+	}
+
+	endResetModel();
+}
+
+void ModelObjectsTreeModel::setObjectTypesVisible(const std::map<ObjectType, bool> &visible_types)
+{
+	this->visible_types = visible_types;
+}
+
+bool ModelObjectsTreeModel::isTypeVisible(ObjectType obj_type) const
+{
+	auto itr = visible_types.find(obj_type);
+	return itr != visible_types.end() && itr->second;
+}
+
+ModelObjectsTreeModel::TreeNode *ModelObjectsTreeModel::getNode(const QModelIndex &index) const
+{
+	if(!index.isValid())
+		return root;
+
+	return static_cast<TreeNode *>(index.internalPointer());
+}
+
+QModelIndex ModelObjectsTreeModel::getIndex(TreeNode *node, int column) const
+{
+	if(!node || node == root)
+		return QModelIndex();
+
+	return createIndex(node->row, column, node);
+}
+
+BaseObject *ModelObjectsTreeModel::getObject(const QModelIndex &index)
+{
+	if(!index.isValid())
+		return nullptr;
+
+	return reinterpret_cast<BaseObject *>(index.siblingAtColumn(NameColumn).data(Qt::UserRole).value<void *>());
+}
+
+ObjectType ModelObjectsTreeModel::getObjectType(const QModelIndex &index)
+{
+	if(!index.isValid())
+		return ObjectType::BaseObject;
+
+	return static_cast<ObjectType>(index.siblingAtColumn(IdColumn).data(Qt::UserRole).toUInt());
+}
+
+std::vector<BaseObject *> ModelObjectsTreeModel::getSchemaObjects(ObjectType obj_type, BaseObject *schema)
+{
+	if(!use_cache)
+		return db_model->getObjects(obj_type, schema);
+
+	if(schema_objs_cache.count(obj_type) == 0)
+	{
+		std::map<BaseObject *, std::vector<BaseObject *>> &objs_map = schema_objs_cache[obj_type];
+		std::vector<BaseObject *> *obj_list = db_model->getObjectList(obj_type);
+
+		if(obj_list)
+		{
+			for(auto &obj : *obj_list)
+				objs_map[obj->getSchema()].push_back(obj);
+		}
+	}
+
+	auto itr = schema_objs_cache[obj_type].find(schema);
+
+	if(itr == schema_objs_cache[obj_type].end())
+		return {};
+
+	return itr->second;
+}
+
+std::vector<BaseObject *> ModelObjectsTreeModel::getGroupObjects(TreeNode *group)
+{
+	std::vector<BaseObject *> objects;
+	BaseObject *owner = group->parent ? group->parent->object : nullptr;
+
+	if(!db_model || !owner)
+		return objects;
+
+	if(owner->getObjectType() == ObjectType::Database)
+	{
+		std::vector<BaseObject *> *obj_list = db_model->getObjectList(group->obj_type);
+
+		if(obj_list)
+			objects = *obj_list;
+
+		//Special case for relationship, merging the base relationship list to the relationship list
+		if(group->obj_type == ObjectType::Relationship)
+		{
+			obj_list = db_model->getObjectList(ObjectType::BaseRelationship);
+			objects.insert(objects.end(), obj_list->begin(), obj_list->end());
+		}
+	}
+	else if(owner->getObjectType() == ObjectType::Schema)
+		objects = getSchemaObjects(group->obj_type, owner);
+	else
+	{
+		BaseTable *table = dynamic_cast<BaseTable *>(owner);
+
+		if(table)
+		{
+			unsigned count = table->getObjectCount(group->obj_type);
+
+			for(unsigned idx = 0; idx < count; idx++)
+				objects.push_back(table->getObject(idx, group->obj_type));
+		}
+	}
+
+	return objects;
+}
+
+std::vector<ModelObjectsTreeModel::ChildInfo> ModelObjectsTreeModel::getChildrenInfo(TreeNode *node)
+{
+	std::vector<ChildInfo> infos;
+
+	if(!db_model)
+		return infos;
+
+	if(node->kind == RootNode)
+	{
+		if(isTypeVisible(ObjectType::Database))
+			infos.push_back({ ObjectNode, db_model, ObjectType::Database });
+	}
+	else if(node->kind == GroupNode)
+	{
+		for(auto &obj : getGroupObjects(node))
+			infos.push_back({ ObjectNode, obj, obj->getObjectType() });
+	}
+	else if(node->kind == ObjectNode)
+	{
+		std::vector<ObjectType> types;
+
+		if(node->obj_type == ObjectType::Tag)
+		{
+			std::vector<BaseObject *> refs;
+			db_model->getObjectReferences(node->object, refs);
+
+			for(auto &ref : refs)
+				infos.push_back({ ReferenceNode, ref, ref->getObjectType() });
+
+			return infos;
+		}
+
+		if(isTypeVisible(ObjectType::Permission) && Permission::acceptsPermission(node->obj_type))
+			infos.push_back({ PermissionNode, node->object, ObjectType::Permission });
+
+		if(node->obj_type == ObjectType::Database)
+		{
+			types = BaseObject::getChildObjectTypes(ObjectType::Database);
+			types.push_back(ObjectType::Tag);
+			types.push_back(ObjectType::GenericSql);
+			types.push_back(ObjectType::Textbox);
+			types.push_back(ObjectType::Relationship);
+
+			//Placing the schema group as the first one
+			types.erase(std::find(types.begin(), types.end(), ObjectType::Schema));
+			types.insert(types.begin(), ObjectType::Schema);
+		}
+		else if(node->obj_type == ObjectType::Schema)
+		{
+			types = BaseObject::getChildObjectTypes(ObjectType::Schema);
+
+			//Placing the tables, foreign tables and views groups as the first ones
+			for(auto &type : { ObjectType::View, ObjectType::ForeignTable, ObjectType::Table })
+			{
+				types.erase(std::find(types.begin(), types.end(), type));
+				types.insert(types.begin(), type);
+			}
+		}
+		else if(BaseTable::isBaseTable(node->obj_type))
+			types = BaseObject::getChildObjectTypes(node->obj_type);
+
+		for(auto &type : types)
+		{
+			if(isTypeVisible(type))
+				infos.push_back({ GroupNode, node->object, type });
+		}
+	}
+
+	return infos;
+}
+
+bool ModelObjectsTreeModel::hasChildNodes(TreeNode *node) const
+{
+	if(node->fetched)
+		return !node->children.empty();
+
+	if(node->kind == RootNode)
+		return db_model != nullptr;
+
+	if(node->kind == GroupNode)
+		return node->count > 0;
+
+	if(node->kind == ObjectNode)
+	{
+		return node->obj_type == ObjectType::Database || node->obj_type == ObjectType::Schema ||
+					 node->obj_type == ObjectType::Tag || BaseTable::isBaseTable(node->obj_type) ||
+					 (isTypeVisible(ObjectType::Permission) && Permission::acceptsPermission(node->obj_type));
+	}
+
+	return false;
+}
+
+QString ModelObjectsTreeModel::getObjectText(BaseObject *object)
+{
+	ObjectType obj_type = object->getObjectType();
+	QString text;
+
+	if(obj_type == ObjectType::Function)
+	{
+		Function *func = dynamic_cast<Function *>(object);
+		func->createSignature(false);
+		text = func->getSignature();
+		func->createSignature(true);
+	}
+	else if(obj_type == ObjectType::Operator)
+		text = dynamic_cast<Operator *>(object)->getSignature(false);
+	else if(obj_type == ObjectType::OpClass || obj_type == ObjectType::OpFamily)
+	{
+		text = object->getSignature(false);
+		text.replace(QRegularExpression("( )+(USING)( )+"), QString(" ["));
+		text += QChar(']');
+	}
+	else
+		text = object->getName();
+
+	return text;
+}
+
+void ModelObjectsTreeModel::configureNode(TreeNode *node)
+{
+	if(node->kind == GroupNode)
+	{
+		if(node->parent && node->parent->object &&
+			 BaseTable::isBaseTable(node->parent->obj_type))
+			node->count = dynamic_cast<BaseTable *>(node->parent->object)->getObjectCount(node->obj_type);
+		else
+			node->count = getGroupObjects(node).size();
+
+		node->text = QString("%1 (%2)").arg(BaseObject::getTypeName(node->obj_type)).arg(node->count);
+		node->icon = BaseObject::getSchemaName(node->obj_type);
+		node->italic = true;
+	}
+	else if(node->kind == PermissionNode)
+	{
+		std::vector<Permission *> perms;
+
+		db_model->getPermissions(node->object, perms);
+		node->count = perms.size();
+		node->text = QString("%1 (%2)").arg(BaseObject::getTypeName(ObjectType::Permission)).arg(node->count);
+		node->icon = QString("permission");
+		node->italic = true;
+	}
+	else if(node->kind == ObjectNode || node->kind == ReferenceNode)
+	{
+		BaseObject *object = node->object;
+		TableObject *tab_obj = dynamic_cast<TableObject *>(object);
+		ObjectType obj_type = node->obj_type;
+		QString str_aux;
+
+		node->text = getObjectText(object);
+
+		node->tooltip = QString("%1 (id: %2)").arg(node->text).arg(object->getObjectId());
+		node->id_text = QString::number(object->getObjectId());
+		node->strike_out = object->isSQLDisabled() && !object->isSystemObject();
+		node->rel_added = tab_obj && tab_obj->isAddedByRelationship();
+		node->protected_obj = !node->rel_added && (object->isProtected() || object->isSystemObject());
+		node->italic = node->rel_added || node->protected_obj;
+
+		if(obj_type == ObjectType::BaseRelationship || obj_type == ObjectType::Relationship)
+		{
+			BaseRelationship::RelType rel_type = dynamic_cast<BaseRelationship *>(object)->getRelationshipType();
+
+			if(obj_type == ObjectType::BaseRelationship)
+				str_aux = rel_type == BaseRelationship::RelationshipFk ? "fk" : "tv";
+			else if(rel_type == BaseRelationship::Relationship11)
+				str_aux = "11";
+			else if(rel_type == BaseRelationship::Relationship1n)
+				str_aux = "1n";
+			else if(rel_type == BaseRelationship::RelationshipNn)
+				str_aux = "nn";
+			else if(rel_type == BaseRelationship::RelationshipDep)
+				str_aux = "dep";
+			else if(rel_type == BaseRelationship::RelationshipGen)
+				str_aux = "gen";
+		}
+		else if(obj_type == ObjectType::Constraint)
+		{
+			ConstraintType constr_type = dynamic_cast<Constraint *>(object)->getConstraintType();
+
+			if(constr_type == ConstraintType::PrimaryKey)
+				str_aux = QString("_%1").arg(TableObjectView::TextPrimaryKey);
+			else if(constr_type == ConstraintType::ForeignKey)
+				str_aux = QString("_%1").arg(TableObjectView::TextForeignKey);
+			else if(constr_type == ConstraintType::Check)
+				str_aux = QString("_%1").arg(TableObjectView::TextCheck);
+			else if(constr_type == ConstraintType::Unique)
+				str_aux = QString("_%1").arg(TableObjectView::TextUnique);
+			else if(constr_type == ConstraintType::Exclude)
+				str_aux = QString("_%1").arg(TableObjectView::TextExclude);
+		}
+
+		node->icon = BaseObject::getSchemaName(obj_type) + str_aux;
+	}
+}
+
+ModelObjectsTreeModel::TreeNode *ModelObjectsTreeModel::createNode(const ChildInfo &info, TreeNode *parent)
+{
+	TreeNode *node = new TreeNode(info.kind, info.object, info.obj_type, parent);
+
+	configureNode(node);
+	registerNode(node, false);
+
+	return node;
+}
+
+void ModelObjectsTreeModel::registerNode(TreeNode *node, bool unregister)
+{
+	if(node->kind == ObjectNode || node->kind == ReferenceNode)
+	{
+		if(unregister)
+			obj_nodes.remove(node->object, node);
+		else
+			obj_nodes.insert(node->object, node);
+	}
+
+	if(unregister)
+	{
+		for(auto &child : node->children)
+			registerNode(child, true);
+	}
+}
+
+void ModelObjectsTreeModel::insertNodes(TreeNode *parent, const std::vector<ChildInfo> &infos)
+{
+	if(infos.empty())
+		return;
+
+	int first = parent->children.size();
+
+	beginInsertRows(getIndex(parent), first, first + infos.size() - 1);
+	parent->children.reserve(parent->children.size() + infos.size());
+
+	for(auto &info : infos)
+	{
+		TreeNode *node = createNode(info, parent);
+		node->row = parent->children.size();
+		parent->children.push_back(node);
+	}
+
+	endInsertRows();
+}
+
+void ModelObjectsTreeModel::removeNode(TreeNode *node)
+{
+	TreeNode *parent = node->parent;
+	int row = node->row;
+
+	beginRemoveRows(getIndex(parent), row, row);
+	parent->children.erase(parent->children.begin() + row);
+
+	for(int idx = row; idx < static_cast<int>(parent->children.size()); idx++)
+		parent->children[idx]->row = idx;
+
+	registerNode(node, true);
+	delete node;
+	endRemoveRows();
+}
+
+void ModelObjectsTreeModel::updateNode(TreeNode *node)
+{
+	if(!node->fetched)
+		return;
+
+	std::vector<ChildInfo> infos = getChildrenInfo(node), new_infos;
+	std::set<std::tuple<NodeKind, BaseObject *, ObjectType>> curr_keys, child_keys;
+
+	for(auto &info : infos)
+		curr_keys.insert({ info.kind, info.object, info.obj_type });
+
+	//Removing the items that aren't in the model anymore
+	for(int row = node->children.size() - 1; row >= 0; row--)
+	{
+		TreeNode *child = node->children[row];
+
+		if(curr_keys.count({ child->kind, child->object, child->obj_type }) == 0)
+			removeNode(child);
+		else
+			child_keys.insert({ child->kind, child->object, child->obj_type });
+	}
+
+	//Updating the remaining items (renamed objects, counters, etc) and their children
+	for(auto &child : node->children)
+	{
+		QString text = child->text, icon = child->icon;
+		bool strike_out = child->strike_out, italic = child->italic;
+
+		configureNode(child);
+
+		if(text != child->text || icon != child->icon ||
+			 strike_out != child->strike_out || italic != child->italic)
+			emit dataChanged(getIndex(child, NameColumn), getIndex(child, IdColumn));
+
+		updateNode(child);
+	}
+
+	for(auto &info : infos)
+	{
+		if(child_keys.count({ info.kind, info.object, info.obj_type }) == 0)
+			new_infos.push_back(info);
+	}
+
+	insertNodes(node, new_infos);
+}
+
+void ModelObjectsTreeModel::updateModel()
+{
+	use_cache = true;
+	schema_objs_cache.clear();
+	updateNode(root);
+	schema_objs_cache.clear();
+	use_cache = false;
+}
+
+void ModelObjectsTreeModel::fetchAll(const QModelIndex &parent)
+{
+	if(canFetchMore(parent))
+		fetchMore(parent);
+
+	TreeNode *node = getNode(parent);
+
+	for(auto &child : node->children)
+		fetchAll(getIndex(child));
+}
+
+void ModelObjectsTreeModel::fetchMatching(const QRegularExpression &expr, ColumnId column)
+{
+	if(!db_model)
+		return;
+
+	std::vector<ObjectType> types;
+	QString text;
+
+	fetchMore(QModelIndex());
+
+	for(auto &itr : visible_types)
+	{
+		if(itr.second && itr.first != ObjectType::Database && itr.first != ObjectType::Permission)
+			types.push_back(itr.first);
+	}
+
+	/* Only the branches (schema, table) that lead to a matching object are fetched,
+	 * the remaining items are created on demand when the user expands them */
+	for(auto &obj : db_model->findObjects("*", types, false, false, false))
+	{
+		if(column == IdColumn)
+			text = QString::number(obj->getObjectId());
+		else
+			text = getObjectText(obj);
+
+		if(expr.match(text).hasMatch())
+			getObjectIndex(obj);
+	}
+}
+
+ModelObjectsTreeModel::TreeNode *ModelObjectsTreeModel::getGroupNode(TreeNode *parent, ObjectType obj_type)
+{
+	if(!parent)
+		return nullptr;
+
+	if(obj_type == ObjectType::BaseRelationship)
+		obj_type = ObjectType::Relationship;
+
+	for(auto &child : parent->children)
+	{
+		if(child->kind == GroupNode && child->obj_type == obj_type)
+			return child;
+	}
+
+	return nullptr;
+}
+
+QModelIndex ModelObjectsTreeModel::getObjectIndex(BaseObject *object)
+{
+	if(!db_model || !object)
+		return QModelIndex();
+
+	std::vector<BaseObject *> path;
+	TableObject *tab_obj = dynamic_cast<TableObject *>(object);
+	TreeNode *node = root, *child_node = nullptr;
+
+	//Determining the objects (schema, table) that must be expanded until the item of the object is reached
+	path.push_back(object);
+
+	if(tab_obj && tab_obj->getParentTable())
+	{
+		path.insert(path.begin(), tab_obj->getParentTable());
+
+		if(tab_obj->getParentTable()->getSchema())
+			path.insert(path.begin(), tab_obj->getParentTable()->getSchema());
+	}
+	else if(object->getSchema())
+		path.insert(path.begin(), object->getSchema());
+
+	fetchMore(QModelIndex());
+
+	if(root->children.empty() || root->children[0]->object != db_model)
+		return QModelIndex();
+
+	node = root->children[0];
+
+	if(object == db_model)
+		return getIndex(node);
+
+	for(auto &obj : path)
+	{
+		fetchMore(getIndex(node));
+		node = getGroupNode(node, obj->getObjectType());
+
+		if(!node)
+			return QModelIndex();
+
+		fetchMore(getIndex(node));
+		child_node = nullptr;
+
+		for(auto &child : node->children)
+		{
+			if(child->object == obj)
+			{
+				child_node = child;
+				break;
+			}
+		}
+
+		if(!child_node)
+			return QModelIndex();
+
+		node = child_node;
+	}
+
+	return getIndex(node);
+}
+
+int ModelObjectsTreeModel::rowCount(const QModelIndex &parent) const
+{
+	if(parent.column() > 0)
+		return 0;
+
+	return getNode(parent)->children.size();
+}
+
+int ModelObjectsTreeModel::columnCount(const QModelIndex &) const
+{
+	return 2;
+}
+
+QModelIndex ModelObjectsTreeModel::index(int row, int column, const QModelIndex &parent) const
+{
+	TreeNode *node = getNode(parent);
+
+	if(row < 0 || column < 0 || column >= columnCount() ||
+		 row >= static_cast<int>(node->children.size()))
+		return QModelIndex();
+
+	return createIndex(row, column, node->children[row]);
+}
+
+QModelIndex ModelObjectsTreeModel::parent(const QModelIndex &index) const
+{
+	if(!index.isValid())
+		return QModelIndex();
+
+	return getIndex(getNode(index)->parent);
+}
+
+bool ModelObjectsTreeModel::hasChildren(const QModelIndex &parent) const
+{
+	if(parent.column() > 0)
+		return false;
+
+	return hasChildNodes(getNode(parent));
+}
+
+bool ModelObjectsTreeModel::canFetchMore(const QModelIndex &parent) const
+{
+	return !getNode(parent)->fetched;
+}
+
+void ModelObjectsTreeModel::fetchMore(const QModelIndex &parent)
+{
+	TreeNode *node = getNode(parent);
+
+	if(node->fetched)
+		return;
+
+	node->fetched = true;
+	insertNodes(node, getChildrenInfo(node));
+}
+
+QVariant ModelObjectsTreeModel::data(const QModelIndex &index, int role) const
+{
+	if(!index.isValid())
+		return QVariant();
+
+	TreeNode *node = getNode(index);
+
+	if(index.column() == IdColumn)
+	{
+		if(role == Qt::DisplayRole)
+			return node->id_text;
+
+		if(role == Qt::UserRole)
+			return QVariant(enum_t(node->obj_type));
+
+		return QVariant();
+	}
+
+	if(role == Qt::DisplayRole)
+		return node->text;
+
+	if(role == Qt::ToolTipRole)
+		return node->tooltip;
+
+	if(role == Qt::UserRole)
+		return QVariant::fromValue(reinterpret_cast<void *>(node->kind == GroupNode ? nullptr : node->object));
+
+	if(role == Qt::DecorationRole)
+	{
+		if(!icons.contains(node->icon))
+			icons[node->icon] = QIcon(QPixmap(GuiUtilsNs::getIconPath(node->icon)));
+
+		return icons[node->icon];
+	}
+
+	if(role == Qt::FontRole)
+	{
+		QFont font;
+		font.setStrikeOut(node->strike_out);
+		font.setItalic(node->italic);
+		return font;
+	}
+
+	if(role == Qt::ForegroundRole)
+	{
+		if(node->rel_added)
+			return ObjectsTableWidget::getTableItemColor(ObjectsTableWidget::RelAddedItemAltFgColor);
+
+		if(node->protected_obj)
+			return ObjectsTableWidget::getTableItemColor(ObjectsTableWidget::ProtItemAltFgColor);
+	}
+
+	return QVariant();
+}
+
+Qt::ItemFlags ModelObjectsTreeModel::flags(const QModelIndex &index) const
+{
+	if(!index.isValid())
+		return Qt::NoItemFlags;
+
+	return Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+}
+
+void ModelObjectsTreeModel::handleObjectAdded(BaseObject *object)
+{
+	if(!object || !root->fetched || root->children.empty() ||
+		 TableObject::isTableObject(object->getObjectType()) ||
+		 object->getObjectType() == ObjectType::Permission)
+		return;
+
+	TreeNode *parent = root->children[0], *group = nullptr;
+
+	if(object->getSchema())
+	{
+		parent = nullptr;
+
+		for(auto &node : obj_nodes.values(object->getSchema()))
+		{
+			if(node->kind == ObjectNode)
+			{
+				parent = node;
+				break;
+			}
+		}
+	}
+
+	if(!parent || !parent->fetched)
+		return;
+
+	group = getGroupNode(parent, object->getObjectType());
+
+	if(!group)
+		return;
+
+	// The object is already listed in the group, so the node and the group's count are kept untouched
+	for(auto &node : obj_nodes.values(object))
+	{
+		if(node->parent == group)
+			return;
+	}
+
+	/* The count is updated incrementally instead of recounting the group's objects via configureNode()
+	 * avoiding a quadratic cost when many objects are added at once (e.g. pasting or importing) */
+	group->count++;
+	group->text = QString("%1 (%2)").arg(BaseObject::getTypeName(group->obj_type)).arg(group->count);
+	emit dataChanged(getIndex(group, NameColumn), getIndex(group, IdColumn));
+
+	if(group->fetched)
+		insertNodes(group, {{ ObjectNode, object, object->getObjectType() }});
+}
+
+void ModelObjectsTreeModel::handleObjectRemoved(BaseObject *object)
+{
+	TreeNode *node = nullptr, *parent = nullptr;
+
+	while((node = obj_nodes.value(object, nullptr)))
+	{
+		parent = node->parent;
+		removeNode(node);
+
+		if(parent->kind == GroupNode)
+		{
+			parent->count = parent->children.size();
+			parent->text = QString("%1 (%2)").arg(BaseObject::getTypeName(parent->obj_type)).arg(parent->count);
+			emit dataChanged(getIndex(parent, NameColumn), getIndex(parent, IdColumn));
+		}
+	}
+}
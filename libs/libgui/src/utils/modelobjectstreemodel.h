@@ -0,0 +1,204 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libgui
+\class ModelObjectsTreeModel
+\brief Implements a hierarchical item model over a DatabaseModel used by ModelObjectsWidget to show the object tree.
+The children of each item are only created when the item is expanded (see canFetchMore() / fetchMore()) and
+the model is kept in sync with the database model by applying deltas (inserted, removed and renamed items)
+instead of being rebuilt, so the expansion state of the view is preserved between updates.
+*/
+
+#ifndef MODEL_OBJECTS_TREE_MODEL_H
+#define MODEL_OBJECTS_TREE_MODEL_H
+
+#include "guiglobal.h"
+#include <QAbstractItemModel>
+#include <QFont>
+#include <QIcon>
+#include <QHash>
+#include <QRegularExpression>
+#include "databasemodel.h"
+
+class __libgui ModelObjectsTreeModel: public QAbstractItemModel {
+	private:
+		Q_OBJECT
+
+		//! \brief The kinds of item handled by the model
+		enum NodeKind: unsigned {
+			RootNode,
+			ObjectNode,
+			GroupNode,
+			PermissionNode,
+			//! \brief An object referenced by a tag (child of a tag item)
+			ReferenceNode
+		};
+
+		/*! \brief Stores the data of a single tree item. The object's attributes that are displayed
+		 * are cached in the node so the view never dereferences the object outside an update */
+		struct TreeNode {
+			NodeKind kind;
+			BaseObject *object;
+			ObjectType obj_type;
+			TreeNode *parent;
+			std::vector<TreeNode *> children;
+
+			//! \brief The position of the node in its parent's children list
+			int row;
+
+			//! \brief The amount of objects in a group node or permissions in a permission node
+			unsigned count;
+
+			bool fetched;
+			QString text, id_text, tooltip, icon;
+			bool strike_out, italic, rel_added, protected_obj;
+
+			TreeNode(NodeKind kind, BaseObject *object, ObjectType obj_type, TreeNode *parent) :
+				kind(kind), object(object), obj_type(obj_type), parent(parent), row(0), count(0), fetched(false),
+				strike_out(false), italic(false), rel_added(false), protected_obj(false) {}
+
+			~TreeNode();
+		};
+
+		/*! \brief Describes a child that a node should contain. Used to compare the current
+		 * children of a node against the ones the database model currently provides */
+		struct ChildInfo {
+			NodeKind kind;
+			BaseObject *object;
+			ObjectType obj_type;
+		};
+
+		//! \brief Reference database model
+		DatabaseModel *db_model;
+
+		//! \brief The invisible root item
+		TreeNode *root;
+
+		//! \brief Stores which object types are visible on the tree
+		std::map<ObjectType, bool> visible_types;
+
+		//! \brief Maps each object to the nodes representing it (an object can be listed under a tag too)
+		QMultiHash<BaseObject *, TreeNode *> obj_nodes;
+
+		/*! \brief Stores the objects of each type grouped by schema. This cache is filled on demand
+		 * during a full update to avoid scanning the object lists once per schema */
+		std::map<ObjectType, std::map<BaseObject *, std::vector<BaseObject *>>> schema_objs_cache;
+
+		//! \brief Indicates that schema_objs_cache can be used (only during updateModel())
+		bool use_cache;
+
+		//! \brief Cached icons to avoid loading pixmaps every time an item is painted
+		mutable QHash<QString, QIcon> icons;
+
+		bool isTypeVisible(ObjectType obj_type) const;
+
+		TreeNode *getNode(const QModelIndex &index) const;
+
+		QModelIndex getIndex(TreeNode *node, int column = 0) const;
+
+		//! \brief Returns the objects that belong to a group node
+		std::vector<BaseObject *> getGroupObjects(TreeNode *group);
+
+		//! \brief Returns the schema-level objects of a type that belong to the provided schema
+		std::vector<BaseObject *> getSchemaObjects(ObjectType obj_type, BaseObject *schema);
+
+		//! \brief Returns the list of children the node must have according to the current state of the database model
+		std::vector<ChildInfo> getChildrenInfo(TreeNode *node);
+
+		//! \brief Indicates if the node has (or could have) children without building them
+		bool hasChildNodes(TreeNode *node) const;
+
+		TreeNode *createNode(const ChildInfo &info, TreeNode *parent);
+
+		//! \brief Returns the text that represents the object in the tree (name or signature)
+		static QString getObjectText(BaseObject *object);
+
+		//! \brief Caches in the node the attributes of its object (name, icon, font style)
+		void configureNode(TreeNode *node);
+
+		//! \brief Registers/unregisters the node and its descendants in the object-node mapping
+		void registerNode(TreeNode *node, bool unregister);
+
+		void insertNodes(TreeNode *parent, const std::vector<ChildInfo> &infos);
+
+		void removeNode(TreeNode *node);
+
+		/*! \brief Compares the children of the node with the current state of the database model
+		 * applying the differences. Only fetched nodes have their children compared */
+		void updateNode(TreeNode *node);
+
+		//! \brief Returns the group node of the provided type at the database or schema level
+		TreeNode *getGroupNode(TreeNode *parent, ObjectType obj_type);
+
+	public:
+		enum ColumnId: int {
+			NameColumn,
+			IdColumn
+		};
+
+		ModelObjectsTreeModel(QObject *parent = nullptr);
+		virtual ~ModelObjectsTreeModel();
+
+		//! \brief Defines the database model used to populate the tree. This will reset the model.
+		void setDatabaseModel(DatabaseModel *db_model);
+
+		/*! \brief Defines the object types visible in the tree. The groups of the affected types
+		 * are only inserted/removed in the next call to updateModel() */
+		void setObjectTypesVisible(const std::map<ObjectType, bool> &visible_types);
+
+		/*! \brief Updates the tree by applying only the differences between the items already built
+		 * and the current state of the database model */
+		void updateModel();
+
+		//! \brief Creates all the items of the tree (used by the expand all operation)
+		void fetchAll(const QModelIndex &parent = QModelIndex());
+
+		/*! \brief Creates only the items needed to reach the objects of the visible types whose text in the provided
+		 * column matches the expression, so the filtering of the tree doesn't need to create all items */
+		void fetchMatching(const QRegularExpression &expr, ColumnId column);
+
+		/*! \brief Returns the index of the item that represents the object creating (fetching) the
+		 * intermediate items as needed. An invalid index is returned if the object isn't in the tree */
+		QModelIndex getObjectIndex(BaseObject *object);
+
+		//! \brief Returns the object held by the index (for permission items the object that owns the permissions)
+		static BaseObject *getObject(const QModelIndex &index);
+
+		//! \brief Returns the type of the object or group held by the index
+		static ObjectType getObjectType(const QModelIndex &index);
+
+		virtual int rowCount(const QModelIndex &parent = QModelIndex()) const;
+		virtual int columnCount(const QModelIndex &parent = QModelIndex()) const;
+		virtual QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const;
+		virtual QModelIndex parent(const QModelIndex &index) const;
+		virtual bool hasChildren(const QModelIndex &parent = QModelIndex()) const;
+		virtual bool canFetchMore(const QModelIndex &parent) const;
+		virtual void fetchMore(const QModelIndex &parent);
+		virtual QVariant data(const QModelIndex &index, int role) const;
+		virtual Qt::ItemFlags flags(const QModelIndex &index) const;
+
+	private slots:
+		//! \brief Inserts the item for an object recently added to the database model
+		void handleObjectAdded(BaseObject *object);
+
+		//! \brief Removes the item(s) of an object recently removed from the database model
+		void handleObjectRemoved(BaseObject *object);
+};
+
+#endif
@@ -0,0 +1,275 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "pngstreamwriter.h"
+#include "exception.h"
+#include <QApplication>
+#include <QtEndian>
+#include <zlib.h>
+
+PngStreamWriter::PngStreamWriter()
+{
+	width = height = rows_written = 0;
+}
+
+PngStreamWriter::~PngStreamWriter()
+{
+	endStream();
+
+	if(output.isOpen())
+		output.close();
+}
+
+void PngStreamWriter::writeChunk(const QByteArray &type, const QByteArray &data)
+{
+	QByteArray buffer;
+	uLong crc = ::crc32(0, Z_NULL, 0);
+
+	crc = ::crc32(crc, reinterpret_cast<const Bytef *>(type.constData()), type.size());
+	crc = ::crc32(crc, reinterpret_cast<const Bytef *>(data.constData()), data.size());
+
+	buffer.reserve(data.size() + 12);
+	buffer.append(4, 0);
+	qToBigEndian<quint32>(data.size(), buffer.data());
+	buffer.append(type);
+	buffer.append(data);
+	buffer.append(4, 0);
+	qToBigEndian<quint32>(crc, buffer.data() + buffer.size() - 4);
+
+	if(output.write(buffer) != buffer.size())
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(output.fileName()),
+										ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+}
+
+void PngStreamWriter::flushData(bool force)
+{
+	if(pending_data.size() >= ChunkSize || (force && !pending_data.isEmpty()))
+	{
+		writeChunk("IDAT", pending_data);
+		pending_data.clear();
+	}
+}
+
+void PngStreamWriter::compress(const uchar *data, int size, bool finish)
+{
+	static constexpr int OutBufSize = 65536;
+	Bytef out_buf[OutBufSize];
+	int ret = Z_OK;
+
+	if(!zstream)
+		return;
+
+	zstream->next_in = const_cast<Bytef *>(data);
+	zstream->avail_in = size;
+
+	// Running deflate until all the input is consumed (or the stream is finished) collecting the output
+	do
+	{
+		zstream->next_out = out_buf;
+		zstream->avail_out = OutBufSize;
+		ret = deflate(zstream.get(), finish ? Z_FINISH : Z_NO_FLUSH);
+
+		if(ret == Z_STREAM_ERROR)
+		{
+			throw Exception(QApplication::translate("PngStreamWriter","Failed to compress the data of the image `%1'!","", -1).arg(output.fileName()),
+											__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		}
+
+		pending_data.append(reinterpret_cast<const char *>(out_buf), OutBufSize - zstream->avail_out);
+	}
+	while(zstream->avail_out == 0 || (finish && ret != Z_STREAM_END));
+}
+
+void PngStreamWriter::endStream()
+{
+	if(!zstream)
+		return;
+
+	deflateEnd(zstream.get());
+	zstream.reset();
+}
+
+void PngStreamWriter::writeRow(const uchar *rgb_row)
+{
+	int row_size = width * 3;
+	const uchar *prev = reinterpret_cast<const uchar *>(prev_row.constData());
+	uchar *filt = reinterpret_cast<uchar *>(filt_row.data());
+
+	/* Rows equal to the previous one use the "up" filter (all bytes become zero),
+	 * the others use the "sub" filter (difference to the pixel at the left) */
+	if(rows_written > 0 && memcmp(prev, rgb_row, row_size) == 0)
+	{
+		filt[0] = 2;
+		memset(filt + 1, 0, row_size);
+	}
+	else
+	{
+		filt[0] = 1;
+
+		for(int i = 0; i < row_size; i++)
+			filt[i + 1] = rgb_row[i] - (i >= 3 ? rgb_row[i - 3] : 0);
+
+		memcpy(prev_row.data(), rgb_row, row_size);
+	}
+
+	compress(filt, row_size + 1);
+	rows_written++;
+}
+
+void PngStreamWriter::open(const QString &filename, unsigned width, unsigned height)
+{
+	endStream();
+
+	if(output.isOpen())
+		output.close();
+
+	output.setFileName(filename);
+
+	if(width == 0 || height == 0 || !output.open(QFile::WriteOnly | QFile::Truncate))
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
+										ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	QByteArray header(13, 0);
+
+	this->width = width;
+	this->height = height;
+	rows_written = 0;
+	prev_row = QByteArray(width * 3, 0);
+	filt_row = QByteArray(width * 3 + 1, 0);
+	pending_data.clear();
+
+	/* The fastest compression level is used since the filtered rows of diagrams are mostly
+	 * long sequences of the same byte which are compressed well even at that level */
+	zstream = std::make_unique<z_stream_s>();
+
+	if(deflateInit(zstream.get(), Z_BEST_SPEED) != Z_OK)
+	{
+		zstream.reset();
+		output.close();
+		output.remove();
+		throw Exception(QApplication::translate("PngStreamWriter","Failed to compress the data of the image `%1'!","", -1).arg(filename),
+										__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	output.write("\x89PNG\r\n\x1A\n", 8);
+
+	// IHDR: 8 bits per channel, truecolor (RGB), no interlace
+	qToBigEndian<quint32>(width, header.data());
+	qToBigEndian<quint32>(height, header.data() + 4);
+	header[8] = 8;
+	header[9] = 2;
+	writeChunk("IHDR", header);
+}
+
+void PngStreamWriter::writeRows(const std::vector<QImage> &tiles)
+{
+	if(!output.isOpen() || tiles.empty())
+		return;
+
+	int band_height = tiles.front().height();
+	unsigned band_width = 0;
+	std::vector<QImage> rgb_tiles;
+
+	for(auto &tile : tiles)
+	{
+		if(tile.height() != band_height)
+			band_height = -1;
+
+		band_width += tile.width();
+		rgb_tiles.push_back(tile.format() == QImage::Format_RGB888 ? tile : tile.convertToFormat(QImage::Format_RGB888));
+	}
+
+	if(band_height < 0 || band_width != width || rows_written + band_height > height)
+	{
+		throw Exception(QApplication::translate("PngStreamWriter","The rows provided don't fit the dimensions of the image `%1' (%2x%3)!","", -1)
+										.arg(output.fileName()).arg(width).arg(height),
+										__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	QByteArray row(width * 3, 0);
+	int pos = 0, tile_row_size = 0;
+
+	for(int y = 0; y < band_height; y++)
+	{
+		pos = 0;
+
+		for(auto &tile : rgb_tiles)
+		{
+			tile_row_size = tile.width() * 3;
+			memcpy(row.data() + pos, tile.constScanLine(y), tile_row_size);
+			pos += tile_row_size;
+		}
+
+		writeRow(reinterpret_cast<const uchar *>(row.constData()));
+	}
+
+	flushData(false);
+}
+
+void PngStreamWriter::writeRows(const QImage &band)
+{
+	writeRows(std::vector<QImage>{ band });
+}
+
+void PngStreamWriter::close()
+{
+	if(!output.isOpen())
+		return;
+
+	if(rows_written != height)
+	{
+		QString filename = output.fileName();
+
+		// The incomplete image is removed since it can't be decoded
+		output.remove();
+		throw Exception(QApplication::translate("PngStreamWriter","The image `%1' was closed before all its rows were written!","", -1).arg(filename),
+										__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	compress(nullptr, 0, true);
+	endStream();
+	flushData(true);
+
+	writeChunk("IEND", QByteArray());
+	output.close();
+}
+
+void PngStreamWriter::discard()
+{
+	endStream();
+
+	if(!output.isOpen())
+		return;
+
+	output.close();
+	output.remove();
+}
+
+bool PngStreamWriter::isOpen()
+{
+	return output.isOpen();
+}
+
+unsigned PngStreamWriter::getRowsWritten()
+{
+	return rows_written;
+}
@@ -0,0 +1,108 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libgui
+\class PngStreamWriter
+\brief Implements a PNG encoder that receives the image rows incrementally (band by band) and writes them
+to the output file as they arrive, so images that don't fit in memory (e.g. huge exported diagrams) can be produced.
+The image data is written as 8-bit RGB and compressed with zlib in streaming mode.
+*/
+
+#ifndef PNG_STREAM_WRITER_H
+#define PNG_STREAM_WRITER_H
+
+#include "guiglobal.h"
+#include <QFile>
+#include <QImage>
+#include <vector>
+#include <memory>
+
+struct z_stream_s;
+
+class __libgui PngStreamWriter {
+	private:
+		//! \brief Amount of compressed bytes accumulated before a IDAT chunk is written
+		static constexpr int ChunkSize = 262144;
+
+		QFile output;
+
+		//! \brief The dimensions of the image being written
+		unsigned width, height,
+
+		//! \brief The amount of rows already written
+		rows_written;
+
+		//! \brief The zlib stream that compresses the image data
+		std::unique_ptr<z_stream_s> zstream;
+
+		//! \brief Compressed data not yet written in an IDAT chunk
+		QByteArray pending_data;
+
+		//! \brief The previous row (unfiltered) used to apply the "up" filter on identical rows
+		QByteArray prev_row;
+
+		//! \brief Filtered row buffer (reused between rows to avoid allocations)
+		QByteArray filt_row;
+
+		//! \brief Writes a complete PNG chunk (length, type, data and CRC) to the output
+		void writeChunk(const QByteArray &type, const QByteArray &data);
+
+		//! \brief Writes the compressed data accumulated so far as IDAT chunk(s)
+		void flushData(bool force);
+
+		/*! \brief Compresses the provided bytes appending the output to the pending data. When finish is true
+		 * the zlib stream is finished (no more data can be compressed) */
+		void compress(const uchar *data, int size, bool finish = false);
+
+		//! \brief Releases the zlib stream (if allocated)
+		void endStream();
+
+		//! \brief Filters and compresses a single row of RGB pixels
+		void writeRow(const uchar *rgb_row);
+
+	public:
+		PngStreamWriter();
+		~PngStreamWriter();
+
+		/*! \brief Creates the output file and writes the PNG header for an image with the provided dimensions.
+		 * An exception is raised if the file can't be written */
+		void open(const QString &filename, unsigned width, unsigned height);
+
+		/*! \brief Appends a band of rows to the image. The band is composed by the provided tiles which are placed
+		 * side by side (from left to right), so they must have the same height and their widths summed must be equal
+		 * to the image's width. This avoids the composition of the tiles into a single (wide) image */
+		void writeRows(const std::vector<QImage> &tiles);
+
+		//! \brief Appends a band of rows to the image. The band's width must be equal to the image's width
+		void writeRows(const QImage &band);
+
+		/*! \brief Finishes the compressed stream and closes the file. An exception is raised
+		 * (and the incomplete file is removed) if the amount of rows written is different from the image's height */
+		void close();
+
+		//! \brief Closes and removes the file being written without finishing the image
+		void discard();
+
+		bool isOpen();
+
+		//! \brief Returns the amount of rows written so far
+		unsigned getRowsWritten();
+};
+
+#endif
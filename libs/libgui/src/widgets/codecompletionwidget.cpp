@@ -100,8 +100,9 @@ bool CodeCompletionWidget::eventFilter(QObject *object, QEvent *event)
 	{
 		if(object==code_field_txt)
 		{
-			//Filters the trigger char and shows up the code completion only if there is a valid database model in use
-			if(k_event->key() == completion_trigger.unicode() && db_model)
+			/* Filters the trigger char and shows up the code completion only if there is a valid database model
+			 * or a live connection catalog in use */
+			if(k_event->key() == completion_trigger.unicode() && (db_model || !catalog_conn_params.empty()))
 			{
 				/* If the completion widget is not visible start the timer to give the user
 				a small delay in order to type another character. If no char is typed the completion is triggered */
@@ -251,6 +252,24 @@ void CodeCompletionWidget::configureCompletion(DatabaseModel *db_model, SyntaxHi
 	}
 }
 
+void CodeCompletionWidget::setCatalogConnection(const attribs_map &conn_params)
+{
+	try
+	{
+		catalog_conn_params.clear();
+
+		if(conn_params.empty())
+			return;
+
+		CompletionCatalog::refresh(conn_params);
+		catalog_conn_params = conn_params;
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
 void CodeCompletionWidget::insertCustomItem(const QString &name, const QString &tooltip, const QPixmap &icon)
 {
 	if(!name.isEmpty())
@@ -354,10 +373,99 @@ void CodeCompletionWidget::setQualifyingLevel(BaseObject *obj)
 	}
 }
 
+void CodeCompletionWidget::getTypedReference(QStringList &qualifiers, QString &prefix)
+{
+	QTextCursor tc=code_field_txt->textCursor();
+	QString text=tc.block().text().left(tc.positionInBlock()), name;
+	int pos=text.size(), prefix_len=0;
+	bool quoted=false;
+	QChar chr;
+
+	qualifiers.clear();
+	prefix.clear();
+
+	//Walking backwards while the chars can compose a qualified name (quoted names may contain any char)
+	while(pos > 0)
+	{
+		chr=text.at(pos - 1);
+
+		if(chr==QChar('"'))
+			quoted=!quoted;
+		else if(!quoted && !chr.isLetterOrNumber() && chr!=QChar('_') && chr!=QChar('$') && chr!=completion_trigger)
+			break;
+
+		pos--;
+	}
+
+	quoted=false;
+
+	for(auto &ref_chr : text.mid(pos))
+	{
+		prefix_len++;
+
+		if(ref_chr==QChar('"'))
+			quoted=!quoted;
+		else if(!quoted && ref_chr==completion_trigger)
+		{
+			qualifiers.append(name);
+			name.clear();
+			prefix_len=0;
+		}
+		else
+			name.append(ref_chr);
+	}
+
+	prefix=name;
+
+	//Selects the typed prefix so it is replaced by the name selected on the list
+	new_txt_cur=tc;
+	new_txt_cur.movePosition(QTextCursor::PreviousCharacter, QTextCursor::KeepAnchor, prefix_len);
+}
+
+void CodeCompletionWidget::populateCatalogList(const QStringList &qualifiers, const QString &prefix)
+{
+	QListWidgetItem *item=nullptr;
+	QString item_text, name, tooltip;
+	std::shared_ptr<const CompletionIndex> index;
+
+	/* The refresh runs in background and only when the index of the connection is outdated,
+	 * meanwhile the current index is used to list the names */
+	CompletionCatalog::refresh(catalog_conn_params);
+	index=CompletionCatalog::getIndex(catalog_conn_params);
+
+	if(!index)
+		return;
+
+	for(auto &cat_item : index->find(qualifiers, prefix))
+	{
+		item_text=cat_item->name;
+		tooltip=BaseObject::getTypeName(cat_item->obj_type);
+		name=BaseObject::formatName(cat_item->name);
+
+		//Names that can't be formatted (e.g. containing quotes) are inserted as they are
+		if(name.isEmpty())
+			name=cat_item->name;
+
+		if(cat_item->obj_type==ObjectType::Function)
+			item_text+=QString("(%1)").arg(cat_item->signature);
+
+		if(cat_item->obj_type==ObjectType::Column)
+			tooltip+=QString(" (%1)").arg(cat_item->signature);
+		else if(!cat_item->schema.isEmpty())
+			tooltip+=QString(" (%1)").arg(cat_item->schema);
+
+		item=new QListWidgetItem(QPixmap(GuiUtilsNs::getIconPath(cat_item->obj_type)), item_text);
+		item->setToolTip(tooltip);
+		item->setData(CatalogNameRole, name);
+		name_list->addItem(item);
+	}
+}
+
 void CodeCompletionWidget::updateList()
 {
 	QListWidgetItem *item=nullptr;
-	QString pattern;
+	QString pattern, cat_prefix;
+	QStringList cat_qualifiers;
 	std::vector<BaseObject *> objects;
 	std::vector<ObjectType> types=BaseObject::getObjectTypes(false, 	{ ObjectType::Textbox, ObjectType::Relationship, ObjectType::BaseRelationship });
 	QTextCursor tc;
@@ -452,10 +560,16 @@ void CodeCompletionWidget::updateList()
 
 		populateNameList(objects, word);
 	}
+	else if(!catalog_conn_params.empty())
+	{
+		getTypedReference(cat_qualifiers, cat_prefix);
+		populateCatalogList(cat_qualifiers, cat_prefix);
+	}
 
 	/* List the keywords if the qualifying level is negative or the
-	completion wasn't triggered using the special char */
-	if(qualifying_level < 0 && !auto_triggered)
+	completion wasn't triggered using the special char. Keywords are
+	not listed after a qualifier typed in a live connection catalog completion */
+	if(qualifying_level < 0 && !auto_triggered && cat_qualifiers.isEmpty())
 	{
 		QRegularExpression regexp(pattern, QRegularExpression::CaseInsensitiveOption);
 
@@ -555,6 +669,12 @@ void CodeCompletionWidget::selectItem()
 			insertObjectName(object);
 			setQualifyingLevel(object);
 		}
+		//Names from the catalog of live connections are inserted without a trailing space so they can be qualified
+		else if(!item->data(CatalogNameRole).isNull())
+		{
+			code_field_txt->insertPlainText(item->data(CatalogNameRole).toString());
+			setQualifyingLevel(nullptr);
+		}
 		else
 		{
 			code_field_txt->insertPlainText(item->text() + QString(" "));
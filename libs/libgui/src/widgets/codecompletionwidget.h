@@ -20,7 +20,8 @@
 \ingroup libgui
 \class CodeCompletionWidget
 \brief Widget that handles the code completion (keywords and model object names) on a field that has
-the syntax highlighter installed on it.
+the syntax highlighter installed on it. When there is no model assigned the object names can be retrieved
+from the catalog of a live database connection (see setCatalogConnection()).
 */
 
 #ifndef CODE_COMPLETION_WIDGET_H
@@ -29,12 +30,16 @@ the syntax highlighter installed on it.
 #include <QWidget>
 #include "utils/syntaxhighlighter.h"
 #include "databasemodel.h"
+#include "completioncatalog.h"
 
 class __libgui CodeCompletionWidget: public QWidget
 {
 	private:
 		Q_OBJECT
 
+		//! \brief Item data role that stores the name inserted by the items listed from the catalog of a live connection
+		static constexpr int CatalogNameRole = Qt::UserRole + 1;
+
 		//! \brief A timer that controls the completion popup
 		QTimer popup_timer;
 		
@@ -72,6 +77,10 @@ class __libgui CodeCompletionWidget: public QWidget
 		
 		//! \brief Stores the database model used to search for objects and list them on completion
 		DatabaseModel *db_model;
+
+		/*! \brief Stores the parameters of the connection which catalog is used to list object names
+		 * when there is no database model assigned (see CompletionCatalog) */
+		attribs_map catalog_conn_params;
 		
 		/*! \brief This is used to simulate an history of selected object
 		whenever the user types the completion trigger char. An example of qualifying is access a column
@@ -103,6 +112,14 @@ class __libgui CodeCompletionWidget: public QWidget
 		
 		//! \brief Configures the current qualifying level according to the passed object
 		void setQualifyingLevel(BaseObject *obj);
+
+		/*! \brief Splits the (possibly qualified) name typed right before the cursor in the qualifiers and the prefix
+		 * of the name being typed, e.g. public.customer.na results in { public, customer } and na. The text cursor used
+		 * to replace the prefix by the selected name is configured by this method */
+		void getTypedReference(QStringList &qualifiers, QString &prefix);
+
+		//! \brief Inserts into the name listing the objects from the catalog of the connection that match the qualifiers and the prefix
+		void populateCatalogList(const QStringList &qualifiers, const QString &prefix);
 		
 	public:
 		CodeCompletionWidget(QPlainTextEdit *code_field_txt, bool enable_snippets = false);
@@ -112,6 +129,10 @@ class __libgui CodeCompletionWidget: public QWidget
 		highlighter uses an different configuration */
 		void configureCompletion(DatabaseModel *db_model, SyntaxHighlighter *syntax_hl=nullptr, const QString &keywords_grp=QString("keywords"));
 		
+		/*! \brief Configures the connection which catalog is used to list object names when there is no database model
+		 * assigned, starting the retrieval of the catalog in background. Empty parameters disable the catalog completion */
+		void setCatalogConnection(const attribs_map &conn_params);
+
 		//! \brief Inserts a custom named item on the list with a custom icon. Custom item will always appear at the beggining of the list
 		void insertCustomItem(const QString &name, const QString &tooltip, const QPixmap &icon);
 		
@@ -21,6 +21,7 @@
 #include "exception.h"
 #include <QTextStream>
 #include "utilsns.h"
+#include <QFileInfo>
 
 CsvLoadWidget::CsvLoadWidget(QWidget * parent, bool cols_in_first_row) : QWidget(parent)
 {
@@ -33,6 +34,7 @@ CsvLoadWidget::CsvLoadWidget(QWidget * parent, bool cols_in_first_row) : QWidget
 	load_csv_grid->addWidget(file_sel, 0, 1, 1, 8);
 
 	separator_edt->setVisible(false);
+	large_file_streaming = false;
 
 	if(cols_in_first_row)
 	{
@@ -78,12 +80,20 @@ void CsvLoadWidget::loadCsvFile()
 	try
 	{
 		CsvParser csv_parser;
-
-		csv_parser.setSpecialChars(getSeparator(),
-															 txt_delim_chk->isChecked() ? txt_delim_edt->text().at(0) : CsvDocument::TextDelimiter,
-															 CsvDocument::LineBreak);
+		QString filename = file_sel->getSelectedFile();
+
+		/* Large files aren't parsed into a document, instead, the receiver of the signal
+		 * is responsible to read them in batches */
+		if(large_file_streaming && QFileInfo(filename).size() >= LargeFileSize)
+		{
+			file_sel->clearSelector();
+			emit s_largeCsvFileSelected(filename);
+			return;
+		}
+
+		csv_parser.setSpecialChars(getSeparator(), getTextDelimiter(), CsvDocument::LineBreak);
 		csv_parser.setColumnInFirstRow(col_names_chk->isChecked());
-		csv_document = csv_parser.parseFile(file_sel->getSelectedFile());
+		csv_document = csv_parser.parseFile(filename);
 		file_sel->clearSelector();
 
 		emit s_csvFileLoaded();
@@ -101,6 +111,16 @@ QChar CsvLoadWidget::getSeparator()
 	return separators[separator_cmb->currentIndex()];
 }
 
+QChar CsvLoadWidget::getTextDelimiter()
+{
+	return txt_delim_chk->isChecked() && !txt_delim_edt->text().isEmpty() ? txt_delim_edt->text().at(0) : CsvDocument::TextDelimiter;
+}
+
+void CsvLoadWidget::setLargeFileStreaming(bool value)
+{
+	large_file_streaming = value;
+}
+
 bool CsvLoadWidget::isColumnsInFirstRow()
 {
 	return col_names_chk->isChecked();
@@ -43,7 +43,14 @@ class __libgui CsvLoadWidget : public QWidget, Ui::CsvLoadWidget {
 
 		CsvDocument csv_document;
 
+		/*! \brief Indicates that files larger than LargeFileSize are not parsed into a CsvDocument. Instead, the signal
+		 * s_largeCsvFileSelected() is emitted so the file can be read in batches (see CsvReader) */
+		bool large_file_streaming;
+
 	public:
+		//! \brief The size (in bytes) from which a file is considered too large to be loaded at once (see setLargeFileStreaming())
+		static constexpr qint64 LargeFileSize = 64 * 1024 * 1024;
+
 		CsvLoadWidget(QWidget * parent = nullptr, bool cols_in_first_row = true);
 
 		CsvDocument getCsvDocument();
@@ -52,6 +59,10 @@ class __libgui CsvLoadWidget : public QWidget, Ui::CsvLoadWidget {
 
 		QChar getSeparator();
 
+		QChar getTextDelimiter();
+
+		void setLargeFileStreaming(bool value);
+
 		/*! \brief Loads a csv document from a buffer. The user can specify the value separator, text delimiter and an object
 		 *  which will store the column names.In that case, the column names are only extracted from the first
 		 *  row if the cols_in_first_row is true */
@@ -62,6 +73,9 @@ class __libgui CsvLoadWidget : public QWidget, Ui::CsvLoadWidget {
 
 	signals:
 		void s_csvFileLoaded();
+
+		//! \brief Signal emitted in place of s_csvFileLoaded() when the selected file is larger than LargeFileSize (see setLargeFileStreaming())
+		void s_largeCsvFileSelected(const QString &filename);
 };
 
 #endif
@@ -17,7 +17,6 @@
 */
 
 #include "modelobjectswidget.h"
-#include "tools/databaseimportform.h"
 #include "guiutilsns.h"
 #include "settings/generalconfigwidget.h"
 #include "objectstablewidget.h"
@@ -29,11 +28,21 @@ ModelObjectsWidget::ModelObjectsWidget(bool simplified_view, QWidget *parent) :
 	obj_types_wgt = nullptr;
 	model_wgt=nullptr;
 	db_model=nullptr;
+	list_outdated=true;
+
+	tree_model = new ModelObjectsTreeModel(this);
+	tree_proxy_model = new QSortFilterProxyModel(this);
+	tree_proxy_model->setSourceModel(tree_model);
+	tree_proxy_model->setRecursiveFilteringEnabled(true);
+	tree_proxy_model->setFilterCaseSensitivity(Qt::CaseInsensitive);
+	tree_proxy_model->sort(ModelObjectsTreeModel::NameColumn, Qt::AscendingOrder);
+	objectstree_tw->setModel(tree_proxy_model);
+	objectstree_tw->setColumnHidden(ModelObjectsTreeModel::IdColumn, true);
+
 	setModel(db_model);
 
 	title_wgt->setVisible(!simplified_view);
 	this->simplified_view=simplified_view;
-	this->save_tree_state=!simplified_view;
 	enable_obj_creation=simplified_view;
 
 	select_tb->setVisible(simplified_view);
@@ -43,13 +52,13 @@ ModelObjectsWidget::ModelObjectsWidget(bool simplified_view, QWidget *parent) :
 	filter_wgt->setVisible(simplified_view);
 	splitter->handle(1)->setEnabled(false);
 
-	connect(objectstree_tw, &QTreeWidget::itemPressed, this, &ModelObjectsWidget::selectObject);
-	connect(objectstree_tw, &QTreeWidget::itemPressed, this, &ModelObjectsWidget::showObjectMenu);
+	connect(objectstree_tw, &QTreeView::pressed, this, &ModelObjectsWidget::selectObject);
+	connect(objectstree_tw, &QTreeView::pressed, this, &ModelObjectsWidget::showObjectMenu);
 	connect(objectslist_tbw, &QTableWidget::itemPressed, this, &ModelObjectsWidget::selectObject);
 	connect(objectslist_tbw, &QTableWidget::itemPressed, this, &ModelObjectsWidget::showObjectMenu);
-	connect(objectstree_tw, &QTreeWidget::itemSelectionChanged, this, &ModelObjectsWidget::selectObject);
+	connect(objectstree_tw->selectionModel(), &QItemSelectionModel::selectionChanged, this, &ModelObjectsWidget::selectObject);
 	connect(objectslist_tbw, &QTableWidget::itemSelectionChanged, this, &ModelObjectsWidget::selectObject);
-	connect(expand_all_tb, &QToolButton::clicked, objectstree_tw, &QTreeWidget::expandAll);
+	connect(expand_all_tb, &QToolButton::clicked, this, &ModelObjectsWidget::expandAll);
 	connect(collapse_all_tb, &QToolButton::clicked, this, &ModelObjectsWidget::collapseAll);
 
 	if(!simplified_view)
@@ -69,7 +78,7 @@ ModelObjectsWidget::ModelObjectsWidget(bool simplified_view, QWidget *parent) :
 			setAllObjectsVisible(state == Qt::Checked);
 		});
 
-		connect(objectstree_tw, &QTreeWidget::itemDoubleClicked, this, &ModelObjectsWidget::editObject);
+		connect(objectstree_tw, &QTreeView::doubleClicked, this, &ModelObjectsWidget::editObject);
 		connect(objectslist_tbw, &QTableWidget::itemDoubleClicked, this, &ModelObjectsWidget::editObject);
 		connect(hide_tb, &QToolButton::clicked, this, &ModelObjectsWidget::hide);
 
@@ -84,7 +93,7 @@ ModelObjectsWidget::ModelObjectsWidget(bool simplified_view, QWidget *parent) :
 		setMinimumSize(250, 300);
 		setWindowModality(Qt::ApplicationModal);
 		setWindowFlags(Qt::Dialog | Qt::WindowCloseButtonHint | Qt::WindowTitleHint);
-		connect(objectstree_tw, &QTreeWidget::itemDoubleClicked, this, &ModelObjectsWidget::close);
+		connect(objectstree_tw, &QTreeView::doubleClicked, this, &ModelObjectsWidget::close);
 		connect(objectslist_tbw, &QTableWidget::itemDoubleClicked, this, &ModelObjectsWidget::close);
 		connect(select_tb, &QToolButton::clicked, this, &ModelObjectsWidget::close);
 		connect(cancel_tb, &QToolButton::clicked, this, &ModelObjectsWidget::close);
@@ -138,9 +147,9 @@ void ModelObjectsWidget::editObject()
 	if(selected_objs.size() == 1 && model_wgt && !simplified_view)
 	{
 		//If the user double-clicked the item "Permission (n)" on tree view
-		if(sender()==objectstree_tw && objectstree_tw->currentItem() &&
-			 objectstree_tw->currentItem()->data(1, Qt::UserRole).toUInt() == enum_t(ObjectType::Permission))
-			model_wgt->showObjectForm(ObjectType::Permission, reinterpret_cast<BaseObject *>(objectstree_tw->currentItem()->data(0, Qt::UserRole).value<void *>()));
+		if(sender()==objectstree_tw && objectstree_tw->currentIndex().isValid() &&
+			 ModelObjectsTreeModel::getObjectType(objectstree_tw->currentIndex()) == ObjectType::Permission)
+			model_wgt->showObjectForm(ObjectType::Permission, ModelObjectsTreeModel::getObject(objectstree_tw->currentIndex()));
 		//If the user double-clicked a permission on  list view
 		else if(sender() == objectslist_tbw && objectslist_tbw->currentRow() >= 0)
 		{
@@ -174,16 +183,19 @@ void ModelObjectsWidget::selectObject()
 
 	if(tree_view_tb->isChecked())
 	{
-		QTreeWidgetItem *tree_item = objectstree_tw->currentItem();
+		QModelIndex tree_idx = objectstree_tw->currentIndex();
 
-		if(tree_item)
+		if(tree_idx.isValid())
 		{
-			obj_type = static_cast<ObjectType>(tree_item->data(1,Qt::UserRole).toUInt());
-			selected_obj = reinterpret_cast<BaseObject *>(tree_item->data(0,Qt::UserRole).value<void *>());
+			obj_type = ModelObjectsTreeModel::getObjectType(tree_idx);
+			selected_obj = ModelObjectsTreeModel::getObject(tree_idx);
 
-			for(auto &item : objectstree_tw->selectedItems())
+			for(auto &idx : objectstree_tw->selectionModel()->selectedIndexes())
 			{
-				selected_obj = reinterpret_cast<BaseObject *>(item->data(0,Qt::UserRole).value<void *>());
+				if(idx.column() != ModelObjectsTreeModel::NameColumn)
+					continue;
+
+				selected_obj = ModelObjectsTreeModel::getObject(idx);
 
 				if(selected_obj)
 					selected_objs.push_back(selected_obj);
@@ -251,122 +263,6 @@ void ModelObjectsWidget::selectObject()
 	}
 }
 
-QVariant ModelObjectsWidget::generateItemValue(BaseObject *object)
-{
-	return QVariant::fromValue(reinterpret_cast<void *>(object));
-}
-
-QTreeWidgetItem *ModelObjectsWidget::createItemForObject(BaseObject *object, QTreeWidgetItem *root, bool update_perms)
-{
-	QTreeWidgetItem *item=nullptr;
-	QFont font;
-	QString str_aux;
-	BaseRelationship::RelType rel_type;
-	ConstraintType constr_type;
-	ObjectType obj_type;
-	TableObject *tab_obj=nullptr;
-	QString obj_name;
-
-	if(!object)
-		throw Exception(ErrorCode::OprNotAllocatedObject ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-
-	obj_type=object->getObjectType();
-	tab_obj=dynamic_cast<TableObject *>(object);
-	item=new QTreeWidgetItem(root);
-
-	if(obj_type==ObjectType::Function)
-	{
-		Function *func=dynamic_cast<Function *>(object);
-		func->createSignature(false);
-		item->setText(0,func->getSignature());
-		obj_name=func->getSignature();
-		func->createSignature(true);
-	}
-	else if(obj_type==ObjectType::Operator)
-	{
-		Operator *oper=dynamic_cast<Operator *>(object);
-		item->setText(0, oper->getSignature(false));
-		obj_name=oper->getSignature(false);
-	}
-	else if(obj_type==ObjectType::OpClass || obj_type == ObjectType::OpFamily)
-	{
-		obj_name=object->getSignature(false);
-		obj_name.replace(QRegularExpression("( )+(USING)( )+"), QString(" ["));
-		obj_name+=QChar(']');
-		item->setText(0,obj_name);
-	}
-	else
-	{
-		item->setText(0,object->getName());
-		obj_name=object->getName();
-	}
-
-	item->setToolTip(0, QString("%1 (id: %2)").arg(obj_name).arg(object->getObjectId()));
-	item->setData(0, Qt::UserRole, generateItemValue(object));
-	item->setText(1, QString::number(object->getObjectId()));
-
-	if(update_perms)
-		updatePermissionTree(item, object);
-
-	font=item->font(0);
-	font.setStrikeOut(object->isSQLDisabled() && !object->isSystemObject());
-
-	if(tab_obj && tab_obj->isAddedByRelationship())
-	{
-		font.setItalic(true);
-		item->setForeground(0, ObjectsTableWidget::getTableItemColor(ObjectsTableWidget::RelAddedItemAltFgColor));
-	}
-	else if(object->isProtected() || object->isSystemObject())
-	{
-		font.setItalic(true);
-		item->setForeground(0, ObjectsTableWidget::getTableItemColor(ObjectsTableWidget::ProtItemAltFgColor));
-	}
-
-	item->setFont(0,font);
-
-	if(obj_type==ObjectType::BaseRelationship || obj_type==ObjectType::Relationship)
-	{
-		rel_type=dynamic_cast<BaseRelationship *>(object)->getRelationshipType();
-
-		if(obj_type==ObjectType::BaseRelationship)
-		{
-			if(rel_type==BaseRelationship::RelationshipFk)
-				str_aux=QString("fk");
-			else
-				str_aux=QString("tv");
-		}
-		else if(rel_type==BaseRelationship::Relationship11)
-			str_aux=QString("11");
-		else if(rel_type==BaseRelationship::Relationship1n)
-			str_aux=QString("1n");
-		else if(rel_type==BaseRelationship::RelationshipNn)
-			str_aux=QString("nn");
-		else if(rel_type==BaseRelationship::RelationshipDep)
-			str_aux=QString("dep");
-		else if(rel_type==BaseRelationship::RelationshipGen)
-			str_aux=QString("gen");
-	}
-	else if(obj_type==ObjectType::Constraint)
-	{
-		constr_type=dynamic_cast<Constraint *>(object)->getConstraintType();
-
-		if(constr_type==ConstraintType::PrimaryKey)
-			str_aux=QString("_%1").arg(TableObjectView::TextPrimaryKey);
-		else if(constr_type==ConstraintType::ForeignKey)
-			str_aux=QString("_%1").arg(TableObjectView::TextForeignKey);
-		else if(constr_type==ConstraintType::Check)
-			str_aux=QString("_%1").arg(TableObjectView::TextCheck);
-		else if(constr_type==ConstraintType::Unique)
-			str_aux=QString("_%1").arg(TableObjectView::TextUnique);
-		else if(constr_type==ConstraintType::Exclude)
-			str_aux=QString("_%1").arg(TableObjectView::TextExclude);
-	}
-
-	item->setIcon(0, QPixmap(GuiUtilsNs::getIconPath(BaseObject::getSchemaName(obj_type) + str_aux)));
-
-	return item;
-}
-
 void ModelObjectsWidget::setObjectVisible(ObjectType obj_type, bool visible)
 {
 	if(obj_type!=ObjectType::BaseObject && obj_type!=ObjectType::BaseTable)
@@ -408,6 +304,14 @@ void ModelObjectsWidget::changeObjectsView()
 		tree_view_tb->setChecked(sender()==tree_view_tb);
 		list_view_tb->setChecked(sender()==list_view_tb);
 		by_id_chk->setEnabled(sender()==tree_view_tb);
+
+		if(list_view_tb->isChecked() && list_outdated)
+		{
+			updateObjectsList();
+
+			if(!filter_edt->text().isEmpty())
+				filterObjects();
+		}
 	}
 	else if(sender()==options_tb)
 	{
@@ -426,399 +330,162 @@ void ModelObjectsWidget::changeObjectsView()
 
 void ModelObjectsWidget::collapseAll()
 {
-	QTreeWidgetItem *root=objectstree_tw->topLevelItem(0);
 	objectstree_tw->collapseAll();
+	objectstree_tw->expand(tree_proxy_model->index(0, 0));
+}
 
-	if(root)
-		root->setExpanded(true);
+void ModelObjectsWidget::expandAll()
+{
+	QApplication::setOverrideCursor(Qt::WaitCursor);
+	tree_model->fetchAll();
+	objectstree_tw->expandAll();
+	QApplication::restoreOverrideCursor();
 }
 
 void ModelObjectsWidget::filterObjects()
 {
 	if(tree_view_tb->isChecked())
 	{
-		DatabaseImportForm::filterObjects(objectstree_tw, filter_edt->text(), (by_id_chk->isChecked() ? 1 : 0), simplified_view);
-	}
-	else
-	{
-		QList<QTableWidgetItem*> items=objectslist_tbw->findItems(filter_edt->text(), Qt::MatchStartsWith | Qt::MatchRecursive);
+		QString pattern = QRegularExpression::escape(filter_edt->text());
+		QRegularExpression filter_expr;
 
-		objectslist_tbw->blockSignals(true);
-		for(int row=0; row < objectslist_tbw->rowCount(); row++)
-			objectslist_tbw->setRowHidden(row, true);
+		objectstree_tw->selectionModel()->blockSignals(true);
+		objectstree_tw->clearSelection();
 
-		while(!items.isEmpty())
+		if(by_id_chk->isChecked())
 		{
-			objectslist_tbw->setRowHidden(items.front()->row(), false);
-			items.pop_front();
+			filter_expr = QRegularExpression(QString("^(0)*(%1)(.)*").arg(pattern));
+			tree_proxy_model->setFilterKeyColumn(ModelObjectsTreeModel::IdColumn);
+		}
+		else
+		{
+			filter_expr = QRegularExpression(QString("^%1").arg(pattern), QRegularExpression::CaseInsensitiveOption);
+			tree_proxy_model->setFilterKeyColumn(ModelObjectsTreeModel::NameColumn);
 		}
 
-		objectslist_tbw->blockSignals(false);
-	}
-}
-
-void ModelObjectsWidget::updateObjectsView()
-{
-	selected_objs.clear();
-	updateDatabaseTree();
-	updateObjectsList();
-
-	if(!filter_edt->text().isEmpty())
-		filterObjects();
-}
-
-void ModelObjectsWidget::updateObjectsList()
-{
-	std::vector<BaseObject *> objects;
-
-	if(db_model)
-	{
-		std::vector<ObjectType> visible_types;
-
-		for(auto &tp : visible_objs_map)
+		/* The items not yet fetched are invisible to the proxy model so the branches
+		 * that lead to the matching objects are populated prior to filtering the tree */
+		if(!pattern.isEmpty())
 		{
-			if(tp.second)
-				visible_types.push_back(tp.first);
+			tree_model->fetchMatching(filter_expr, by_id_chk->isChecked() ?
+																	ModelObjectsTreeModel::IdColumn : ModelObjectsTreeModel::NameColumn);
 		}
 
-		objects = db_model->findObjects("*", visible_types, false, false, false);
-	}
+		tree_proxy_model->setFilterRegularExpression(filter_expr);
 
-	GuiUtilsNs::updateObjectTable(objectslist_tbw, objects);
-	objectslist_tbw->clearSelection();
-}
-
-void ModelObjectsWidget::updateSchemaTree(QTreeWidgetItem *root)
-{
-	if(db_model && visible_objs_map[ObjectType::Schema])
-	{
-		BaseObject *schema=nullptr;
-		std::vector<BaseObject *> obj_list;
-		QFont font;
-		QTreeWidgetItem *item=nullptr, *item1=nullptr, *item2=nullptr, *item3=nullptr;
-		std::vector<ObjectType> types = BaseObject::getChildObjectTypes(ObjectType::Schema);
-		int count = 0, count2 = 0, i = 0;
-		QPixmap group_icon=QPixmap(GuiUtilsNs::getIconPath(QString(BaseObject::getSchemaName(ObjectType::Schema))));
-
-		//Removing the ObjectType::Table and ObjectType::View types since they are handled separetedly
-		types.erase(std::find(types.begin(), types.end(), ObjectType::Table));
-		types.erase(std::find(types.begin(), types.end(), ObjectType::ForeignTable));
-		types.erase(std::find(types.begin(), types.end(), ObjectType::View));
-
-		//Get the current schema count on database
-		count=(db_model->getObjectCount(ObjectType::Schema));
-		item=new QTreeWidgetItem(root);
-		item->setIcon(0,group_icon);
-		item->setData(1, Qt::UserRole, QVariant(enum_t(ObjectType::Schema)));
-
-		//Create the schema group item
-		item->setText(0, QString("%1 (%2)").arg(BaseObject::getTypeName(ObjectType::Schema)).arg(count));
-		font=item->font(0);
-		font.setItalic(true);
-		item->setFont(0, font);
-
-		try
+		if(pattern.isEmpty())
+			collapseAll();
+		else
 		{
-			for(i=0; i < count; i++)
+			QModelIndexList indexes = { tree_proxy_model->index(0, 0) };
+			QModelIndex idx;
+
+			/* Expanding only the items already fetched (the ones leading to the matching objects)
+			 * since QTreeView::expandAll() would fetch the children of every visible item */
+			while(!indexes.isEmpty())
 			{
-				//The first item is the public schema
-				if(i==-1)
-				{
-					//The new sub item to be configured will be the public schema item
-					item2=item1;
-					schema=nullptr;
-				}
-				else
-				{
-					schema=db_model->getObject(i, ObjectType::Schema);
-					item2=createItemForObject(schema, item);
-				}
+				idx = indexes.takeFirst();
 
-				//Updates the table subtree for the current schema
-				updateTableTree(item2, schema, ObjectType::Table);
+				if(!idx.isValid() || tree_proxy_model->canFetchMore(idx))
+					continue;
 
-				//Updates the foreign table subtree for the current schema
-				updateTableTree(item2, schema, ObjectType::ForeignTable);
+				objectstree_tw->expand(idx);
 
-				//Updates the view subtree for the current schema
-				updateViewTree(item2, schema);
+				for(int row = 0; row < tree_proxy_model->rowCount(idx); row++)
+					indexes.append(tree_proxy_model->index(row, 0, idx));
+			}
 
-				//Creates the object group at schema level (function, domain, sequences, etc)
-				for(auto type : types)
-				{
-					if(visible_objs_map[type])
-					{
-						item3=new QTreeWidgetItem(item2);
-						item3->setIcon(0,QPixmap(GuiUtilsNs::getIconPath(BaseObject::getSchemaName(type))));
+			//Selecting the single leaf item found (in simplified view)
+			if(simplified_view)
+			{
+				QModelIndexList indexes = { tree_proxy_model->index(0, 0) }, leaves;
+				QModelIndex idx;
 
-						//Get the objects that belongs to the current schema
-						obj_list=db_model->getObjects(type, schema);
+				while(!indexes.isEmpty())
+				{
+					idx = indexes.takeFirst();
 
-						count2=obj_list.size();
-						item3->setText(0, QString("%1 (%2)").arg(BaseObject::getTypeName(type)).arg(count2));
-						item3->setData(1, Qt::UserRole, QVariant(enum_t(type)));
+					if(!idx.isValid())
+						continue;
 
-						font=item3->font(0);
-						font.setItalic(true);
-						item3->setFont(0, font);
+					if(tree_proxy_model->rowCount(idx) == 0 && idx.parent().isValid() &&
+						 tree_proxy_model->filterRegularExpression().match(idx.siblingAtColumn(tree_proxy_model->filterKeyColumn()).data().toString()).hasMatch())
+						leaves.append(idx);
 
-						for(auto obj : obj_list)
-							createItemForObject(obj, item3);
-					}
+					for(int row = 0; row < tree_proxy_model->rowCount(idx); row++)
+						indexes.append(tree_proxy_model->index(row, 0, idx));
 				}
-			}
-		}
-		catch(Exception &e)
-		{
-			throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
-		}
-	}
-}
 
-void ModelObjectsWidget::updateTableTree(QTreeWidgetItem *root, BaseObject *schema, ObjectType table_type)
-{
-	if(db_model && PhysicalTable::isPhysicalTable(table_type) && visible_objs_map[table_type])
-	{
-		std::vector<BaseObject *> obj_list;
-		PhysicalTable *table=nullptr;
-		QTreeWidgetItem *item=nullptr, *item1=nullptr, *item2=nullptr;
-		QFont font;
-		std::vector<ObjectType> types = BaseObject::getChildObjectTypes(table_type);
-		QPixmap group_icon=QPixmap(GuiUtilsNs::getIconPath(BaseObject::getSchemaName(table_type)));
-
-		try
-		{
-			//Get all tables that belongs to the specified schema
-			obj_list=db_model->getObjects(table_type, schema);
-
-			//Create a table group item
-			item=new QTreeWidgetItem(root);
-			item->setIcon(0,group_icon);
-			item->setText(0,BaseObject::getTypeName(table_type) +
-						  QString(" (%1)").arg(obj_list.size()));
-			item->setData(1, Qt::UserRole, QVariant(enum_t(table_type)));
-
-			font=item->font(0);
-			font.setItalic(true);
-			item->setFont(0, font);
-
-			for(auto obj : obj_list)
-			{
-				table=dynamic_cast<PhysicalTable *>(obj);
-				item1=createItemForObject(table, item);
-
-				//Creating the group for the child objects (column, rules, triggers, indexes and constraints)
-				for(auto type : types)
+				if(leaves.size() == 1)
 				{
-					if(visible_objs_map[type])
-					{
-						item2=new QTreeWidgetItem(item1);
-						item2->setIcon(0,QPixmap(GuiUtilsNs::getIconPath(BaseObject::getSchemaName(type))));
-						font=item2->font(0);
-						font.setItalic(true);
-						item2->setFont(0, font);
-
-						item2->setText(0, QString("%1 (%2)").arg(BaseObject::getTypeName(type)).arg(table->getObjectCount(type)));
-
-						for(auto tab_obj : *table->getObjectList(type))
-							createItemForObject(tab_obj, item2);
-					}
+					objectstree_tw->selectionModel()->select(leaves.front(), QItemSelectionModel::ClearAndSelect);
+					objectstree_tw->setCurrentIndex(leaves.front());
 				}
 			}
 		}
-		catch(Exception &e)
-		{
-			throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
-		}
-	}
-}
 
-void ModelObjectsWidget::updateViewTree(QTreeWidgetItem *root, BaseObject *schema)
-{
-	if(db_model && visible_objs_map[ObjectType::View])
+		objectstree_tw->selectionModel()->blockSignals(false);
+	}
+	else
 	{
-		BaseObject *object=nullptr;
-		std::vector<BaseObject *> obj_list;
-		View *view=nullptr;
-		QTreeWidgetItem *item=nullptr, *item1=nullptr, *item2=nullptr;
-		QFont font;
-		std::vector<ObjectType> types = BaseObject::getChildObjectTypes(ObjectType::View);
-		int count = 0, count1 = 0, i = 0, i2 = 0;
-		QPixmap group_icon=QPixmap(GuiUtilsNs::getIconPath(QString(BaseObject::getSchemaName(ObjectType::View))));
-
-		try
-		{
-			//Get all views that belongs to the specified schema
-			obj_list=db_model->getObjects(ObjectType::View, schema);
-
-			//Create a table group item
-			item=new QTreeWidgetItem(root);
-			item->setIcon(0,group_icon);
-			item->setText(0,BaseObject::getTypeName(ObjectType::View) + QString(" (%1)").arg(obj_list.size()));
-			item->setData(1, Qt::UserRole, QVariant(enum_t(ObjectType::View)));
-
-			font=item->font(0);
-			font.setItalic(true);
-			item->setFont(0, font);
-
-			count=obj_list.size();
+		QList<QTableWidgetItem*> items=objectslist_tbw->findItems(filter_edt->text(), Qt::MatchStartsWith | Qt::MatchRecursive);
 
-			for(i=0; i < count; i++)
-			{
-				view=dynamic_cast<View *>(obj_list[i]);
-				item1=createItemForObject(view, item);
+		objectslist_tbw->blockSignals(true);
+		for(int row=0; row < objectslist_tbw->rowCount(); row++)
+			objectslist_tbw->setRowHidden(row, true);
 
-				//Creating the group for the child objects (rules, triggers)
-				for(auto &type : types)
-				{
-					if(visible_objs_map[type])
-					{
-						item2=new QTreeWidgetItem(item1);
-						item2->setIcon(0,QPixmap(GuiUtilsNs::getIconPath(BaseObject::getSchemaName(type))));
-						font=item2->font(0);
-						font.setItalic(true);
-						item2->setFont(0, font);
-
-						count1 = view->getObjectCount(type);
-						item2->setText(0,BaseObject::getTypeName(type) + QString(" (%1)").arg(count1));
-
-						for(i2=0; i2 < count1; i2++)
-						{
-							object=view->getObject(i2, type);
-							createItemForObject(object, item2);
-						}
-					}
-				}
-			}
-		}
-		catch(Exception &e)
+		while(!items.isEmpty())
 		{
-			throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+			objectslist_tbw->setRowHidden(items.front()->row(), false);
+			items.pop_front();
 		}
+
+		objectslist_tbw->blockSignals(false);
 	}
 }
 
-void ModelObjectsWidget::updatePermissionTree(QTreeWidgetItem *root, BaseObject *object)
+void ModelObjectsWidget::updateObjectsView()
 {
-	try
-	{
-		if(db_model && visible_objs_map[ObjectType::Permission] &&
-				Permission::acceptsPermission(object->getObjectType()))
-		{
-			std::vector<Permission *> perms;
-			QTreeWidgetItem *item=new QTreeWidgetItem(root);
-			QFont font=item->font(0);
+	selected_objs.clear();
 
-			db_model->getPermissions(object, perms);
-			item->setIcon(0,QPixmap(GuiUtilsNs::getIconPath("permission")));
+	tree_model->setObjectTypesVisible(visible_objs_map);
+	tree_model->updateModel();
 
-			font.setItalic(true);
-			item->setFont(0, font);
-			item->setText(0, QString("%1 (%2)")
-							.arg(BaseObject::getTypeName(ObjectType::Permission))
-						  .arg(perms.size()));
+	if(tree_model->canFetchMore(QModelIndex()))
+		tree_model->fetchMore(QModelIndex());
 
-			item->setData(0, Qt::UserRole, generateItemValue(object));
-			item->setData(1, Qt::UserRole, static_cast<unsigned>(ObjectType::Permission));
-		}
-	}
-	catch(Exception &e)
-	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
-	}
-}
+	objectstree_tw->expand(tree_proxy_model->index(0, 0));
 
-void ModelObjectsWidget::updateDatabaseTree()
-{
-	if(!db_model)
-		objectstree_tw->clear();
-	else
-	{
-		QString str_aux;
-		BaseObject *object=nullptr;
-		QTreeWidgetItem *root=nullptr,*item1=nullptr, *item2=nullptr;
-		QFont font;
-		std::vector<BaseObject *> ref_list, tree_state, obj_list;
-		std::vector<ObjectType> types = BaseObject::getChildObjectTypes(ObjectType::Database);
-		unsigned count = 0, i = 0, i1 = 0;
-
-		types.push_back(ObjectType::Tag);
-		types.push_back(ObjectType::GenericSql);
-		types.push_back(ObjectType::Textbox);
-		types.push_back(ObjectType::Relationship);
-		types.erase(std::find(types.begin(), types.end(), ObjectType::Schema));
-
-		try
-		{
-			if(save_tree_state)
-				saveTreeState(tree_state);
+	//The objects list is only refreshed when visible, otherwise it's refreshed when activated
+	list_outdated = true;
 
-			//objectstree_tw->setUpdatesEnabled(false);
-			objectstree_tw->clear();
+	if(list_view_tb->isChecked())
+		updateObjectsList();
 
-			if(visible_objs_map[ObjectType::Database])
-			{
-				root=createItemForObject(db_model);
-				objectstree_tw->insertTopLevelItem(0,root);
-
-				updateSchemaTree(root);
+	if(!filter_edt->text().isEmpty())
+		filterObjects();
+}
 
-				for(auto &type : types)
-				{
-					if(visible_objs_map[type])
-					{
-						item1=new QTreeWidgetItem(root);
-						str_aux=QString(BaseObject::getSchemaName(type));
-
-						item1->setIcon(0,QPixmap(GuiUtilsNs::getIconPath(str_aux)));
-						item1->setData(1, Qt::UserRole, QVariant(enum_t(type)));
-
-						obj_list=(*db_model->getObjectList(type));
-
-						//Special case for relationship, merging the base relationship list to the relationship list
-						if(type==ObjectType::Relationship)
-						{
-							std::vector<BaseObject *> obj_list_aux;
-							obj_list_aux=(*db_model->getObjectList(ObjectType::BaseRelationship));
-							obj_list.insert(obj_list.end(), obj_list_aux.begin(), obj_list_aux.end());
-						}
-
-						count=obj_list.size();
-						item1->setText(0,BaseObject::getTypeName(type) + QString(" (%1)").arg(count));
-						font=item1->font(0);
-						font.setItalic(true);
-						item1->setFont(0, font);
-
-						for(i1=0; i1 < count; i1++)
-						{
-							object=obj_list.at(i1);
-							item2=createItemForObject(object, item1);
-
-							if(types[i]==ObjectType::Tag)
-							{
-								db_model->getObjectReferences(object, ref_list);
-
-								for(auto &ref : ref_list)
-									createItemForObject(ref, item2, false);
-							}
-						}
-					}
-				}
+void ModelObjectsWidget::updateObjectsList()
+{
+	std::vector<BaseObject *> objects;
 
-				//objectstree_tw->setUpdatesEnabled(true);
-				objectstree_tw->expandItem(root);
+	if(db_model)
+	{
+		std::vector<ObjectType> visible_types;
 
-				if(save_tree_state)
-					restoreTreeState(tree_state);
-			}
-		}
-		catch(Exception &e)
+		for(auto &tp : visible_objs_map)
 		{
-			throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+			if(tp.second)
+				visible_types.push_back(tp.first);
 		}
 
-		objectstree_tw->sortByColumn(0, Qt::AscendingOrder);
+		objects = db_model->findObjects("*", visible_types, false, false, false);
 	}
+
+	GuiUtilsNs::updateObjectTable(objectslist_tbw, objects);
+	objectslist_tbw->clearSelection();
+	list_outdated = false;
 }
 
 BaseObject *ModelObjectsWidget::getSelectedObject()
@@ -845,8 +512,8 @@ void ModelObjectsWidget::close()
 		QVariant data;
 		BaseObject *selected_obj = nullptr;
 
-		if(tree_view_tb->isChecked() && objectstree_tw->currentItem())
-			data = objectstree_tw->currentItem()->data(0,Qt::UserRole);
+		if(tree_view_tb->isChecked() && objectstree_tw->currentIndex().isValid())
+			data = objectstree_tw->currentIndex().siblingAtColumn(ModelObjectsTreeModel::NameColumn).data(Qt::UserRole);
 		else if(objectslist_tbw->currentItem())
 			data = objectslist_tbw->currentItem()->data(Qt::UserRole);
 
@@ -874,6 +541,7 @@ void ModelObjectsWidget::setModel(DatabaseModel *db_model)
 	bool enable = (db_model!=nullptr);
 
 	this->db_model=db_model;
+	tree_model->setDatabaseModel(db_model);
 	content_wgt->setEnabled(enable);
 	updateObjectsView();
 	visaoobjetos_stw->setEnabled(true);
@@ -970,18 +638,13 @@ void ModelObjectsWidget::resizeEvent(QResizeEvent *)
 	objectstree_tw->header()->setDefaultSectionSize(objectstree_tw->width());
 }
 
-void ModelObjectsWidget::saveTreeState(bool value)
-{
-	save_tree_state=(!simplified_view && value);
-}
-
 void ModelObjectsWidget::clearSelectedObject()
 {
-	objectstree_tw->blockSignals(true);
+	objectstree_tw->selectionModel()->blockSignals(true);
 	objectslist_tbw->blockSignals(true);
 	objectstree_tw->clearSelection();
 	objectslist_tbw->clearSelection();
-	objectstree_tw->blockSignals(false);
+	objectstree_tw->selectionModel()->blockSignals(false);
 	objectslist_tbw->blockSignals(false);
 	selected_objs.clear();
 	model_wgt->configurePopupMenu(nullptr);
@@ -990,88 +653,79 @@ void ModelObjectsWidget::clearSelectedObject()
 
 void ModelObjectsWidget::saveTreeState(std::vector<BaseObject *> &tree_items)
 {
-	QTreeWidgetItemIterator itr(objectstree_tw);
+	QModelIndexList indexes = { tree_proxy_model->index(0, 0) };
+	QModelIndex idx;
 	BaseObject *obj=nullptr;
-	QTreeWidgetItem *item=nullptr;
 
-	while(*itr)
+	//Only the items already fetched are visited since the others can't be expanded
+	while(!indexes.isEmpty())
 	{
-		item=*itr;
-		obj=reinterpret_cast<BaseObject *>(item->data(0,Qt::UserRole).value<void *>());
+		idx = indexes.takeFirst();
 
-		if(obj && item->parent() && item->parent()->isExpanded())
+		if(!idx.isValid())
+			continue;
+
+		obj = ModelObjectsTreeModel::getObject(idx);
+
+		if(obj && idx.parent().isValid() && objectstree_tw->isExpanded(idx.parent()))
 			tree_items.push_back(obj);
 
-		++itr;
+		for(int row = 0; row < tree_proxy_model->rowCount(idx); row++)
+			indexes.append(tree_proxy_model->index(row, 0, idx));
 	}
 }
 
 void ModelObjectsWidget::restoreTreeState(std::vector<BaseObject *> &tree_items)
 {
-	QTreeWidgetItem *item=nullptr, *parent_item=nullptr;
+	QModelIndex idx;
 
-	objectslist_tbw->setUpdatesEnabled(false);
+	objectstree_tw->setUpdatesEnabled(false);
 
 	while(!tree_items.empty())
 	{
-		item=getTreeItem(tree_items.back());
-
-		if(item)
-		{
-			parent_item=item->parent();
-
-			if(parent_item)
-				objectstree_tw->expandItem(parent_item);
+		idx = getTreeIndex(tree_items.back());
 
-			if(parent_item && parent_item->parent())
-				objectstree_tw->expandItem(parent_item->parent());
-		}
+		if(idx.isValid())
+			expandTreeIndex(idx.parent());
 
 		tree_items.pop_back();
 	}
 
-	objectslist_tbw->setUpdatesEnabled(true);
+	objectstree_tw->setUpdatesEnabled(true);
 }
 
-QTreeWidgetItem *ModelObjectsWidget::getTreeItem(BaseObject *object)
+QModelIndex ModelObjectsWidget::getTreeIndex(BaseObject *object)
 {
-	if(object)
-	{
-		QTreeWidgetItemIterator itr(objectstree_tw);
-		BaseObject *aux_obj=nullptr;
-		QTreeWidgetItem *item=nullptr;
-
-		while(*itr)
-		{
-			aux_obj=reinterpret_cast<BaseObject *>((*itr)->data(0,Qt::UserRole).value<void *>());
+	if(!object)
+		return QModelIndex();
 
-			if(aux_obj==object)
-			{
-				item=*itr;
-				break;
-			}
+	return tree_proxy_model->mapFromSource(tree_model->getObjectIndex(object));
+}
 
-			++itr;
-		}
+void ModelObjectsWidget::expandTreeIndex(const QModelIndex &index)
+{
+	QModelIndex idx = index;
 
-		return item;
+	while(idx.isValid())
+	{
+		objectstree_tw->expand(idx);
+		idx = idx.parent();
 	}
-	else
-		return nullptr;
 }
 
 void ModelObjectsWidget::selectCreatedObject(BaseObject *obj)
 {
 	updateObjectsView();
-	QTreeWidgetItem *item = getTreeItem(obj);
+	QModelIndex idx = getTreeIndex(obj);
 
-	if(item)
+	if(idx.isValid())
 	{
-		objectstree_tw->blockSignals(true);
-		item->setSelected(true);
-		objectstree_tw->setCurrentItem(item);
-		objectstree_tw->scrollToItem(item);
+		objectstree_tw->selectionModel()->blockSignals(true);
+		expandTreeIndex(idx.parent());
+		objectstree_tw->selectionModel()->select(idx, QItemSelectionModel::ClearAndSelect);
+		objectstree_tw->setCurrentIndex(idx);
+		objectstree_tw->scrollTo(idx);
 		select_tb->setFocus();
-		objectstree_tw->blockSignals(false);
+		objectstree_tw->selectionModel()->blockSignals(false);
 	}
 }
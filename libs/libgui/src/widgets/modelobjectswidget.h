@@ -30,6 +30,7 @@
 #include "modelwidget.h"
 #include "messagebox.h"
 #include "objecttypeslistwidget.h"
+#include "modelobjectstreemodel.h"
 
 class __libgui ModelObjectsWidget: public QWidget, public Ui::ModelObjectsWidget {
 	private:
@@ -40,14 +41,14 @@ class __libgui ModelObjectsWidget: public QWidget, public Ui::ModelObjectsWidget
 		object selectors. See ObjectSelectorWidget for details. */
 		bool simplified_view,
 
-		/*! \brief Indicates if the object tree state must be saved, this means, that the current item
-					expansion is memorized and can be restored at any moment via restoreTreeState() method */
-		save_tree_state,
-
 		/*! \brief Allow the object creation in simplified mode by using the "New [object type]" popup menu.
 		This flag is ignored if the model object widget is used in the complete mode since the main purpose
 		of the widget is to allow the object management */
-		enable_obj_creation;
+		enable_obj_creation,
+
+		/*! \brief Indicates that the objects list must be updated when the list view is activated.
+		The list is only updated while visible to avoid searching the whole model on each change */
+		list_outdated;
 
 		//! \brief Stores the objects currently selected on the tree/list
 		std::vector<BaseObject *> selected_objs;
@@ -67,32 +68,20 @@ class __libgui ModelObjectsWidget: public QWidget, public Ui::ModelObjectsWidget
 
 		ObjectTypesListWidget *obj_types_wgt;
 
-		//! \brief Updates only a schema tree starting from the 'root' item
-		void updateSchemaTree(QTreeWidgetItem *root);
-
-		/*! \brief Updates only a table / foreign table tree starting from the 'root' item.
-		 * table_type must be ObjectType::Table or ObjectType::ForeignTable */
-		void updateTableTree(QTreeWidgetItem *root, BaseObject *schema, ObjectType table_type);
-
-		//! \brief Updates only a view tree starting from the 'root' item
-		void updateViewTree(QTreeWidgetItem *root, BaseObject *schema);
+		//! \brief The item model that populates the objects tree on demand
+		ModelObjectsTreeModel *tree_model;
 
-		//! \brief Updates only the permission tree related to the specified object
-		void updatePermissionTree(QTreeWidgetItem *root, BaseObject *object);
-
-		//! \brief Updates the whole database object tree
-		void updateDatabaseTree();
+		//! \brief The proxy model used to sort and filter the objects tree
+		QSortFilterProxyModel *tree_proxy_model;
 
 		//! \brief Updates the whole object list
 		void updateObjectsList();
 
-		//! \brief Returns an item from the tree related to the specified object reference
-		QTreeWidgetItem *getTreeItem(BaseObject *object);
-
-		//! \brief Generates a QVariant containing the passed object reference as data
-		QVariant generateItemValue(BaseObject *object);
+		//! \brief Returns the index of the tree (in the proxy model) related to the specified object reference
+		QModelIndex getTreeIndex(BaseObject *object);
 
-		QTreeWidgetItem *createItemForObject(BaseObject *object, QTreeWidgetItem *root=nullptr, bool update_perms=true);
+		//! \brief Expands the tree items of the provided index and its ancestors
+		void expandTreeIndex(const QModelIndex &index);
 
 		void mouseMoveEvent(QMouseEvent *);
 		void resizeEvent(QResizeEvent *);
@@ -115,9 +104,6 @@ class __libgui ModelObjectsWidget: public QWidget, public Ui::ModelObjectsWidget
 		//! \brief Restores the tree at a previous state when the specified items were expanded
 		void restoreTreeState(std::vector<BaseObject *> &tree_items);
 
-		//! \brief Defines if the widget must save/restore the tree state automaticaly
-		void saveTreeState(bool value);
-
 		void clearSelectedObject();
 
 	public slots:
@@ -135,6 +121,7 @@ class __libgui ModelObjectsWidget: public QWidget, public Ui::ModelObjectsWidget
 		void showObjectMenu();
 		void editObject();
 		void collapseAll();
+		void expandAll();
 		void filterObjects();
 		void selectCreatedObject(BaseObject *obj);
 
@@ -92,7 +92,14 @@ ModelWidget::ModelWidget(QWidget *parent) : QWidget(parent)
 																																					ObjectType::BaseRelationship, ObjectType::Relationship });
 
 	current_zoom = 1;
-	modified = panning_mode = wheel_move = false;
+	modified = panning_mode = wheel_move = loading_model = false;
+	load_failed = load_progress_changed = false;
+	load_thread = nullptr;
+	load_db_model = nullptr;
+	load_prog_wgt = nullptr;
+	load_progress = 0;
+	load_progress_icon = 0;
+	scene_obj_idx = 0;
 	curr_show_grid = curr_show_delim = true;
 	new_obj_type = ObjectType::BaseObject;
 
@@ -602,6 +609,16 @@ ModelWidget::ModelWidget(QWidget *parent) : QWidget(parent)
 		wheel_move = false;
 	});
 
+	connect(&load_progress_timer, &QTimer::timeout, this, [this](){
+		QMutexLocker locker(&load_progress_mtx);
+
+		if(!load_progress_changed)
+			return;
+
+		load_progress_changed = false;
+		load_prog_wgt->updateProgress(load_progress, load_progress_msg, load_progress_icon);
+	});
+
 	viewport->installEventFilter(this);
 	viewport->horizontalScrollBar()->installEventFilter(this);
 	viewport->verticalScrollBar()->installEventFilter(this);
@@ -636,10 +653,18 @@ ModelWidget::~ModelWidget()
 	tags_menu.clear();
 	break_rel_menu.clear();
 
+	// The model can't be destroyed while it's being loaded by the worker thread
+	if(load_thread)
+	{
+		load_thread->wait();
+		delete load_thread;
+	}
+
 	delete viewport;
 	delete scene;
 	delete op_list;
 	delete db_model;
+	delete load_db_model;
 }
 
 void ModelWidget::setModified(bool value)
@@ -1690,30 +1715,182 @@ void ModelWidget::convertRelationship1N()
 
 void ModelWidget::loadModel(const QString &filename)
 {
-	TaskProgressWidget task_prog_wgt(this);
+	if(loading_model)
+		return;
 
 	try
 	{
-		connect(db_model, &DatabaseModel::s_objectLoaded, &task_prog_wgt, qOverload<int, QString, unsigned>(&TaskProgressWidget::updateProgress));
-		task_prog_wgt.addIcon(enum_t(ObjectType::BaseObject), QPixmap(GuiUtilsNs::getIconPath("design")));
-		task_prog_wgt.setWindowTitle(tr("Loading database model"));
-		task_prog_wgt.show();
+		DatabaseModel *model = nullptr;
 
-		db_model->loadModel(filename);		
-		this->filename=filename;
+		loading_model = true;
+		load_failed = load_progress_changed = false;
+		load_filename = filename;
+		loading_times.clear();
+
+		// The widget can't be used until the loaded model replaces the current one
+		setEnabled(false);
+
+		if(!load_prog_wgt)
+		{
+			load_prog_wgt = new TaskProgressWidget(this);
+			load_prog_wgt->addIcon(enum_t(ObjectType::BaseObject), QPixmap(GuiUtilsNs::getIconPath("design")));
+			load_prog_wgt->setWindowTitle(tr("Loading database model"));
+		}
+
+		/* The progress widget is displayed without calling TaskProgressWidget::show()
+		 * since it runs a nested event loop to give some time to the widget to be shown */
+		GuiUtilsNs::resizeDialog(load_prog_wgt);
+		load_prog_wgt->QDialog::show();
+		load_prog_wgt->updateProgress(0, tr("Loading database model `%1'...").arg(filename), enum_t(ObjectType::BaseObject));
+
+		/* The file is loaded in a detached database model which is not connected to the scene or to any other widget,
+		 * so the objects created by the worker thread are only accessed by the GUI thread after the loading finishes */
+		model = load_db_model = new DatabaseModel(this);
+		load_db_model->createSystemObjects(false);
+
+		/* The loading progress is stored by the worker thread and sampled periodically by the GUI thread
+		 * avoiding to queue an event for each loaded object */
+		connect(model, &DatabaseModel::s_objectLoaded, model, [this](int progress, QString msg, unsigned icon_id){
+			QMutexLocker locker(&load_progress_mtx);
+			load_progress = progress;
+			load_progress_msg = msg;
+			load_progress_icon = icon_id;
+			load_progress_changed = true;
+		}, Qt::DirectConnection);
+
+		load_thread = QThread::create([this, model, filename](){
+			try
+			{
+				model->loadModel(filename);
+			}
+			catch(Exception &e)
+			{
+				load_error = Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+				load_failed = true;
+			}
+
+			// The graphical objects created in the worker thread are handed over to the GUI thread
+			model->moveGraphicObjectsToThread(qApp->thread());
+		});
+
+		// The loaded model is handed over to the GUI thread through the queued signal emitted when the worker finishes
+		connect(load_thread, &QThread::finished, this, &ModelWidget::finishModelLoading, Qt::QueuedConnection);
+
+		load_progress_timer.start(50);
+		load_thread->start();
+	}
+	catch(Exception &e)
+	{
+		delete load_db_model;
+		load_db_model = nullptr;
+		load_prog_wgt->close();
+		loading_model = false;
+		setEnabled(true);
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void ModelWidget::finishModelLoading()
+{
+	load_progress_timer.stop();
+	load_thread->wait();
+	delete load_thread;
+	load_thread = nullptr;
+
+	disconnect(load_db_model, &DatabaseModel::s_objectLoaded, nullptr, nullptr);
+
+	if(load_failed)
+	{
+		delete load_db_model;
+		load_db_model = nullptr;
+		load_prog_wgt->close();
+		loading_model = false;
+		setEnabled(true);
+		emit s_modelLoadFailed(load_error);
+		return;
+	}
+
+	/* The loaded model replaces the current one (an empty placeholder) which is kept until the scene population finishes
+	 * because other widgets may still reference it until they are notified about the new model via s_modelLoaded() */
+	disconnect(db_model, nullptr, this, nullptr);
+	std::swap(db_model, load_db_model);
+	xmlparser = db_model->getXMLParser();
+
+	delete op_list;
+	op_list = new OperationList(db_model);
+
+	connect(db_model, &DatabaseModel::s_objectAdded, this, &ModelWidget::handleObjectAddition);
+	connect(db_model, &DatabaseModel::s_objectRemoved, this, &ModelWidget::handleObjectRemoval);
+
+	loading_times = db_model->getLoadingTimes();
+	this->filename = load_filename;
+
+	/* Schemas are the last ones since their rectangles are configured from the tables/views
+	 * and relationships come after tables/views since they are linked to their graphical objects */
+	scene_objects.clear();
+	scene_obj_idx = 0;
+
+	for(auto &obj_type : { ObjectType::Table, ObjectType::ForeignTable, ObjectType::View, ObjectType::Textbox,
+												 ObjectType::Relationship, ObjectType::BaseRelationship, ObjectType::Schema })
+	{
+		scene_objects.insert(scene_objects.end(), db_model->getObjectList(obj_type)->begin(),
+												 db_model->getObjectList(obj_type)->end());
+	}
+
+	scene_timer.start();
+	load_prog_wgt->updateProgress(100, tr("Rendering database model..."), enum_t(ObjectType::BaseObject));
+	populateScene();
+}
+
+void ModelWidget::populateScene()
+{
+	try
+	{
+		BaseGraphicObject *graph_obj = nullptr;
+		unsigned batch_end = std::min<unsigned>(scene_obj_idx + SceneBatchSize, scene_objects.size());
+
+		for(; scene_obj_idx < batch_end; scene_obj_idx++)
+		{
+			graph_obj = dynamic_cast<BaseGraphicObject *>(scene_objects[scene_obj_idx]);
+
+			if(!graph_obj->getOverlyingObject())
+				handleObjectAddition(graph_obj);
+		}
+
+		// The next batch is processed after the events queued meanwhile (repaints, user input, etc)
+		if(scene_obj_idx < scene_objects.size())
+		{
+			load_prog_wgt->updateProgress((scene_obj_idx / static_cast<double>(scene_objects.size())) * 100,
+																		tr("Rendering database model..."), enum_t(ObjectType::BaseObject));
+			QTimer::singleShot(0, this, &ModelWidget::populateScene);
+			return;
+		}
+
+		scene_objects.clear();
 		updateObjectsOpacity();
 		updateSceneLayers();
 		adjustSceneSize();
+		loading_times.push_back({ tr("Scene population"), scene_timer.elapsed() });
 
-		task_prog_wgt.close();
+		load_prog_wgt->close();
 		protected_model_frm->setVisible(db_model->isProtected());
+		loading_model = false;
+		setEnabled(true);
 		setModified(false);
+
+		emit s_modelLoaded();
+
+		// The placeholder model is destroyed only after the other widgets were notified about the loaded model
+		delete load_db_model;
+		load_db_model = nullptr;
 	}
 	catch(Exception &e)
 	{
-		task_prog_wgt.close();
-		setModified(false);
-		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		scene_objects.clear();
+		load_prog_wgt->close();
+		loading_model = false;
+		setEnabled(true);
+		emit s_modelLoadFailed(Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e));
 	}
 }
 
@@ -2857,12 +3034,37 @@ void ModelWidget::pasteObjects(bool duplicate_mode)
 		}
 	}
 
+	/* When all the copied objects support it (and they aren't being pasted into a table/view) the objects are
+	cloned in memory instead of having their XML code generated and parsed, which is much faster */
+	ObjectCloneHelper clone_hlp(db_model, duplicate_mode);
+	bool clone_objs = !sel_table && !sel_view && ObjectCloneHelper::isCloneSupported(copied_objects, duplicate_mode);
+
+	if(clone_objs)
+	{
+		pos=0;
+
+		for(auto &obj : copied_objects)
+		{
+			pos++;
+
+			// Table children objects are cloned together with their parent tables
+			if(TableObject::isTableObject(obj->getObjectType()))
+				continue;
+
+			task_prog_wgt.updateProgress((pos/static_cast<double>(copied_objects.size()))*100,
+																	 tr("Cloning object: `%1' (%2)").arg(obj->getName())
+																	 .arg(obj->getTypeName()),
+																	 enum_t(obj->getObjectType()));
+			clone_hlp.cloneObject(obj);
+		}
+	}
+
 	/* The third step is get the XML code definition of the copied objects, is
 	with the xml code that the copied object are created and inserted on the model */
 	itr=copied_objects.begin();
 	itr_end=copied_objects.end();
 	pos=0;
-	while(itr!=itr_end)
+	while(!clone_objs && itr!=itr_end)
 	{
 		object=(*itr);
 		object->setCodeInvalidated(true);
@@ -2963,7 +3165,10 @@ void ModelWidget::pasteObjects(bool duplicate_mode)
 
 	op_list->startOperationChain();
 
-	while(itr!=itr_end)
+	if(clone_objs)
+		pasteClonedObjects(clone_hlp, errors, task_prog_wgt);
+
+	while(!clone_objs && itr!=itr_end)
 	{
 		object = *itr;
 		itr++;
@@ -3076,6 +3281,57 @@ void ModelWidget::pasteObjects(bool duplicate_mode)
 	viewport->horizontalScrollBar()->setValue(db_model->getLastPosition().x());
 }
 
+void ModelWidget::pasteClonedObjects(ObjectCloneHelper &clone_hlp, std::vector<Exception> &errors, TaskProgressWidget &task_prog_wgt)
+{
+	BaseObject *clone = nullptr;
+	std::vector<Constraint *> added_fks;
+	unsigned pos = 0;
+
+	for(auto &object : copied_objects)
+	{
+		pos++;
+		clone = clone_hlp.getClone(object);
+
+		// Table children objects are inserted together with their (cloned) parent tables
+		if(!clone)
+			continue;
+
+		task_prog_wgt.updateProgress((pos/static_cast<double>(copied_objects.size()))*100,
+																 tr("Pasting object: `%1' (%2)").arg(clone->getName())
+																 .arg(clone->getTypeName()),
+																 enum_t(clone->getObjectType()));
+
+		try
+		{
+			clone_hlp.resolveReferences(object);
+
+			/* Like in the pasting from XML, clones conflicting with existing objects are renamed and the
+			 * references to their original objects are resolved to the existing objects instead */
+			if(db_model->getObjectIndex(clone->getSignature(), clone->getObjectType()) >= 0)
+			{
+				clone_hlp.discardClone(object);
+				clone->setName(CoreUtilsNs::generateUniqueName(clone, *db_model->getObjectList(clone->getObjectType()), false, QString("_cp")));
+			}
+
+			db_model->addObject(clone);
+			op_list->registerObject(clone, Operation::ObjCreated);
+		}
+		catch(Exception &e)
+		{
+			if(db_model->getObjectIndex(clone) < 0)
+				clone_hlp.destroyClone(clone);
+
+			errors.push_back(e);
+		}
+	}
+
+	// Foreign keys are created after all tables are in the model since they can reference any of them
+	clone_hlp.finishCloning(added_fks, errors);
+
+	for(auto &fk : added_fks)
+		op_list->registerObject(fk, Operation::ObjCreated, -1, fk->getParentTable());
+}
+
 void ModelWidget::duplicateObject()
 {
 	int op_id = -1;
@@ -4592,6 +4848,16 @@ bool ModelWidget::isModified()
 	return modified;
 }
 
+bool ModelWidget::isLoadingModel()
+{
+	return loading_model;
+}
+
+std::vector<std::pair<QString, qint64>> ModelWidget::getLoadingTimes()
+{
+	return loading_times;
+}
+
 DatabaseModel *ModelWidget::getDatabaseModel()
 {
 	return db_model;
@@ -28,6 +28,7 @@
 #include <QtWidgets>
 #include "databasemodel.h"
 #include "operationlist.h"
+#include "objectclonehelper.h"
 #include "messagebox.h"
 #include "objectsscene.h"
 #include "taskprogresswidget.h"
@@ -55,7 +56,10 @@ class __libgui ModelWidget: public QWidget {
 		//! \brief Constants used to control the object stacking method
 		static constexpr int BringToFront = 1,
 
-		SendToBack = -1;
+		SendToBack = -1,
+
+		//! \brief Amount of graphical objects added to the scene before the pending events are processed (see populateScene())
+		SceneBatchSize = 250;
 
 		XmlParser *xmlparser;
 
@@ -79,7 +83,56 @@ class __libgui ModelWidget: public QWidget {
 		curr_show_delim,
 
 		//! \brief Indicates if the canvas panning move is being made via mouse wheel
-		wheel_move;
+		wheel_move,
+
+		//! \brief Indicates if the model file is being loaded by a worker thread (see loadModel())
+		loading_model,
+
+		//! \brief Indicates if the model loading running in the worker thread failed (see load_error)
+		load_failed,
+
+		//! \brief Indicates if the loading progress changed since the last time it was displayed
+		load_progress_changed;
+
+		//! \brief Stores the time (in milliseconds) spent in each phase of the last model loading
+		std::vector<std::pair<QString, qint64>> loading_times;
+
+		//! \brief Worker thread that loads the model file (see loadModel())
+		QThread *load_thread;
+
+		/*! \brief Detached database model in which the file is loaded by the worker thread. When the loading
+		 * finishes it replaces the current database model (which is kept in this attribute until the scene is populated) */
+		DatabaseModel *load_db_model;
+
+		//! \brief Stores the error raised by the model loading in the worker thread
+		Exception load_error;
+
+		//! \brief The file being loaded
+		QString load_filename;
+
+		//! \brief Widget that displays the progress of the model loading
+		TaskProgressWidget *load_prog_wgt;
+
+		//! \brief Controls the concurrent access to the loading progress stored by the worker thread
+		QMutex load_progress_mtx;
+
+		//! \brief The last loading progress stored by the worker thread
+		int load_progress;
+
+		//! \brief The last loading message stored by the worker thread
+		QString load_progress_msg;
+
+		//! \brief The icon of the last loading message stored by the worker thread
+		unsigned load_progress_icon;
+
+		//! \brief Graphical objects of the loaded model which representation is being created in the scene (see populateScene())
+		std::vector<BaseObject *> scene_objects;
+
+		//! \brief The index of the next object in scene_objects to be added to the scene
+		unsigned scene_obj_idx;
+
+		//! \brief Counts the time spent populating the scene
+		QElapsedTimer scene_timer;
 
 		/*! \brief Indicates if the cut operation is currently activated. This flag modifies
 		the way the methods copyObjects() and removeObject() works. */
@@ -196,6 +249,9 @@ class __libgui ModelWidget: public QWidget {
 		//! \brief This timer controls the interval the zoom label is visible
 		QTimer zoom_info_timer,
 
+		//! \brief This timer controls the interval in which the loading progress stored by the worker thread is displayed
+		load_progress_timer,
+
 		/*! \brief This timer controls the interval that the background of the scene is hidden while
 		 *  using the mouse wheel to zoom or move the scene */
 		wheel_timer;
@@ -362,6 +418,19 @@ class __libgui ModelWidget: public QWidget {
 
 		void setAllCollapseMode(BaseTable::CollapseMode mode);
 
+		/*! \brief Replaces the current database model by the one loaded in the worker thread and starts the population
+		 * of the scene. This method is called in the GUI thread when the worker thread finishes (see loadModel()) */
+		void finishModelLoading();
+
+		/*! \brief Creates the graphical representation of a batch of the objects in scene_objects and schedules the next
+		 * batch through the event queue, so the UI is kept responsive without processing events in a nested loop.
+		 * When the last batch is processed the signal s_modelLoaded() is emitted */
+		void populateScene();
+
+		/*! \brief Inserts in the model the clones of the copied objects created by the provided helper (see pasteObjects()).
+		 * The errors raised while inserting the objects are stored in the errors vector */
+		void pasteClonedObjects(ObjectCloneHelper &clone_hlp, std::vector<Exception> &errors, TaskProgressWidget &task_prog_wgt);
+
 	public:
 		static constexpr double MinimumZoom = ObjectsScene::MinScaleFactor,
 		MaximumZoom = ObjectsScene::MaxScaleFactor,
@@ -398,6 +467,13 @@ class __libgui ModelWidget: public QWidget {
 		//! \brief Returns if the model is modified or not
 		bool isModified();
 
+		/*! \brief Returns if the model file is being loaded. While loading, the database model is a placeholder
+		 * that is replaced when the loading finishes, so it must not be modified or saved */
+		bool isLoadingModel();
+
+		//! \brief Returns the phases of the last model loading and the time (in milliseconds) spent in each one
+		std::vector<std::pair<QString, qint64>> getLoadingTimes();
+
 		//! \brief Returns the reference database model
 		DatabaseModel *getDatabaseModel();
 
@@ -604,6 +680,9 @@ class __libgui ModelWidget: public QWidget {
 		void finishPanningMove();
 
 	public slots:
+		/*! \brief Starts the loading of the model file in a worker thread and returns immediately. The file is loaded
+		 * in a detached database model that replaces the current one when the loading finishes. The result is
+		 * notified by the signals s_modelLoaded() and s_modelLoadFailed() */
 		void loadModel(const QString &filename);
 		void saveModel(const QString &filename);
 		void saveModel();
@@ -613,6 +692,12 @@ class __libgui ModelWidget: public QWidget {
 		void sendToBack();
 
 	signals:
+		//! \brief Signal emitted when the model file started by loadModel() is completely loaded and rendered
+		void s_modelLoaded();
+
+		//! \brief Signal emitted when the model file started by loadModel() could not be loaded
+		void s_modelLoadFailed(Exception e);
+
 		void s_objectModified();
 		void s_objectsMoved();
 		void s_objectCreated();
@@ -30,6 +30,20 @@ TaskProgressWidget::TaskProgressWidget(QWidget *parent, Qt::WindowFlags f) : QDi
 
 	for(auto &obj_tp : obj_types)
 		addIcon(enum_t(obj_tp), QIcon(GuiUtilsNs::getIconPath(obj_tp)));
+
+	cancel_tb->setVisible(false);
+
+	connect(cancel_tb, &QToolButton::clicked, this, [this](){
+		cancel_tb->setEnabled(false);
+		text_lbl->setText(tr("Cancelling the task..."));
+		emit s_cancelRequested();
+	});
+}
+
+void TaskProgressWidget::setCancelable(bool value)
+{
+	cancel_tb->setVisible(value);
+	cancel_tb->setEnabled(value);
 }
 
 void TaskProgressWidget::addIcon(unsigned id, const QIcon &ico)
@@ -74,7 +88,17 @@ void TaskProgressWidget::updateProgress(int progress, QString text, unsigned ico
 	else
 		icon_lbl->clear();
 
+	/* Updates received right after the previous repaint are painted in the next iteration of the event loop
+	 * so a burst of progress signals doesn't cause one synchronous repaint per signal. The final
+	 * progress is always painted right away */
+	if(repaint_timer.isValid() && !repaint_timer.hasExpired(RepaintInterval) && progress < progress_pb->maximum())
+	{
+		this->update();
+		return;
+	}
+
 	this->repaint();
+	repaint_timer.start();
 
 	/* MacOSX workaround: The event loop below is needed because on this system
 		 the task progress is not correctly updated. The event loop causes a little
@@ -91,6 +115,8 @@ void TaskProgressWidget::updateProgress(int progress, QString text, unsigned ico
 void TaskProgressWidget::close()
 {
 	QDialog::close();
+	cancel_tb->setEnabled(cancel_tb->isVisible());
+	repaint_timer.invalidate();
 	progress_pb->setValue(0);
 	text_lbl->clear();
 	icon_lbl->clear();
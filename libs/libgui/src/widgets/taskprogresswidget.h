@@ -38,15 +38,29 @@ class __libgui TaskProgressWidget: public QDialog, public Ui::TaskProgressWidget
 		//! \brief Stores the icons that are shown as the icons tokens are send via	updateProgress() slot
 		std::map<unsigned, QIcon> icons;
 
+		//! \brief Minimum interval (in ms) between two synchronous repaints of the widget
+		static constexpr qint64 RepaintInterval = 40;
+
+		//! \brief Counts the time elapsed since the last synchronous repaint of the widget
+		QElapsedTimer repaint_timer;
+
 	public:
 		TaskProgressWidget(QWidget *parent = nullptr, Qt::WindowFlags f = Qt::Widget);
 		void addIcon(unsigned id, const QIcon &ico);
 
+		/*! \brief Shows/hides the cancel button. When clicked the button is disabled and the signal
+		 * s_cancelRequested() is emitted, so the task must be stopped by the receiver */
+		void setCancelable(bool value);
+
 	public slots:
 		void show();
 		void close();
 		void updateProgress(int progress, unsigned icon_id);
 		void updateProgress(int progress, QString text, unsigned icon_id);
+
+	signals:
+		//! \brief This signal is emitted when the user clicks the cancel button (see setCancelable())
+		void s_cancelRequested();
 };
 
 #endif
@@ -11,14 +11,18 @@ HEADERS += src/parsersglobal.h \
 src/schemaparser.h \
 src/csvdocument.h \
 src/csvparser.h \
+src/csvreader.h \
 src/xmlparser.h \
+src/xmlsnapshot.h \
 src/attribsmap.h \
 src/attributes.h
 
 SOURCES += src/schemaparser.cpp \
 src/csvdocument.cpp \
 src/csvparser.cpp \
+src/csvreader.cpp \
 src/xmlparser.cpp \
+src/xmlsnapshot.cpp \
 src/attributes.cpp
 
 unix|windows: LIBS += $$LIBUTILS_LIB $$XML_LIB
@@ -70,6 +70,7 @@ namespace Attributes {
 	Cascade("cascade"),
 	CaseSensitive("case-sensitive"),
 	CastType("cast-type"),
+	CatalogProbe("catalogprobe"),
 	Category("category"),
 	Change("change"),
 	Changelog("changelog"),
@@ -99,6 +100,7 @@ namespace Attributes {
 	CompactView("compact-view"),
 	CompareToDatabase="compare-to-db",
 	ComparisonType("comparison-type"),
+	Completion("completion"),
 	CompletionTrigger("completion-trigger"),
 	CompositeType("composite"),
 	Concurrent("concurrent"),
@@ -296,6 +298,7 @@ namespace Attributes {
 	ImportExtObjs="import-ext-objs",
 	ImportSysObjs="import-sys-objs",
 	Increment("increment"),
+	IncrementalImport="incremental-import",
 	Index("index"),	
 	IndexElement("idxelement"),
 	Indexes("indexes"),
@@ -368,6 +371,7 @@ namespace Attributes {
 	Login("login"),
 	LookaheadChar("lookahead-char"),
 	LowVerbosity("low-verbosity"),
+	Marker("marker"),
 	Materialized("materialized"),
 	MaxConnections("max-connections"),
 	Maximized("maximized"),
@@ -403,6 +407,7 @@ namespace Attributes {
 	ObjectFinder("objectfinder"),
 	ObjectId("object-id"),
 	Objects("objects"),
+	ObjectsMarkers("objectsmarkers"),
 	ObjectType("object-type"),
 	ObjCount("objcount"),
 	ObjSelection("obj-selection"),
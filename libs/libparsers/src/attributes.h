@@ -83,6 +83,7 @@ namespace Attributes {
 	Cascade,
 	CaseSensitive,
 	CastType,
+	CatalogProbe,
 	Category,
 	Change,
 	Changelog,
@@ -112,6 +113,7 @@ namespace Attributes {
 	CompactView,
 	CompareToDatabase,
 	ComparisonType,
+	Completion,
 	CompletionTrigger,
 	CompositeType,
 	Concurrent,
@@ -310,6 +312,7 @@ namespace Attributes {
 	ImportExtObjs,
 	ImportSysObjs,
 	Increment,
+	IncrementalImport,
 	IncludedCols,
 	Index,
 	IndexElement,
@@ -383,6 +386,7 @@ namespace Attributes {
 	Login,
 	LookaheadChar,
 	LowVerbosity,
+	Marker,
 	Materialized,
 	MaxConnections,
 	Maximized,
@@ -418,6 +422,7 @@ namespace Attributes {
 	ObjectFinder,
 	ObjectId,
 	Objects,
+	ObjectsMarkers,
 	ObjectType,
 	ObjCount,
 	ObjSelection,
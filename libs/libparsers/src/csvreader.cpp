@@ -0,0 +1,263 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+#include "csvreader.h"
+#include "csvdocument.h"
+#include <cstring>
+
+CsvReader::CsvReader()
+{
+	data_start = data_end = curr_pos = nullptr;
+	cols_in_first_row = false;
+	curr_row = 0;
+	setSpecialChars(CsvDocument::Separator, CsvDocument::TextDelimiter);
+}
+
+CsvReader::~CsvReader()
+{
+	close();
+}
+
+void CsvReader::setSpecialChars(const QChar &sep, const QChar &txt_delim)
+{
+	if(sep.unicode() > 127 || txt_delim.unicode() > 127 ||
+		 sep == txt_delim || sep == CsvDocument::LineBreak || sep == QChar::CarriageReturn)
+		throw Exception(ErrorCode::InvCsvParserOptions, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	separator = sep.toLatin1();
+	text_delim = txt_delim.toLatin1();
+
+	value_end_chars.fill(false);
+	value_end_chars[static_cast<unsigned char>(separator)] = true;
+	value_end_chars[static_cast<unsigned char>('\n')] = true;
+	value_end_chars[static_cast<unsigned char>('\r')] = true;
+}
+
+void CsvReader::setColumnInFirstRow(bool value)
+{
+	cols_in_first_row = value;
+}
+
+void CsvReader::open(const QString &filename)
+{
+	close();
+	input.setFileName(filename);
+
+	if(!input.open(QFile::ReadOnly))
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(filename),
+										ErrorCode::FileDirectoryNotAccessed, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+	}
+
+	try
+	{
+		const char *data = nullptr;
+
+		/* Mapping the whole file in memory so the pages are loaded by the system on demand
+		 * as the rows are read. In case of failure the contents are loaded in a buffer */
+		if(input.size() > 0)
+			data = reinterpret_cast<const char *>(input.map(0, input.size()));
+
+		if(!data && input.size() > 0)
+		{
+			input_buf = input.readAll();
+			data = input_buf.constData();
+		}
+
+		setData(data, input.size());
+	}
+	catch(Exception &e)
+	{
+		close();
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+	}
+}
+
+void CsvReader::openBuffer(const QByteArray &buffer)
+{
+	try
+	{
+		close();
+		input_buf = buffer;
+		setData(input_buf.constData(), input_buf.size());
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+	}
+}
+
+void CsvReader::setData(const char *data, qint64 size)
+{
+	static const char utf8_bom[] = "\xEF\xBB\xBF";
+
+	data_start = curr_pos = data;
+	data_end = data ? data + size : data;
+	curr_row = 0;
+	columns.clear();
+
+	// Ignoring the UTF-8 byte order mark (if present)
+	if(size >= 3 && memcmp(data, utf8_bom, 3) == 0)
+		curr_pos += 3;
+
+	if(cols_in_first_row && !atEnd())
+		columns = extractRow();
+}
+
+void CsvReader::close()
+{
+	if(input.isOpen())
+		input.close();
+
+	input_buf.clear();
+	data_start = data_end = curr_pos = nullptr;
+	columns.clear();
+	curr_row = 0;
+}
+
+bool CsvReader::atEnd()
+{
+	return curr_pos >= data_end;
+}
+
+QStringList CsvReader::getColumnNames()
+{
+	return columns;
+}
+
+qint64 CsvReader::getSize()
+{
+	return data_end - data_start;
+}
+
+qint64 CsvReader::getBytesRead()
+{
+	return curr_pos - data_start;
+}
+
+int CsvReader::readRows(QList<QStringList> &rows, int max_rows)
+{
+	try
+	{
+		rows.clear();
+
+		while(!atEnd() && rows.size() < max_rows)
+			rows.append(extractRow());
+
+		return rows.size();
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+	}
+}
+
+QString CsvReader::extractValue(bool &row_end)
+{
+	const char *start = curr_pos;
+	QByteArray value;
+
+	row_end = false;
+
+	// Unquoted value: the bytes are consumed until a separator or a line break is found
+	if(curr_pos >= data_end || *curr_pos != text_delim)
+	{
+		while(curr_pos < data_end && !value_end_chars[static_cast<unsigned char>(*curr_pos)])
+			curr_pos++;
+
+		value = QByteArray::fromRawData(start, curr_pos - start);
+	}
+	/* Quoted value: separators and line breaks are part of the value until the closing delimiter is found.
+	 * Since only the text delimiter is relevant here we jump between them using memchr() which is
+	 * vectorized by the system's C library */
+	else
+	{
+		const char *delim = nullptr;
+		bool closed = false;
+
+		curr_pos++;
+
+		while(!closed)
+		{
+			delim = reinterpret_cast<const char *>(memchr(curr_pos, text_delim, data_end - curr_pos));
+
+			if(!delim)
+			{
+				throw Exception(Exception::getErrorMessage(ErrorCode::MalformedCsvMissingDelim).arg(QChar(text_delim)).arg(curr_row + 1),
+												ErrorCode::MalformedCsvMissingDelim, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+			}
+
+			value.append(curr_pos, delim - curr_pos);
+			curr_pos = delim + 1;
+
+			// Two contiguous delimiters represent a single delimiter char in the value (e.g. "foo""bar" is translated to foo"bar)
+			if(curr_pos < data_end && *curr_pos == text_delim)
+			{
+				value.append(text_delim);
+				curr_pos++;
+			}
+			else
+				closed = true;
+		}
+
+		/* Any char between the closing delimiter and the next separator/line break is
+		 * appended to the value, the same way CsvParser does */
+		start = curr_pos;
+
+		while(curr_pos < data_end && !value_end_chars[static_cast<unsigned char>(*curr_pos)])
+			curr_pos++;
+
+		value.append(start, curr_pos - start);
+
+		// Converting Windows (\r\n) and MacOs (\r) line breaks inside the value into a single line feed char
+		if(value.contains('\r'))
+		{
+			value.replace("\r\n", "\n");
+			value.replace('\r', '\n');
+		}
+	}
+
+	if(curr_pos >= data_end)
+		row_end = true;
+	else if(*curr_pos == separator)
+		curr_pos++;
+	else
+	{
+		// Consuming the line break (\n, \r\n or \r) that finishes the row
+		if(*curr_pos == '\r' && curr_pos + 1 < data_end && *(curr_pos + 1) == '\n')
+			curr_pos++;
+
+		curr_pos++;
+		curr_row++;
+		row_end = true;
+	}
+
+	return QString::fromUtf8(value);
+}
+
+QStringList CsvReader::extractRow()
+{
+	QStringList values;
+	bool row_end = false;
+
+	while(!row_end)
+		values.append(extractValue(row_end));
+
+	return values;
+}
@@ -0,0 +1,122 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+/**
+\ingroup libparsers
+\class CsvReader
+\brief Implements a streaming reader of CSV documents (RFC 4180) stored in UTF-8 encoded files. The file is mapped in memory
+(when the system supports it) and the rows are extracted in batches directly from the mapped bytes, so large files can be processed
+(e.g. copied into a table) without holding the whole document in memory. Line breaks in Windows (\r\n) and MacOs (\r) formats are
+converted to a single line feed as done by CsvParser.
+*/
+
+#ifndef CSV_READER_H
+#define CSV_READER_H
+
+#include "parsersglobal.h"
+#include "exception.h"
+#include <QFile>
+#include <QStringList>
+#include <array>
+
+class __libparsers CsvReader {
+	private:
+		//! \brief The file being read
+		QFile input;
+
+		//! \brief Stores the file contents when the file can't be mapped in memory
+		QByteArray input_buf;
+
+		//! \brief The start and the end of the document's bytes (mapped or in the buffer)
+		const char *data_start, *data_end,
+
+		//! \brief The position of the next byte to be read
+		*curr_pos;
+
+		//! \brief Indicates the character used as values separator
+		char separator,
+
+		//! \brief Indicates the character used as text delimiter
+		text_delim;
+
+		//! \brief Indicates if the document contains the column names in the first row
+		bool cols_in_first_row;
+
+		//! \brief Stores the column names when they are extracted from the first row
+		QStringList columns;
+
+		//! \brief Indicates the current row in which the reader is in (used in error messages)
+		int curr_row;
+
+		/*! \brief Flags the bytes that end an unquoted value (separator, line feed and carriage return) so the
+		 * scanning of the values performs a single lookup per byte */
+		std::array<bool, 256> value_end_chars;
+
+		//! \brief Configures the reader to extract rows from the provided bytes
+		void setData(const char *data, qint64 size);
+
+		/*! \brief Extracts a single value from the current position. The row_end parameter is
+		 * set to true when the value is the last one of a row */
+		QString extractValue(bool &row_end);
+
+		//! \brief Extracts the values of the row in the current position
+		QStringList extractRow();
+
+	public:
+		//! \brief Default amount of rows returned by readRows()
+		static constexpr int DefaultBatchSize = 1000;
+
+		CsvReader();
+		~CsvReader();
+
+		/*! \brief Configures the separator and text delimiter characters. Both must be ASCII characters since the
+		 * document is scanned as UTF-8 bytes. This method raises an error otherwise */
+		void setSpecialChars(const QChar &sep, const QChar &txt_delim);
+
+		void setColumnInFirstRow(bool value);
+
+		/*! \brief Opens the file mapping it in memory and extracts the column names in case the reader is configured to do so.
+		 * If the file can't be mapped its contents are loaded in memory */
+		void open(const QString &filename);
+
+		//! \brief Configures the reader to extract rows from a buffer instead of a file
+		void openBuffer(const QByteArray &buffer);
+
+		//! \brief Closes the current file releasing the mapped memory
+		void close();
+
+		//! \brief Returns true when all the rows were read
+		bool atEnd();
+
+		//! \brief Returns the column names extracted from the first row (see setColumnInFirstRow())
+		QStringList getColumnNames();
+
+		//! \brief Returns the size (in bytes) of the document
+		qint64 getSize();
+
+		//! \brief Returns the amount of bytes read so far. This is used to report the progress of the reading
+		qint64 getBytesRead();
+
+		/*! \brief Reads at most max_rows rows into the provided list (which is cleared first) returning the amount
+		 * of rows read. When zero is returned the end of the document was reached. This method raises an error in
+		 * case of a malformed document, e.g., a quoted value which isn't closed */
+		int readRows(QList<QStringList> &rows, int max_rows = DefaultBatchSize);
+};
+
+#endif
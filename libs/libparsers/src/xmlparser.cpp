@@ -19,8 +19,12 @@
 #include "xmlparser.h"
 #include <QUrl>
 #include "utilsns.h"
+#include <mutex>
+#include <cstdint>
 
-int XmlParser::parser_instances = 0;
+std::atomic<int> XmlParser::parser_instances(0);
+std::map<QString, xmlDtd *> XmlParser::dtd_cache;
+QMutex XmlParser::dtd_cache_mutex;
 const QString XmlParser::CharAmp("&amp;");
 const QString XmlParser::CharLt("&lt;");
 const QString XmlParser::CharGt("&gt;");
@@ -36,26 +40,124 @@ XmlParser::XmlParser()
 	root_elem=nullptr;
 	curr_elem=nullptr;
 	xml_doc=nullptr;
+	xml_reader=nullptr;
+	stream_size=0;
+	dtd=nullptr;
 	curr_line = 0;
 
-	if(parser_instances == 0)
-		xmlInitParser();
+	/* The libxml2 global state is initialized only once and never cleaned up by the parser instances
+	 * (xmlCleanupParser() isn't called) since parsers can be created and destroyed in different threads
+	 * and the cleanup would tear down the library while another thread is still using it */
+	static std::once_flag init_flag;
+	std::call_once(init_flag, [](){ xmlInitParser(); });
 
+	QMutexLocker locker(&dtd_cache_mutex);
 	parser_instances++;
 }
 
 XmlParser::~XmlParser()
 {
 	restartParser();
-	parser_instances--;
 
-	if(parser_instances <= 0)
+	/* The counter is decremented while the cache is locked so no other parser can start (or be
+	 * using) a cached DTD when the last instance frees the cache */
+	QMutexLocker locker(&dtd_cache_mutex);
+
+	if(--parser_instances <= 0)
 	{
-		xmlCleanupParser();
+		clearDTDCache();
 		parser_instances = 0;
 	}
 }
 
+xmlDtd *XmlParser::getCachedDTD(const QString &dtd_file)
+{
+	QMutexLocker locker(&dtd_cache_mutex);
+	xmlDtd *cached_dtd = nullptr;
+
+	if(dtd_cache.count(dtd_file))
+		return dtd_cache[dtd_file];
+
+	xmlResetLastError();
+	cached_dtd = xmlParseDTD(nullptr, reinterpret_cast<const xmlChar *>(dtd_file.toUtf8().constData()));
+
+	if(!cached_dtd)
+	{
+		xmlError *xml_error = xmlGetLastError();
+		QString msg = xml_error ? QString(xml_error->message).replace("\n", " ") : "";
+
+		throw Exception(Exception::getErrorMessage(ErrorCode::LibXMLError)
+										.arg(xml_error ? xml_error->line : 0).arg(xml_error ? xml_error->int2 : 0).arg(msg).arg(dtd_file),
+										ErrorCode::LibXMLError,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+#ifdef LIBXML_REGEXP_ENABLED
+	/* Building the content models (automata) of all the elements in advance since libxml2 builds
+	 * them on demand during the validation and that would make the shared DTD being modified */
+	if(cached_dtd->elements)
+	{
+		xmlValidCtxt *valid_ctx = xmlNewValidCtxt();
+
+		xmlHashScan(static_cast<xmlHashTable *>(cached_dtd->elements),
+								[](void *payload, void *data, const xmlChar *) {
+									xmlValidBuildContentModel(static_cast<xmlValidCtxt *>(data), static_cast<xmlElement *>(payload));
+								}, valid_ctx);
+
+		xmlFreeValidCtxt(valid_ctx);
+	}
+#endif
+
+	dtd_cache[dtd_file] = cached_dtd;
+	return cached_dtd;
+}
+
+void XmlParser::clearDTDCache()
+{
+	for(auto &itr : dtd_cache)
+		xmlFreeDtd(itr.second);
+
+	dtd_cache.clear();
+}
+
+bool XmlParser::hasDTDDeclaration(const char *buffer, qint64 size)
+{
+	QByteArrayView buf(buffer, size);
+	qint64 pos = 0;
+
+	/* Returns if the buffer contains the provided token exactly at the current position. This way
+	 * the check never scans the rest of the (possibly huge) buffer when the token isn't there */
+	auto startsWith = [&buf, &pos](const char *token) {
+		return buf.sliced(pos).startsWith(QByteArrayView(token));
+	};
+
+	// Skipping the UTF-8 byte order mark (if present) that precedes the prolog
+	if(buf.startsWith(QByteArrayView("\xEF\xBB\xBF")))
+		pos = 3;
+
+	// Skipping the whitespaces, processing instructions and comments that can precede the root element
+	while(pos < size)
+	{
+		if(QChar::isSpace(buf.at(pos)))
+			pos++;
+		else if(startsWith("<?"))
+		{
+			pos = buf.indexOf(QByteArrayView("?>"), pos);
+			if(pos < 0) return false;
+			pos += 2;
+		}
+		else if(startsWith("<!--"))
+		{
+			pos = buf.indexOf(QByteArrayView("-->"), pos);
+			if(pos < 0) return false;
+			pos += 3;
+		}
+		else
+			return startsWith("<!DOCTYPE");
+	}
+
+	return false;
+}
+
 void XmlParser::removeDTD()
 {
 	int pos1=-1, pos2=-1, pos3=-1, len;
@@ -66,11 +168,11 @@ void XmlParser::removeDTD()
 		 If the user attempts to manipulate the structure of
 		 document damaging its integrity. */
 		pos1=xml_buffer.indexOf(QLatin1String("<!DOCTYPE"));
-		pos2=xml_buffer.indexOf(QLatin1String("]>\n"));
-		pos3=xml_buffer.indexOf(QLatin1String("\">\n"));
+		pos2=xml_buffer.indexOf(QLatin1String("]>\n"), pos1);
+		pos3=xml_buffer.indexOf(QLatin1String("\">\n"), pos1);
 		if(pos1 >=0 && (pos2 >=0 || pos3 >= 0))
 		{
-			len=((pos2 > pos3) ? (pos2-pos1)+3 :  (pos3-pos2)+3);
+			len=((pos2 > pos3) ? (pos2-pos1)+3 :  (pos3-pos1)+3);
 			xml_buffer.replace(pos1,len,"");
 		}
 	}
@@ -82,9 +184,32 @@ void XmlParser::loadXMLFile(const QString &filename)
 	{
 		if(!filename.isEmpty())
 		{
-			QString buffer(UtilsNs::loadFile(filename));
+			QFile input(filename);
+			uchar *data = nullptr;
+
+			if(!input.open(QFile::ReadOnly))
+				throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(filename),
+												ErrorCode::FileDirectoryNotAccessed,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			if(input.size() == 0)
+				throw Exception(ErrorCode::AsgEmptyXMLBuffer,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			data = input.map(0, input.size());
 			xml_doc_filename=filename;
-			loadXMLBuffer(buffer);
+
+			/* If the file can't be mapped in memory or it carries its own DTD declaration (which must be
+			 * removed) we fallback to the loading of the file contents in a buffer */
+			if(!data || hasDTDDeclaration(reinterpret_cast<const char *>(data), input.size()))
+			{
+				input.seek(0);
+				loadXMLBuffer(QString::fromUtf8(input.readAll()));
+			}
+			else
+			{
+				// The mapped memory is released when the file is closed (destroyed)
+				xml_buffer.clear();
+				readBuffer(reinterpret_cast<const char *>(data), input.size());
+			}
 		}
 	}
 	catch(Exception &e)
@@ -97,26 +222,20 @@ void XmlParser::loadXMLBuffer(const QString &xml_buf)
 {
 	try
 	{
-		int pos1=-1, pos2=-1, tam=0;
+		QByteArray buffer;
 
 		if(xml_buf.isEmpty())
 			throw Exception(ErrorCode::AsgEmptyXMLBuffer,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-		pos1=xml_buf.indexOf(QLatin1String("<?xml"));
-		pos2=xml_buf.indexOf(QLatin1String("?>"));
 		xml_buffer=xml_buf;
 
-		if(pos1 >= 0 && pos2 >= 0)
-		{
-			tam=(pos2-pos1)+3;
-			xml_decl=xml_buffer.mid(pos1, tam);
-			xml_buffer.replace(pos1,tam,"");
-		}
-		else
-			xml_decl=QString("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+		/* The buffer is handed to libxml2 as is (including the <?xml?> declaration).
+		 * Only when the buffer has its own DTD declaration it needs to be changed */
+		if(xml_buffer.contains(QLatin1String("<!DOCTYPE")))
+			removeDTD();
 
-		removeDTD();
-		readBuffer();
+		buffer = xml_buffer.toUtf8();
+		readBuffer(buffer.constData(), buffer.size());
 	}
 	catch(Exception &e)
 	{
@@ -126,60 +245,64 @@ void XmlParser::loadXMLBuffer(const QString &xml_buf)
 
 void XmlParser::setDTDFile(const QString &dtd_file, const QString &dtd_name)
 {
-	QString fmt_dtd_file;
-
 	if(dtd_file.isEmpty())
 		throw Exception(ErrorCode::AsgEmptyDTDFile,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	if(dtd_name.isEmpty())
 		throw Exception(ErrorCode::AsgEmptyDTDName,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-#ifndef Q_OS_WIN
-	fmt_dtd_file=QString("file://");
-#else
-	fmt_dtd_file=QString("file:///");
-#endif
-
 	//Formats the dtd file path to URL style (converting to percentage format the non reserved chars)
-	fmt_dtd_file=QUrl::toPercentEncoding(QFileInfo(dtd_file).absoluteFilePath(), "/:");
-	dtd_decl=QString("<!DOCTYPE ") + dtd_name +
-			 QString(" SYSTEM ") +
-			 QString("\"") +
-			 fmt_dtd_file + QString("\">\n");
+	dtd=getCachedDTD(QUrl::toPercentEncoding(QFileInfo(dtd_file).absoluteFilePath(), "/:"));
+	this->dtd_name=dtd_name;
 }
 
-void XmlParser::readBuffer()
+void XmlParser::readBuffer(const char *buffer, qint64 size)
 {
-	QByteArray buffer;
 	QString msg, file;
 	xmlError *xml_error=nullptr;
+	xmlValidCtxt *valid_ctx=nullptr;
 	int parser_opt;
 
-	if(!xml_buffer.isEmpty())
+	if(size > 0)
 	{
-		//Inserts the XML declaration
-		buffer+=xml_decl.toUtf8();
-
-		//Configures the parser, initially, to not validate the document against the dtd
+		/* Configures the parser to not validate the document during the parsing. The validation
+		 * is made afterwards against the cached DTD so it doesn't need to be loaded for each document */
 		parser_opt=( XML_PARSE_NOBLANKS | XML_PARSE_NONET | XML_PARSE_NOENT | XML_PARSE_BIG_LINES);
 
-		//If the dtd declarions is setup
-		if(!dtd_decl.isEmpty())
+		xmlResetLastError();
+
+		//Create an xml document from the buffer
+		xml_doc=xmlReadMemory(buffer, size, nullptr, nullptr, parser_opt);
+
+		//In case the document creation fails, gets the last xml parser error
+		xml_error=xmlGetLastError();
+
+		//If the dtd is set validates the document against it
+		if(xml_doc && !xml_error && dtd)
 		{
-			//Inserts the default software DTD declarion into XML buffer
-			buffer+=dtd_decl.toUtf8();
+			xmlNode *root = xmlDocGetRootElement(xml_doc);
 
-			//Now configures the parser to validate the buffer against the DTD
-			parser_opt=(parser_opt | XML_PARSE_DTDLOAD | XML_PARSE_DTDVALID);
-		}
+			valid_ctx=xmlNewValidCtxt();
 
-		buffer+=xml_buffer.toUtf8();
+			if(!xmlValidateDtd(valid_ctx, xml_doc, dtd))
+				xml_error=xmlGetLastError();
 
-		//Create an xml document from the buffer
-		xml_doc=xmlReadMemory(buffer.data(), buffer.size(),	nullptr, nullptr, parser_opt);
+			xmlFreeValidCtxt(valid_ctx);
 
-		//In case the document criation fails, gets the last xml parser error
-		xml_error=xmlGetLastError();
+			/* Since the document has no DOCTYPE the name of the root element is
+			 * not checked by libxml2 so we do it here */
+			if(!xml_error && root && dtd_name != reinterpret_cast<const char *>(root->name))
+			{
+				int line = root->line;
+
+				msg=QString("root and DTD name do not match '%1' and '%2'").arg(reinterpret_cast<const char *>(root->name), dtd_name);
+				restartParser();
+
+				throw Exception(Exception::getErrorMessage(ErrorCode::LibXMLError)
+												.arg(line).arg(0).arg(msg).arg(""),
+												ErrorCode::LibXMLError,__PRETTY_FUNCTION__,__FILE__,__LINE__,nullptr, xml_doc_filename);
+			}
+		}
 
 		//If some error is set
 		if(xml_error)
@@ -204,6 +327,254 @@ void XmlParser::readBuffer()
 	}
 }
 
+void XmlParser::openXMLStream(const QString &filename)
+{
+	openXMLStream(filename, "", "", nullptr);
+}
+
+void XmlParser::openXMLStream(const QString &filename, const QString &snapshot_file, const QByteArray &snapshot_stamp,
+															const std::function<QByteArray()> &get_snapshot_key)
+{
+	int ret = 0;
+	QByteArray snapshot_key;
+
+	// The key is computed at most once, when checking the existing snapshot or when writing a new one
+	auto get_key = [&snapshot_key, &get_snapshot_key](){
+		if(snapshot_key.isEmpty())
+			snapshot_key = get_snapshot_key();
+
+		return snapshot_key;
+	};
+
+	try
+	{
+		if(filename.isEmpty())
+			throw Exception(ErrorCode::AsgEmptyXMLBuffer,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		if(!QFileInfo(filename).isReadable())
+			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(filename),
+											ErrorCode::FileDirectoryNotAccessed,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		/* Entities substitution (XML_PARSE_NOENT) is not enabled here because the file's DTD declaration
+		 * can't be removed in streaming mode and that would allow the loading of external entities.
+		 * The predefined and character entities are always expanded by the parser */
+		xml_doc_filename=filename;
+
+		// A valid snapshot of the file is available so the elements are read from it
+		if(!snapshot_file.isEmpty() && snapshot.openForReading(snapshot_file, snapshot_stamp, get_key))
+		{
+			xml_doc=xmlNewDoc(reinterpret_cast<const xmlChar *>("1.0"));
+			root_elem=curr_elem=snapshot.readRootElement(xml_doc);
+			return;
+		}
+
+		xmlResetLastError();
+		stream_size=QFileInfo(filename).size();
+		xml_reader=xmlReaderForFile(QFile::encodeName(filename).constData(), nullptr,
+																XML_PARSE_NOBLANKS | XML_PARSE_NONET | XML_PARSE_BIG_LINES);
+
+		if(!xml_reader)
+			raiseStreamError();
+
+		// Moving the reader to the root element
+		while((ret = xmlTextReaderRead(xml_reader)) == 1 &&
+					xmlTextReaderNodeType(xml_reader) != XML_READER_TYPE_ELEMENT);
+
+		if(ret != 1)
+			raiseStreamError();
+
+		root_elem=curr_elem=xmlTextReaderCurrentNode(xml_reader);
+		xml_doc=root_elem->doc;
+
+		if(dtd && dtd_name != reinterpret_cast<const char *>(root_elem->name))
+		{
+			throw Exception(Exception::getErrorMessage(ErrorCode::LibXMLError)
+											.arg(root_elem->line).arg(0)
+											.arg(QString("root and DTD name do not match '%1' and '%2'").arg(reinterpret_cast<const char *>(root_elem->name), dtd_name))
+											.arg(""),
+											ErrorCode::LibXMLError,__PRETTY_FUNCTION__,__FILE__,__LINE__,nullptr, xml_doc_filename);
+		}
+
+		validateStreamElement(root_elem, false);
+
+		if(!snapshot_file.isEmpty())
+		{
+			try
+			{
+				snapshot.openForWriting(snapshot_file, snapshot_stamp, get_key());
+				snapshot.writeRootElement(root_elem);
+			}
+			catch(Exception &)
+			{
+				snapshot.close();
+			}
+		}
+	}
+	catch(Exception &e)
+	{
+		restartParser();
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e, filename);
+	}
+}
+
+bool XmlParser::readNextStreamElement()
+{
+	int ret = 0;
+	bool read_child = false;
+	xmlNode *prev_elem = root_elem;
+
+	if(!isStreamOpen())
+		throw Exception(ErrorCode::OprNotAllocatedElementTree,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	// The stream reached its end
+	if(!root_elem)
+		return false;
+
+	/* If the current root is the document's root element we need to step into its children
+	 * otherwise we skip the subtree of the element previously read (which is freed by the reader) */
+	read_child = root_elem->parent && root_elem->parent->type == XML_DOCUMENT_NODE;
+
+	while(!elems_stack.empty())
+		elems_stack.pop();
+
+	root_elem=curr_elem=nullptr;
+
+	if(snapshot.isReading())
+	{
+		// Freeing the element previously read from the snapshot
+		if(!read_child)
+		{
+			xmlUnlinkNode(prev_elem);
+			xmlFreeNode(prev_elem);
+		}
+
+		root_elem=curr_elem=snapshot.readElement(xml_doc);
+
+		if(root_elem)
+			curr_line=getElementLine(root_elem);
+
+		return root_elem != nullptr;
+	}
+
+	// An empty root element has no children to be read
+	if(read_child && xmlTextReaderIsEmptyElement(xml_reader))
+		return false;
+
+	ret = read_child ? xmlTextReaderRead(xml_reader) : xmlTextReaderNext(xml_reader);
+
+	while(ret == 1 && xmlTextReaderDepth(xml_reader) > 0)
+	{
+		if(xmlTextReaderDepth(xml_reader) == 1 &&
+			 xmlTextReaderNodeType(xml_reader) == XML_READER_TYPE_ELEMENT)
+		{
+			root_elem=curr_elem=xmlTextReaderExpand(xml_reader);
+
+			if(!root_elem)
+				raiseStreamError();
+
+			curr_line=getElementLine(root_elem);
+			validateStreamElement(root_elem, true);
+			writeSnapshotElement(root_elem);
+			return true;
+		}
+
+		ret = xmlTextReaderNext(xml_reader);
+	}
+
+	if(ret < 0)
+		raiseStreamError();
+
+	// The whole file was read so the snapshot can be stored
+	writeSnapshotElement(nullptr);
+	return false;
+}
+
+void XmlParser::writeSnapshotElement(xmlNode *elem)
+{
+	if(!snapshot.isWriting())
+		return;
+
+	try
+	{
+		if(elem)
+			snapshot.writeElement(elem);
+		else
+			snapshot.finish();
+	}
+	catch(Exception &)
+	{
+		snapshot.close();
+	}
+}
+
+bool XmlParser::isStreamOpen()
+{
+	return xml_reader != nullptr || snapshot.isReading();
+}
+
+bool XmlParser::isSnapshotLoaded()
+{
+	return snapshot.isReading();
+}
+
+int XmlParser::getStreamProgress()
+{
+	if(snapshot.isReading())
+		return root_elem ? snapshot.getReadProgress() : 100;
+
+	// When the end of the stream is reached there's no current root element
+	if(!xml_reader || !root_elem || stream_size <= 0)
+		return 100;
+
+	return std::min<int>(100, (xmlTextReaderByteConsumed(xml_reader) * 100) / stream_size);
+}
+
+void XmlParser::validateStreamElement(xmlNode *elem, bool subtree)
+{
+	xmlValidCtxt *valid_ctx=nullptr;
+	xmlDtd *ext_subset=nullptr, *int_subset=nullptr;
+	int valid = 0;
+
+	if(!dtd || !elem)
+		return;
+
+	/* The cached DTD is temporarily attached to the document being streamed (and the internal
+	 * DTD declared in the file, if any, is ignored) in order to validate the element */
+	ext_subset=xml_doc->extSubset;
+	int_subset=xml_doc->intSubset;
+	xml_doc->extSubset=dtd;
+	xml_doc->intSubset=nullptr;
+
+	xmlResetLastError();
+	valid_ctx=xmlNewValidCtxt();
+	valid=(subtree ? xmlValidateElement(valid_ctx, xml_doc, elem) : xmlValidateOneElement(valid_ctx, xml_doc, elem));
+	xmlFreeValidCtxt(valid_ctx);
+
+	xml_doc->extSubset=ext_subset;
+	xml_doc->intSubset=int_subset;
+
+	if(!valid)
+		raiseStreamError();
+}
+
+void XmlParser::raiseStreamError()
+{
+	xmlError *xml_error=xmlGetLastError();
+	QString msg, file;
+
+	if(xml_error)
+	{
+		msg=xml_error->message;
+		file=xml_error->file;
+		if(!file.isEmpty()) file=QString("(%1)").arg(file);
+		msg.replace("\n"," ");
+	}
+
+	throw Exception(Exception::getErrorMessage(ErrorCode::LibXMLError)
+									.arg(xml_error ? xml_error->line : 0).arg(xml_error ? xml_error->int2 : 0).arg(msg).arg(file),
+									ErrorCode::LibXMLError,__PRETTY_FUNCTION__,__FILE__,__LINE__,nullptr, xml_doc_filename);
+}
+
 void XmlParser::savePosition()
 {
 	if(!root_elem)
@@ -252,13 +623,25 @@ void XmlParser::restartParser()
 {
 	root_elem=curr_elem=nullptr;
 	curr_line = 0;
+	stream_size = 0;
+	snapshot.close();
+
+	// In streaming mode the document is deallocated together with the reader
+	if(xml_reader)
+	{
+		xmlFreeTextReader(xml_reader);
+		xml_reader=nullptr;
+		xml_doc=nullptr;
+	}
 
 	if(xml_doc)
 	{
 		xmlFreeDoc(xml_doc);
 		xml_doc=nullptr;
 	}
-	dtd_decl=xml_buffer=xml_decl="";
+	xml_buffer.clear();
+	dtd_name.clear();
+	dtd=nullptr;
 
 	while(!elems_stack.empty())
 		elems_stack.pop();
@@ -271,6 +654,7 @@ bool XmlParser::accessElement(ElementType elem_type)
 {
 	bool has_elem;
 	xmlNode *elems[4];
+	int line = 0;
 
 	if(!root_elem)
 		throw Exception(ErrorCode::OprNotAllocatedElementTree,__PRETTY_FUNCTION__,__FILE__,__LINE__);
@@ -290,26 +674,31 @@ bool XmlParser::accessElement(ElementType elem_type)
 	{
 		curr_elem=elems[elem_type];
 
-		/* NOTE: Due to XML2 implementation big line numbers are stored in the psvi
-		 * attribute so we need to convert the void* to char and convert it back to integer value */
-		if(curr_elem->line == 65535 && curr_elem->next && curr_elem->next->psvi != nullptr)
-		{
-			char hex_value[10] = "";
-			int aux_line = 0;
-
-			sprintf(hex_value, "%p", curr_elem->next->psvi);
-			aux_line = static_cast<int>(strtol(hex_value, nullptr, 16));
+		line = getElementLine(curr_elem);
 
-			if(curr_line < aux_line)
-				curr_line = aux_line;
-		}
-		else if(curr_elem->line > curr_line)
-			curr_line = curr_elem->line;
+		if(line > curr_line)
+			curr_line = line;
 	}
 
 	return has_elem;
 }
 
+int XmlParser::getElementLine(const xmlNode *elem)
+{
+	/* NOTE: Due to XML2 implementation big line numbers are stored in the psvi attribute
+	 * of the text node next to the element (or of the element itself when it was read from
+	 * a snapshot) so we need to convert the void* back to integer value */
+	if(elem->line == 65535)
+	{
+		const xmlNode *node = elem->psvi != nullptr ? elem : elem->next;
+
+		if(node && node->psvi != nullptr)
+			return static_cast<int>(reinterpret_cast<std::intptr_t>(node->psvi));
+	}
+
+	return elem->line;
+}
+
 bool XmlParser::hasElement(ElementType elem_type, xmlElementType xml_node_type)
 {
 	if(!root_elem)
@@ -421,6 +810,9 @@ QString XmlParser::getLoadedFilename()
 
 QString XmlParser::getXMLBuffer()
 {
+	if(xml_buffer.isEmpty() && !xml_doc_filename.isEmpty())
+		return QString::fromUtf8(UtilsNs::loadFile(xml_doc_filename));
+
 	return xml_buffer;
 }
 
@@ -434,7 +826,8 @@ int XmlParser::getCurrentBufferLine()
 
 int XmlParser::getBufferLineCount()
 {
-	if(xml_doc)
+	// In streaming mode the amount of lines is unknown until the end of the file
+	if(xml_doc && !isStreamOpen())
 	{
 		/* To get the very last line of the document is necessary to call
 		the last element of the last because xml_doc->last->line stores the
@@ -28,18 +28,30 @@
 
 #include <libxml/parser.h>
 #include <libxml/tree.h>
+#include <libxml/valid.h>
+#include <libxml/xmlreader.h>
+#include <QMutex>
 #include "schemaparser.h"
+#include "xmlsnapshot.h"
 #include "exception.h"
 #include <stack>
+#include <atomic>
 #include <iostream>
 #include "attribsmap.h"
 
 class __libparsers XmlParser {
 	private:
-		/*! \brief This global counter holds the number of parsers instances created on the application. This is done to control
-		 * when to call xmlInitParser() and xmlCleanupParser() as these functions need to be called only once in the application.
-		 * Reference: http://xmlsoft.org/html/libxml-parser.html#xmlCleanupParser */
-		static int parser_instances;
+		/*! \brief This global counter holds the number of parsers instances alive on the application (in any thread). It's changed
+		 * only while dtd_cache_mutex is locked and it's used to free the DTD cache when the last parser is destroyed. */
+		static std::atomic<int> parser_instances;
+
+		/*! \brief Stores the DTDs already parsed (and with the element content models built) indexed by the DTD file path.
+		 * The DTDs are shared by all the parser instances and are only read by the validation so the same DTD can be
+		 * used by parsers in different threads. The cache is freed when the last parser instance is destroyed */
+		static std::map<QString, xmlDtd *> dtd_cache;
+
+		//! \brief Controls the concurrent access to the DTD cache
+		static QMutex dtd_cache_mutex;
 
 		/*! \brief Stores the name of the file that generated the xml buffer when
 		 loadXMLFile() method is called */
@@ -48,6 +60,17 @@ class __libparsers XmlParser {
 		//! \brief Stores the xml document (element tree) generated after the buffer reading
 		xmlDoc *xml_doc;
 
+		/*! \brief Stores the reader used to load a file in streaming mode (see openXMLStream()).
+		 * When the reader is allocated the document (xml_doc) belongs to it */
+		xmlTextReader *xml_reader;
+
+		//! \brief Stores the size (in bytes) of the file being read in streaming mode
+		qint64 stream_size;
+
+		/*! \brief The binary snapshot from which the document is read in streaming mode, or in which
+		 * the document is written while it is read from the original file (see openXMLStream()) */
+		XmlSnapshot snapshot;
+
 		//! \brief Stores the approximated line position on the current parsed buffer
 		int curr_line;
 
@@ -63,23 +86,51 @@ class __libparsers XmlParser {
 		 position is necessary call restorePosition() */
 		std::stack<xmlNode *> elems_stack;
 
-		//! \brief Stores the document DTD declaration
-		QString	dtd_decl,
-		//! \brief Stores XML document to be analyzed
-		xml_buffer,
-		/*! \brief Stores the declaration <?xml?>. If this isn't exists it will be
-										 a default declaration. */
-		xml_decl;
+		//! \brief Stores the DTD (from the cache) used to validate the documents
+		xmlDtd *dtd;
+
+		//! \brief Stores the name of the DTD which must match the document's root element name
+		QString dtd_name,
+
+		/*! \brief Stores XML document to be analyzed. When the document is loaded from a file
+		 this buffer is empty since the file contents are handed directly to the libxml2 */
+		xml_buffer;
+
+		/*! \brief Returns the DTD parsed from the provided file, parsing it and storing it in the cache
+		 if it wasn't used before. An exception is raised if the DTD can't be parsed */
+		static xmlDtd *getCachedDTD(const QString &dtd_file);
+
+		//! \brief Frees all the DTDs in the cache. The caller must hold dtd_cache_mutex
+		static void clearDTDCache();
+
+		/*! \brief Returns if the buffer has a DTD declaration (<!DOCTYPE>) in its prolog
+		 (the portion of the document before the root element) */
+		static bool hasDTDDeclaration(const char *buffer, qint64 size);
 
 		/*! \brief Remove the original DTD from the document. This is done to evit that
 		 the user insert some external dtd in the model file that is not valid for pgModeler */
 		void removeDTD();
 
-		/*! \brief Makes the interpretation of XML inside the buffer validating it according to
-		 DTD defined configured (by the parser) to the buffer. Initializes
-		 the necessary attributes to make possible the navigation through the element tree
-		 generated from the XML document read. */
-		void readBuffer();
+		/*! \brief Makes the interpretation of the UTF-8 XML buffer validating it against the DTD
+		 configured in the parser. Initializes the necessary attributes to make possible the navigation
+		 through the element tree generated from the XML document read. The buffer is only accessed
+		 during the call so it can be a memory mapped file */
+		void readBuffer(const char *buffer, qint64 size);
+
+		/*! \brief Validates the provided element of the document being streamed against the DTD.
+		 * If the subtree param is false only the element itself (without its children) is validated */
+		void validateStreamElement(xmlNode *elem, bool subtree);
+
+		//! \brief Raises an exception using the last error registered by libxml2
+		void raiseStreamError();
+
+		/*! \brief Writes the element to the snapshot being generated (if any). A null element finishes
+		 * the snapshot. If an error occurs the snapshot is discarded since it's only a cache */
+		void writeSnapshotElement(xmlNode *elem);
+
+		/*! \brief Returns the line of the element in the document, including the ones greater than 65535
+		 * that libxml2 (and XmlSnapshot) store out of the element's line attribute */
+		static int getElementLine(const xmlNode *elem);
 
 	public:
 		//! \brief Constants used to referência the elements on the element tree
@@ -109,6 +160,36 @@ class __libparsers XmlParser {
 		//! \brief Loads the XML buffer from a string
 		void loadXMLBuffer(const QString &xml_buf);
 
+		/*! \brief Opens a file to be read in streaming mode. Differently from loadXMLFile() only the root element
+		 * is read (and positioned as current element) and the children of the root element are read one at time
+		 * through readNextStreamElement(). This way the whole document is never in memory at once.
+		 * The root element attributes are validated against the DTD, since its content model can't be checked
+		 * in this mode the DTD must declare it as ANY and the validation is made on each child element read */
+		void openXMLStream(const QString &filename);
+
+		/*! \brief Opens a file to be read in streaming mode using a binary snapshot as cache. If the snapshot file exists
+		 * and was generated with the same stamp (e.g. the file's size and modification time) or, when the stamp differs,
+		 * with the same key (e.g. a hash of the file contents, computed by get_snapshot_key only when needed) the elements
+		 * are read from the snapshot skipping the XML parsing and the DTD validation, otherwise, the file is read as in
+		 * openXMLStream(filename) and each element read and validated is written to a new snapshot which is stored when
+		 * all elements are read. Failures while writing the snapshot are ignored since it is only a cache */
+		void openXMLStream(const QString &filename, const QString &snapshot_file, const QByteArray &snapshot_stamp,
+											 const std::function<QByteArray()> &get_snapshot_key);
+
+		/*! \brief Reads the next child element of the root element (and its subtree) from the file opened in
+		 * streaming mode. The element read becomes the root and current element of the navigation and the
+		 * one previously read is freed. Returns false when there are no more elements to be read */
+		bool readNextStreamElement();
+
+		//! \brief Returns if a file is opened in streaming mode
+		bool isStreamOpen();
+
+		//! \brief Returns if the file opened in streaming mode is being read from a binary snapshot
+		bool isSnapshotLoaded();
+
+		//! \brief Returns the percentage (0 - 100) of the file opened in streaming mode that was already read
+		int getStreamProgress();
+
 		//! \brief Informs the DTD file used to make element validations
 		void setDTDFile(const QString &dtd_file, const QString &dtd_name);
 
@@ -159,7 +240,8 @@ class __libparsers XmlParser {
 		//! \brief Returns the filename that generated XML buffer
 		QString getLoadedFilename();
 
-		//! \brief Returns the full parser buffer
+		/*! \brief Returns the full parser buffer. In case the buffer was loaded from a file
+		 the contents of that file are read again and returned */
 		QString getXMLBuffer();
 
 		//! \brief Reset all the elements resposible to the navigation through the element tree
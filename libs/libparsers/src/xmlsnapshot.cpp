@@ -0,0 +1,409 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "xmlsnapshot.h"
+#include "exception.h"
+#include <QDateTime>
+#include <algorithm>
+#include <cstdint>
+
+XmlSnapshot::XmlSnapshot()
+{
+	stream.setVersion(QDataStream::Qt_6_0);
+}
+
+XmlSnapshot::~XmlSnapshot()
+{
+	close();
+}
+
+bool XmlSnapshot::openForReading(const QString &filename, const QByteArray &stamp, const std::function<QByteArray()> &get_key)
+{
+	quint32 magic = 0, version = 0;
+	QByteArray snp_key, snp_stamp;
+	qint64 stamp_pos = 0;
+
+	close();
+	input.setFileName(filename);
+
+	if(!input.exists() || !input.open(QFile::ReadOnly))
+		return false;
+
+	stream.setDevice(&input);
+	stream >> magic >> version >> snp_key;
+	stamp_pos = input.pos();
+	stream >> snp_stamp;
+
+	if(stream.status() != QDataStream::Ok || magic != Magic || version != FormatVersion)
+	{
+		close();
+		return false;
+	}
+
+	// The key (which is expensive to compute) is only checked when the stamp doesn't match
+	if(snp_stamp != stamp && snp_key != get_key())
+	{
+		close();
+		return false;
+	}
+
+	/* The modification time of the snapshot is renewed in each reading so the least recently used
+	 * snapshots can be identified and pruned (see DatabaseModel::pruneSnapshots()). Additionally, if the original
+	 * document was not changed but the stamp differs (e.g. it was only copied or touched) the stamp is updated in place,
+	 * avoiding the key checking in the next readings. Since the snapshot is only a cache, failures here are ignored */
+	QFile snp_file(filename);
+
+	if(snp_file.open(QFile::ReadWrite))
+	{
+		if(snp_stamp != stamp && snp_stamp.size() == stamp.size() && snp_file.seek(stamp_pos))
+		{
+			QDataStream stamp_stream(&snp_file);
+			stamp_stream.setVersion(stream.version());
+			stamp_stream << stamp;
+			snp_file.flush();
+		}
+
+		snp_file.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+	}
+
+	return true;
+}
+
+void XmlSnapshot::openForWriting(const QString &filename, const QByteArray &stamp, const QByteArray &key)
+{
+	close();
+	output.setFileName(filename);
+
+	if(!output.open(QFile::WriteOnly))
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
+										ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__, nullptr, output.errorString());
+	}
+
+	stream.setDevice(&output);
+	stream << Magic << FormatVersion << key << stamp;
+	checkStreamStatus();
+}
+
+void XmlSnapshot::writeName(const xmlChar *name)
+{
+	QByteArray name_str(reinterpret_cast<const char *>(name));
+	auto itr = name_ids.find(name_str);
+
+	/* A name not written yet is stored as the next index followed by the name itself,
+	 * the subsequent occurrences of the name are written only as the index */
+	if(itr == name_ids.end())
+	{
+		quint32 id = name_ids.size();
+		name_ids[name_str] = id;
+		stream << id << name_str;
+	}
+	else
+		stream << itr->second;
+}
+
+QByteArray XmlSnapshot::readName()
+{
+	quint32 id = 0;
+
+	stream >> id;
+
+	if(id == names.size())
+	{
+		QByteArray name;
+		stream >> name;
+		names.push_back(name);
+	}
+	else if(id > names.size())
+		stream.setStatus(QDataStream::ReadCorruptData);
+
+	checkStreamStatus();
+	return names[id];
+}
+
+void XmlSnapshot::writeNode(const xmlNode *node, bool incl_children)
+{
+	quint32 count = 0;
+
+	if(node->type == XML_ELEMENT_NODE)
+	{
+		stream << static_cast<quint8>(ElementMarker);
+		writeName(node->name);
+
+		// xmlGetLineNo() retrieves the real line number even when it is greater than 65535 (see readNode())
+		stream << static_cast<quint32>(std::max<long>(xmlGetLineNo(node), 0));
+
+		for(xmlAttr *attr = node->properties; attr; attr = attr->next)
+			count++;
+
+		stream << count;
+
+		for(xmlAttr *attr = node->properties; attr; attr = attr->next)
+		{
+			writeName(attr->name);
+			stream << QByteArray(attr->children ? reinterpret_cast<const char *>(attr->children->content) : "");
+		}
+
+		count = 0;
+
+		if(incl_children)
+		{
+			for(xmlNode *child = node->children; child; child = child->next)
+			{
+				if(child->type == XML_ELEMENT_NODE || child->type == XML_TEXT_NODE ||
+					 child->type == XML_CDATA_SECTION_NODE || child->type == XML_COMMENT_NODE)
+					count++;
+			}
+		}
+
+		stream << count;
+
+		for(xmlNode *child = (incl_children ? node->children : nullptr); child; child = child->next)
+			writeNode(child, true);
+	}
+	else if(node->type == XML_TEXT_NODE || node->type == XML_CDATA_SECTION_NODE || node->type == XML_COMMENT_NODE)
+	{
+		if(node->type == XML_TEXT_NODE)
+			stream << static_cast<quint8>(TextMarker);
+		else if(node->type == XML_CDATA_SECTION_NODE)
+			stream << static_cast<quint8>(CDataMarker);
+		else
+			stream << static_cast<quint8>(CommentMarker);
+
+		stream << QByteArray(reinterpret_cast<const char *>(node->content));
+	}
+}
+
+xmlNode *XmlSnapshot::readNode(xmlDoc *doc, bool incl_children)
+{
+	quint8 marker = EndMarker;
+	QByteArray content, name;
+	xmlNode *node = nullptr, *child = nullptr;
+	quint32 count = 0, line = 0;
+
+	stream >> marker;
+	checkStreamStatus();
+
+	if(marker == EndMarker)
+		return nullptr;
+
+	if(marker == ElementMarker)
+	{
+		name = readName();
+		node = xmlNewDocNode(doc, nullptr, reinterpret_cast<const xmlChar *>(name.constData()), nullptr);
+
+		try
+		{
+			stream >> line >> count;
+
+			/* Mimics the libxml2 behavior when parsing with XML_PARSE_BIG_LINES: line numbers that don't fit
+			 * the node's line attribute are stored in the psvi attribute so XmlParser can retrieve them */
+			if(line < 65535)
+				node->line = static_cast<unsigned short>(line);
+			else
+			{
+				node->line = 65535;
+				node->psvi = reinterpret_cast<void *>(static_cast<std::intptr_t>(line));
+			}
+
+			for(quint32 i = 0; i < count; i++)
+			{
+				name = readName();
+				stream >> content;
+				checkStreamStatus();
+
+				xmlNewProp(node, reinterpret_cast<const xmlChar *>(name.constData()),
+									 reinterpret_cast<const xmlChar *>(content.constData()));
+			}
+
+			stream >> count;
+
+			if(!incl_children && count > 0)
+				stream.setStatus(QDataStream::ReadCorruptData);
+
+			checkStreamStatus();
+
+			for(quint32 i = 0; i < count; i++)
+			{
+				child = readNode(doc, true);
+
+				if(!child)
+				{
+					stream.setStatus(QDataStream::ReadCorruptData);
+					checkStreamStatus();
+				}
+
+				xmlAddChild(node, child);
+			}
+		}
+		catch(Exception &)
+		{
+			xmlFreeNode(node);
+			throw;
+		}
+
+		return node;
+	}
+
+	stream >> content;
+	checkStreamStatus();
+
+	if(marker == TextMarker)
+		return xmlNewDocTextLen(doc, reinterpret_cast<const xmlChar *>(content.constData()), content.size());
+
+	if(marker == CDataMarker)
+		return xmlNewCDataBlock(doc, reinterpret_cast<const xmlChar *>(content.constData()), content.size());
+
+	if(marker == CommentMarker)
+		return xmlNewDocComment(doc, reinterpret_cast<const xmlChar *>(content.constData()));
+
+	stream.setStatus(QDataStream::ReadCorruptData);
+	checkStreamStatus();
+	return nullptr;
+}
+
+void XmlSnapshot::checkStreamStatus()
+{
+	if(stream.status() == QDataStream::Ok)
+		return;
+
+	QString filename = isReading() ? input.fileName() : output.fileName();
+
+	if(isReading())
+	{
+		close();
+		QFile::remove(filename);
+
+		throw Exception(Exception::getErrorMessage(ErrorCode::InvModelSnapshotFile).arg(filename),
+										ErrorCode::InvModelSnapshotFile,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	close();
+	throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
+									ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+}
+
+void XmlSnapshot::writeRootElement(const xmlNode *root)
+{
+	if(!isWriting() || !root)
+		throw Exception(ErrorCode::OprNotAllocatedElementTree,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	writeNode(root, false);
+	checkStreamStatus();
+}
+
+void XmlSnapshot::writeElement(const xmlNode *elem)
+{
+	if(!isWriting() || !elem)
+		throw Exception(ErrorCode::OprNotAllocatedElementTree,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	writeNode(elem, true);
+	checkStreamStatus();
+}
+
+xmlNode *XmlSnapshot::readRootElement(xmlDoc *doc)
+{
+	xmlNode *root = nullptr;
+
+	if(!isReading() || !doc)
+		throw Exception(ErrorCode::OprNotAllocatedElementTree,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	root = readNode(doc, false);
+
+	if(!root || root->type != XML_ELEMENT_NODE)
+	{
+		if(root) xmlFreeNode(root);
+		stream.setStatus(QDataStream::ReadCorruptData);
+		checkStreamStatus();
+	}
+
+	xmlDocSetRootElement(doc, root);
+	return root;
+}
+
+xmlNode *XmlSnapshot::readElement(xmlDoc *doc)
+{
+	xmlNode *elem = nullptr, *root = xmlDocGetRootElement(doc);
+
+	if(!isReading() || !root)
+		throw Exception(ErrorCode::OprNotAllocatedElementTree,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	elem = readNode(doc, true);
+
+	if(elem)
+		xmlAddChild(root, elem);
+
+	return elem;
+}
+
+void XmlSnapshot::finish()
+{
+	if(!isWriting())
+		return;
+
+	stream << static_cast<quint8>(EndMarker);
+	checkStreamStatus();
+
+	stream.setDevice(nullptr);
+
+	if(!output.commit())
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(output.fileName()),
+										ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__, nullptr, output.errorString());
+	}
+
+	names.clear();
+	name_ids.clear();
+}
+
+void XmlSnapshot::close()
+{
+	stream.setDevice(nullptr);
+	stream.resetStatus();
+
+	if(input.isOpen())
+		input.close();
+
+	// Discarding the unfinished snapshot (the destination file is kept untouched)
+	if(output.isOpen())
+	{
+		output.cancelWriting();
+		output.commit();
+	}
+
+	names.clear();
+	name_ids.clear();
+}
+
+int XmlSnapshot::getReadProgress()
+{
+	if(!isReading() || input.size() == 0)
+		return 100;
+
+	return (input.pos() * 100) / input.size();
+}
+
+bool XmlSnapshot::isReading()
+{
+	return input.isOpen();
+}
+
+bool XmlSnapshot::isWriting()
+{
+	return output.isOpen();
+}
@@ -0,0 +1,134 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libparsers
+\class XmlSnapshot
+\brief Implements a compact binary representation of an already validated XML document used as cache for
+documents that are loaded several times without changes (e.g. database models). The document is stored as the root
+element (without children) followed by each child element of the root with its complete subtree so it can be written
+and read in streaming mode together with XmlParser. Elements and attributes names are stored only once (in the first
+time they appear) and then referenced by their indexes. The snapshot file carries two identifiers of the original document
+provided by the user: a stamp, which is cheap to compute (e.g. from the file's size and modification time), and a key
+(generally a hash of the original document's contents) which is only computed when the stamp doesn't match.
+Only the validated document tree is stored: what is built from it (e.g. the objects of a database model) must be created again
+in each loading. Line numbers greater than 65535 are restored the same way libxml2 does (in the psvi attribute of the element).
+*/
+
+#ifndef XML_SNAPSHOT_H
+#define XML_SNAPSHOT_H
+
+#include "parsersglobal.h"
+#include <libxml/tree.h>
+#include <QFile>
+#include <QSaveFile>
+#include <QDataStream>
+#include <functional>
+#include <map>
+#include <vector>
+
+class __libparsers XmlSnapshot {
+	private:
+		//! \brief Identifies the snapshot files (the chars "PGMS")
+		static constexpr quint32 Magic = 0x50474D53;
+
+		//! \brief Version of the binary format. This must be incremented every time the format is changed
+		static constexpr quint32 FormatVersion = 2;
+
+		//! \brief Markers that precedes each node written in the snapshot
+		enum NodeMarker: quint8 {
+			EndMarker,
+			ElementMarker,
+			TextMarker,
+			CDataMarker,
+			CommentMarker
+		};
+
+		//! \brief File from which the snapshot is read
+		QFile input;
+
+		//! \brief File in which the snapshot is written (only replaces the destination file when finished)
+		QSaveFile output;
+
+		QDataStream stream;
+
+		//! \brief Stores the names read from the snapshot (the position in the vector is the name's index)
+		std::vector<QByteArray> names;
+
+		//! \brief Stores the indexes of the names already written in the snapshot
+		std::map<QByteArray, quint32> name_ids;
+
+		void writeName(const xmlChar *name);
+
+		QByteArray readName();
+
+		//! \brief Writes the node and its children (if incl_children is true) to the snapshot
+		void writeNode(const xmlNode *node, bool incl_children);
+
+		/*! \brief Creates in the document the node read from the snapshot (and its children, if incl_children is true).
+		 * Returns nullptr if the end marker is read */
+		xmlNode *readNode(xmlDoc *doc, bool incl_children);
+
+		/*! \brief Raises an exception if the stream has an error status. In case of reading errors
+		 * the snapshot file is removed since it's probably corrupted */
+		void checkStreamStatus();
+
+	public:
+		XmlSnapshot();
+		~XmlSnapshot();
+
+		/*! \brief Opens the snapshot file for reading. Returns false if the file doesn't exist or it is not a valid snapshot
+		 * of the original document (in that case the snapshot must be recreated). The snapshot is valid if it was written
+		 * with the provided stamp or, when the stamp differs, with the key returned by get_key, which is called only in
+		 * that case. A snapshot validated by the key has its stamp replaced by the provided one. The modification time of
+		 * a valid snapshot is updated to the current time so the least recently used snapshots can be identified */
+		bool openForReading(const QString &filename, const QByteArray &stamp, const std::function<QByteArray()> &get_key);
+
+		/*! \brief Opens the snapshot file for writing and writes its header. The contents of the snapshot
+		 * are only stored in the file when the snapshot is finished via finish() */
+		void openForWriting(const QString &filename, const QByteArray &stamp, const QByteArray &key);
+
+		/*! \brief Writes the root element of the document (without its children). This must be the first element
+		 * written after opening the snapshot. Then, each child element of the root must be written via writeElement() */
+		void writeRootElement(const xmlNode *root);
+
+		//! \brief Writes an element and all its subtree
+		void writeElement(const xmlNode *elem);
+
+		//! \brief Reads the root element (without children) creating it in the provided document as the document's root
+		xmlNode *readRootElement(xmlDoc *doc);
+
+		/*! \brief Reads an element (and its subtree) creating it in the provided document as a child of the
+		 * document's root. Returns nullptr if there are no more elements to be read */
+		xmlNode *readElement(xmlDoc *doc);
+
+		//! \brief Writes the end marker and stores the snapshot in the destination file
+		void finish();
+
+		//! \brief Closes the snapshot file discarding it if it was being written and wasn't finished
+		void close();
+
+		//! \brief Returns the percentage (0 - 100) of the snapshot being read that was already read
+		int getReadProgress();
+
+		bool isReading();
+
+		bool isWriting();
+};
+
+#endif
@@ -15,13 +15,15 @@ src/globalattributes.h \
 src/pgsqlversions.h \
 src/doublenan.h \
 src/application.h \
-src/utilsns.h
+src/utilsns.h \
+src/progressthrottle.h
 
 SOURCES += src/exception.cpp \
 src/globalattributes.cpp \
 src/pgsqlversions.cpp \
 src/application.cpp \
-src/utilsns.cpp
+src/utilsns.cpp \
+src/progressthrottle.cpp
 
 # Deployment settings
 target.path = $$PRIVATELIBDIR
@@ -284,6 +284,8 @@ QString Exception::messages[Exception::ErrorCount][2]={
 	{"MalformedCsvMissingDelim", QT_TR_NOOP("Malformed CSV document detected! Missing close text delimiter `%1' row `%2'!")},
 	{"RefInvCsvDocumentValue", QT_TR_NOOP("Trying to get a value from the CSV document in an invalid position: row `%1', column `%2'!")},
 	{"ModelFileSaveFailure", QT_TR_NOOP("Failed to save the database model to file `%1'! In order to avoid data loss, the backup file `%2' was restored. Note that the backup file will not be erased automatically, the user must delete it manually or, if preferred, copy it to a safe place to have an extra security copy!")},
+	{"InvModelSnapshotFile", QT_TR_NOOP("The model snapshot file `%1' is corrupted or incomplete! The file was discarded, please, try to load the model again.")},
+	{"OprModelModificationsBlocked", QT_TR_NOOP("The database model `%1' can't have objects added or removed while an operation that reads it in parallel (e.g. model validation) is running!")},
 };
 
 Exception::Exception()
@@ -300,12 +300,14 @@ enum class ErrorCode: unsigned {
 	MalformedCsvInvalidCols,
 	MalformedCsvMissingDelim,
 	RefInvCsvDocumentValue,
-	ModelFileSaveFailure
+	ModelFileSaveFailure,
+	InvModelSnapshotFile,
+	OprModelModificationsBlocked
 };
 
 class __libutils Exception {
 	private:
-		static constexpr unsigned ErrorCount=265;
+		static constexpr unsigned ErrorCount=267;
 
 		//! \brief Constants used to access the error details
 		static constexpr unsigned ErrorCodeId=0, ErrorMessage=1;
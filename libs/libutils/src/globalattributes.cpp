@@ -70,6 +70,8 @@ const QString GlobalAttributes::MetadataDTD("metadata");
 const QString GlobalAttributes::ConfigurationExt(".conf");
 const QString GlobalAttributes::HighlightFileSuffix("-highlight");
 const QString GlobalAttributes::ThemesDir("themes");
+const QString GlobalAttributes::SnapshotsDir("snapshots");
+const QString GlobalAttributes::ImportCachesDir("importcaches");
 
 const QString GlobalAttributes::CodeHighlightConf("source-code-highlight");
 const QString GlobalAttributes::AppearanceConf("appearance");
@@ -122,6 +122,8 @@ class __libutils GlobalAttributes {
 		ConfigurationExt, //! \brief Default extension for configuration files
 		HighlightFileSuffix, //! \brief Suffix of language highlight configuration files
 		ThemesDir,					 //! \brief Default name for the ui style directory
+		SnapshotsDir,				 //! \brief Default name for the directory which stores the binary snapshots of the loaded models
+		ImportCachesDir,		 //! \brief Default name for the directory which stores the cached models imported by the diff process
 
 		CodeHighlightConf,  //! \brief Default name for the language highlight dtd
 		AppearanceConf,   //! \brief Default name for the appearance configuration file
@@ -0,0 +1,69 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+#include "progressthrottle.h"
+
+ProgressThrottle::ProgressThrottle(qint64 interval)
+{
+	setInterval(interval);
+	reset();
+}
+
+void ProgressThrottle::reset()
+{
+	timer.start();
+	next_report.store(0);
+	suppressed_count.store(0);
+}
+
+void ProgressThrottle::setInterval(qint64 interval)
+{
+	this->interval = interval < 0 ? 0 : interval;
+}
+
+qint64 ProgressThrottle::getInterval()
+{
+	return interval;
+}
+
+bool ProgressThrottle::isReportDue(int progress)
+{
+	qint64 elapsed = timer.elapsed(),
+			next = next_report.load(std::memory_order_relaxed);
+
+	if(progress >= 100 || interval == 0)
+	{
+		next_report.store(elapsed + interval, std::memory_order_relaxed);
+		return true;
+	}
+
+	/* When several threads reach the end of the interval at the same time only the one
+	 * that succeeds in moving the next report time forward gets the report */
+	if(elapsed >= next &&
+		 next_report.compare_exchange_strong(next, elapsed + interval, std::memory_order_relaxed))
+		return true;
+
+	suppressed_count.fetch_add(1, std::memory_order_relaxed);
+	return false;
+}
+
+unsigned ProgressThrottle::getSuppressedCount()
+{
+	return suppressed_count.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,75 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+/**
+\ingroup libutils
+\class ProgressThrottle
+\brief Limits the rate in which the long running operations (model loading, code generation, diff, export, etc.) report
+their progress. The operations that process one object at a time ask the throttle if a report is due before formatting the
+progress message and emitting the progress signal, so the messages are formatted, delivered to the user interface (often
+through queued connections) and painted only a few times per second instead of once per object. The final report
+(progress of 100%) is never suppressed. The throttle can be used by several threads at once, in that case only one of the
+threads asking for a report in the same interval gets it.
+*/
+
+#ifndef PROGRESS_THROTTLE_H
+#define PROGRESS_THROTTLE_H
+
+#include "utilsglobal.h"
+#include <QElapsedTimer>
+#include <atomic>
+
+class __libutils ProgressThrottle {
+	private:
+		//! \brief Counts the time elapsed since the throttle was (re)started
+		QElapsedTimer timer;
+
+		//! \brief Minimum interval (in ms) between two reports
+		qint64 interval;
+
+		//! \brief The elapsed time (in ms) from which the next report is allowed
+		std::atomic<qint64> next_report;
+
+		//! \brief Amount of reports suppressed since the throttle was (re)started
+		std::atomic<unsigned> suppressed_count;
+
+	public:
+		//! \brief Default interval (in ms) between two reports (about 20 reports per second)
+		static constexpr qint64 DefaultInterval = 50;
+
+		ProgressThrottle(qint64 interval = DefaultInterval);
+
+		/*! \brief Restarts the throttle so the next report is granted right away. This method must be called
+		 * at the beginning of the operation and never while other threads are using the throttle */
+		void reset();
+
+		//! \brief Changes the interval between reports. A zero interval grants all the reports
+		void setInterval(qint64 interval);
+
+		qint64 getInterval();
+
+		/*! \brief Returns true when the progress must be reported, i.e., when the interval elapsed since
+		 * the last granted report or the progress reached 100% */
+		bool isReportDue(int progress = -1);
+
+		//! \brief Returns the amount of reports suppressed since the throttle was (re)started
+		unsigned getSuppressedCount();
+};
+
+#endif
@@ -210,6 +210,9 @@ DEFINES += BINDIR=\\\"$${BINDIR}\\\" \
 #
 # XML_LIB   -> Full path to libxml2.(so | dll | dylib)
 # XML_INC   -> Root path where XML2 includes can be found
+#
+# ZLIB_LIB  -> The linker flags for zlib (used to write exported images in streaming mode). Since zlib
+#              is a dependency of libxml2 it's expected to be found in the default libraries paths
 
 linux: {
   # If all custom variables PGSQL_??? and XML_??? are defined
@@ -246,6 +249,8 @@ windows {
   INCLUDEPATH += "$$PGSQL_INC" "$$XML_INC"
 }
 
+!defined(ZLIB_LIB, var): ZLIB_LIB = -lz
+
 linux:defined(has_dep_paths,var) | macx | windows : {
   !exists($$PGSQL_LIB) {
     PKG_ERROR = "PostgreSQL libraries"
@@ -0,0 +1,11 @@
+include(../tests.pri)
+
+TARGET = pgmodeler-bench
+
+SOURCES += modelbenchmark.cpp \
+	   syntheticmodelgenerator.cpp
+
+HEADERS += syntheticmodelgenerator.h
+
+# The benchmarks are installed apart from the unit tests so they aren't executed by runtests
+target.path = $$BINDIR/benchmarks
@@ -0,0 +1,388 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+/**
+\ingroup tests
+\class ModelBenchmark
+\brief Measures the time spent by the main model operations (load, save, SQL export, validation, diff,
+undo/redo and references queries) over large models created by SyntheticModelGenerator. Each scenario
+runs once per scale factor listed in the environment variable PGMODELER_BENCH_SCALES (default: 1,2) which
+multiplies the amount of schemas of the generated model. The results can be written in machine-readable
+formats using the QtTest output options, e.g., "pgmodeler-bench -o results.xml,xml" or "-o results.csv,csv".
+*/
+
+#include <QtTest/QtTest>
+#include "syntheticmodelgenerator.h"
+#include "tools/modelvalidationhelper.h"
+#include "tools/modelsdiffhelper.h"
+#include "operationlist.h"
+#include "pgmodelerunittest.h"
+
+class ModelBenchmark: public QObject, public PgModelerUnitTest {
+	private:
+		Q_OBJECT
+
+		//! \brief Directory where the generated models are saved (removed when the benchmark finishes)
+		QTemporaryDir tmp_dir;
+
+		//! \brief Stores the files of the generated models per scale factor
+		std::map<unsigned, QString> model_files;
+
+		//! \brief Adds the scale factors as the data rows of the current benchmark
+		void addScales();
+
+		//! \brief Returns the file of the model generated for the scale, generating it if needed
+		QString getModelFile(unsigned scale);
+
+		//! \brief Loads the model generated for the scale
+		void loadModel(DatabaseModel &model, unsigned scale);
+
+	public:
+		ModelBenchmark() : PgModelerUnitTest(SCHEMASDIR){}
+
+	private slots:
+		void initTestCase();
+		void benchmarkLoad_data();
+		void benchmarkLoad();
+		void benchmarkSave_data();
+		void benchmarkSave();
+		void benchmarkSQLExport_data();
+		void benchmarkSQLExport();
+		void benchmarkValidation_data();
+		void benchmarkValidation();
+		void benchmarkDiff_data();
+		void benchmarkDiff();
+		void benchmarkUndoRedo_data();
+		void benchmarkUndoRedo();
+		void benchmarkReferences_data();
+		void benchmarkReferences();
+};
+
+void ModelBenchmark::addScales()
+{
+	QStringList scales = qEnvironmentVariable("PGMODELER_BENCH_SCALES", "1,2").split(',', Qt::SkipEmptyParts);
+	unsigned scale = 0;
+	bool ok = false;
+
+	QTest::addColumn<unsigned>("scale");
+
+	for(auto &value : scales)
+	{
+		scale = value.trimmed().toUInt(&ok);
+
+		if(ok && scale > 0)
+			QTest::newRow(QString("x%1").arg(scale).toUtf8()) << scale;
+	}
+}
+
+QString ModelBenchmark::getModelFile(unsigned scale)
+{
+	if(model_files.count(scale))
+		return model_files[scale];
+
+	DatabaseModel model;
+	SyntheticModelGenerator generator(SyntheticModelGenerator::Params::fromEnvironment(scale));
+	QString file = tmp_dir.filePath(QString("synthetic_x%1%2").arg(scale).arg(GlobalAttributes::DbModelExt));
+
+	model.createSystemObjects(true);
+	generator.generateModel(&model);
+	model.saveModel(file, SchemaParser::XmlCode);
+	model_files[scale] = file;
+
+	qInfo() << QString("Model x%1: %2 objects, %3 tables, %4 relationships")
+						 .arg(scale).arg(model.getObjectCount())
+						 .arg(model.getObjectCount(ObjectType::Table))
+						 .arg(model.getObjectCount(ObjectType::Relationship) + model.getObjectCount(ObjectType::BaseRelationship));
+
+	return file;
+}
+
+void ModelBenchmark::loadModel(DatabaseModel &model, unsigned scale)
+{
+	model.createSystemObjects(false);
+	model.loadModel(getModelFile(scale));
+}
+
+void ModelBenchmark::initTestCase()
+{
+	QVERIFY(tmp_dir.isValid());
+
+	// The snapshots are disabled so the loading always parses the XML code
+	DatabaseModel::setSnapshotsDirectory("");
+}
+
+void ModelBenchmark::benchmarkLoad_data()
+{
+	addScales();
+}
+
+void ModelBenchmark::benchmarkLoad()
+{
+	QFETCH(unsigned, scale);
+
+	try
+	{
+		getModelFile(scale);
+
+		QBENCHMARK
+		{
+			DatabaseModel model;
+			loadModel(model, scale);
+		}
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelBenchmark::benchmarkSave_data()
+{
+	addScales();
+}
+
+void ModelBenchmark::benchmarkSave()
+{
+	QFETCH(unsigned, scale);
+
+	try
+	{
+		DatabaseModel model;
+		QString file = tmp_dir.filePath(QString("saved_x%1%2").arg(scale).arg(GlobalAttributes::DbModelExt));
+
+		loadModel(model, scale);
+
+		QBENCHMARK
+		{
+			// Invalidating the cached code of the objects so all of them are generated again
+			model.setCodesInvalidated();
+			model.saveModel(file, SchemaParser::XmlCode);
+		}
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelBenchmark::benchmarkSQLExport_data()
+{
+	addScales();
+}
+
+void ModelBenchmark::benchmarkSQLExport()
+{
+	QFETCH(unsigned, scale);
+
+	try
+	{
+		DatabaseModel model;
+		QString sql;
+
+		loadModel(model, scale);
+
+		QBENCHMARK
+		{
+			model.setCodesInvalidated();
+			sql = model.getSourceCode(SchemaParser::SqlCode);
+		}
+
+		QVERIFY(!sql.isEmpty());
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelBenchmark::benchmarkValidation_data()
+{
+	addScales();
+}
+
+void ModelBenchmark::benchmarkValidation()
+{
+	QFETCH(unsigned, scale);
+
+	try
+	{
+		DatabaseModel model;
+		ModelValidationHelper helper;
+
+		loadModel(model, scale);
+		helper.setValidationParams(&model);
+		helper.setFullValidation(true);
+
+		QBENCHMARK
+		{
+			helper.validateModel();
+		}
+
+		QCOMPARE(helper.getErrorCount(), 0u);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelBenchmark::benchmarkDiff_data()
+{
+	addScales();
+}
+
+void ModelBenchmark::benchmarkDiff()
+{
+	QFETCH(unsigned, scale);
+
+	try
+	{
+		DatabaseModel src_model, imp_model;
+		ModelsDiffHelper diff_hlp;
+		Table *table = nullptr;
+		Column *column = nullptr;
+
+		loadModel(src_model, scale);
+		loadModel(imp_model, scale);
+
+		/* Changing one of each ten tables of the compared model so the diff produces
+		 * some ALTER commands besides comparing all the objects */
+		for(unsigned idx = 0; idx < imp_model.getObjectCount(ObjectType::Table); idx += 10)
+		{
+			table = imp_model.getTable(idx);
+
+			if(table->isPartition() || table->isPartitioned())
+				continue;
+
+			column = new Column;
+			column->setName("diff_column");
+			column->setType(PgSqlType("text"));
+			table->addColumn(column);
+			table->setComment("Changed by the benchmark");
+		}
+
+		diff_hlp.setModels(&src_model, &imp_model);
+		diff_hlp.setPgSQLVersion(PgSqlVersions::DefaulVersion);
+
+		QBENCHMARK
+		{
+			diff_hlp.diffModels();
+		}
+
+		QVERIFY(!diff_hlp.getDiffDefinition().isEmpty());
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelBenchmark::benchmarkUndoRedo_data()
+{
+	addScales();
+}
+
+void ModelBenchmark::benchmarkUndoRedo()
+{
+	QFETCH(unsigned, scale);
+
+	try
+	{
+		DatabaseModel model;
+		OperationList op_list(&model);
+		Table *table = nullptr;
+
+		loadModel(model, scale);
+
+		// Registering the change of all tables in a single chain of operations
+		op_list.startOperationChain();
+
+		for(unsigned idx = 0; idx < model.getObjectCount(ObjectType::Table); idx++)
+		{
+			table = model.getTable(idx);
+			op_list.registerObject(table, Operation::ObjModified);
+			table->setComment("Changed by the benchmark");
+		}
+
+		op_list.finishOperationChain();
+
+		QBENCHMARK
+		{
+			op_list.undoOperation();
+			op_list.redoOperation();
+		}
+
+		QVERIFY(op_list.isUndoAvailable());
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelBenchmark::benchmarkReferences_data()
+{
+	addScales();
+}
+
+void ModelBenchmark::benchmarkReferences()
+{
+	QFETCH(unsigned, scale);
+
+	try
+	{
+		DatabaseModel model;
+		std::vector<BaseObject *> refs;
+		Table *table = nullptr;
+		unsigned ref_count = 0;
+
+		loadModel(model, scale);
+
+		// Retrieving the references to all tables and their columns (the most referenced objects)
+		QBENCHMARK
+		{
+			ref_count = 0;
+
+			for(unsigned idx = 0; idx < model.getObjectCount(ObjectType::Table); idx++)
+			{
+				table = model.getTable(idx);
+
+				refs.clear();
+				model.getObjectReferences(table, refs);
+				ref_count += refs.size();
+
+				for(auto &col : *table->getObjectList(ObjectType::Column))
+				{
+					refs.clear();
+					model.getObjectReferences(col, refs);
+					ref_count += refs.size();
+				}
+			}
+		}
+
+		QVERIFY(ref_count > 0);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+QTEST_MAIN(ModelBenchmark)
+#include "modelbenchmark.moc"
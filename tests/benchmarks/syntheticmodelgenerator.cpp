@@ -0,0 +1,319 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+#include "syntheticmodelgenerator.h"
+
+SyntheticModelGenerator::Params::Params()
+{
+	schemas = 4;
+	tables = 50;
+	columns = 10;
+	foreign_keys = 2;
+	inheritances = 5;
+	partitioned_tables = 2;
+	partitions = 4;
+	views = 10;
+	functions = 10;
+	seed = 0x5EED;
+}
+
+SyntheticModelGenerator::Params SyntheticModelGenerator::Params::fromEnvironment(unsigned scale)
+{
+	Params params;
+	std::map<const char *, unsigned *> env_vars = {
+		{ "PGMODELER_BENCH_SCHEMAS", &params.schemas },
+		{ "PGMODELER_BENCH_TABLES", &params.tables },
+		{ "PGMODELER_BENCH_COLUMNS", &params.columns },
+		{ "PGMODELER_BENCH_FKS", &params.foreign_keys },
+		{ "PGMODELER_BENCH_INHERITANCES", &params.inheritances },
+		{ "PGMODELER_BENCH_PARTITIONED", &params.partitioned_tables },
+		{ "PGMODELER_BENCH_PARTITIONS", &params.partitions },
+		{ "PGMODELER_BENCH_VIEWS", &params.views },
+		{ "PGMODELER_BENCH_FUNCTIONS", &params.functions },
+		{ "PGMODELER_BENCH_SEED", &params.seed }
+	};
+	bool ok = false;
+	unsigned value = 0;
+
+	for(auto &[var, param] : env_vars)
+	{
+		value = qEnvironmentVariable(var).toUInt(&ok);
+
+		if(ok)
+			*param = value;
+	}
+
+	params.schemas *= std::max<unsigned>(scale, 1);
+
+	// Each table has at least the primary key column
+	params.columns = std::max<unsigned>(params.columns, 1);
+
+	// The foreign keys need at least two tables to reference each other
+	if(params.tables < 2)
+		params.foreign_keys = 0;
+
+	return params;
+}
+
+SyntheticModelGenerator::SyntheticModelGenerator(const Params &params)
+{
+	this->params = params;
+}
+
+unsigned SyntheticModelGenerator::random(unsigned max)
+{
+	return max > 0 ? rand_gen.bounded(max) : 0;
+}
+
+Column *SyntheticModelGenerator::createColumn(PhysicalTable *table, const QString &name, const PgSqlType &type, bool not_null)
+{
+	Column *column = new Column;
+
+	column->setName(name);
+	column->setType(type);
+	column->setNotNull(not_null);
+	table->addColumn(column);
+
+	return column;
+}
+
+Table *SyntheticModelGenerator::createTable(DatabaseModel *model, Schema *schema, const QString &name, const QPointF &pos)
+{
+	static const std::vector<PgSqlType> types = {
+		PgSqlType("varchar", 0, 64), PgSqlType("text"), PgSqlType("integer"),
+		PgSqlType("bigint"), PgSqlType("numeric", 0, 12, 2), PgSqlType("boolean"),
+		PgSqlType("date"), PgSqlType("timestamp")
+	};
+
+	Table *table = new Table;
+	Constraint *pk = new Constraint;
+
+	table->setName(name);
+	table->setSchema(schema);
+	table->setPosition(pos);
+
+	pk->setName(name + "_pk");
+	pk->setConstraintType(ConstraintType::PrimaryKey);
+	pk->addColumn(createColumn(table, "id", PgSqlType("integer"), true), Constraint::SourceCols);
+	table->addConstraint(pk);
+
+	for(unsigned col_id = 1; col_id < params.columns; col_id++)
+		createColumn(table, QString("col_%1").arg(col_id), types[random(types.size())], random(4) == 0);
+
+	model->addTable(table);
+	return table;
+}
+
+void SyntheticModelGenerator::createForeignKeys(Table *table, const std::vector<Table *> &ref_tables)
+{
+	Constraint *fk = nullptr;
+	Table *ref_table = nullptr;
+
+	for(unsigned fk_id = 0; fk_id < params.foreign_keys; fk_id++)
+	{
+		// Avoiding self references so all foreign keys generate relationships between different tables
+		do
+		{
+			ref_table = ref_tables[random(ref_tables.size())];
+		}
+		while(ref_table == table && ref_tables.size() > 1);
+
+		fk = new Constraint;
+		fk->setName(QString("%1_fk_%2").arg(table->getName()).arg(fk_id));
+		fk->setConstraintType(ConstraintType::ForeignKey);
+		fk->setReferencedTable(ref_table);
+		fk->setActionType(random(2) == 0 ? ActionType::Cascade : ActionType::Restrict, Constraint::DeleteAction);
+		fk->addColumn(createColumn(table, QString("fk_%1_id").arg(fk_id), PgSqlType("integer")), Constraint::SourceCols);
+		fk->addColumn(ref_table->getColumn("id"), Constraint::ReferencedCols);
+		table->addConstraint(fk);
+	}
+}
+
+void SyntheticModelGenerator::createInheritances(DatabaseModel *model, Schema *schema, const std::vector<Table *> &parents, QPointF pos)
+{
+	Table *child = nullptr;
+
+	for(unsigned inh_id = 0; inh_id < params.inheritances && !parents.empty(); inh_id++)
+	{
+		child = new Table;
+		child->setName(QString("child_%1").arg(inh_id));
+		child->setSchema(schema);
+		child->setPosition(pos);
+
+		createColumn(child, "child_id", PgSqlType("integer"), true);
+		createColumn(child, "child_info", PgSqlType("text"));
+		model->addTable(child);
+
+		model->addRelationship(new Relationship(BaseRelationship::RelationshipGen, child, parents[random(parents.size())]));
+		pos.rx() += 300;
+	}
+}
+
+void SyntheticModelGenerator::createPartitionedTables(DatabaseModel *model, Schema *schema, QPointF pos)
+{
+	Table *partitioned = nullptr, *partition = nullptr;
+	PartitionKey part_key;
+	std::vector<PartitionKey> part_keys;
+
+	for(unsigned tab_id = 0; tab_id < params.partitioned_tables; tab_id++)
+	{
+		partitioned = new Table;
+		partitioned->setName(QString("partitioned_%1").arg(tab_id));
+		partitioned->setSchema(schema);
+		partitioned->setPosition(pos);
+		partitioned->setPartitioningType(PartitioningType::List);
+
+		createColumn(partitioned, "id", PgSqlType("integer"), true);
+		part_key.setColumn(createColumn(partitioned, "region", PgSqlType("integer"), true));
+		createColumn(partitioned, "payload", PgSqlType("text"));
+
+		part_keys = { part_key };
+		partitioned->addPartitionKeys(part_keys);
+		model->addTable(partitioned);
+
+		for(unsigned part_id = 0; part_id < params.partitions; part_id++)
+		{
+			partition = new Table;
+			partition->setName(QString("%1_part_%2").arg(partitioned->getName()).arg(part_id));
+			partition->setSchema(schema);
+			partition->setPosition(pos + QPointF(300 * (part_id + 1), 0));
+			partition->setPartitionBoundingExpr(QString("IN (%1)").arg(part_id));
+			model->addTable(partition);
+
+			model->addRelationship(new Relationship(BaseRelationship::RelationshipPart, partition, partitioned));
+		}
+
+		pos.ry() += 200;
+	}
+}
+
+void SyntheticModelGenerator::createViews(DatabaseModel *model, Schema *schema, const std::vector<Table *> &tables, QPointF pos)
+{
+	View *view = nullptr;
+	Table *table = nullptr;
+	Column *column = nullptr;
+	std::vector<Column *> columns;
+	QStringList col_names;
+
+	for(unsigned view_id = 0; view_id < params.views && !tables.empty(); view_id++)
+	{
+		table = tables[random(tables.size())];
+		columns.clear();
+		col_names.clear();
+
+		// Each view selects the primary key column and about half of the other columns of the table
+		for(unsigned col_id = 0; col_id < table->getColumnCount(); col_id++)
+		{
+			column = table->getColumn(col_id);
+
+			if(col_id == 0 || random(2) == 0)
+			{
+				columns.push_back(column);
+				col_names.append(column->getName(true));
+			}
+		}
+
+		Reference ref(QString("SELECT %1 FROM %2 WHERE id > %3").arg(col_names.join(", "), table->getSignature()).arg(random(1000)), "");
+		ref.addReferencedTable(table);
+
+		for(auto &col : columns)
+			ref.addColumn(col);
+
+		view = new View;
+		view->setName(QString("view_%1").arg(view_id));
+		view->setSchema(schema);
+		view->setPosition(pos);
+		view->addReference(ref, Reference::SqlViewDef);
+		model->addView(view);
+
+		pos.rx() += 250;
+	}
+}
+
+void SyntheticModelGenerator::createFunctions(DatabaseModel *model, Schema *schema, const std::vector<Table *> &tables)
+{
+	Function *func = nullptr;
+	Table *table = nullptr;
+	Language *lang_sql = model->getLanguage(DefaultLanguages::Sql);
+
+	for(unsigned func_id = 0; func_id < params.functions && !tables.empty(); func_id++)
+	{
+		table = tables[random(tables.size())];
+
+		func = new Function;
+		func->setName(QString("function_%1").arg(func_id));
+		func->setSchema(schema);
+		func->setLanguage(lang_sql);
+		func->setReturnType(PgSqlType("bigint"));
+		func->addParameter(Parameter("p_id", PgSqlType("integer"), true));
+		func->setFunctionSource(QString("SELECT count(*) FROM %1 WHERE id > p_id;").arg(table->getSignature()));
+		model->addFunction(func);
+	}
+}
+
+void SyntheticModelGenerator::generateModel(DatabaseModel *model)
+{
+	Schema *schema = nullptr;
+	std::vector<Table *> tables;
+	double y_pos = 0;
+
+	try
+	{
+		rand_gen.seed(params.seed);
+		model->setName("synthetic_model");
+
+		for(unsigned sch_id = 0; sch_id < params.schemas; sch_id++)
+		{
+			schema = new Schema;
+			schema->setName(QString("schema_%1").arg(sch_id));
+			schema->setRectVisible(true);
+			model->addSchema(schema);
+
+			tables.clear();
+
+			for(unsigned tab_id = 0; tab_id < params.tables; tab_id++)
+			{
+				tables.push_back(createTable(model, schema, QString("table_%1").arg(tab_id),
+																		 QPointF((tab_id % 10) * 300, y_pos + (tab_id / 10) * 400)));
+			}
+
+			// The foreign keys are created after all tables so any table of the schema can be referenced
+			for(auto &table : tables)
+				createForeignKeys(table, tables);
+
+			y_pos += ((params.tables / 10) + 1) * 400;
+			createInheritances(model, schema, tables, QPointF(0, y_pos));
+
+			y_pos += 300;
+			createPartitionedTables(model, schema, QPointF(0, y_pos));
+
+			y_pos += params.partitioned_tables * 200 + 100;
+			createViews(model, schema, tables, QPointF(0, y_pos));
+
+			y_pos += 300;
+			createFunctions(model, schema, tables);
+		}
+
+		model->updateTablesFKRelationships();
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
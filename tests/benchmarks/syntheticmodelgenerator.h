@@ -0,0 +1,114 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+/**
+\ingroup tests
+\class SyntheticModelGenerator
+\brief Generates large database models in a deterministic way so the benchmarks measure the same model
+across different runs and releases. The amount of objects is controlled by the generation parameters
+which can be overridden by environment variables (see Params::fromEnvironment()). All random choices
+(column types, referenced tables, etc.) are driven by a generator initialized with a fixed seed.
+*/
+
+#ifndef SYNTHETIC_MODEL_GENERATOR_H
+#define SYNTHETIC_MODEL_GENERATOR_H
+
+#include <QRandomGenerator>
+#include "databasemodel.h"
+
+class SyntheticModelGenerator {
+	public:
+		struct Params {
+			//! \brief Amount of schemas. All the other amounts are per schema (or per table)
+			unsigned schemas,
+
+			//! \brief Amount of ordinary tables per schema
+			tables,
+
+			//! \brief Amount of columns per table (including the primary key column)
+			columns,
+
+			//! \brief Amount of foreign keys per table
+			foreign_keys,
+
+			//! \brief Amount of tables per schema that inherit from an ordinary table
+			inheritances,
+
+			//! \brief Amount of partitioned tables per schema
+			partitioned_tables,
+
+			//! \brief Amount of partitions per partitioned table
+			partitions,
+
+			//! \brief Amount of views per schema
+			views,
+
+			//! \brief Amount of functions per schema
+			functions;
+
+			//! \brief Seed used to initialize the random generator
+			quint32 seed;
+
+			Params();
+
+			/*! \brief Returns the default parameters overridden by the environment variables PGMODELER_BENCH_SCHEMAS,
+			 * PGMODELER_BENCH_TABLES, PGMODELER_BENCH_COLUMNS, PGMODELER_BENCH_FKS, PGMODELER_BENCH_INHERITANCES,
+			 * PGMODELER_BENCH_PARTITIONED, PGMODELER_BENCH_PARTITIONS, PGMODELER_BENCH_VIEWS, PGMODELER_BENCH_FUNCTIONS
+			 * and PGMODELER_BENCH_SEED. The amount of schemas is multiplied by the provided scale */
+			static Params fromEnvironment(unsigned scale = 1);
+		};
+
+	private:
+		Params params;
+
+		QRandomGenerator rand_gen;
+
+		//! \brief Returns a random integer in the interval [0, max)
+		unsigned random(unsigned max);
+
+		//! \brief Creates a column with the provided name and type in the table
+		Column *createColumn(PhysicalTable *table, const QString &name, const PgSqlType &type, bool not_null = false);
+
+		//! \brief Creates a table with the primary key column "id" and the configured amount of columns in the schema
+		Table *createTable(DatabaseModel *model, Schema *schema, const QString &name, const QPointF &pos);
+
+		//! \brief Creates the foreign keys of the table referencing random tables of the provided list
+		void createForeignKeys(Table *table, const std::vector<Table *> &ref_tables);
+
+		//! \brief Creates the tables that inherit from random tables of the provided list
+		void createInheritances(DatabaseModel *model, Schema *schema, const std::vector<Table *> &parents, QPointF pos);
+
+		//! \brief Creates the partitioned tables and their partitions in the schema
+		void createPartitionedTables(DatabaseModel *model, Schema *schema, QPointF pos);
+
+		//! \brief Creates the views in the schema each one selecting some columns of a random table of the list
+		void createViews(DatabaseModel *model, Schema *schema, const std::vector<Table *> &tables, QPointF pos);
+
+		//! \brief Creates the SQL functions in the schema each one querying a random table of the list
+		void createFunctions(DatabaseModel *model, Schema *schema, const std::vector<Table *> &tables);
+
+	public:
+		SyntheticModelGenerator(const Params &params);
+
+		/*! \brief Populates the provided model with the objects configured by the generation parameters.
+		 * The model must contain only the system objects (see DatabaseModel::createSystemObjects()) */
+		void generateModel(DatabaseModel *model);
+};
+
+#endif
@@ -0,0 +1,164 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+#include <QtTest/QtTest>
+#include "catalogcache.h"
+#include "connection.h"
+
+class CatalogCacheTest: public QObject {
+	private:
+		Q_OBJECT
+
+		attribs_map conn_params;
+
+		QString conn_key;
+
+	private slots:
+		void init();
+		void cleanup();
+		void generatesSameKeyForSameSession();
+		void requiresProbeForUnknownConnections();
+		void returnsStoredResultsWhileProbeIsUnchanged();
+		void discardsResultsWhenProbeChanges();
+		void ignoresResultsFromOutdatedGeneration();
+		void discardsResultsOnInvalidation();
+		void discardsResultsWhenDisabled();
+};
+
+void CatalogCacheTest::init()
+{
+	conn_params = {{ Connection::ParamAlias, "local" },
+								 { Connection::ParamServerFqdn, "localhost" },
+								 { Connection::ParamPort, "5432" },
+								 { Connection::ParamDbName, "db_test" },
+								 { Connection::ParamUser, "postgres" },
+								 { Connection::ParamPassword, "secret" }};
+
+	conn_key = CatalogCache::getConnectionKey(conn_params);
+	CatalogCache::setCacheEnabled(true);
+	CatalogCache::invalidate();
+}
+
+void CatalogCacheTest::cleanup()
+{
+	CatalogCache::invalidate();
+}
+
+void CatalogCacheTest::generatesSameKeyForSameSession()
+{
+	attribs_map params = conn_params;
+
+	// Alias and password don't identify the session
+	params[Connection::ParamAlias] = "other";
+	params[Connection::ParamPassword] = "other";
+	QCOMPARE(CatalogCache::getConnectionKey(params), conn_key);
+
+	params[Connection::ParamDbName] = "other_db";
+	QVERIFY(CatalogCache::getConnectionKey(params) != conn_key);
+
+	params = conn_params;
+	params[Connection::ParamUser] = "other_user";
+	QVERIFY(CatalogCache::getConnectionKey(params) != conn_key);
+}
+
+void CatalogCacheTest::requiresProbeForUnknownConnections()
+{
+	QVERIFY(CatalogCache::isProbeRequired(conn_key, false));
+
+	CatalogCache::updateProbeValue(conn_key, "probe1");
+	QVERIFY(!CatalogCache::isProbeRequired(conn_key, false));
+	QVERIFY(CatalogCache::isProbeRequired(conn_key, true));
+}
+
+void CatalogCacheTest::returnsStoredResultsWhileProbeIsUnchanged()
+{
+	std::vector<attribs_map> tuples;
+	unsigned generation = 0;
+
+	CatalogCache::updateProbeValue(conn_key, "probe1");
+	QVERIFY(!CatalogCache::getResult(conn_key, "SELECT 1", tuples, generation));
+
+	CatalogCache::storeResult(conn_key, "SELECT 1", {{{ "oid", "1" }}, {{ "oid", "2" }}}, generation);
+	QVERIFY(!CatalogCache::updateProbeValue(conn_key, "probe1"));
+	QVERIFY(CatalogCache::getResult(conn_key, "SELECT 1", tuples, generation));
+	QVERIFY(tuples.size() == 2);
+	QCOMPARE(tuples[1]["oid"], QString("2"));
+}
+
+void CatalogCacheTest::discardsResultsWhenProbeChanges()
+{
+	std::vector<attribs_map> tuples;
+	unsigned generation = 0;
+
+	CatalogCache::updateProbeValue(conn_key, "probe1");
+	CatalogCache::getResult(conn_key, "SELECT 1", tuples, generation);
+	CatalogCache::storeResult(conn_key, "SELECT 1", {{{ "oid", "1" }}}, generation);
+
+	QVERIFY(CatalogCache::updateProbeValue(conn_key, "probe2"));
+	QVERIFY(!CatalogCache::getResult(conn_key, "SELECT 1", tuples, generation));
+}
+
+void CatalogCacheTest::ignoresResultsFromOutdatedGeneration()
+{
+	std::vector<attribs_map> tuples;
+	unsigned generation = 0;
+
+	CatalogCache::updateProbeValue(conn_key, "probe1");
+	CatalogCache::getResult(conn_key, "SELECT 1", tuples, generation);
+
+	// The catalog changes while the query is being executed
+	CatalogCache::updateProbeValue(conn_key, "probe2");
+	CatalogCache::storeResult(conn_key, "SELECT 1", {{{ "oid", "1" }}}, generation);
+
+	QVERIFY(!CatalogCache::getResult(conn_key, "SELECT 1", tuples, generation));
+}
+
+void CatalogCacheTest::discardsResultsOnInvalidation()
+{
+	std::vector<attribs_map> tuples;
+	unsigned generation = 0;
+
+	CatalogCache::updateProbeValue(conn_key, "probe1");
+	CatalogCache::getResult(conn_key, "SELECT 1", tuples, generation);
+	CatalogCache::storeResult(conn_key, "SELECT 1", {{{ "oid", "1" }}}, generation);
+
+	CatalogCache::invalidate(conn_key);
+	QVERIFY(CatalogCache::isProbeRequired(conn_key, false));
+	QVERIFY(!CatalogCache::getResult(conn_key, "SELECT 1", tuples, generation));
+}
+
+void CatalogCacheTest::discardsResultsWhenDisabled()
+{
+	std::vector<attribs_map> tuples;
+	unsigned generation = 0;
+
+	CatalogCache::updateProbeValue(conn_key, "probe1");
+	CatalogCache::getResult(conn_key, "SELECT 1", tuples, generation);
+	CatalogCache::storeResult(conn_key, "SELECT 1", {{{ "oid", "1" }}}, generation);
+
+	CatalogCache::setCacheEnabled(false);
+	QVERIFY(!CatalogCache::isProbeRequired(conn_key, true));
+	QVERIFY(!CatalogCache::getResult(conn_key, "SELECT 1", tuples, generation));
+
+	CatalogCache::setCacheEnabled(true);
+	QVERIFY(!CatalogCache::getResult(conn_key, "SELECT 1", tuples, generation));
+}
+
+QTEST_MAIN(CatalogCacheTest)
+#include "catalogcachetest.moc"
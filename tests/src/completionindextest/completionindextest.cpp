@@ -0,0 +1,123 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+#include <QtTest/QtTest>
+#include "completionindex.h"
+
+class CompletionIndexTest: public QObject {
+	private:
+		Q_OBJECT
+
+		CompletionIndex index;
+
+		//! \brief Returns the names of the items found in the index
+		QStringList findNames(const QStringList &qualifiers, const QString &prefix, unsigned limit = CompletionIndex::DefaultLimit);
+
+	private slots:
+		void initTestCase();
+		void findsNothingWhileNotFinished();
+		void findsRootNamesByPrefix();
+		void findsNamesCaseInsensitively();
+		void findsSchemaObjects();
+		void findsColumnsOfQualifiedRelations();
+		void findsColumnsOfUnqualifiedRelations();
+		void limitsTheFoundItems();
+};
+
+QStringList CompletionIndexTest::findNames(const QStringList &qualifiers, const QString &prefix, unsigned limit)
+{
+	QStringList names;
+
+	for(auto &item : index.find(qualifiers, prefix, limit))
+		names.append(item->name);
+
+	return names;
+}
+
+void CompletionIndexTest::initTestCase()
+{
+	index.addItem(ObjectType::Schema, "", "", "public");
+	index.addItem(ObjectType::Schema, "", "", "sales");
+	index.addItem(ObjectType::Table, "public", "", "customer");
+	index.addItem(ObjectType::Table, "sales", "", "customer");
+	index.addItem(ObjectType::View, "sales", "", "CustomerView");
+	index.addItem(ObjectType::Function, "sales", "", "customer_total", "integer");
+	index.addItem(ObjectType::Column, "public", "customer", "id", "integer");
+	index.addItem(ObjectType::Column, "public", "customer", "name", "text");
+	index.addItem(ObjectType::Column, "sales", "customer", "code", "character varying(10)");
+	index.addItem(ObjectType::Index, "public", "", "customer_idx");
+}
+
+void CompletionIndexTest::findsNothingWhileNotFinished()
+{
+	QVERIFY(!index.isFinished());
+	QVERIFY(index.find({}, "").empty());
+
+	index.finish();
+	QVERIFY(index.isFinished());
+
+	//Objects other than schemas, relations, columns and functions are ignored
+	QCOMPARE(index.getItemCount(), 9u);
+}
+
+void CompletionIndexTest::findsRootNamesByPrefix()
+{
+	QCOMPARE(findNames({}, "s"), QStringList({ "sales" }));
+	QCOMPARE(findNames({}, "customer_"), QStringList({ "customer_total" }));
+	QCOMPARE(findNames({}, "customer").size(), 4);
+	QVERIFY(findNames({}, "x").isEmpty());
+}
+
+void CompletionIndexTest::findsNamesCaseInsensitively()
+{
+	QCOMPARE(findNames({}, "CUSTOMERV"), QStringList({ "CustomerView" }));
+	QCOMPARE(findNames({ "SALES" }, "customerv"), QStringList({ "CustomerView" }));
+}
+
+void CompletionIndexTest::findsSchemaObjects()
+{
+	QCOMPARE(findNames({ "sales" }, ""), QStringList({ "customer", "customer_total", "CustomerView" }));
+	QCOMPARE(findNames({ "public" }, ""), QStringList({ "customer" }));
+}
+
+void CompletionIndexTest::findsColumnsOfQualifiedRelations()
+{
+	QCOMPARE(findNames({ "public", "customer" }, ""), QStringList({ "id", "name" }));
+	QCOMPARE(findNames({ "sales", "customer" }, "c"), QStringList({ "code" }));
+
+	//Database names in fully qualified references are ignored
+	QCOMPARE(findNames({ "db", "public", "customer" }, "n"), QStringList({ "name" }));
+}
+
+void CompletionIndexTest::findsColumnsOfUnqualifiedRelations()
+{
+	//The relation in public is preferred when several schemas contain relations with the same name
+	QCOMPARE(findNames({ "customer" }, ""), QStringList({ "id", "name" }));
+	QVERIFY(findNames({ "customerview" }, "").isEmpty());
+	QVERIFY(findNames({ "unknown" }, "").isEmpty());
+}
+
+void CompletionIndexTest::limitsTheFoundItems()
+{
+	QCOMPARE(findNames({}, "", 2), QStringList({ "customer", "customer" }));
+	QVERIFY(findNames({}, "", 0).isEmpty());
+}
+
+QTEST_MAIN(CompletionIndexTest)
+#include "completionindextest.moc"
@@ -0,0 +1,219 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+#include <QtTest/QtTest>
+#include <QTemporaryFile>
+#include "csvreader.h"
+
+class CsvReaderTest: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Writes the buffer in a temporary file and reads all its rows in batches of the provided size
+		QList<QStringList> readFile(const QByteArray &buffer, int batch_size, QStringList *columns = nullptr, int *batch_cnt = nullptr);
+
+	private slots:
+		void testReadRowsInBatches();
+		void testExtractColumnsInFirstRow();
+		void testQuotesSeparatorLineBreakInValues();
+		void testConvertWindowsAndMacLineBreaks();
+		void testEmptyValuesAndUtf8Bom();
+		void testEmptyFile();
+		void testRaiseExceptionOnMissingCloseDelim();
+		void testRaiseExceptionOnInvalidSpecialChars();
+};
+
+QList<QStringList> CsvReaderTest::readFile(const QByteArray &buffer, int batch_size, QStringList *columns, int *batch_cnt)
+{
+	QTemporaryFile tmp_file;
+	CsvReader csv_reader;
+	QList<QStringList> rows, batch;
+
+	tmp_file.open();
+	tmp_file.write(buffer);
+	tmp_file.close();
+
+	csv_reader.setSpecialChars(';', '"');
+	csv_reader.setColumnInFirstRow(columns != nullptr);
+	csv_reader.open(tmp_file.fileName());
+
+	if(columns)
+		*columns = csv_reader.getColumnNames();
+
+	if(batch_cnt)
+		*batch_cnt = 0;
+
+	while(csv_reader.readRows(batch, batch_size) > 0)
+	{
+		rows.append(batch);
+
+		if(batch_cnt)
+			(*batch_cnt)++;
+	}
+
+	if(csv_reader.getBytesRead() != csv_reader.getSize())
+		QTest::qFail("The reader didn't consume the whole file!", __FILE__, __LINE__);
+
+	return rows;
+}
+
+void CsvReaderTest::testReadRowsInBatches()
+{
+	try
+	{
+		QByteArray buffer;
+		QList<QStringList> rows;
+		int batch_cnt = 0;
+
+		for(int row = 0; row < 25; row++)
+			buffer += QString("value %1;%2\n").arg(row).arg(row * 2).toUtf8();
+
+		rows = readFile(buffer, 10, nullptr, &batch_cnt);
+
+		QCOMPARE(batch_cnt, 3);
+		QCOMPARE(rows.size(), 25);
+		QCOMPARE(rows.at(0), QStringList({ "value 0", "0" }));
+		QCOMPARE(rows.at(24), QStringList({ "value 24", "48" }));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void CsvReaderTest::testExtractColumnsInFirstRow()
+{
+	try
+	{
+		QStringList columns;
+		QList<QStringList> rows;
+
+		rows = readFile("\"col_1\";col_2;\"col\"\"3\"\nvalue 1;value 2;value 3", 100, &columns);
+
+		QCOMPARE(columns, QStringList({ "col_1", "col_2", "col\"3" }));
+		QCOMPARE(rows.size(), 1);
+		QCOMPARE(rows.at(0), QStringList({ "value 1", "value 2", "value 3" }));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void CsvReaderTest::testQuotesSeparatorLineBreakInValues()
+{
+	try
+	{
+		QList<QStringList> rows;
+
+		rows = readFile("\"\"\"quoted\"\"\";\"quoted + ;\";\"value \n with break\"\nação;\"\";\"foo\"\"bar\"\n", 1);
+
+		QCOMPARE(rows.size(), 2);
+		QCOMPARE(rows.at(0), QStringList({ "\"quoted\"", "quoted + ;", "value \n with break" }));
+		QCOMPARE(rows.at(1), QStringList({ "ação", "", "foo\"bar" }));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void CsvReaderTest::testConvertWindowsAndMacLineBreaks()
+{
+	try
+	{
+		QList<QStringList> rows;
+
+		rows = readFile("value 1;\"value\r\n2\"\r\nvalue 3;\"value\r4\"\rvalue 5;value 6", 100);
+
+		QCOMPARE(rows.size(), 3);
+		QCOMPARE(rows.at(0), QStringList({ "value 1", "value\n2" }));
+		QCOMPARE(rows.at(1), QStringList({ "value 3", "value\n4" }));
+		QCOMPARE(rows.at(2), QStringList({ "value 5", "value 6" }));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void CsvReaderTest::testEmptyValuesAndUtf8Bom()
+{
+	try
+	{
+		QStringList columns;
+		QList<QStringList> rows;
+
+		rows = readFile("\xEF\xBB\xBF" "col_1;col_2;col_3\n;;\nvalue 1;;", 100, &columns);
+
+		QCOMPARE(columns, QStringList({ "col_1", "col_2", "col_3" }));
+		QCOMPARE(rows.size(), 2);
+		QCOMPARE(rows.at(0), QStringList({ "", "", "" }));
+		QCOMPARE(rows.at(1), QStringList({ "value 1", "", "" }));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void CsvReaderTest::testEmptyFile()
+{
+	try
+	{
+		QStringList columns;
+
+		QVERIFY(readFile("", 100, &columns).isEmpty());
+		QVERIFY(columns.isEmpty());
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void CsvReaderTest::testRaiseExceptionOnMissingCloseDelim()
+{
+	try
+	{
+		readFile("value 1;value 2\n\"value 3;value 4\n", 100);
+		QFAIL("Expected exception not thrown!");
+	}
+	catch(Exception &e)
+	{
+		QVERIFY(e.getErrorCode() == ErrorCode::MalformedCsvMissingDelim);
+	}
+}
+
+void CsvReaderTest::testRaiseExceptionOnInvalidSpecialChars()
+{
+	try
+	{
+		CsvReader csv_reader;
+		csv_reader.setSpecialChars(';', ';');
+		QFAIL("Expected exception not thrown!");
+	}
+	catch(Exception &e)
+	{
+		QVERIFY(e.getErrorCode() == ErrorCode::InvCsvParserOptions);
+	}
+}
+
+QTEST_MAIN(CsvReaderTest)
+#include "csvreadertest.moc"
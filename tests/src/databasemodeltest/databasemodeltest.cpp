@@ -19,6 +19,7 @@
 #include <QtTest/QtTest>
 #include "databasemodel.h"
 #include "pgmodelerunittest.h"
+#include "utilsns.h"
 
 class DatabaseModelTest: public QObject, public PgModelerUnitTest {
 	private:
@@ -31,6 +32,14 @@ class DatabaseModelTest: public QObject, public PgModelerUnitTest {
 		void saveObjectsMetadata();
 		void loadObjectsMetadata();
 		void saveSplitSQLDefinition();
+		void saveIncrementalSplitSQL();
+		void findObjectsAfterChanges();
+		void indexPermissions();
+		void memoizeCreationOrders();
+		void blockModifications();
+		void loadModelFromSnapshot();
+		void benchmarkLoadSamples_data();
+		void benchmarkLoadSamples();
 };
 
 void DatabaseModelTest::saveObjectsMetadata()
@@ -102,5 +111,385 @@ void DatabaseModelTest::saveSplitSQLDefinition()
 	}
 }
 
+void DatabaseModelTest::saveIncrementalSplitSQL()
+{
+	DatabaseModel dbmodel;
+	QString output=QFileInfo(BINDIR).absolutePath() + GlobalAttributes::DirSeparator + "demo_incr_split_test",
+			input_dbm=SAMPLESDIR + GlobalAttributes::DirSeparator + QString("demo.dbm");
+
+	try
+	{
+		QDir dir(output);
+		dir.removeRecursively();
+		dbmodel.createSystemObjects(false);
+		dbmodel.loadModel(input_dbm);
+		dbmodel.saveSplitSQLDefinition(output, DatabaseModel::OriginalSql, true);
+
+		QStringList sql_files = dir.entryList({ "*.sql" }, QDir::Files);
+		QVERIFY(!sql_files.isEmpty());
+		QVERIFY(QFileInfo::exists(dir.filePath(SplitSQLManifest::ManifestFile)));
+
+		// Exporting the same model again must not write any file
+		SplitSQLManifest manifest(output, true);
+
+		for(auto &file : sql_files)
+			manifest.saveScript(file, UtilsNs::loadFile(dir.filePath(file)));
+
+		QCOMPARE(manifest.getWrittenCount(), 0u);
+		QCOMPARE(manifest.getUnchangedCount(), static_cast<unsigned>(sql_files.size()));
+
+		// Changing only the creation order prefix renames the file and changing the contents rewrites it
+		SplitSQLManifest manifest2(output, true);
+		QString first_file = sql_files.takeFirst(), second_file = sql_files.takeFirst();
+		QString renamed_file = "0" + first_file;
+
+		manifest2.saveScript(renamed_file, UtilsNs::loadFile(dir.filePath(first_file)));
+		manifest2.saveScript(second_file, "-- changed");
+		manifest2.finish();
+
+		QCOMPARE(manifest2.getRenamedCount(), 1u);
+		QCOMPARE(manifest2.getWrittenCount(), 1u);
+		QVERIFY(QFileInfo::exists(dir.filePath(renamed_file)));
+		QVERIFY(!QFileInfo::exists(dir.filePath(first_file)));
+
+		// The files that weren't generated this time are removed as stale ones
+		QCOMPARE(manifest2.getRemovedCount(), static_cast<unsigned>(sql_files.size()));
+		QCOMPARE(dir.entryList({ "*.sql" }, QDir::Files).size(), 2);
+	}
+	catch (Exception &e)
+	{
+		QTextStream out(stdout);
+		out << e.getExceptionsText() << Qt::endl;
+		QCOMPARE(false, true);
+	}
+}
+
+void DatabaseModelTest::findObjectsAfterChanges()
+{
+	DatabaseModel dbmodel;
+	Table *table = nullptr;
+	Column *column = nullptr;
+
+	try
+	{
+		dbmodel.createSystemObjects(true);
+
+		table = new Table;
+		table->setName("customer_orders");
+		table->setSchema(dbmodel.getSchema("public"));
+
+		column = new Column;
+		column->setName("order_id");
+		column->setType(PgSqlType("integer"));
+		table->addColumn(column);
+		dbmodel.addTable(table);
+
+		QVERIFY(dbmodel.findObjects("customer_orders", { ObjectType::Table }, false, false, false).size() == 1);
+		QVERIFY(dbmodel.findObjects("CUSTOMER*", { ObjectType::Table }, false, false, false).size() == 1);
+		QVERIFY(dbmodel.findObjects("*_orders", { ObjectType::Table }, false, false, false).size() == 1);
+		QVERIFY(dbmodel.findObjects("tomer_ord", { ObjectType::Table }, false, true, false).size() == 1);
+		QVERIFY(dbmodel.findObjects("customer_orders", { ObjectType::Column }, false, false, false).size() == 0);
+		QVERIFY(dbmodel.findObjects("order_?d", { ObjectType::Column }, false, false, false).size() == 1);
+
+		// Renamed objects must be found by their new names only
+		table->setName("client_orders");
+		column->setName("client_id");
+		QVERIFY(dbmodel.findObjects("customer*", { ObjectType::Table }, false, false, false).size() == 0);
+		QVERIFY(dbmodel.findObjects("client*", { ObjectType::Table, ObjectType::Column }, false, false, false).size() == 2);
+		QVERIFY(dbmodel.findObjects("^client_(orders|id)$", { ObjectType::Table }, false, true, false).size() == 1);
+
+		table->setComment("Stores the orders of the clients");
+		QVERIFY(dbmodel.findObjects("*orders*", { ObjectType::Table }, false, false, false, Attributes::Comment).size() == 1);
+
+		// Objects removed from the model (or from their tables) aren't returned anymore
+		table->removeObject(column);
+		QVERIFY(dbmodel.findObjects("client_id", { ObjectType::Column }, false, false, false).size() == 0);
+
+		dbmodel.removeTable(table);
+		QVERIFY(dbmodel.findObjects("client*", { ObjectType::Table }, false, false, false).size() == 0);
+
+		delete column;
+		delete table;
+	}
+	catch (Exception &e)
+	{
+		QTextStream out(stdout);
+		out << e.getExceptionsText() << Qt::endl;
+		QCOMPARE(false, true);
+	}
+}
+
+void DatabaseModelTest::indexPermissions()
+{
+	DatabaseModel dbmodel;
+	Table *table = nullptr;
+	Role *role1 = nullptr, *role2 = nullptr;
+	Permission *perm1 = nullptr, *perm2 = nullptr, *perm3 = nullptr, *dup_perm = nullptr;
+	std::vector<Permission *> perms;
+	std::vector<BaseObject *> refs;
+
+	try
+	{
+		dbmodel.createSystemObjects(true);
+
+		table = new Table;
+		table->setName("orders");
+		table->setSchema(dbmodel.getSchema("public"));
+		dbmodel.addTable(table);
+
+		role1 = new Role;
+		role1->setName("role1");
+		dbmodel.addRole(role1);
+
+		role2 = new Role;
+		role2->setName("role2");
+		dbmodel.addRole(role2);
+
+		perm1 = new Permission(table);
+		perm1->addRole(role1);
+		perm1->setPrivilege(Permission::PrivSelect, true, false);
+		dbmodel.addPermission(perm1);
+
+		perm2 = new Permission(table);
+		perm2->addRole(role2);
+		perm2->setPrivilege(Permission::PrivInsert, true, false);
+		dbmodel.addPermission(perm2);
+
+		// A REVOKE sharing the role of a GRANT is not a duplicate
+		perm3 = new Permission(table);
+		perm3->addRole(role1);
+		perm3->setRevoke(true);
+		perm3->setPrivilege(Permission::PrivDelete, true, false);
+		dbmodel.addPermission(perm3);
+
+		// Permissions of the object are returned in the same order they were added
+		dbmodel.getPermissions(table, perms);
+		QVERIFY(perms == std::vector<Permission *>({ perm1, perm2, perm3 }));
+		QCOMPARE(dbmodel.getPermissionIndex(perm2, false), 1);
+
+		dup_perm = new Permission(table);
+		dup_perm->addRole(role1);
+		dup_perm->addRole(role2);
+		QCOMPARE(dbmodel.getPermissionIndex(dup_perm, false), 0);
+		QVERIFY_EXCEPTION_THROWN(dbmodel.addPermission(dup_perm), Exception);
+		delete dup_perm;
+
+		dbmodel.getObjectReferences(role2, refs);
+		QVERIFY(std::find(refs.begin(), refs.end(), perm2) != refs.end());
+
+		// Roles changed after the insertion must be reflected in the role references
+		perm2->removeRoles();
+		perm2->addRole(role1);
+		dbmodel.getObjectReferences(role2, refs);
+		QVERIFY(std::find(refs.begin(), refs.end(), perm2) == refs.end());
+		dbmodel.getObjectReferences(role1, refs);
+		QVERIFY(std::find(refs.begin(), refs.end(), perm2) != refs.end());
+
+		dbmodel.removePermission(perm2);
+		delete perm2;
+
+		dbmodel.getPermissions(table, perms);
+		QVERIFY(perms == std::vector<Permission *>({ perm1, perm3 }));
+		QCOMPARE(dbmodel.getPermissionIndex(perm3, false), 1);
+
+		dbmodel.removePermissions(table);
+		dbmodel.getPermissions(table, perms);
+		QVERIFY(perms.empty());
+		QCOMPARE(dbmodel.getObjectCount(ObjectType::Permission), 0u);
+
+		dbmodel.getObjectReferences(role1, refs);
+		QVERIFY(refs.empty());
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseModelTest::memoizeCreationOrders()
+{
+	DatabaseModel dbmodel;
+	Table *table = nullptr, *table2 = nullptr;
+	Column *column = nullptr;
+	Role *role = nullptr;
+	std::vector<BaseObject *> objs;
+	std::map<unsigned, BaseObject *> objs_map;
+	quint64 revision = 0;
+
+	try
+	{
+		dbmodel.createSystemObjects(true);
+
+		table = new Table;
+		table->setName("orders");
+		table->setSchema(dbmodel.getSchema("public"));
+
+		column = new Column;
+		column->setName("id");
+		column->setType(PgSqlType("integer"));
+		table->addColumn(column);
+		dbmodel.addTable(table);
+
+		objs = dbmodel.getCreationOrder(table, false);
+		QVERIFY(std::find(objs.begin(), objs.end(), table) != objs.end());
+		QVERIFY(std::find(objs.begin(), objs.end(), dbmodel.getSchema("public")) != objs.end());
+
+		// Consecutive calls without changes in the model reuse the computed order
+		revision = dbmodel.getRevision();
+		QVERIFY(dbmodel.getCreationOrder(table, false) == objs);
+		QVERIFY(dbmodel.getCreationOrder(SchemaParser::SqlCode) == dbmodel.getCreationOrder(SchemaParser::SqlCode));
+		QCOMPARE(dbmodel.getRevision(), revision);
+
+		// Modifying an object changes the revision so its new dependencies are included
+		role = new Role;
+		role->setName("owner_role");
+		dbmodel.addRole(role);
+		table->setOwner(role);
+		QVERIFY(dbmodel.getRevision() != revision);
+
+		objs = dbmodel.getCreationOrder(table, false);
+		QVERIFY(std::find(objs.begin(), objs.end(), role) != objs.end());
+
+		// Objects added or removed are reflected in the creation order of the whole model
+		table2 = new Table;
+		table2->setName("customers");
+		table2->setSchema(dbmodel.getSchema("public"));
+		dbmodel.addTable(table2);
+
+		objs_map = dbmodel.getCreationOrder(SchemaParser::SqlCode);
+		QVERIFY(objs_map.count(table2->getObjectId()) == 1);
+
+		dbmodel.removeTable(table2);
+		objs_map = dbmodel.getCreationOrder(SchemaParser::SqlCode);
+		QVERIFY(objs_map.count(table2->getObjectId()) == 0);
+
+		delete table2;
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseModelTest::blockModifications()
+{
+	DatabaseModel dbmodel;
+	Table *table = new Table;
+	quint64 revision = 0;
+	bool blocked = false;
+
+	try
+	{
+		dbmodel.createSystemObjects(true);
+		table->setName("orders");
+		table->setSchema(dbmodel.getSchema("public"));
+		revision = dbmodel.getRevision();
+
+		// While blocked the model refuses any addition (or removal) before being changed
+		dbmodel.setModificationsBlocked(true);
+
+		try
+		{
+			dbmodel.addTable(table);
+		}
+		catch(Exception &e)
+		{
+			blocked = (e.getErrorCode() == ErrorCode::OprModelModificationsBlocked);
+		}
+
+		QVERIFY(blocked);
+		QCOMPARE(dbmodel.getRevision(), revision);
+		QCOMPARE(dbmodel.getObjectIndex(table), -1);
+
+		dbmodel.setModificationsBlocked(false);
+		dbmodel.addTable(table);
+		QVERIFY(dbmodel.getObjectIndex(table) >= 0);
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseModelTest::loadModelFromSnapshot()
+{
+	QString input = SAMPLESDIR + GlobalAttributes::DirSeparator + QString("demo.dbm"),
+			snp_dir = QFileInfo(BINDIR).absolutePath() + GlobalAttributes::DirSeparator + GlobalAttributes::SnapshotsDir;
+
+	try
+	{
+		DatabaseModel xml_model, snp_model;
+
+		QDir(snp_dir).removeRecursively();
+		DatabaseModel::setSnapshotsDirectory(snp_dir);
+
+		// The first loading reads the XML file and creates the snapshot
+		xml_model.createSystemObjects(false);
+		xml_model.loadModel(input);
+		QVERIFY(QFileInfo::exists(DatabaseModel::getSnapshotFilePath(input)));
+
+		// The second loading uses the snapshot and must produce the same model
+		snp_model.createSystemObjects(false);
+		snp_model.loadModel(input);
+		DatabaseModel::setSnapshotsDirectory("");
+
+		QVERIFY(xml_model.getObjectCount() == snp_model.getObjectCount());
+		QCOMPARE(snp_model.getSourceCode(SchemaParser::XmlCode), xml_model.getSourceCode(SchemaParser::XmlCode));
+	}
+	catch(Exception &e)
+	{
+		DatabaseModel::setSnapshotsDirectory("");
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseModelTest::benchmarkLoadSamples_data()
+{
+	QTest::addColumn<QString>("sample");
+	QTest::addColumn<bool>("use_snapshot");
+
+	for(auto &sample : QDir(SAMPLESDIR, "*" + GlobalAttributes::DbModelExt).entryList())
+	{
+		QTest::newRow(QString("%1 (xml)").arg(sample).toUtf8()) << sample << false;
+		QTest::newRow(QString("%1 (snapshot)").arg(sample).toUtf8()) << sample << true;
+	}
+}
+
+void DatabaseModelTest::benchmarkLoadSamples()
+{
+	QFETCH(QString, sample);
+	QFETCH(bool, use_snapshot);
+
+	QString input = SAMPLESDIR + GlobalAttributes::DirSeparator + sample,
+			snp_dir = QFileInfo(BINDIR).absolutePath() + GlobalAttributes::DirSeparator + GlobalAttributes::SnapshotsDir;
+
+	try
+	{
+		DatabaseModel::setSnapshotsDirectory(use_snapshot ? snp_dir : "");
+
+		// Creating the snapshot before the measurement
+		if(use_snapshot)
+		{
+			DatabaseModel dbmodel;
+			dbmodel.createSystemObjects(false);
+			dbmodel.loadModel(input);
+		}
+
+		QBENCHMARK
+		{
+			DatabaseModel dbmodel;
+			dbmodel.createSystemObjects(false);
+			dbmodel.loadModel(input);
+		}
+
+		DatabaseModel::setSnapshotsDirectory("");
+	}
+	catch(Exception &e)
+	{
+		DatabaseModel::setSnapshotsDirectory("");
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
 QTEST_MAIN(DatabaseModelTest)
 #include "databasemodeltest.moc"
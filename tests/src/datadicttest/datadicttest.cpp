@@ -19,6 +19,7 @@
 #include <QtTest/QtTest>
 #include "databasemodel.h"
 #include "pgmodelerunittest.h"
+#include "utilsns.h"
 
 class DataDictTest: public QObject, public PgModelerUnitTest {
 	private:
@@ -30,6 +31,7 @@ class DataDictTest: public QObject, public PgModelerUnitTest {
 	private slots:
 		void generateASimpleDataDict();
 		void generateASplittedDataDictFromSampleModel();
+		void generateDataDictUsingManyThreads();
 };
 
 void DataDictTest::generateASimpleDataDict()
@@ -150,5 +152,40 @@ void DataDictTest::generateASplittedDataDictFromSampleModel()
 	}
 }
 
+void DataDictTest::generateDataDictUsingManyThreads()
+{
+	DatabaseModel dbmodel;
+	QRegularExpression date_regexp("<em>.*</em>");
+	QDir single_dir("./dict_single_thread"), multi_dir("./dict_multi_thread");
+
+	try
+	{
+		single_dir.removeRecursively();
+		multi_dir.removeRecursively();
+
+		dbmodel.createSystemObjects(false);
+		dbmodel.loadModel(QString(SAMPLESDIR)+ "/demo.dbm");
+		dbmodel.saveDataDictionary(single_dir.path(), true, true, 1);
+		dbmodel.saveDataDictionary(multi_dir.path(), true, true, 4);
+
+		// The pages rendered in parallel must be the same (except for the generation date) as the ones rendered sequentially
+		QStringList files = single_dir.entryList(QDir::Files, QDir::Name);
+		QVERIFY(files.size() > 2);
+		QCOMPARE(multi_dir.entryList(QDir::Files, QDir::Name), files);
+
+		for(auto &file : files)
+		{
+			QString single_page = UtilsNs::loadFile(single_dir.filePath(file)),
+					multi_page = UtilsNs::loadFile(multi_dir.filePath(file));
+
+			QCOMPARE(multi_page.remove(date_regexp), single_page.remove(date_regexp));
+		}
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
 QTEST_MAIN(DataDictTest)
 #include "datadicttest.moc"
@@ -0,0 +1,158 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "tools/modelvalidationhelper.h"
+#include "pgmodelerunittest.h"
+
+class ModelValidationHelperTest: public QObject, public PgModelerUnitTest {
+	private:
+		Q_OBJECT
+
+		void addSampleModels();
+
+	public:
+		ModelValidationHelperTest() : PgModelerUnitTest(SCHEMASDIR){}
+
+	private slots:
+		void changesTrackedAfterSuccessfulValidation();
+		void benchmarkFullValidation_data();
+		void benchmarkFullValidation();
+		void benchmarkIncrementalValidation_data();
+		void benchmarkIncrementalValidation();
+};
+
+void ModelValidationHelperTest::addSampleModels()
+{
+	QTest::addColumn<QString>("model_file");
+
+	for(auto &model : { "demo.dbm", "pagila.dbm", "usda.dbm", "3dcitydb.dbm", "cryptoconcept.dbm" })
+		QTest::newRow(model) << SAMPLESDIR + GlobalAttributes::DirSeparator + model;
+}
+
+void ModelValidationHelperTest::changesTrackedAfterSuccessfulValidation()
+{
+	DatabaseModel dbmodel;
+	ModelValidationHelper helper;
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+		dbmodel.loadModel(SAMPLESDIR + GlobalAttributes::DirSeparator + "demo.dbm");
+		QVERIFY(!dbmodel.isTrackingChanges());
+
+		helper.setValidationParams(&dbmodel);
+		helper.validateModel();
+
+		// Only a validation without broken references starts the tracking of changes
+		QCOMPARE(dbmodel.isTrackingChanges(), helper.getErrorCount() == 0);
+
+		if(dbmodel.isTrackingChanges())
+		{
+			Table *table = dbmodel.getTable(0);
+
+			QVERIFY(dbmodel.getChangedObjects().empty());
+			table->setName(table->getName() + "_changed");
+			QVERIFY(dbmodel.getChangedObjects().size() == 1);
+			QVERIFY(dbmodel.getChangedObjects().front() == table);
+
+			helper.validateModel();
+			QVERIFY(dbmodel.getChangedObjects().empty());
+		}
+	}
+	catch(Exception &e)
+	{
+		QTextStream out(stdout);
+		out << e.getExceptionsText() << Qt::endl;
+		QCOMPARE(false, true);
+	}
+}
+
+void ModelValidationHelperTest::benchmarkFullValidation_data()
+{
+	addSampleModels();
+}
+
+void ModelValidationHelperTest::benchmarkFullValidation()
+{
+	QFETCH(QString, model_file);
+	DatabaseModel dbmodel;
+	ModelValidationHelper helper;
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+		dbmodel.loadModel(model_file);
+		helper.setValidationParams(&dbmodel);
+		helper.setFullValidation(true);
+
+		QBENCHMARK {
+			helper.validateModel();
+		}
+	}
+	catch(Exception &e)
+	{
+		QTextStream out(stdout);
+		out << e.getExceptionsText() << Qt::endl;
+		QCOMPARE(false, true);
+	}
+}
+
+void ModelValidationHelperTest::benchmarkIncrementalValidation_data()
+{
+	addSampleModels();
+}
+
+void ModelValidationHelperTest::benchmarkIncrementalValidation()
+{
+	QFETCH(QString, model_file);
+	DatabaseModel dbmodel;
+	ModelValidationHelper helper;
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+		dbmodel.loadModel(model_file);
+		helper.setValidationParams(&dbmodel);
+
+		// The first validation checks all objects and starts the tracking of changes
+		helper.validateModel();
+
+		if(!dbmodel.isTrackingChanges())
+			QSKIP("The model has broken references so the incremental validation can't be used.");
+
+		Table *table = dbmodel.getTable(0);
+
+		// Each iteration validates the model after a single table (and its children) was changed
+		QBENCHMARK {
+			if(table)
+				table->setCodeInvalidated(true);
+
+			helper.validateModel();
+		}
+	}
+	catch(Exception &e)
+	{
+		QTextStream out(stdout);
+		out << e.getExceptionsText() << Qt::endl;
+		QCOMPARE(false, true);
+	}
+}
+
+QTEST_MAIN(ModelValidationHelperTest)
+#include "modelvalidationhelpertest.moc"
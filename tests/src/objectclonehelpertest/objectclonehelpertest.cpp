@@ -0,0 +1,263 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "objectclonehelper.h"
+#include "pgmodelerunittest.h"
+
+class ObjectCloneHelperTest: public QObject, public PgModelerUnitTest {
+	private:
+		Q_OBJECT
+
+		//! \brief Amount of tables copied and pasted in the benchmarks
+		static constexpr unsigned BenchTableCount = 250;
+
+		/*! \brief Creates in the model the amount of tables provided. Each table has a primary key
+		 * and, except the first one, a foreign key referencing the previous table */
+		std::vector<BaseObject *> createTables(DatabaseModel &dbmodel, unsigned count, const QString &prefix = "table");
+
+		//! \brief Pastes the objects into the model in the same way ModelWidget::pasteObjects() does when cloning objects
+		void pasteClones(DatabaseModel &dbmodel, const std::vector<BaseObject *> &objects);
+
+	public:
+		ObjectCloneHelperTest() : PgModelerUnitTest(SCHEMASDIR){}
+
+	private slots:
+		void cloneTablesInSameModel();
+		void cloneTablesInAnotherModel();
+		void benchmarkPasteTablesClone();
+		void benchmarkPasteTablesXml();
+};
+
+std::vector<BaseObject *> ObjectCloneHelperTest::createTables(DatabaseModel &dbmodel, unsigned count, const QString &prefix)
+{
+	std::vector<BaseObject *> tables;
+	Table *table = nullptr, *prev_table = nullptr;
+	Column *col = nullptr;
+	Constraint *constr = nullptr;
+
+	for(unsigned i = 0; i < count; i++)
+	{
+		table = new Table;
+		table->setName(QString("%1_%2").arg(prefix).arg(i));
+		table->setSchema(dbmodel.getSchema("public"));
+
+		col = new Column;
+		col->setName("id");
+		col->setType(PgSqlType("integer"));
+		table->addColumn(col);
+
+		col = new Column;
+		col->setName("description");
+		col->setType(PgSqlType("varchar", 0, 100));
+		table->addColumn(col);
+
+		constr = new Constraint;
+		constr->setName(QString("%1_pk").arg(table->getName()));
+		constr->setConstraintType(ConstraintType::PrimaryKey);
+		constr->addColumn(table->getColumn("id"), Constraint::SourceCols);
+		table->addConstraint(constr);
+
+		if(prev_table)
+		{
+			col = new Column;
+			col->setName("prev_id");
+			col->setType(PgSqlType("integer"));
+			table->addColumn(col);
+
+			constr = new Constraint;
+			constr->setName(QString("%1_fk").arg(table->getName()));
+			constr->setConstraintType(ConstraintType::ForeignKey);
+			constr->setReferencedTable(prev_table);
+			constr->addColumn(col, Constraint::SourceCols);
+			constr->addColumn(prev_table->getColumn("id"), Constraint::ReferencedCols);
+			table->addConstraint(constr);
+		}
+
+		dbmodel.addTable(table);
+		tables.push_back(table);
+		prev_table = table;
+	}
+
+	return tables;
+}
+
+void ObjectCloneHelperTest::pasteClones(DatabaseModel &dbmodel, const std::vector<BaseObject *> &objects)
+{
+	ObjectCloneHelper clone_hlp(&dbmodel, false);
+	std::vector<Constraint *> added_fks;
+	std::vector<Exception> errors;
+	BaseObject *clone = nullptr;
+
+	for(auto &obj : objects)
+	{
+		clone = clone_hlp.cloneObject(obj);
+
+		if(dbmodel.getObjectIndex(clone->getSignature(), clone->getObjectType()) >= 0)
+			clone->setName(CoreUtilsNs::generateUniqueName(clone, *dbmodel.getObjectList(clone->getObjectType()), false, "_cp"));
+	}
+
+	for(auto &obj : objects)
+	{
+		clone_hlp.resolveReferences(obj);
+		dbmodel.addObject(clone_hlp.getClone(obj));
+	}
+
+	clone_hlp.finishCloning(added_fks, errors);
+
+	if(!errors.empty())
+		throw Exception(errors.front().getErrorMessage(), errors.front().getErrorCode(), __PRETTY_FUNCTION__, __FILE__, __LINE__, errors);
+}
+
+void ObjectCloneHelperTest::cloneTablesInSameModel()
+{
+	DatabaseModel dbmodel;
+
+	try
+	{
+		dbmodel.createSystemObjects(true);
+
+		std::vector<BaseObject *> tables = createTables(dbmodel, 3);
+		Table *table_1 = dynamic_cast<Table *>(tables[1]), *clone_0 = nullptr, *clone_1 = nullptr;
+		Constraint *fk = nullptr;
+
+		pasteClones(dbmodel, tables);
+
+		clone_0 = dbmodel.getTable("public.table_0_cp");
+		clone_1 = dbmodel.getTable("public.table_1_cp");
+
+		QVERIFY(clone_0 && clone_1);
+		QVERIFY(dbmodel.getObjectCount(ObjectType::Table) == 6);
+		QVERIFY(clone_1->getColumnCount() == 3);
+		QVERIFY(clone_1->getConstraintCount() == 2);
+
+		// The cloned children must reference the columns of the cloned tables only
+		QVERIFY(clone_1->getPrimaryKey()->getColumn(0, Constraint::SourceCols) == clone_1->getColumn("id"));
+		QVERIFY(clone_1->getPrimaryKey()->getColumn(0, Constraint::SourceCols) != table_1->getColumn("id"));
+
+		fk = clone_1->getConstraint("table_1_fk");
+		QVERIFY(fk != nullptr);
+		QVERIFY(fk->getReferencedTable() == clone_0);
+		QVERIFY(fk->getColumn(0, Constraint::SourceCols) == clone_1->getColumn("prev_id"));
+		QVERIFY(fk->getColumn(0, Constraint::ReferencedCols) == clone_0->getColumn("id"));
+
+		// The original tables must remain untouched
+		QVERIFY(table_1->getColumn("id")->isNotNull());
+		QVERIFY(table_1->getConstraint("table_1_fk")->getReferencedTable() == tables[0]);
+	}
+	catch(Exception &e)
+	{
+		QTextStream out(stdout);
+		out << e.getExceptionsText() << Qt::endl;
+		QCOMPARE(false, true);
+	}
+}
+
+void ObjectCloneHelperTest::cloneTablesInAnotherModel()
+{
+	DatabaseModel src_model, dst_model;
+
+	try
+	{
+		src_model.createSystemObjects(true);
+		dst_model.createSystemObjects(true);
+
+		std::vector<BaseObject *> tables = createTables(src_model, 2);
+		Table *clone_1 = nullptr;
+
+		pasteClones(dst_model, tables);
+		clone_1 = dst_model.getTable("public.table_1");
+
+		QVERIFY(clone_1 != nullptr);
+		QVERIFY(clone_1 != tables[1]);
+
+		// References to objects which were not cloned are resolved to the objects of the destination model
+		QVERIFY(clone_1->getSchema() == dst_model.getSchema("public"));
+		QVERIFY(clone_1->getConstraint("table_1_fk")->getReferencedTable() == dst_model.getTable("public.table_0"));
+		QVERIFY(src_model.getObjectCount(ObjectType::Table) == 2);
+	}
+	catch(Exception &e)
+	{
+		QTextStream out(stdout);
+		out << e.getExceptionsText() << Qt::endl;
+		QCOMPARE(false, true);
+	}
+}
+
+void ObjectCloneHelperTest::benchmarkPasteTablesClone()
+{
+	DatabaseModel src_model;
+
+	try
+	{
+		src_model.createSystemObjects(true);
+		std::vector<BaseObject *> tables = createTables(src_model, BenchTableCount);
+
+		QBENCHMARK
+		{
+			DatabaseModel dst_model;
+			dst_model.createSystemObjects(true);
+			pasteClones(dst_model, tables);
+		}
+	}
+	catch(Exception &e)
+	{
+		QTextStream out(stdout);
+		out << e.getExceptionsText() << Qt::endl;
+		QCOMPARE(false, true);
+	}
+}
+
+void ObjectCloneHelperTest::benchmarkPasteTablesXml()
+{
+	DatabaseModel src_model;
+
+	try
+	{
+		src_model.createSystemObjects(true);
+		std::vector<BaseObject *> tables = createTables(src_model, BenchTableCount);
+
+		// Pasting the tables in the same way ModelWidget::pasteObjects() does when cloning isn't possible
+		QBENCHMARK
+		{
+			DatabaseModel dst_model;
+			XmlParser *xmlparser = dst_model.getXMLParser();
+			std::vector<Table *> pasted_tabs;
+			BaseObject *object = nullptr;
+
+			dst_model.createSystemObjects(true);
+
+			for(auto &tab : tables)
+			{
+				xmlparser->restartParser();
+				xmlparser->loadXMLBuffer(dynamic_cast<Table *>(tab)->__getSourceCode(SchemaParser::XmlCode, true));
+				object = dst_model.createObject(BaseObject::getObjectType(xmlparser->getElementName()));
+				dst_model.addObject(object);
+			}
+		}
+	}
+	catch(Exception &e)
+	{
+		QTextStream out(stdout);
+		out << e.getExceptionsText() << Qt::endl;
+		QCOMPARE(false, true);
+	}
+}
+
+QTEST_MAIN(ObjectCloneHelperTest)
+#include "objectclonehelpertest.moc"
@@ -0,0 +1,146 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "operationlist.h"
+#include "pgmodelerunittest.h"
+
+class OperationListTest: public QObject, public PgModelerUnitTest {
+	private:
+		Q_OBJECT
+
+		Table *createTable(DatabaseModel &dbmodel, const QString &name, const QPointF &pos);
+
+	public:
+		OperationListTest() : PgModelerUnitTest(SCHEMASDIR){}
+
+	private slots:
+		void undoRedoMovedObjectsPositions();
+		void movedObjectsDontRetainCopies();
+};
+
+Table *OperationListTest::createTable(DatabaseModel &dbmodel, const QString &name, const QPointF &pos)
+{
+	Table *table = new Table;
+	Column *column = new Column;
+
+	table->setName(name);
+	table->setSchema(dbmodel.getSchema("public"));
+	table->setPosition(pos);
+
+	column->setName("id");
+	column->setType(PgSqlType("integer"));
+	table->addColumn(column);
+
+	dbmodel.addTable(table);
+	return table;
+}
+
+void OperationListTest::undoRedoMovedObjectsPositions()
+{
+	DatabaseModel dbmodel;
+	OperationList op_list(&dbmodel);
+	std::vector<Table *> tables;
+	unsigned op_type = 0;
+	QString obj_name;
+	ObjectType obj_type;
+
+	try
+	{
+		dbmodel.createSystemObjects(true);
+
+		for(int i = 0; i < 3; i++)
+			tables.push_back(createTable(dbmodel, QString("table_%1").arg(i), QPointF(i * 100, 50)));
+
+		op_list.startOperationChain();
+
+		for(auto &table : tables)
+		{
+			op_list.registerObject(table, Operation::ObjMoved);
+			table->setPosition(table->getPosition() + QPointF(10, 20));
+		}
+
+		op_list.finishOperationChain();
+
+		QVERIFY(op_list.getCurrentSize() == 3);
+		QVERIFY(op_list.isObjectRegistered(tables[1], Operation::ObjMoved));
+		QVERIFY(!op_list.isObjectRegistered(tables[1], Operation::ObjModified));
+
+		op_list.getOperationData(0, op_type, obj_name, obj_type);
+		QVERIFY(op_type == Operation::ObjMoved);
+		QVERIFY(obj_type == ObjectType::Table);
+		QCOMPARE(obj_name, tables[0]->getName(true));
+
+		op_list.undoOperation();
+
+		for(int i = 0; i < 3; i++)
+			QCOMPARE(tables[i]->getPosition(), QPointF(i * 100, 50));
+
+		op_list.redoOperation();
+
+		for(int i = 0; i < 3; i++)
+			QCOMPARE(tables[i]->getPosition(), QPointF((i * 100) + 10, 70));
+
+		// Registering a new operation after an undo discards the operations that could be redone
+		op_list.undoOperation();
+		op_list.registerObject(tables[0], Operation::ObjMoved);
+		QVERIFY(op_list.getCurrentSize() == 1);
+		QVERIFY(!op_list.isObjectRegistered(tables[2], Operation::ObjMoved));
+	}
+	catch(Exception &e)
+	{
+		QTextStream out(stdout);
+		out << e.getExceptionsText() << Qt::endl;
+		QCOMPARE(false, true);
+	}
+}
+
+void OperationListTest::movedObjectsDontRetainCopies()
+{
+	DatabaseModel dbmodel;
+	OperationList op_list(&dbmodel);
+	Table *table = nullptr;
+	size_t move_usage = 0;
+
+	try
+	{
+		dbmodel.createSystemObjects(true);
+		table = createTable(dbmodel, "table_a", QPointF(0, 0));
+
+		op_list.registerObject(table, Operation::ObjMoved);
+		move_usage = op_list.getMemoryUsage();
+		QVERIFY(move_usage > 0);
+
+		// Modifications keep a copy of the object (and its columns) so they retain more memory
+		op_list.registerObject(table, Operation::ObjModified);
+		QVERIFY(op_list.getMemoryUsage() - move_usage > move_usage);
+
+		op_list.removeOperations();
+		QVERIFY(op_list.getMemoryUsage() == 0);
+		QVERIFY(!op_list.isObjectRegistered(table, Operation::ObjMoved));
+	}
+	catch(Exception &e)
+	{
+		QTextStream out(stdout);
+		out << e.getExceptionsText() << Qt::endl;
+		QCOMPARE(false, true);
+	}
+}
+
+QTEST_MAIN(OperationListTest)
+#include "operationlisttest.moc"
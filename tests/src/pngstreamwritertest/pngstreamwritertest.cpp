@@ -0,0 +1,159 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+#include <QtTest/QtTest>
+#include <QTemporaryDir>
+#include "utils/pngstreamwriter.h"
+
+class PngStreamWriterTest: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Creates an image with uniform areas, repeated rows and a noisy region (the content of a diagram)
+		QImage createImage(int width, int height);
+
+		/*! \brief Writes the image in bands of the provided height, splitting each band in tiles of the provided
+		 * width, and reads the written file back comparing its pixels with the original image */
+		void writeAndCompare(const QImage &image, int band_height, int tile_width);
+
+	private slots:
+		void testRoundTripSingleTile();
+		void testRoundTripMultipleTilesAndBands();
+		void testRemoveIncompleteImage();
+		void testRaiseExceptionOnInvalidBand();
+};
+
+QImage PngStreamWriterTest::createImage(int width, int height)
+{
+	QImage image(width, height, QImage::Format_RGB32);
+	QPainter painter;
+
+	image.fill(Qt::white);
+	painter.begin(&image);
+	painter.setRenderHint(QPainter::Antialiasing, true);
+	painter.fillRect(QRect(10, 10, width / 2, height / 3), QColor(50, 120, 200));
+	painter.setPen(QPen(Qt::black, 3));
+	painter.drawEllipse(QRect(width / 3, height / 3, width / 2, height / 2));
+	painter.drawText(QPoint(15, height - 15), "pgModeler");
+	painter.end();
+
+	// A noisy region which can't be compressed as runs of the same byte
+	for(int y = height / 2; y < height; y++)
+	{
+		for(int x = width - 40; x < width; x++)
+			image.setPixel(x, y, qRgb((x * 7 + y * 13) % 256, (x * y) % 256, (x + y * 31) % 256));
+	}
+
+	return image;
+}
+
+void PngStreamWriterTest::writeAndCompare(const QImage &image, int band_height, int tile_width)
+{
+	QTemporaryDir tmp_dir;
+	QString filename = tmp_dir.filePath("image.png");
+	PngStreamWriter png_writer;
+	std::vector<QImage> tiles;
+	QImage read_img;
+
+	png_writer.open(filename, image.width(), image.height());
+
+	for(int y = 0; y < image.height(); y += band_height)
+	{
+		int height = std::min(band_height, image.height() - y);
+
+		tiles.clear();
+
+		for(int x = 0; x < image.width(); x += tile_width)
+			tiles.push_back(image.copy(x, y, std::min(tile_width, image.width() - x), height));
+
+		png_writer.writeRows(tiles);
+	}
+
+	QCOMPARE(png_writer.getRowsWritten(), static_cast<unsigned>(image.height()));
+	png_writer.close();
+
+	QVERIFY(read_img.load(filename, "PNG"));
+	QCOMPARE(read_img.size(), image.size());
+	QCOMPARE(read_img.convertToFormat(QImage::Format_RGB888), image.convertToFormat(QImage::Format_RGB888));
+}
+
+void PngStreamWriterTest::testRoundTripSingleTile()
+{
+	try
+	{
+		writeAndCompare(createImage(200, 150), 150, 200);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void PngStreamWriterTest::testRoundTripMultipleTilesAndBands()
+{
+	try
+	{
+		// Bands and tiles which don't divide the image evenly
+		writeAndCompare(createImage(1000, 700), 64, 300);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void PngStreamWriterTest::testRemoveIncompleteImage()
+{
+	QTemporaryDir tmp_dir;
+	QString filename = tmp_dir.filePath("incomplete.png");
+	PngStreamWriter png_writer;
+
+	try
+	{
+		png_writer.open(filename, 100, 100);
+		png_writer.writeRows(createImage(100, 50));
+		png_writer.close();
+		QFAIL("Expected exception not thrown!");
+	}
+	catch(Exception &)
+	{
+		QVERIFY(!QFileInfo::exists(filename));
+	}
+}
+
+void PngStreamWriterTest::testRaiseExceptionOnInvalidBand()
+{
+	QTemporaryDir tmp_dir;
+	PngStreamWriter png_writer;
+
+	try
+	{
+		png_writer.open(tmp_dir.filePath("invalid.png"), 100, 100);
+		png_writer.writeRows(createImage(90, 50));
+		QFAIL("Expected exception not thrown!");
+	}
+	catch(Exception &)
+	{
+		png_writer.discard();
+		QVERIFY(!png_writer.isOpen());
+	}
+}
+
+QTEST_MAIN(PngStreamWriterTest)
+#include "pngstreamwritertest.moc"
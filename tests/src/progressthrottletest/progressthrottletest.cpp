@@ -0,0 +1,119 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+#include <QtTest/QtTest>
+#include "progressthrottle.h"
+#include <QThreadPool>
+
+class ProgressThrottleTest: public QObject {
+	private:
+		Q_OBJECT
+
+	private slots:
+		void grantsFirstReportRightAway();
+		void suppressesReportsWithinInterval();
+		void grantsReportsAfterInterval();
+		void alwaysGrantsFinalReport();
+		void grantsAllReportsWithZeroInterval();
+		void grantsOneReportPerIntervalAcrossThreads();
+};
+
+void ProgressThrottleTest::grantsFirstReportRightAway()
+{
+	ProgressThrottle throttle(10000);
+
+	QVERIFY(throttle.isReportDue(0));
+	QCOMPARE(throttle.getSuppressedCount(), 0u);
+}
+
+void ProgressThrottleTest::suppressesReportsWithinInterval()
+{
+	ProgressThrottle throttle(10000);
+
+	QVERIFY(throttle.isReportDue(1));
+
+	for(int i = 2; i < 99; i++)
+		QVERIFY(!throttle.isReportDue(i));
+
+	QCOMPARE(throttle.getSuppressedCount(), 97u);
+
+	throttle.reset();
+	QCOMPARE(throttle.getSuppressedCount(), 0u);
+	QVERIFY(throttle.isReportDue(1));
+}
+
+void ProgressThrottleTest::grantsReportsAfterInterval()
+{
+	ProgressThrottle throttle(20);
+
+	QVERIFY(throttle.isReportDue(10));
+	QVERIFY(!throttle.isReportDue(11));
+
+	QThread::msleep(30);
+	QVERIFY(throttle.isReportDue(12));
+	QVERIFY(!throttle.isReportDue(13));
+}
+
+void ProgressThrottleTest::alwaysGrantsFinalReport()
+{
+	ProgressThrottle throttle(10000);
+
+	QVERIFY(throttle.isReportDue(50));
+	QVERIFY(!throttle.isReportDue(99));
+	QVERIFY(throttle.isReportDue(100));
+	QVERIFY(throttle.isReportDue(100));
+}
+
+void ProgressThrottleTest::grantsAllReportsWithZeroInterval()
+{
+	ProgressThrottle throttle(0);
+
+	for(int i = 0; i < 100; i++)
+		QVERIFY(throttle.isReportDue(i));
+
+	QCOMPARE(throttle.getSuppressedCount(), 0u);
+}
+
+void ProgressThrottleTest::grantsOneReportPerIntervalAcrossThreads()
+{
+	ProgressThrottle throttle(10000);
+	std::atomic<unsigned> granted(0);
+	QThreadPool pool;
+
+	pool.setMaxThreadCount(4);
+
+	for(int thread = 0; thread < 4; thread++)
+	{
+		pool.start([&throttle, &granted](){
+			for(int i = 0; i < 1000; i++)
+			{
+				if(throttle.isReportDue(50))
+					granted++;
+			}
+		});
+	}
+
+	pool.waitForDone();
+
+	QCOMPARE(granted.load(), 1u);
+	QCOMPARE(throttle.getSuppressedCount(), 3999u);
+}
+
+QTEST_MAIN(ProgressThrottleTest)
+#include "progressthrottletest.moc"
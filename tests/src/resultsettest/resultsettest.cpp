@@ -0,0 +1,121 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+#include <QtTest/QtTest>
+#include "resultset.h"
+
+//! \brief Exposes the protected constructor so results built in memory (without a server) can be used
+class MemoryResultSet: public ResultSet {
+	public:
+		MemoryResultSet(PGresult *sql_result) : ResultSet(sql_result) {}
+};
+
+class ResultSetTest: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Creates a result with the columns oid, name_bool and name filled with the provided rows
+		PGresult *createResult(const std::vector<QStringList> &rows);
+
+	private slots:
+		void resolvesColumnIndexesOnce();
+		void accessesValuesWithoutCopies();
+		void accessesValuesColumnWise();
+		void raisesErrorOnInvalidColumns();
+};
+
+PGresult *ResultSetTest::createResult(const std::vector<QStringList> &rows)
+{
+	PGresult *res = PQmakeEmptyPGresult(nullptr, PGRES_TUPLES_OK);
+	QByteArrayList col_names = { "oid", "name_bool", "name" };
+	PGresAttDesc attrs[3];
+
+	for(int col = 0; col < 3; col++)
+	{
+		memset(&attrs[col], 0, sizeof(PGresAttDesc));
+		attrs[col].name = col_names[col].data();
+		attrs[col].typlen = -1;
+	}
+
+	PQsetResultAttrs(res, 3, attrs);
+
+	for(int row = 0; row < static_cast<int>(rows.size()); row++)
+	{
+		for(int col = 0; col < 3; col++)
+		{
+			QByteArray value = rows[row][col].toUtf8();
+			PQsetvalue(res, row, col, value.data(), value.size());
+		}
+	}
+
+	return res;
+}
+
+void ResultSetTest::resolvesColumnIndexesOnce()
+{
+	MemoryResultSet res(createResult({{ "16384", "t", "customer" }}));
+	std::vector<int> col_idxs = res.getColumnIndexes({ "name", "oid" });
+
+	QCOMPARE(res.getColumnNames(), QStringList({ "oid", "name_bool", "name" }));
+	QCOMPARE(col_idxs.size(), 2u);
+	QCOMPARE(col_idxs[0], 2);
+	QCOMPARE(col_idxs[1], 0);
+}
+
+void ResultSetTest::accessesValuesWithoutCopies()
+{
+	MemoryResultSet res(createResult({{ "16384", "t", "customer" }, { "16390", "f", "ação" }}));
+
+	QVERIFY(res.accessTuple(ResultSet::FirstTuple));
+	QCOMPARE(res.getColumnLatin1(0), QLatin1String("16384"));
+	QCOMPARE(res.getColumnView(2).toByteArray(), QByteArray("customer"));
+
+	QVERIFY(res.accessTuple(ResultSet::NextTuple));
+	QCOMPARE(res.getColumnString(2), QString("ação"));
+	QCOMPARE(res.getColumnLatin1(1), QLatin1String("f"));
+
+	// The tuple values returned as map must be the same as the ones retrieved individually
+	attribs_map tuple = res.getTupleValues();
+	QCOMPARE(tuple["oid"], QString("16390"));
+	QCOMPARE(tuple["name"], QString("ação"));
+}
+
+void ResultSetTest::accessesValuesColumnWise()
+{
+	MemoryResultSet res(createResult({{ "1", "t", "a" }, { "2", "f", "b" }, { "3", "t", "c" }}));
+	std::vector<QByteArrayView> values = res.getColumnViews(res.getColumnIndex("name"));
+
+	QCOMPARE(values.size(), 3u);
+	QCOMPARE(values[0].toByteArray(), QByteArray("a"));
+	QCOMPARE(values[2].toByteArray(), QByteArray("c"));
+}
+
+void ResultSetTest::raisesErrorOnInvalidColumns()
+{
+	MemoryResultSet res(createResult({{ "1", "t", "a" }}));
+
+	QVERIFY_EXCEPTION_THROWN(res.getColumnIndexes({ "oid", "schema" }), Exception);
+	QVERIFY_EXCEPTION_THROWN(res.getColumnViews(3), Exception);
+
+	// Accessing values without positioning the cursor in a tuple is an error
+	QVERIFY_EXCEPTION_THROWN(res.getColumnView(0), Exception);
+}
+
+QTEST_MAIN(ResultSetTest)
+#include "resultsettest.moc"
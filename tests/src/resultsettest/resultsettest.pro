@@ -0,0 +1,6 @@
+include(../../tests.pri)
+
+# The results are built in memory using libpq functions
+LIBS += $$PGSQL_LIB
+
+SOURCES += resultsettest.cpp
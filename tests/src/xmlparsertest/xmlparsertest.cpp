@@ -18,15 +18,35 @@
 
 #include <QtTest/QtTest>
 #include "xmlparser.h"
+#include "pgmodelerunittest.h"
 
-class XmlParserTest: public QObject {
+class XmlParserTest: public QObject, public PgModelerUnitTest {
 	private:
 		Q_OBJECT
 
+		QString getDTDFile();
+
+	public:
+		XmlParserTest() : PgModelerUnitTest(SCHEMASDIR) {}
+
 	private slots:
 		void correctlyConvertJsonValsToXmlEntites();
+		void validatesBuffersAgainstCachedDTD();
+		void raisesErrorOnRootNotMatchingDTDName();
+		void loadsFilesWithAndWithoutDTDDeclaration();
+		void readsFileElementsInStreamingMode();
+		void raisesErrorOnInvalidStreamElement();
+		void readsStreamElementsFromSnapshot();
+		void keepsBigLineNumbersInSnapshot();
 };
 
+QString XmlParserTest::getDTDFile()
+{
+	return GlobalAttributes::getSchemasRootPath() + GlobalAttributes::DirSeparator +
+				 GlobalAttributes::XMLSchemaDir + GlobalAttributes::DirSeparator +
+				 "dtd" + GlobalAttributes::DirSeparator + "dbmodel.dtd";
+}
+
 void XmlParserTest::correctlyConvertJsonValsToXmlEntites()
 {
 	QString value = "value=\"'{\"attr\": { \"\" }}'::json\"		value-abc=\"true\"     value-cde=\"'{\"sign_aspect\": { \"message_no\": 0, \"message_multi\": \"\" }}'::json\"\n",
@@ -44,5 +64,307 @@ void XmlParserTest::correctlyConvertJsonValsToXmlEntites()
 	}
 }
 
+void XmlParserTest::validatesBuffersAgainstCachedDTD()
+{
+	XmlParser parser1, parser2;
+	QString valid_xml = "<schema name=\"public\" rect-visible=\"true\" fill-color=\"#e1e1e1\" sql-disabled=\"true\"/>",
+			invalid_xml = "<schema name=\"public\"><foo/></schema>";
+	attribs_map attribs;
+
+	try
+	{
+		// Both parsers share the same DTD which is parsed only once
+		parser1.setDTDFile(getDTDFile(), "schema");
+		parser1.loadXMLBuffer(valid_xml);
+		parser1.getElementAttributes(attribs);
+		QCOMPARE(attribs["name"], QString("public"));
+
+		parser2.setDTDFile(getDTDFile(), "schema");
+		parser2.loadXMLBuffer(QString("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n") + valid_xml);
+		QCOMPARE(parser2.getElementName(), QString("schema"));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+
+	try
+	{
+		parser1.restartParser();
+		parser1.setDTDFile(getDTDFile(), "schema");
+		parser1.loadXMLBuffer(invalid_xml);
+		QFAIL("An invalid buffer was accepted by the parser!");
+	}
+	catch(Exception &e)
+	{
+		QVERIFY(e.getErrorCode() == ErrorCode::LibXMLError);
+	}
+}
+
+void XmlParserTest::raisesErrorOnRootNotMatchingDTDName()
+{
+	XmlParser parser;
+
+	try
+	{
+		parser.setDTDFile(getDTDFile(), "table");
+		parser.loadXMLBuffer("<schema name=\"public\"/>");
+		QFAIL("A buffer with a root element different from the DTD name was accepted by the parser!");
+	}
+	catch(Exception &e)
+	{
+		QVERIFY(e.getErrorCode() == ErrorCode::LibXMLError);
+	}
+}
+
+void XmlParserTest::loadsFilesWithAndWithoutDTDDeclaration()
+{
+	XmlParser parser;
+	QTemporaryFile plain_file, dtd_file, bom_file;
+	QByteArray xml = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<!-- comment -->\n<schema name=\"public\"/>\n";
+
+	try
+	{
+		QVERIFY(plain_file.open() && dtd_file.open() && bom_file.open());
+
+		plain_file.write(xml);
+		plain_file.close();
+
+		// The external DTD declared in the file must be ignored in favor of the one set in the parser
+		dtd_file.write(QByteArray(xml).insert(xml.indexOf("<schema"), "<!DOCTYPE schema SYSTEM \"invalid.dtd\">\n"));
+		dtd_file.close();
+
+		// The DTD declaration must also be detected when the file starts with an UTF-8 byte order mark
+		bom_file.write(QByteArray("\xEF\xBB\xBF") + QByteArray(xml).insert(xml.indexOf("<schema"), "<!DOCTYPE schema SYSTEM \"invalid.dtd\">\n"));
+		bom_file.close();
+
+		parser.setDTDFile(getDTDFile(), "schema");
+		parser.loadXMLFile(plain_file.fileName());
+		QCOMPARE(parser.getElementName(), QString("schema"));
+		QVERIFY(parser.getXMLBuffer().contains("<schema name=\"public\"/>"));
+
+		parser.restartParser();
+		parser.setDTDFile(getDTDFile(), "schema");
+		parser.loadXMLFile(dtd_file.fileName());
+		QCOMPARE(parser.getElementName(), QString("schema"));
+		QVERIFY(!parser.getXMLBuffer().contains("<!DOCTYPE"));
+
+		parser.restartParser();
+		parser.setDTDFile(getDTDFile(), "schema");
+		parser.loadXMLFile(bom_file.fileName());
+		QCOMPARE(parser.getElementName(), QString("schema"));
+		QVERIFY(!parser.getXMLBuffer().contains("<!DOCTYPE"));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void XmlParserTest::readsFileElementsInStreamingMode()
+{
+	XmlParser parser;
+	QTemporaryFile file;
+	QStringList elem_names;
+	attribs_map attribs;
+
+	try
+	{
+		QVERIFY(file.open());
+		file.write("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+							 "<dbmodel author=\"test\">\n"
+							 "<!-- comment -->\n"
+							 "<role name=\"foo\"/>\n"
+							 "<schema name=\"bar\"><comment><![CDATA[test]]></comment></schema>\n"
+							 "<tag name=\"baz\"/>\n"
+							 "</dbmodel>\n");
+		file.close();
+
+		parser.setDTDFile(getDTDFile(), "dbmodel");
+		parser.openXMLStream(file.fileName());
+		QVERIFY(parser.isStreamOpen());
+
+		parser.getElementAttributes(attribs);
+		QCOMPARE(parser.getElementName(), QString("dbmodel"));
+		QCOMPARE(attribs["author"], QString("test"));
+
+		while(parser.readNextStreamElement())
+		{
+			elem_names.append(parser.getElementName());
+
+			// The subtree of the element read must be available for navigation
+			if(parser.getElementName() == "schema")
+			{
+				parser.savePosition();
+				QVERIFY(parser.accessElement(XmlParser::ChildElement));
+				QCOMPARE(parser.getElementName(), QString("comment"));
+				parser.restorePosition();
+			}
+		}
+
+		QCOMPARE(elem_names, QStringList({ "role", "schema", "tag" }));
+		QCOMPARE(parser.getStreamProgress(), 100);
+
+		parser.restartParser();
+		QVERIFY(!parser.isStreamOpen());
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void XmlParserTest::raisesErrorOnInvalidStreamElement()
+{
+	XmlParser parser;
+	QTemporaryFile file;
+	unsigned read_count = 0;
+
+	try
+	{
+		QVERIFY(file.open());
+		file.write("<dbmodel>\n<role name=\"foo\"/>\n<schema><foo/></schema>\n</dbmodel>\n");
+		file.close();
+
+		parser.setDTDFile(getDTDFile(), "dbmodel");
+		parser.openXMLStream(file.fileName());
+
+		while(parser.readNextStreamElement())
+			read_count++;
+
+		QFAIL("An invalid element was accepted by the parser!");
+	}
+	catch(Exception &e)
+	{
+		// The first element is valid and must be read before the error is raised
+		QVERIFY(read_count == 1);
+		QVERIFY(e.getErrorCode() == ErrorCode::LibXMLError);
+	}
+}
+
+void XmlParserTest::readsStreamElementsFromSnapshot()
+{
+	XmlParser parser;
+	QTemporaryFile file;
+	QTemporaryDir snp_dir;
+	QString snp_file = snp_dir.filePath("test.snapshot");
+	QStringList xml_elems, snp_elems;
+	attribs_map attribs;
+	int key_count = 0;
+
+	// Counts how many times the key of the snapshot is computed
+	auto get_key = [&key_count](){
+		key_count++;
+		return QByteArray("key");
+	};
+
+	auto read_elements = [&parser](QStringList &elems) {
+		attribs_map attribs;
+
+		while(parser.readNextStreamElement())
+		{
+			parser.getElementAttributes(attribs);
+			elems.append(parser.getElementName() + ":" + attribs["name"]);
+
+			if(parser.accessElement(XmlParser::ChildElement))
+			{
+				parser.accessElement(XmlParser::ChildElement);
+				elems.append(parser.getElementContent());
+			}
+		}
+	};
+
+	try
+	{
+		QVERIFY(file.open() && snp_dir.isValid());
+		file.write("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+							 "<dbmodel author=\"test\">\n"
+							 "<role name=\"foo\"/>\n"
+							 "<schema name=\"bar\"><comment><![CDATA[<test> & \"comment\"]]></comment></schema>\n"
+							 "</dbmodel>\n");
+		file.close();
+
+		// The first reading generates the snapshot
+		parser.setDTDFile(getDTDFile(), "dbmodel");
+		parser.openXMLStream(file.fileName(), snp_file, "stamp", get_key);
+		QVERIFY(!parser.isSnapshotLoaded());
+		read_elements(xml_elems);
+		QVERIFY(QFileInfo::exists(snp_file));
+
+		// The second reading uses the snapshot and the key isn't computed since the stamp matches
+		key_count = 0;
+		parser.restartParser();
+		parser.setDTDFile(getDTDFile(), "dbmodel");
+		parser.openXMLStream(file.fileName(), snp_file, "stamp", get_key);
+		QVERIFY(parser.isSnapshotLoaded());
+		QCOMPARE(key_count, 0);
+
+		parser.getElementAttributes(attribs);
+		QCOMPARE(attribs["author"], QString("test"));
+
+		read_elements(snp_elems);
+		QCOMPARE(snp_elems, xml_elems);
+		QCOMPARE(snp_elems.last(), QString("<test> & \"comment\""));
+
+		// A snapshot with a different stamp is still used if the key matches and its stamp is updated
+		parser.restartParser();
+		parser.setDTDFile(getDTDFile(), "dbmodel");
+		parser.openXMLStream(file.fileName(), snp_file, "other", get_key);
+		QVERIFY(parser.isSnapshotLoaded());
+		QCOMPARE(key_count, 1);
+
+		parser.restartParser();
+		parser.setDTDFile(getDTDFile(), "dbmodel");
+		parser.openXMLStream(file.fileName(), snp_file, "other", get_key);
+		QVERIFY(parser.isSnapshotLoaded());
+		QCOMPARE(key_count, 1);
+
+		// A snapshot with a different stamp and key is ignored
+		parser.restartParser();
+		parser.setDTDFile(getDTDFile(), "dbmodel");
+		parser.openXMLStream(file.fileName(), snp_file, "stamp", [](){ return QByteArray("another key"); });
+		QVERIFY(!parser.isSnapshotLoaded());
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void XmlParserTest::keepsBigLineNumbersInSnapshot()
+{
+	XmlParser parser;
+	QTemporaryFile file;
+	QTemporaryDir snp_dir;
+	QString snp_file = snp_dir.filePath("test.snapshot");
+	auto get_key = [](){ return QByteArray("key"); };
+
+	try
+	{
+		// The schema element is placed at the line 70003, beyond the limit of the libxml2's node line attribute
+		QVERIFY(file.open() && snp_dir.isValid());
+		file.write("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<dbmodel>\n");
+		file.write(QByteArray(70000, '\n'));
+		file.write("<schema name=\"bar\"><comment>test</comment></schema>\n</dbmodel>\n");
+		file.close();
+
+		parser.setDTDFile(getDTDFile(), "dbmodel");
+		parser.openXMLStream(file.fileName(), snp_file, "stamp", get_key);
+		while(parser.readNextStreamElement());
+
+		parser.restartParser();
+		parser.setDTDFile(getDTDFile(), "dbmodel");
+		parser.openXMLStream(file.fileName(), snp_file, "stamp", get_key);
+		QVERIFY(parser.isSnapshotLoaded());
+		QVERIFY(parser.readNextStreamElement());
+		QCOMPARE(parser.getElementName(), QString("schema"));
+		QCOMPARE(parser.getCurrentBufferLine(), 70003);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
 QTEST_MAIN(XmlParserTest)
 #include "xmlparsertest.moc"
@@ -18,3 +18,13 @@ src/xmlparsertest \
 src/proceduretest \
 src/basefunctiontest \
 src/csvparsertest \
+src/modelvalidationhelpertest \
+src/operationlisttest \
+src/objectclonehelpertest \
+src/catalogcachetest \
+src/resultsettest \
+src/completionindextest \
+src/progressthrottletest \
+src/csvreadertest \
+src/pngstreamwritertest \
+benchmarks \